@@ -27,7 +27,10 @@ DEFAULT_FILES = [
     'src/state_map.cpp',
     'src/nucname.h',
     'src/nucname.cpp',
+    'src/nuclide_index.h',
+    'src/nuclide_index.cpp',
     'src/rxname.h',
+    'src/rxname_hash.cpp',
     'src/rxname.cpp',
     'src/_atomic_data.h',
     'src/_atomic_data.cpp',
@@ -48,6 +51,8 @@ DEFAULT_FILES = [
     'src/enrichment.cpp',
     'src/enrichment_symbolic.h',
     'src/enrichment_symbolic20.cpp',
+    'src/decay_chains.h',
+    'src/decay_chains.cpp',
     'src/_decay.h',
     'src/_decay.cpp',
     ]
@@ -887,7 +887,7 @@ def _rat_apprx_14(A, t, n_0):
                       2.2697838292311127097 + 8.4617379730402214019j])
 
     alpha = np.array([-.000071542880635890672853 + .00014361043349541300111j,
-                      .0094390253107361688779 - .01784791958483017511j,
+                      .0094390253107361688779 - .017184791958483017511j,
                       -.37636003878226968717 + .33518347029450104214j,
                       -23.498232091082701191 - 5.8083591297142074004j,
                       46.933274488831293047 + 45.643649768827760791j,
@@ -0,0 +1,36 @@
+"""This is a command line interface for writing a memory-mappable snapshot of
+the nuc_data.h5 decay and atomic tables.
+"""
+from __future__ import print_function
+import os
+import argparse
+from warnings import warn
+from pyne.utils import QAWarning
+
+from pyne import data
+from pyne.api import nuc_data
+
+warn(__name__ + " is not yet QA compliant.", QAWarning)
+
+
+def main(args=None):
+    """Writes a snapshot of nuc_data.h5 and checks that it can be read back."""
+    parser = argparse.ArgumentParser(description='Writes a flat, '
+                                     'memory-mappable snapshot of the tables '
+                                     'in nuc_data.h5.')
+    parser.add_argument('-o', dest='filename', default=None,
+                        help='path of the snapshot, defaults to nuc_data.h5 '
+                             'with a .snapshot extension.')
+    ns = parser.parse_args(args=args)
+    filename = ns.filename
+    if filename is None:
+        filename = os.path.splitext(nuc_data)[0] + '.snapshot'
+    print("writing snapshot of {0} to {1}".format(nuc_data, filename))
+    data.write_data_snapshot(filename)
+    data.load_data_snapshot(filename, True)
+    print("snapshot verified, {0} bytes".format(os.path.getsize(filename)))
+    return 0
+
+
+if __name__ == '__main__':
+    main()
@@ -22,6 +22,21 @@ cdef extern from "data.h" namespace "pyne":
    # hash map and initialization function
     map[std_string, std_string] data_checksums
 
+    # nuc_data snapshot functions
+    void write_data_snapshot(std_string) except +
+    void load_data_snapshot(std_string, bool) except +
+    bool data_snapshot_loaded() except +
+
+    # preloading
+    cdef struct data_load_stats:
+        std_string table
+        bool loaded
+        double seconds
+        size_t bytes
+    vector[std_string] data_table_names() except +
+    vector[data_load_stats] preload_data(vector[std_string], int) except +
+    data_load_stats data_load_info(std_string) except +
+
     # atomic_mass functions
     map[int, double] atomic_mass_map
     double atomic_mass(int) except +
@@ -34,6 +49,16 @@ cdef extern from "data.h" namespace "pyne":
     double simple_xs(int nuc, std_string rx_id, std_string energy) except +
     double simple_xs(std_string nuc, int rx_id, std_string energy) except +
     double simple_xs(std_string nuc, std_string rx_id, std_string energy) except +
+    enum simple_xs_group:
+        SIMPLE_XS_THERMAL
+        SIMPLE_XS_THERMAL_MAXWELL_AVE
+        SIMPLE_XS_RESONANCE_INTEGRAL
+        SIMPLE_XS_FOURTEEN_MEV
+        SIMPLE_XS_FISSION_SPECTRUM_AVE
+        SIMPLE_XS_NGROUPS
+    simple_xs_group simple_xs_group_id(std_string energy) except +
+    void simple_xs(int * nucs, size_t n, int rx_id, simple_xs_group group,
+                   double * out) except +
 
     # natural_abund functions
     map[int, double] natural_abund_map
@@ -103,6 +128,16 @@ cdef extern from "data.h" namespace "pyne":
     double fpyield(int, int, int, bool) except +
     double fpyield(char *, char *, int, bool) except +
     double fpyield(std_string, std_string, int, bool) except +
+    cdef struct fpyield_csr:
+        vector[int] parents
+        vector[size_t] indptr
+        vector[int] children
+        vector[double] values
+        vector[int] products
+        vector[size_t] product_indptr
+        vector[int] product_parents
+        vector[size_t] entry_of
+    fpyield_csr fpyield_matrix(int, bool) except +
 
     # atomic data functions
     vector[pair[double, double]] calculate_xray_data(int, double,
@@ -8,6 +8,7 @@ from libcpp.utility cimport pair
 from libcpp cimport bool
 
 cimport cpp_jsoncpp
+from cpp_nuclide_index cimport NuclideIndex
 
 cdef extern from "material.h" namespace "pyne":
     # Cython does not allow for typdef'ing tamplated types :(
@@ -105,12 +106,18 @@ cdef extern from "material.h" namespace "pyne":
 
         map[int, double] to_atom_dens() except +
 
+        # Dense composition member functions
+        vector[double] to_dense(NuclideIndex&) except +
+        void from_dense(NuclideIndex&, vector[double]) except +
+        vector[double] to_atom_frac(NuclideIndex&) except +
+        void from_atom_frac(NuclideIndex&, vector[double]) except +
 
         vector[pair[double, double]] gammas() except +
         vector[pair[double, double]] xrays() except +
         vector[pair[double, double]] photons(bool) except +
 
         Material decay(double) except +
+        vector[Material] decay(vector[double]) except +
         Material cram(vector[double]) except +
         Material cram(vector[double], int) except +
 
@@ -119,3 +126,6 @@ cdef extern from "material.h" namespace "pyne":
         Material operator+(Material) except +
         Material operator*(double) except +
         Material operator/(double) except +
+
+    vector[Material] decay_many(vector[Material], double, int) except +
+    vector[Material] decay_many(vector[Material], vector[double], int) except +
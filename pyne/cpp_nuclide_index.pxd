@@ -0,0 +1,20 @@
+"""C++ wrapper for the dense nuclide index."""
+from libcpp.map cimport map
+from libcpp.vector cimport vector
+from libcpp cimport bool
+
+cdef extern from "nuclide_index.h" namespace "pyne":
+    cdef cppclass NuclideIndex:
+        NuclideIndex() except +
+        NuclideIndex(vector[int]) except +
+        NuclideIndex(int *, int) except +
+
+        int size()
+        vector[int] nucs()
+        int nuc(int)
+        int index(int)
+        bool contains(int)
+
+        vector[int] map_to(NuclideIndex&) except +
+        vector[double] to_dense(map[int, double]) except +
+        map[int, double] to_map(double *, bool) except +
@@ -8,6 +8,7 @@ cdef extern from "nucname.h" namespace "pyne::nucname":
     map[std_string, int] name_zz
     map[int, std_string] zz_name
     map[int, int] state_id_map
+    void * _fill_maps() except +
 
     # Elemental string sets
     set[std_string] LAN
@@ -37,6 +38,7 @@ cdef extern from "nucname.h" namespace "pyne::nucname":
     int id(int) except +
     int id(char *) except +
     int id(std_string) except +
+    int _id_general(std_string) except +
 
     # name Functions
     std_string name(int) except +
@@ -152,3 +154,17 @@ cdef extern from "nucname.h" namespace "pyne::nucname":
 
     # ENSDF id Functions
     int ensdf_to_id(char *) except +
+
+    # Bulk Conversion Functions
+    void id_array(int *, size_t, int *) except +
+    void id_array(std_string *, size_t, int *) except +
+    void name_array(int *, size_t, std_string *) except +
+    void zzaaam_array(int *, size_t, int *) except +
+    void zzzaaa_array(int *, size_t, int *) except +
+    void mcnp_array(int *, size_t, int *) except +
+    void cinder_array(int *, size_t, int *) except +
+    void state_id_to_id_array(int *, size_t, int *) except +
+    void id_to_state_id_array(int *, size_t, int *) except +
+    void serpent_array(int *, size_t, std_string *) except +
+    void openmc_array(int *, size_t, std_string *) except +
+    void fluka_array(int *, size_t, std_string *) except +
@@ -3,7 +3,9 @@ from libcpp.map cimport map
 from libcpp.set cimport set
 from libc.string cimport const_char
 from libcpp.string cimport string as std_string
+from libcpp.vector cimport vector
 cimport extra_types
+from cpp_nuclide_index cimport NuclideIndex
 
 cdef extern from "rxname.h" namespace "pyne::rxname":
     # names sets
@@ -18,6 +20,8 @@ cdef extern from "rxname.h" namespace "pyne::rxname":
     map[extra_types.uint32, std_string] labels
     map[extra_types.uint32, std_string] docs
 
+    void * _fill_maps() except +
+
     extra_types.uint32 hash(std_string) except +
     extra_types.uint32 hash(const_char *) except +
 
@@ -95,3 +99,22 @@ cdef extern from "rxname.h" namespace "pyne::rxname":
     int parent(int, std_string, std_string) except +
     int parent(std_string, int, std_string) except +
     int parent(std_string, std_string, std_string) except + 
+
+    enum particle:
+        PARTICLE_N
+        PARTICLE_P
+        PARTICLE_D
+        PARTICLE_T
+        PARTICLE_HE3
+        PARTICLE_A
+        PARTICLE_GAMMA
+        PARTICLE_DECAY
+        PARTICLE_NTYPES
+    particle particle_id(std_string) except +
+
+    cdef struct rx_triplets:
+        vector[int] parents
+        vector[extra_types.uint32] rxs
+        vector[int] children
+    rx_triplets child_triplets(NuclideIndex&, extra_types.uint32 *, size_t,
+                               particle) except +
@@ -7,4 +7,27 @@ cdef extern from "transmuters.h" namespace "pyne::transmuters":
 
     map[int, double] cram(vector[double], const map[int, double]) except +ValueError
     map[int, double] cram(vector[double], const map[int, double], const int) except +ValueError
+    void cram_inplace(vector[double], double *) except +ValueError
+    void cram_inplace(vector[double], double *, const int) except +ValueError
+    void cram_batch(vector[double], double *, double *, int) except +ValueError
+    void cram_batch(vector[double], double *, double *, int, const int) except +ValueError
+    void cram_many(vector[vector[double]], vector[vector[double]], vector[vector[double]]&, const int, int) except +ValueError
+    void cram_many(vector[double], vector[vector[double]], vector[vector[double]]&, const int, int) except +ValueError
+    vector[vector[double]] cram_times(vector[double], vector[double], vector[double], const int) except +ValueError
 
+    double cram_adaptive_tol()
+    void set_cram_adaptive_tol(double) except +ValueError
+    int cram_adaptive_order(double)
+    cdef struct cram_order_stats:
+        int order
+        long calls
+        long escalations
+        double seconds
+    vector[cram_order_stats] cram_adaptive_stats() except +
+    void reset_cram_adaptive_stats() except +
+
+    cdef cppclass TransmutationBuilder:
+        TransmutationBuilder(vector[int], vector[int], int) except +ValueError
+        int nchannels()
+        int ngroups()
+        void assemble(double *, double *, double, double *)
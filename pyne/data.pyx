@@ -10,6 +10,7 @@ from libcpp.map cimport map as cpp_map
 from libcpp.set cimport set as cpp_set
 from libcpp.string cimport string as std_string
 from libcpp.utility cimport pair as cpp_pair
+from libcpp.vector cimport vector as cpp_vector
 #from cython cimport pointer
 
 #Standard lib import
@@ -29,6 +30,7 @@ import pyne.pyne_config
 cimport pyne.cpp_nucname
 cimport pyne.nucname
 import pyne.nucname
+import pyne.rxname
 
 cimport cpp_data
 cimport pyne.stlcontainers as conv
@@ -72,6 +74,92 @@ data_checksums_proxy.map_ptr = &cpp_data.data_checksums
 data_checksums = data_checksums_proxy
 
 
+#
+# nuc_data snapshot functions
+#
+def write_data_snapshot(path):
+    """Writes the atomic mass, Q value, atomic and decay tables from
+    nuc_data.h5 to a flat binary snapshot file.
+
+    Parameters
+    ----------
+    path : str
+        Path of the snapshot file to write.
+    """
+    path_bytes = path.encode()
+    cpp_data.write_data_snapshot(std_string(<char *> path_bytes))
+
+
+def load_data_snapshot(path, verify=True):
+    """Uses a snapshot written by write_data_snapshot() as the source of the
+    tables it holds.  The file is memory-mapped, so processes on the same node
+    share its pages.  This must be called before those tables are first used.
+    Snapshots written from a nuc_data.h5 with a different size or modification
+    time than the current one are rejected as stale.
+
+    Parameters
+    ----------
+    path : str
+        Path of the snapshot file.
+    verify : bool, optional
+        Whether to check the payload checksum when the file is opened.
+    """
+    path_bytes = path.encode()
+    cpp_data.load_data_snapshot(std_string(<char *> path_bytes), verify)
+
+
+def data_snapshot_loaded():
+    """True if a nuc_data snapshot has been loaded."""
+    return cpp_data.data_snapshot_loaded()
+
+
+#
+# preloading functions
+#
+cdef _data_load_stats_dict(cpp_data.data_load_stats s):
+    return {'table': s.table.decode(), 'loaded': s.loaded,
+            'seconds': s.seconds, 'bytes': s.bytes}
+
+
+def data_table_names():
+    """The names of the nuclear data tables that preload_data() accepts."""
+    return [name.decode() for name in cpp_data.data_table_names()]
+
+
+def preload_data(tables, nthreads=0):
+    """Loads nuclear data tables up front rather than on first access.  The
+    tables are loaded concurrently on a pool of threads.
+
+    Parameters
+    ----------
+    tables : sequence of str
+        Names of the tables to load, see data_table_names().
+    nthreads : int, optional
+        Number of threads; by default one per table, up to the number of
+        cores.
+
+    Returns
+    -------
+    stats : list of dict
+        For each table, its name, whether it is loaded, the seconds spent
+        loading it and the approximate memory it holds in bytes.
+    """
+    cdef cpp_vector[std_string] cpp_tables
+    for table in tables:
+        table_bytes = table.encode()
+        cpp_tables.push_back(std_string(<char *> table_bytes))
+    return [_data_load_stats_dict(s) for s in
+            cpp_data.preload_data(cpp_tables, nthreads)]
+
+
+def data_load_info(table):
+    """The load stats of a nuclear data table, as returned by preload_data().
+    """
+    table_bytes = table.encode()
+    return _data_load_stats_dict(cpp_data.data_load_info(
+        std_string(<char *> table_bytes)))
+
+
 #
 # atomic_mass functions
 #
@@ -289,6 +377,39 @@ def simple_xs(nuc, rx, energy):
     return xs
 
 
+def simple_xs_array(nucs, rx, energy):
+    """Finds the cross sections for many nuclides and one reaction in [barns]
+    with a single call into the dense simple_xs table.
+
+    Parameters
+    ----------
+    nucs : sequence of ints or strs
+        Input nuclides.
+    rx : int or str
+        Input reaction.
+    energy : str
+        Energy group for reaction, as for simple_xs().
+
+    Returns
+    -------
+    xs : ndarray of doubles
+        cross section values [barns].  Nuclides without data are NaN.
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] nuc_ids = np.array(
+        [pyne.nucname.id(nuc) for nuc in nucs], dtype=np.int32)
+    cdef np.ndarray[np.float64_t, ndim=1] xs = np.empty(len(nuc_ids),
+                                                       dtype=np.float64)
+    if isinstance(rx, bytes):
+        rx = rx.decode("utf-8")
+    rx_id = pyne.rxname.id(rx)
+    energy_bytes = energy.encode()
+    group = cpp_data.simple_xs_group_id(std_string(<char *> energy_bytes))
+    if len(nuc_ids) > 0:
+        cpp_data.simple_xs(<int *> nuc_ids.data, len(nuc_ids), <int> rx_id,
+                           group, <double *> xs.data)
+    return xs
+
+
 #
 # Decay Factor data
 #
@@ -812,6 +933,44 @@ def fpyield(from_nuc, to_nuc, source=0, get_errors=False):
     fpy = cpp_data.fpyield(cpp_pair[int, int](fn, tn), <int> source, get_errors)
     return fpy
 
+
+def fpyield_matrix(source=0, get_errors=False):
+    """Returns the whole fission product yield table of a source as a sparse
+    matrix in compressed sparse row form.
+
+    Parameters
+    ----------
+    source : int or str
+        The source dataset, as for fpyield().
+    get_errors : boolean
+        return the errors in the yields rather than the yields, for the NDS
+        sources
+
+    Returns
+    -------
+    fpy : dict of ndarrays
+        'parents', 'indptr', 'children' and 'values' hold the rows: the
+        products of parents[i] are children[indptr[i]:indptr[i+1]], with
+        yields in values.  'products', 'product_indptr', 'product_parents'
+        and 'entry_of' index the parents of each product: the parents of
+        products[j] are product_parents[product_indptr[j]:product_indptr[j+1]]
+        and entry_of gives the matching positions in values.  Zero yields
+        are left out.
+    """
+    srcmap = {'WIMSD': 0, 'NDS_THERMAL': 1, 'NDS_FAST': 2, 'NDS_14MEV': 3}
+    if isinstance(source, str):
+        source = srcmap[source]
+    cdef cpp_data.fpyield_csr m = cpp_data.fpyield_matrix(<int> source,
+                                                          get_errors)
+    return {'parents': np.array(m.parents, dtype=np.int32),
+            'indptr': np.array(m.indptr, dtype=np.intp),
+            'children': np.array(m.children, dtype=np.int32),
+            'values': np.array(m.values, dtype=np.float64),
+            'products': np.array(m.products, dtype=np.int32),
+            'product_indptr': np.array(m.product_indptr, dtype=np.intp),
+            'product_parents': np.array(m.product_parents, dtype=np.int32),
+            'entry_of': np.array(m.entry_of, dtype=np.intp)}
+
 #
 # atomic data functions
 #
@@ -1246,6 +1246,59 @@ cdef class _Material:
         return comp_proxy
 
 
+    #
+    # Dense Composition Methods
+    #
+    def to_dense(self, nucname.NuclideIndex index):
+        """to_dense(index)
+        Returns the mass weights of the material in the order of index.
+        Nuclides that are not in the index are dropped.
+
+        Parameters
+        ----------
+        index : pyne.nucname.NuclideIndex
+            Nuclides giving the order of the entries.
+
+        Returns
+        -------
+        x : ndarray of float64
+            Mass weights, one per nuclide in index.
+
+        """
+        return np.array(self.mat_pointer.to_dense(deref(index._inst)),
+                        dtype=np.float64)
+
+
+    def from_dense(self, nucname.NuclideIndex index, x):
+        """from_dense(index, x)
+        Sets the composition of the material from the mass weights x, given in
+        the order of index, and normalizes it.
+
+        """
+        cdef cpp_vector[double] cpp_x = np.asarray(x, dtype=np.float64).ravel()
+        self.mat_pointer.from_dense(deref(index._inst), cpp_x)
+
+
+    def to_atom_frac_dense(self, nucname.NuclideIndex index):
+        """to_atom_frac_dense(index)
+        Returns the atom fractions of the material in the order of index, as
+        an ndarray of float64.
+
+        """
+        return np.array(self.mat_pointer.to_atom_frac(deref(index._inst)),
+                        dtype=np.float64)
+
+
+    def from_atom_frac_dense(self, nucname.NuclideIndex index, x):
+        """from_atom_frac_dense(index, x)
+        Sets the composition and atoms_per_molecule of the material from the
+        atom fractions x, given in the order of index.
+
+        """
+        cdef cpp_vector[double] cpp_x = np.asarray(x, dtype=np.float64).ravel()
+        self.mat_pointer.from_atom_frac(deref(index._inst), cpp_x)
+
+
     #
     # Radioactive Properties
     #
@@ -1301,6 +1354,22 @@ cdef class _Material:
         pymat.mat_pointer[0] = self.mat_pointer.decay(t)
         return pymat
 
+    def decay_times(self, times):
+        """decay_times(times)
+        Decays a material to each of the times, in seconds, with one pass
+        over the decay chains. Returns a list of new materials, one per time.
+        """
+        cdef cpp_vector[double] cpp_times = np.asarray(times, dtype=np.float64)
+        cdef cpp_vector[cpp_material.Material] cpp_mats = \
+            self.mat_pointer.decay(cpp_times)
+        cdef _Material pymat
+        mats = []
+        for i in range(cpp_mats.size()):
+            pymat = Material()
+            pymat.mat_pointer[0] = cpp_mats[i]
+            mats.append(pymat)
+        return mats
+
     def cram(self, A, int order=14):
         """Transmutes the material via the CRAM method.
 
@@ -1910,6 +1979,50 @@ def from_text(filename, double mass=-1.0, double atoms_per_molecule=-1.0, metada
     return mat
 
 
+
+def decay_many(mats, t, int nthreads=0):
+    """decay_many(mats, t, int nthreads=0)
+    Decays many materials in parallel.
+
+    Parameters
+    ----------
+    mats : sequence of Materials
+        The materials to decay.
+    t : float or sequence of floats
+        The decay time, or times, in seconds.
+    nthreads : int, optional
+        The number of threads, or 0 for one per core.
+
+    Returns
+    -------
+    decayed : list of Materials, or list of lists of Materials
+        The decayed materials, in the order of mats.  When t is a sequence,
+        each entry is the list of that material at each of the times.
+    """
+    cdef cpp_vector[cpp_material.Material] cpp_mats
+    cdef _Material pymat
+    for mat in mats:
+        pymat = mat
+        cpp_mats.push_back(pymat.mat_pointer[0])
+    cdef cpp_vector[double] cpp_times
+    cdef cpp_vector[cpp_material.Material] cpp_decayed
+    scalar = np.ndim(t) == 0
+    if scalar:
+        cpp_decayed = cpp_material.decay_many(cpp_mats, <double> t, nthreads)
+    else:
+        cpp_times = np.asarray(t, dtype=np.float64)
+        cpp_decayed = cpp_material.decay_many(cpp_mats, cpp_times, nthreads)
+    decayed = []
+    for i in range(cpp_decayed.size()):
+        pymat = Material()
+        pymat.mat_pointer[0] = cpp_decayed[i]
+        decayed.append(pymat)
+    if scalar:
+        return decayed
+    ntimes = cpp_times.size()
+    return [decayed[i:i+ntimes] for i in range(0, len(decayed), ntimes)]
+
+
 ###########################
 ### Material Converters ###
 ###########################
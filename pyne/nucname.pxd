@@ -16,6 +16,7 @@ cimport pyne.pyne_config
 import pyne.pyne_config
 
 cimport cpp_nucname
+cimport cpp_nuclide_index
 cimport pyne.stlcontainers as conv
 import pyne.stlcontainers as conv
 
@@ -31,3 +32,11 @@ import pyne.stlcontainers as conv
 cdef cpp_set[int] id_set(object nuc_sequence)
 cdef cpp_set[int] zzaaam_set(object nuc_sequence)
 cdef cpp_set[int] zzzaaa_set(object nuc_sequence)
+
+
+#
+# Dense nuclide index
+#
+
+cdef class NuclideIndex:
+    cdef cpp_nuclide_index.NuclideIndex * _inst
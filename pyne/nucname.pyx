@@ -8,9 +8,12 @@ from cython.operator cimport dereference as deref
 from cython.operator cimport preincrement as inc
 #from cython cimport pointer
 from libcpp.string cimport string as std_string
+from libcpp.vector cimport vector as cpp_vector
 
 # Python imports
 #from collections import Iterable
+cimport numpy as np
+import numpy as np
 
 # local imports
 cimport pyne.cpp_utils
@@ -18,6 +21,7 @@ cimport pyne.pyne_config
 import pyne.pyne_config
 
 from pyne cimport cpp_nucname
+from pyne cimport cpp_nuclide_index
 cimport pyne.stlcontainers as conv
 import pyne.stlcontainers as conv
 
@@ -25,6 +29,8 @@ import pyne.stlcontainers as conv
 # Conversion dictionaries
 #
 
+cpp_nucname._fill_maps()
+
 cdef conv._MapStrInt name_zz_proxy = conv.MapStrInt(False)
 name_zz_proxy.map_ptr = &cpp_nucname.name_zz
 name_zz = name_zz_proxy
@@ -196,6 +202,14 @@ def id(nuc):
     return newnuc
 
 
+def _id_general(nuc):
+    """The general string parser behind id().  This gives the same result as
+    id() for every string but is slower; it is kept visible for testing.
+    """
+    nuc_bytes = nuc.encode()
+    return cpp_nucname._id_general(std_string(<char *> nuc_bytes))
+
+
 def name(nuc):
     """Converts a nuclide to its name form ('Am242M'). The name() function
     first converts functions to id form using the id() function. Thus the
@@ -925,6 +939,366 @@ def ensdf_to_id(nuc):
         return cpp_nucname.ensdf_to_id(<char *> nuc_bytes)
     else:
         raise NucTypeError(nuc)
+
+#
+# Bulk Conversion Functions
+#
+
+def id_array(nucs):
+    """Converts a sequence of nuclides to id form in a single call.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides, in any form accepted by id().
+
+    Returns
+    -------
+    newnucs : ndarray of int32
+        Output nuclides in id form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids
+    cdef np.ndarray[np.int32_t, ndim=1] newnucs
+    cdef cpp_vector[std_string] strs
+    nucs = np.asarray(nucs).ravel()
+    newnucs = np.empty(len(nucs), dtype=np.int32)
+    if len(nucs) == 0:
+        return newnucs
+    if nucs.dtype.kind in 'iu':
+        ids = np.ascontiguousarray(nucs, dtype=np.int32)
+        cpp_nucname.id_array(<int *> ids.data, len(ids), <int *> newnucs.data)
+    elif nucs.dtype.kind in 'SUO':
+        for nuc in nucs:
+            if isinstance(nuc, bytes):
+                strs.push_back(std_string(<char *> nuc))
+            elif isinstance(nuc, basestring):
+                nuc_bytes = nuc.encode()
+                strs.push_back(std_string(<char *> nuc_bytes))
+            else:
+                raise NucTypeError(nuc)
+        cpp_nucname.id_array(&strs[0], strs.size(), <int *> newnucs.data)
+    else:
+        raise NucTypeError(nucs)
+    return newnucs
+
+
+cdef object _str_array(cpp_vector[std_string] & strs):
+    return np.array([s.decode() for s in strs], dtype='U')
+
+
+def name_array(nucs):
+    """Converts a sequence of nuclides to name form, as name() does for one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    newnucs : ndarray of str
+        Output nuclides in name form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef cpp_vector[std_string] newnucs = cpp_vector[std_string](len(ids))
+    if len(ids) > 0:
+        cpp_nucname.name_array(<int *> ids.data, len(ids), &newnucs[0])
+    return _str_array(newnucs)
+
+
+def zzaaam_array(nucs):
+    """Converts a sequence of nuclides to zzaaam form, as zzaaam() does for
+    one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    newnucs : ndarray of int32
+        Output nuclides in zzaaam form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef np.ndarray[np.int32_t, ndim=1] newnucs = np.empty_like(ids)
+    if len(ids) > 0:
+        cpp_nucname.zzaaam_array(<int *> ids.data, len(ids),
+                                 <int *> newnucs.data)
+    return newnucs
+
+
+def zzzaaa_array(nucs):
+    """Converts a sequence of nuclides to zzzaaa form, as zzzaaa() does for
+    one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    newnucs : ndarray of int32
+        Output nuclides in zzzaaa form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef np.ndarray[np.int32_t, ndim=1] newnucs = np.empty_like(ids)
+    if len(ids) > 0:
+        cpp_nucname.zzzaaa_array(<int *> ids.data, len(ids),
+                                 <int *> newnucs.data)
+    return newnucs
+
+
+def mcnp_array(nucs):
+    """Converts a sequence of nuclides to MCNP form, as mcnp() does for one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    newnucs : ndarray of int32
+        Output nuclides in MCNP form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef np.ndarray[np.int32_t, ndim=1] newnucs = np.empty_like(ids)
+    if len(ids) > 0:
+        cpp_nucname.mcnp_array(<int *> ids.data, len(ids),
+                               <int *> newnucs.data)
+    return newnucs
+
+
+def cinder_array(nucs):
+    """Converts a sequence of nuclides to CINDER form, as cinder() does for
+    one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    newnucs : ndarray of int32
+        Output nuclides in CINDER form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef np.ndarray[np.int32_t, ndim=1] newnucs = np.empty_like(ids)
+    if len(ids) > 0:
+        cpp_nucname.cinder_array(<int *> ids.data, len(ids),
+                                 <int *> newnucs.data)
+    return newnucs
+
+
+def state_id_to_id_array(states):
+    """Converts a sequence of decay state ids to id form, as state_id_to_id()
+    does for one.
+
+    Parameters
+    ----------
+    states : array_like of ints
+        Input state ids.
+
+    Returns
+    -------
+    newnucs : ndarray of int32
+        Output nuclides in id form, or -1 where there is no match.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = np.ascontiguousarray(
+        np.asarray(states, dtype=np.int32).ravel())
+    cdef np.ndarray[np.int32_t, ndim=1] newnucs = np.empty_like(ids)
+    if len(ids) > 0:
+        cpp_nucname.state_id_to_id_array(<int *> ids.data, len(ids),
+                                         <int *> newnucs.data)
+    return newnucs
+
+
+def id_to_state_id_array(nucs):
+    """Converts a sequence of nuclides to decay state ids, as id_to_state_id()
+    does for one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    states : ndarray of int32
+        Output state ids, or -1 where there is no match.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef np.ndarray[np.int32_t, ndim=1] states = np.empty_like(ids)
+    if len(ids) > 0:
+        cpp_nucname.id_to_state_id_array(<int *> ids.data, len(ids),
+                                         <int *> states.data)
+    return states
+
+
+def serpent_array(nucs):
+    """Converts a sequence of nuclides to Serpent form, as serpent() does for
+    one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    newnucs : ndarray of str
+        Output nuclides in Serpent form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef cpp_vector[std_string] newnucs = cpp_vector[std_string](len(ids))
+    if len(ids) > 0:
+        cpp_nucname.serpent_array(<int *> ids.data, len(ids), &newnucs[0])
+    return _str_array(newnucs)
+
+
+def openmc_array(nucs):
+    """Converts a sequence of nuclides to OpenMC form, as openmc() does for
+    one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    newnucs : ndarray of str
+        Output nuclides in OpenMC form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef cpp_vector[std_string] newnucs = cpp_vector[std_string](len(ids))
+    if len(ids) > 0:
+        cpp_nucname.openmc_array(<int *> ids.data, len(ids), &newnucs[0])
+    return _str_array(newnucs)
+
+
+def fluka_array(nucs):
+    """Converts a sequence of nuclides to FLUKA form, as fluka() does for one.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Input nuclides.
+
+    Returns
+    -------
+    newnucs : ndarray of str
+        Output nuclides in FLUKA form.
+
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] ids = id_array(nucs)
+    cdef cpp_vector[std_string] newnucs = cpp_vector[std_string](len(ids))
+    if len(ids) > 0:
+        cpp_nucname.fluka_array(<int *> ids.data, len(ids), &newnucs[0])
+    return _str_array(newnucs)
+
+
+#
+# Dense nuclide index
+#
+
+cdef int _index_key(object nuc) except? -1:
+    # ints are taken as already in id form, so that negative entries
+    # can be queried without going through id()
+    if isinstance(nuc, (int, long, np.integer)):
+        return nuc
+    return id(nuc)
+
+
+cdef class NuclideIndex:
+    """Assigns each nuclide of a fixed sequence a position in 0..N-1, so that
+    compositions can be passed around as plain arrays.
+
+    Parameters
+    ----------
+    nucs : array_like of ints or strs
+        Nuclides, in any form accepted by id().  Negative ints keep their
+        position but cannot be looked up.  Duplicates raise an error.
+
+    """
+
+    def __cinit__(self, nucs=()):
+        cdef cpp_vector[int] ids
+        nucs = np.asarray(nucs).ravel()
+        if len(nucs) == 0:
+            pass
+        elif nucs.dtype.kind in 'iu':
+            ids = [int(n) for n in nucs]
+        else:
+            ids = [int(n) for n in id_array(nucs)]
+        self._inst = new cpp_nuclide_index.NuclideIndex(ids)
+
+    def __dealloc__(self):
+        del self._inst
+
+    def __len__(self):
+        return self._inst.size()
+
+    def __contains__(self, nuc):
+        return self._inst.contains(_index_key(nuc))
+
+    property nucs:
+        """Nuclides in index order, as an ndarray of int32."""
+        def __get__(self):
+            return np.array(self._inst.nucs(), dtype=np.int32)
+
+    def nuc(self, int i):
+        """Returns the nuclide in id form at position i."""
+        if i < 0 or i >= self._inst.size():
+            raise IndexError(i)
+        return self._inst.nuc(i)
+
+    def index(self, nuc):
+        """Returns the position of nuc, or -1 if it is not in the index."""
+        return self._inst.index(_index_key(nuc))
+
+    def map_to(self, NuclideIndex other):
+        """For each nuclide in this index, returns its position in other, or -1,
+        as an ndarray of int32.
+        """
+        return np.array(self._inst.map_to(deref(other._inst)), dtype=np.int32)
+
+    def to_dense(self, comp):
+        """Scatters the mapping comp of nuclides to values into an ndarray in
+        index order.  Nuclides that are not in the index are dropped.
+        """
+        cdef map[int, double] cpp_comp
+        for nuc, val in comp.items():
+            cpp_comp[_index_key(nuc)] = val
+        return np.array(self._inst.to_dense(cpp_comp), dtype=np.float64)
+
+    def to_map(self, x, keep_zeros=False):
+        """Gathers the len(self) values of x into a dict keyed by nuclide,
+        skipping entries that are not greater than zero unless keep_zeros.
+        """
+        cdef np.ndarray[np.float64_t, ndim=1] xs = np.ascontiguousarray(
+            x, dtype=np.float64).ravel()
+        if len(xs) != self._inst.size():
+            raise ValueError("x must have {0} entries, not {1}".format(
+                self._inst.size(), len(xs)))
+        if len(xs) == 0:
+            return {}
+        return self._inst.to_map(<double *> xs.data, keep_zeros)
+
+
 #
 # C++ Helper Functions
 #
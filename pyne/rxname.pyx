@@ -110,15 +110,15 @@ following procedure will add a new reaction to the suite provided.
 1. Increment ``NUM_RX_NAMES`` in "rxname.h".
 2. Add the name to the ``_names`` array at the top of "rxname.cpp".
    Note the location in this array that the new name was added.
-3. In the ``_fill_maps()`` function in "rxname.cpp", add the MT number
-   to the ``_mts`` array at the same index the name was added in step 2.
-   If the reaction does not have a corresponding MT number, add a zero
-   (0) at this location instead.
-4. In the ``_fill_maps()`` function in "rxname.cpp", add a short label
-   to the ``_labels`` array at the same index the name was added in step
-   2.
-5. In the ``_fill_maps()`` function in "rxname.cpp", add a docstring to
-   the ``_docs`` array at the same index the name was added in step 2.
+3. Add the MT number to the ``_mts`` array in "rxname.cpp" at the same
+   index the name was added in step 2.  If the reaction does not have a
+   corresponding MT number, add a zero (0) at this location instead.
+4. Add a short label to the ``_labels`` array in "rxname.cpp" at the same
+   index the name was added in step 2.
+5. Add a docstring to the ``_docs`` array in "rxname.cpp" at the same
+   index the name was added in step 2.
+6. Run "rxnamegen.py" to regenerate the lookup tables in "rxname_hash.cpp".
+   rxname.cpp will not compile until these are up to date.
 
 Repeat this procedure as necessary.
 
@@ -145,6 +145,9 @@ from libcpp.string cimport string as std_string
 from warnings import warn
 from pyne.utils import QAWarning
 
+cimport numpy as np
+import numpy as np
+
 # local imports
 cimport extra_types
 cimport pyne.cpp_utils
@@ -153,12 +156,15 @@ import pyne.pyne_config
 cimport cpp_nucname
 cimport cpp_rxname
 cimport pyne.stlcontainers as conv
+import pyne.nucname
 import pyne.stlcontainers as conv
 
 
 
 warn(__name__ + " is not yet QA compliant.", QAWarning)
 
+cpp_rxname._fill_maps()
+
 # names
 cdef conv._SetStr names_proxy = conv.SetStr(False)
 names_proxy.set_ptr = &cpp_rxname.names
@@ -529,3 +535,43 @@ def parent(nuc, rx, z="n"):
         from_nuc = cpp_rxname.parent(<int> nuc, <extra_types.uint32> long(rx), ptype)
     return int(from_nuc)
 
+
+def child_triplets(nucs, rxs, z="n"):
+    """child_triplets(nucs, rxs, z="n")
+
+    Finds the children of many nuclides for many reactions in a single call,
+    as the sparsity pattern of a transmutation matrix.
+
+    Parameters
+    ----------
+    nucs : sequence of str or int
+        parent nuclides, which are also the candidate children.
+    rxs : sequence of str or int
+        reaction names or ids.
+    z : str, optional
+        incident particle type ("n", "p", ...).
+
+    Returns
+    -------
+    triplets : dict of ndarrays
+        reaction 'rxs'[i] takes nucs['parents'[i]] to nucs['children'[i]].
+        Children that are not in nucs are left out.
+    """
+    cdef np.ndarray[np.int32_t, ndim=1] nuc_ids = pyne.nucname.id_array(nucs)
+    cdef np.ndarray[np.uint32_t, ndim=1] rx_ids = np.array(
+        [id(rx) for rx in rxs], dtype=np.uint32)
+    z_bytes = z.encode() if isinstance(z, basestring) else z
+    cdef cpp_rxname.particle ptype = cpp_rxname.particle_id(
+        std_string(<char *> z_bytes))
+    cdef cpp_rxname.NuclideIndex * index = new cpp_rxname.NuclideIndex(
+        <int *> nuc_ids.data, len(nuc_ids))
+    cdef cpp_rxname.rx_triplets t
+    try:
+        t = cpp_rxname.child_triplets(deref(index),
+                                      <extra_types.uint32 *> rx_ids.data,
+                                      len(rx_ids), ptype)
+    finally:
+        del index
+    return {'parents': np.array(t.parents, dtype=np.int32),
+            'rxs': np.array(t.rxs, dtype=np.uint32),
+            'children': np.array(t.children, dtype=np.int32)}
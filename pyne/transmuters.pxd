@@ -0,0 +1,5 @@
+"""Python header for transmuters library."""
+cimport cpp_transmuters
+
+cdef class TransmutationBuilder:
+    cdef cpp_transmuters.TransmutationBuilder * _inst
@@ -8,6 +8,7 @@ cimport pyne.stlcontainers as conv
 import pyne.stlcontainers as conv
 from pyne cimport nucname
 from pyne import nucname
+from pyne import cram as cram_data
 
 # startup numpy
 cimport numpy as np
@@ -50,3 +51,254 @@ def cram(A, n0, int order=14):
     cdef conv._MapIntDouble n1 = conv.MapIntDouble()
     n1.map_ptr = new cpp_map[int, double](cpp_n1)
     return n1
+
+
+def cram_inplace(A, np.ndarray[np.float64_t, ndim=1, mode="c"] n, int order=14):
+    """Transmutes the dense composition n in place, with no conversion to
+    or from a mapping.
+
+    Parameters
+    ----------
+    A : 1D array-like
+        The transmutation matrix [unitless]
+    n : 1D contiguous float64 ndarray, length N
+        The composition with nuclides in pyne.cram.NUCS order, overwritten
+        with the result [atom fraction]
+    order : int, optional
+        The order of approximation, default 14.
+    """
+    cdef cpp_vector[double] cpp_A = np.asarray(A, dtype=np.float64)
+    if n.shape[0] != cram_data.N:
+        raise ValueError("n must have one entry per nuclide of pyne.cram.NUCS")
+    cpp_transmuters.cram_inplace(cpp_A, <double *> n.data, order)
+
+
+# order that makes the CRAM solvers choose the order of each solve
+ADAPTIVE_ORDER = 0
+
+
+def cram_adaptive_order(tol=None):
+    """Tolerance-to-order mapping that order=ADAPTIVE_ORDER starts from: the
+    lowest CRAM order whose uniform error on the negative real axis, about
+    9.28903**-k, is within tol.  That error does not shrink for short steps,
+    so the order depends on tol alone.  Each adaptive solve also solves at
+    the order below, estimates its error from the difference, and goes to
+    higher orders while the estimate is above the tolerance.
+
+    Parameters
+    ----------
+    tol : float, optional
+        The relative accuracy, by default the one that ADAPTIVE_ORDER aims
+        for, see set_cram_adaptive_tol().
+
+    Returns
+    -------
+    order : int
+        The order, 6 to 18.
+    """
+    if tol is None:
+        tol = cpp_transmuters.cram_adaptive_tol()
+    return cpp_transmuters.cram_adaptive_order(tol)
+
+
+def cram_adaptive_tol():
+    """The relative accuracy that order=ADAPTIVE_ORDER aims for."""
+    return cpp_transmuters.cram_adaptive_tol()
+
+
+def set_cram_adaptive_tol(double tol):
+    """Sets the relative accuracy that order=ADAPTIVE_ORDER aims for, which
+    defaults to 1e-10."""
+    cpp_transmuters.set_cram_adaptive_tol(tol)
+
+
+def cram_adaptive_stats():
+    """The totals of the order=ADAPTIVE_ORDER solves since the last reset.
+
+    Returns
+    -------
+    stats : list of dict
+        For each order from 6 to 18, the order, the number of solves that
+        ended at it, how many of those were stepped up to it by the error
+        estimate, and the seconds they took.
+    """
+    return [{'order': s.order, 'calls': s.calls,
+             'escalations': s.escalations, 'seconds': s.seconds}
+            for s in cpp_transmuters.cram_adaptive_stats()]
+
+
+def reset_cram_adaptive_stats():
+    """Clears the totals of cram_adaptive_stats()."""
+    cpp_transmuters.reset_cram_adaptive_stats()
+
+
+def cram_times(A, n0, times, int order=14):
+    """Transmutes one dense composition to each of several times with the
+    (flat) A matrix of a unit time step.  The times are visited in
+    increasing order, each step starting from the previous result.
+
+    Parameters
+    ----------
+    A : 1D array-like
+        The transmutation matrix for a unit time [unitless]
+    n0 : 1D array-like, length N
+        The initial composition with nuclides in pyne.cram.NUCS order
+        [atom fraction]
+    times : 1D array-like
+        The times, in the units of A, in any order.
+    order : int, optional
+        The order of approximation, default 14.
+
+    Returns
+    -------
+    N : ndarray, shape (len(times), N)
+        The composition at each time as rows [atom fraction]
+    """
+    cdef cpp_vector[double] cpp_A = np.asarray(A, dtype=np.float64)
+    cdef cpp_vector[double] cpp_n0 = np.asarray(n0, dtype=np.float64)
+    cdef cpp_vector[double] cpp_times = np.asarray(times, dtype=np.float64)
+    cdef cpp_vector[cpp_vector[double]] cpp_N = cpp_transmuters.cram_times(
+        cpp_A, cpp_n0, cpp_times, order)
+    return np.array(cpp_N, dtype=np.float64).reshape((len(cpp_times), len(cpp_n0)))
+
+
+def cram_batch(A, N0, int order=14):
+    """Transmutes many compositions with the same (flat) A matrix, factoring
+    the CRAM approximation once for all of them.
+
+    Parameters
+    ----------
+    A : 1D array-like
+        The transmutation matrix [unitless]
+    N0 : 2D array-like, shape (N, nrhs)
+        The initial compositions as columns, with nuclides in pyne.cram.NUCS
+        order [atom fraction]
+    order : int, optional
+        The order of approximation, 14 (default).  Orders 14 and 16 are
+        factored; 6 to 18 and ADAPTIVE_ORDER solve one composition at a time.
+
+    Returns
+    -------
+    N1 : ndarray, shape (N, nrhs)
+        The results of the transmutation as columns [atom fraction]
+    """
+    cdef cpp_vector[double] cpp_A = np.asarray(A, dtype=np.float64)
+    cdef np.ndarray[np.float64_t, ndim=2] B = np.ascontiguousarray(
+        N0, dtype=np.float64)
+    if B.shape[0] != cram_data.N:
+        raise ValueError("N0 must have one row per nuclide of pyne.cram.NUCS")
+    cdef np.ndarray[np.float64_t, ndim=2] X = np.empty_like(B)
+    cpp_transmuters.cram_batch(cpp_A, <double *> B.data, <double *> X.data,
+                               B.shape[1], order)
+    return X
+
+
+def cram_many(A, N0, int order=14, int nthreads=0):
+    """Transmutes many materials in parallel.  The materials either each have
+    their own (flat) A matrix or all share one, which is then factored once.
+
+    Parameters
+    ----------
+    A : 1D or 2D array-like
+        The transmutation matrix shared by all materials, or one row per
+        material [unitless]
+    N0 : 2D array-like, shape (nmat, N)
+        The initial composition of each material as rows, with nuclides in
+        pyne.cram.NUCS order [atom fraction]
+    order : int, optional
+        The order of approximation, 14 (default).  Orders 14 and 16 are
+        factored; 6 to 18 and ADAPTIVE_ORDER solve one composition at a time.
+    nthreads : int, optional
+        The number of threads, or 0 (default) for one per core.
+
+    Returns
+    -------
+    N1 : ndarray, shape (nmat, N)
+        The results of the transmutation as rows [atom fraction]
+    """
+    A = np.asarray(A, dtype=np.float64)
+    cdef cpp_vector[cpp_vector[double]] cpp_n0 = np.asarray(N0, dtype=np.float64)
+    cdef cpp_vector[cpp_vector[double]] cpp_n1
+    cdef cpp_vector[cpp_vector[double]] cpp_As
+    cdef cpp_vector[double] cpp_A
+    if A.ndim == 1:
+        cpp_A = A
+        cpp_transmuters.cram_many(cpp_A, cpp_n0, cpp_n1, order, nthreads)
+    else:
+        cpp_As = A
+        cpp_transmuters.cram_many(cpp_As, cpp_n0, cpp_n1, order, nthreads)
+    return np.array(cpp_n1, dtype=np.float64).reshape(np.shape(N0))
+
+
+cdef class TransmutationBuilder:
+    """Assembles flat CRAM transmutation matrices from a multigroup flux.
+
+    The builder is set up once for a list of reaction channels, each taking
+    a parent nuclide to a child, and then writes the matrix
+
+        A = t (R - D)
+
+    for any flux, where D is the decay matrix pyne.cram.DECAY_MATRIX and
+    channel c removes the rate r_c = sum_g xs_cg phi_g from its parent and
+    adds it to its child.  Channels whose child is not in the matrix are
+    pure losses.  The channels of a set of reactions can be found with
+    pyne.rxname.child_triplets().
+
+    Parameters
+    ----------
+    parents : sequence of nuclides
+        The parent of each channel, which must be in pyne.cram.NUCS.
+    children : sequence of nuclides
+        The child of each channel.
+    ngroups : int
+        The number of energy groups.
+    """
+
+    def __cinit__(self, parents, children, int ngroups):
+        cdef cpp_vector[int] cpp_parents = [nucname.id(p) for p in parents]
+        cdef cpp_vector[int] cpp_children = [nucname.id(c) for c in children]
+        self._inst = new cpp_transmuters.TransmutationBuilder(
+            cpp_parents, cpp_children, ngroups)
+
+    def __dealloc__(self):
+        del self._inst
+
+    property nchannels:
+        """The number of reaction channels."""
+        def __get__(self):
+            return self._inst.nchannels()
+
+    property ngroups:
+        """The number of energy groups."""
+        def __get__(self):
+            return self._inst.ngroups()
+
+    def assemble(self, flux, xs, double t=1.0):
+        """Returns the flat transmutation matrix for one flux spectrum.
+
+        Parameters
+        ----------
+        flux : 1D array-like, length ngroups
+            The group fluxes [n/cm^2/s]
+        xs : 2D array-like, shape (nchannels, ngroups)
+            The group cross sections of each channel [barns]
+        t : float, optional
+            The time step [s], default 1.
+
+        Returns
+        -------
+        A : ndarray, length pyne.cram.NNZ
+            The transmutation matrix [unitless]
+        """
+        cdef np.ndarray[np.float64_t, ndim=1] phi = np.ascontiguousarray(
+            flux, dtype=np.float64)
+        cdef np.ndarray[np.float64_t, ndim=2] sigma = np.ascontiguousarray(
+            xs, dtype=np.float64).reshape((self._inst.nchannels(),
+                                           self._inst.ngroups()))
+        if phi.shape[0] != self._inst.ngroups():
+            raise ValueError("flux must have one value per group")
+        cdef np.ndarray[np.float64_t, ndim=1] A = np.empty(cram_data.NNZ,
+                                                           dtype=np.float64)
+        self._inst.assemble(<double *> phi.data, <double *> sigma.data, t,
+                            <double *> A.data)
+        return A
@@ -0,0 +1 @@
+@python -c "import sys; from pyne.cli.nuc_data_snapshot import main; sys.exit(main())"
@@ -3,6 +3,7 @@
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 !!!!!! This file has been autogenerated, modify atomicgen.py !!!!!!!!!!
+!!!!!!          DO NOT MODIFY THIS FILE BY HAND!!            !!!!!!!!!!
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -13,3684 +14,1269 @@
 #include "nucname.h"
 #endif
 
-void pyne::_load_atomic_mass_map_memory() {
-  // header version of atomic weight table data
-  //see if the data table is already loaded
-  if(!atomic_mass_map.empty()) {
-    return;
-  } else {
-    _insert_atomic_mass_map();
-  }
-  //see if the data table is already loaded
-  if(!natural_abund_map.empty()) {
-    return;
-  } else {
-    _insert_abund_map();
-  }
-  // calculate the atomic_masses of the elements
-  std::map<int,double> :: iterator it;
+#include <algorithm>
 
-  for (int z = 1; z <= 92 ; z++) {
-  // loop through the natural abundance map
-  double element_atomic_weight = 0.0;
-  for (it = natural_abund_map.begin(); it != natural_abund_map.end() ; ++it){
-   // if the atomic number of the abudance matches the
-   // that of index
-   if(pyne::nucname::znum(it->first) == z) {
-      // take atomic abundance and multiply by mass
-      // to get the mass of that nuclide / 100 since abundance is in %
-      element_atomic_weight += (it->second*atomic_mass_map[it->first]/100.0);
-    }
-  }
-  // insert the abundance of the element into the list
-  atomic_mass_map[z*10000000] = element_atomic_weight;
- }
+// binary search of a sorted table, negative if nuc is not there
+static double _atomic_table_find(const int* nucs, const double* values,
+                                 size_t n, int nuc) {
+  const int* it = std::lower_bound(nucs, nucs + n, nuc);
+  if (it == nucs + n || *it != nuc)
+    return -1.0;
+  return values[it - nucs];
 }
 
-
-void pyne::_insert_atomic_mass_map() {
-  atomic_mass_map[10010000] = 1.00782503223;
-  atomic_mass_map[10020000] = 2.01410177812;
-  atomic_mass_map[10030000] = 3.01604927791;
-  atomic_mass_map[20030000] = 3.01602932008;
-  atomic_mass_map[30030000] = 3.030775;
-  atomic_mass_map[10040000] = 4.026431864;
-  atomic_mass_map[20040000] = 4.00260325413;
-  atomic_mass_map[30040000] = 4.027185559;
-  atomic_mass_map[10050000] = 5.035311489;
-  atomic_mass_map[20050000] = 5.012057224;
-  atomic_mass_map[30050000] = 5.0125378;
-  atomic_mass_map[40050000] = 5.03987;
-  atomic_mass_map[10060000] = 6.044955433;
-  atomic_mass_map[20060000] = 6.018885891;
-  atomic_mass_map[30060000] = 6.01512288742;
-  atomic_mass_map[40060000] = 6.019726411;
-  atomic_mass_map[50060000] = 6.0508;
-  atomic_mass_map[10070000] = 7.052749;
-  atomic_mass_map[20070000] = 7.027990654;
-  atomic_mass_map[30070000] = 7.01600343659;
-  atomic_mass_map[40070000] = 7.016928717;
-  atomic_mass_map[50070000] = 7.029712;
-  atomic_mass_map[20080000] = 8.03393439;
-  atomic_mass_map[30080000] = 8.022486246;
-  atomic_mass_map[40080000] = 8.005305102;
-  atomic_mass_map[50080000] = 8.024607326;
-  atomic_mass_map[60080000] = 8.037643042;
-  atomic_mass_map[20090000] = 9.043946494;
-  atomic_mass_map[30090000] = 9.026790191;
-  atomic_mass_map[40090000] = 9.012183065;
-  atomic_mass_map[50090000] = 9.013329649;
-  atomic_mass_map[60090000] = 9.031037204;
-  atomic_mass_map[20100000] = 10.052788655;
-  atomic_mass_map[30100000] = 10.035483453;
-  atomic_mass_map[40100000] = 10.013534695;
-  atomic_mass_map[50100000] = 10.012936949;
-  atomic_mass_map[60100000] = 10.016853307;
-  atomic_mass_map[70100000] = 10.04165363;
-  atomic_mass_map[30110000] = 11.043723581;
-  atomic_mass_map[40110000] = 11.021661081;
-  atomic_mass_map[50110000] = 11.009305355;
-  atomic_mass_map[60110000] = 11.011433563;
-  atomic_mass_map[70110000] = 11.026091034;
-  atomic_mass_map[30120000] = 12.052517322;
-  atomic_mass_map[40120000] = 12.026922082;
-  atomic_mass_map[50120000] = 12.014352658;
-  atomic_mass_map[60120000] = 12.0;
-  atomic_mass_map[70120000] = 12.018613187;
-  atomic_mass_map[80120000] = 12.034261836;
-  atomic_mass_map[30130000] = 13.062631523;
-  atomic_mass_map[40130000] = 13.036134506;
-  atomic_mass_map[50130000] = 13.017780166;
-  atomic_mass_map[60130000] = 13.00335483507;
-  atomic_mass_map[70130000] = 13.005738609;
-  atomic_mass_map[80130000] = 13.024815446;
-  atomic_mass_map[40140000] = 14.04289292;
-  atomic_mass_map[50140000] = 14.025404012;
-  atomic_mass_map[60140000] = 14.00324198843;
-  atomic_mass_map[70140000] = 14.00307400443;
-  atomic_mass_map[80140000] = 14.008596359;
-  atomic_mass_map[90140000] = 14.034315207;
-  atomic_mass_map[40150000] = 15.05342;
-  atomic_mass_map[50150000] = 15.03108768;
-  atomic_mass_map[60150000] = 15.010599256;
-  atomic_mass_map[70150000] = 15.00010889888;
-  atomic_mass_map[80150000] = 15.003065618;
-  atomic_mass_map[90150000] = 15.018042853;
-  atomic_mass_map[40160000] = 16.061672036;
-  atomic_mass_map[50160000] = 16.039841663;
-  atomic_mass_map[60160000] = 16.014701252;
-  atomic_mass_map[70160000] = 16.006101925;
-  atomic_mass_map[80160000] = 15.99491461957;
-  atomic_mass_map[90160000] = 16.011465725;
-  atomic_mass_map[100160000] = 16.025750197;
-  atomic_mass_map[50170000] = 17.046989906;
-  atomic_mass_map[60170000] = 17.02257747;
-  atomic_mass_map[70170000] = 17.008448873;
-  atomic_mass_map[80170000] = 16.9991317565;
-  atomic_mass_map[90170000] = 17.002095237;
-  atomic_mass_map[100170000] = 17.017713963;
-  atomic_mass_map[50180000] = 18.055660189;
-  atomic_mass_map[60180000] = 18.026750708;
-  atomic_mass_map[70180000] = 18.014077565;
-  atomic_mass_map[80180000] = 17.99915961286;
-  atomic_mass_map[90180000] = 18.000937325;
-  atomic_mass_map[100180000] = 18.005708703;
-  atomic_mass_map[110180000] = 18.026878252;
-  atomic_mass_map[50190000] = 19.0631;
-  atomic_mass_map[60190000] = 19.034796372;
-  atomic_mass_map[70190000] = 19.017021603;
-  atomic_mass_map[80190000] = 19.00357797;
-  atomic_mass_map[90190000] = 18.99840316273;
-  atomic_mass_map[100190000] = 19.001880907;
-  atomic_mass_map[110190000] = 19.013880272;
-  atomic_mass_map[120190000] = 19.034169186;
-  atomic_mass_map[50200000] = 20.07207;
-  atomic_mass_map[60200000] = 20.040319754;
-  atomic_mass_map[70200000] = 20.023365807;
-  atomic_mass_map[80200000] = 20.004075354;
-  atomic_mass_map[90200000] = 19.999981252;
-  atomic_mass_map[100200000] = 19.99244017617;
-  atomic_mass_map[110200000] = 20.007354426;
-  atomic_mass_map[120200000] = 20.018850004;
-  atomic_mass_map[50210000] = 21.08129;
-  atomic_mass_map[60210000] = 21.049;
-  atomic_mass_map[70210000] = 21.02710824;
-  atomic_mass_map[80210000] = 21.008654813;
-  atomic_mass_map[90210000] = 20.999948889;
-  atomic_mass_map[100210000] = 20.993846685;
-  atomic_mass_map[110210000] = 20.997654695;
-  atomic_mass_map[120210000] = 21.01171614;
-  atomic_mass_map[130210000] = 21.028975;
-  atomic_mass_map[60220000] = 22.057531496;
-  atomic_mass_map[70220000] = 22.034394934;
-  atomic_mass_map[80220000] = 22.009966057;
-  atomic_mass_map[90220000] = 22.002998813;
-  atomic_mass_map[100220000] = 21.991385114;
-  atomic_mass_map[110220000] = 21.994437411;
-  atomic_mass_map[120220000] = 21.999570648;
-  atomic_mass_map[130220000] = 22.01954;
-  atomic_mass_map[140220000] = 22.03579;
-  atomic_mass_map[60230000] = 23.06889;
-  atomic_mass_map[70230000] = 23.04114;
-  atomic_mass_map[80230000] = 23.015695922;
-  atomic_mass_map[90230000] = 23.003556696;
-  atomic_mass_map[100230000] = 22.994466905;
-  atomic_mass_map[110230000] = 22.98976928196;
-  atomic_mass_map[120230000] = 22.994124208;
-  atomic_mass_map[130230000] = 23.007244351;
-  atomic_mass_map[140230000] = 23.02544;
-  atomic_mass_map[70240000] = 24.05039;
-  atomic_mass_map[80240000] = 24.019861;
-  atomic_mass_map[90240000] = 24.008115485;
-  atomic_mass_map[100240000] = 23.99361065;
-  atomic_mass_map[110240000] = 23.99096295;
-  atomic_mass_map[120240000] = 23.985041697;
-  atomic_mass_map[130240000] = 23.999948883;
-  atomic_mass_map[140240000] = 24.011534538;
-  atomic_mass_map[150240000] = 24.03577;
-  atomic_mass_map[70250000] = 25.0601;
-  atomic_mass_map[80250000] = 25.029358986;
-  atomic_mass_map[90250000] = 25.012199229;
-  atomic_mass_map[100250000] = 24.997788707;
-  atomic_mass_map[110250000] = 24.989953969;
-  atomic_mass_map[120250000] = 24.985836976;
-  atomic_mass_map[130250000] = 24.990428102;
-  atomic_mass_map[140250000] = 25.004108808;
-  atomic_mass_map[150250000] = 25.02119;
-  atomic_mass_map[80260000] = 26.03728745;
-  atomic_mass_map[90260000] = 26.020037768;
-  atomic_mass_map[100260000] = 26.000514705;
-  atomic_mass_map[110260000] = 25.992634649;
-  atomic_mass_map[120260000] = 25.982592968;
-  atomic_mass_map[130260000] = 25.986891904;
-  atomic_mass_map[140260000] = 25.992333845;
-  atomic_mass_map[150260000] = 26.01178;
-  atomic_mass_map[160260000] = 26.02907;
-  atomic_mass_map[80270000] = 27.04772;
-  atomic_mass_map[90270000] = 27.026441;
-  atomic_mass_map[100270000] = 27.007553268;
-  atomic_mass_map[110270000] = 26.994076531;
-  atomic_mass_map[120270000] = 26.984340624;
-  atomic_mass_map[130270000] = 26.981538530999998;
-  atomic_mass_map[140270000] = 26.986704811;
-  atomic_mass_map[150270000] = 26.999224406;
-  atomic_mass_map[160270000] = 27.01828;
-  atomic_mass_map[80280000] = 28.05591;
-  atomic_mass_map[90280000] = 28.035342095;
-  atomic_mass_map[100280000] = 28.012121998;
-  atomic_mass_map[110280000] = 27.998939;
-  atomic_mass_map[120280000] = 27.983876728;
-  atomic_mass_map[130280000] = 27.98191021;
-  atomic_mass_map[140280000] = 27.97692653465;
-  atomic_mass_map[150280000] = 27.992326585;
-  atomic_mass_map[160280000] = 28.004372766;
-  atomic_mass_map[170280000] = 28.02954;
-  atomic_mass_map[90290000] = 29.04254;
-  atomic_mass_map[100290000] = 29.019753;
-  atomic_mass_map[110290000] = 29.002877073;
-  atomic_mass_map[120290000] = 28.988617393;
-  atomic_mass_map[130290000] = 28.98045649;
-  atomic_mass_map[140290000] = 28.9764946649;
-  atomic_mass_map[150290000] = 28.981800794;
-  atomic_mass_map[160290000] = 28.996611456;
-  atomic_mass_map[170290000] = 29.01478;
-  atomic_mass_map[90300000] = 30.05165;
-  atomic_mass_map[100300000] = 30.024734;
-  atomic_mass_map[110300000] = 30.009097932;
-  atomic_mass_map[120300000] = 29.990462926;
-  atomic_mass_map[130300000] = 29.98296022;
-  atomic_mass_map[140300000] = 29.973770136;
-  atomic_mass_map[150300000] = 29.978313753;
-  atomic_mass_map[160300000] = 29.984907033;
-  atomic_mass_map[170300000] = 30.00477;
-  atomic_mass_map[180300000] = 30.02307;
-  atomic_mass_map[90310000] = 31.059709;
-  atomic_mass_map[100310000] = 31.033087;
-  atomic_mass_map[110310000] = 31.013162656;
-  atomic_mass_map[120310000] = 30.996648032;
-  atomic_mass_map[130310000] = 30.983945171;
-  atomic_mass_map[140310000] = 30.975363194;
-  atomic_mass_map[150310000] = 30.97376199842;
-  atomic_mass_map[160310000] = 30.979557007;
-  atomic_mass_map[170310000] = 30.992414203;
-  atomic_mass_map[180310000] = 31.012124;
-  atomic_mass_map[100320000] = 32.03972;
-  atomic_mass_map[110320000] = 32.020193;
-  atomic_mass_map[120320000] = 31.999110239;
-  atomic_mass_map[130320000] = 31.988085239;
-  atomic_mass_map[140320000] = 31.974151539;
-  atomic_mass_map[150320000] = 31.973907643;
-  atomic_mass_map[160320000] = 31.97207117441;
-  atomic_mass_map[170320000] = 31.985684637;
-  atomic_mass_map[180320000] = 31.997637826;
-  atomic_mass_map[190320000] = 32.02265;
-  atomic_mass_map[100330000] = 33.04938;
-  atomic_mass_map[110330000] = 33.02573;
-  atomic_mass_map[120330000] = 33.005327145;
-  atomic_mass_map[130330000] = 32.990908977;
-  atomic_mass_map[140330000] = 32.977976964;
-  atomic_mass_map[150330000] = 32.971725694;
-  atomic_mass_map[160330000] = 32.97145890982;
-  atomic_mass_map[170330000] = 32.977451989;
-  atomic_mass_map[180330000] = 32.989925546;
-  atomic_mass_map[190330000] = 33.00756;
-  atomic_mass_map[100340000] = 34.056728;
-  atomic_mass_map[110340000] = 34.03359;
-  atomic_mass_map[120340000] = 34.008935481;
-  atomic_mass_map[130340000] = 33.996705398;
-  atomic_mass_map[140340000] = 33.978575569;
-  atomic_mass_map[150340000] = 33.973645886;
-  atomic_mass_map[160340000] = 33.967867004;
-  atomic_mass_map[170340000] = 33.973762485;
-  atomic_mass_map[180340000] = 33.98027009;
-  atomic_mass_map[190340000] = 33.99869;
-  atomic_mass_map[200340000] = 34.01487;
-  atomic_mass_map[110350000] = 35.040623;
-  atomic_mass_map[120350000] = 35.01679;
-  atomic_mass_map[130350000] = 34.999764;
-  atomic_mass_map[140350000] = 34.984583476;
-  atomic_mass_map[150350000] = 34.973314062;
-  atomic_mass_map[160350000] = 34.96903231;
-  atomic_mass_map[170350000] = 34.968852682;
-  atomic_mass_map[180350000] = 34.975257586;
-  atomic_mass_map[190350000] = 34.988005407;
-  atomic_mass_map[200350000] = 35.00514;
-  atomic_mass_map[110360000] = 36.049288;
-  atomic_mass_map[120360000] = 36.021879;
-  atomic_mass_map[130360000] = 36.006388;
-  atomic_mass_map[140360000] = 35.986695219;
-  atomic_mass_map[150360000] = 35.978259625;
-  atomic_mass_map[160360000] = 35.967080706;
-  atomic_mass_map[170360000] = 35.968306809;
-  atomic_mass_map[180360000] = 35.967545105;
-  atomic_mass_map[190360000] = 35.98130201;
-  atomic_mass_map[200360000] = 35.993074404;
-  atomic_mass_map[210360000] = 36.01648;
-  atomic_mass_map[110370000] = 37.057051;
-  atomic_mass_map[120370000] = 37.03037;
-  atomic_mass_map[130370000] = 37.010531;
-  atomic_mass_map[140370000] = 36.99292074;
-  atomic_mass_map[150370000] = 36.979606841;
-  atomic_mass_map[160370000] = 36.971125514;
-  atomic_mass_map[170370000] = 36.965902602;
-  atomic_mass_map[180370000] = 36.966776331;
-  atomic_mass_map[190370000] = 36.973375889;
-  atomic_mass_map[200370000] = 36.985897852;
-  atomic_mass_map[210370000] = 37.00374;
-  atomic_mass_map[120380000] = 38.03658;
-  atomic_mass_map[130380000] = 38.017402;
-  atomic_mass_map[140380000] = 37.995523;
-  atomic_mass_map[150380000] = 37.984251583;
-  atomic_mass_map[160380000] = 37.971163328;
-  atomic_mass_map[170380000] = 37.968010436;
-  atomic_mass_map[180380000] = 37.962732106;
-  atomic_mass_map[190380000] = 37.969081117;
-  atomic_mass_map[200380000] = 37.976319224;
-  atomic_mass_map[210380000] = 37.99512;
-  atomic_mass_map[220380000] = 38.01145;
-  atomic_mass_map[120390000] = 39.045384;
-  atomic_mass_map[130390000] = 39.02254;
-  atomic_mass_map[140390000] = 39.002491;
-  atomic_mass_map[150390000] = 38.986227208;
-  atomic_mass_map[160390000] = 38.975134197;
-  atomic_mass_map[170390000] = 38.968008176;
-  atomic_mass_map[180390000] = 38.964313038;
-  atomic_mass_map[190390000] = 38.96370648643;
-  atomic_mass_map[200390000] = 38.970710813;
-  atomic_mass_map[210390000] = 38.984784968;
-  atomic_mass_map[220390000] = 39.00236;
-  atomic_mass_map[120400000] = 40.05218;
-  atomic_mass_map[130400000] = 40.03003;
-  atomic_mass_map[140400000] = 40.005829;
-  atomic_mass_map[150400000] = 39.991331748;
-  atomic_mass_map[160400000] = 39.975482562;
-  atomic_mass_map[170400000] = 39.970415469;
-  atomic_mass_map[180400000] = 39.96238312372;
-  atomic_mass_map[190400000] = 39.963998166;
-  atomic_mass_map[200400000] = 39.962590863;
-  atomic_mass_map[210400000] = 39.977967291;
-  atomic_mass_map[220400000] = 39.990498719;
-  atomic_mass_map[230400000] = 40.01276;
-  atomic_mass_map[130410000] = 41.03638;
-  atomic_mass_map[140410000] = 41.013011;
-  atomic_mass_map[150410000] = 40.994654;
-  atomic_mass_map[160410000] = 40.979593451;
-  atomic_mass_map[170410000] = 40.970684525;
-  atomic_mass_map[180410000] = 40.96450057;
-  atomic_mass_map[190410000] = 40.96182525792;
-  atomic_mass_map[200410000] = 40.962277924;
-  atomic_mass_map[210410000] = 40.969251105;
-  atomic_mass_map[220410000] = 40.983148;
-  atomic_mass_map[230410000] = 41.00021;
-  atomic_mass_map[130420000] = 42.04384;
-  atomic_mass_map[140420000] = 42.01778;
-  atomic_mass_map[150420000] = 42.001084;
-  atomic_mass_map[160420000] = 41.9810651;
-  atomic_mass_map[170420000] = 41.973254804;
-  atomic_mass_map[180420000] = 41.963045736;
-  atomic_mass_map[190420000] = 41.962402306;
-  atomic_mass_map[200420000] = 41.95861783;
-  atomic_mass_map[210420000] = 41.965516532;
-  atomic_mass_map[220420000] = 41.973049034;
-  atomic_mass_map[230420000] = 41.99182;
-  atomic_mass_map[240420000] = 42.0067;
-  atomic_mass_map[130430000] = 43.05147;
-  atomic_mass_map[140430000] = 43.0248;
-  atomic_mass_map[150430000] = 43.005024;
-  atomic_mass_map[160430000] = 42.986907635;
-  atomic_mass_map[170430000] = 42.973888584;
-  atomic_mass_map[180430000] = 42.965636055;
-  atomic_mass_map[190430000] = 42.960734702;
-  atomic_mass_map[200430000] = 42.958766438;
-  atomic_mass_map[210430000] = 42.961150474;
-  atomic_mass_map[220430000] = 42.96852252;
-  atomic_mass_map[230430000] = 42.980766;
-  atomic_mass_map[240430000] = 42.99753;
-  atomic_mass_map[140440000] = 44.03061;
-  atomic_mass_map[150440000] = 44.01121;
-  atomic_mass_map[160440000] = 43.990118848;
-  atomic_mass_map[170440000] = 43.977874543;
-  atomic_mass_map[180440000] = 43.964923815;
-  atomic_mass_map[190440000] = 43.961586985;
-  atomic_mass_map[200440000] = 43.955481561;
-  atomic_mass_map[210440000] = 43.959402875;
-  atomic_mass_map[220440000] = 43.959689949;
-  atomic_mass_map[230440000] = 43.97411;
-  atomic_mass_map[240440000] = 43.98536;
-  atomic_mass_map[250440000] = 44.00715;
-  atomic_mass_map[140450000] = 45.03995;
-  atomic_mass_map[150450000] = 45.01645;
-  atomic_mass_map[160450000] = 44.995717;
-  atomic_mass_map[170450000] = 44.98029;
-  atomic_mass_map[180450000] = 44.968039733;
-  atomic_mass_map[190450000] = 44.960691493;
-  atomic_mass_map[200450000] = 44.95618635;
-  atomic_mass_map[210450000] = 44.955908275;
-  atomic_mass_map[220450000] = 44.958121983;
-  atomic_mass_map[230450000] = 44.96577482;
-  atomic_mass_map[240450000] = 44.97905;
-  atomic_mass_map[250450000] = 44.99449;
-  atomic_mass_map[260450000] = 45.014419;
-  atomic_mass_map[150460000] = 46.02446;
-  atomic_mass_map[160460000] = 46.00004;
-  atomic_mass_map[170460000] = 45.985174;
-  atomic_mass_map[180460000] = 45.968082712;
-  atomic_mass_map[190460000] = 45.961981586;
-  atomic_mass_map[200460000] = 45.953689023;
-  atomic_mass_map[210460000] = 45.955168257;
-  atomic_mass_map[220460000] = 45.952627718;
-  atomic_mass_map[230460000] = 45.960198775;
-  atomic_mass_map[240460000] = 45.968358861;
-  atomic_mass_map[250460000] = 45.98609;
-  atomic_mass_map[260460000] = 46.00063;
-  atomic_mass_map[150470000] = 47.03139;
-  atomic_mass_map[160470000] = 47.00795;
-  atomic_mass_map[170470000] = 46.98916;
-  atomic_mass_map[180470000] = 46.972934865;
-  atomic_mass_map[190470000] = 46.961661614;
-  atomic_mass_map[200470000] = 46.954542430000004;
-  atomic_mass_map[210470000] = 46.95240374;
-  atomic_mass_map[220470000] = 46.951758787;
-  atomic_mass_map[230470000] = 46.954904914;
-  atomic_mass_map[240470000] = 46.962897359;
-  atomic_mass_map[250470000] = 46.975775;
-  atomic_mass_map[260470000] = 46.99185;
-  atomic_mass_map[270470000] = 47.01057;
-  atomic_mass_map[160480000] = 48.0137;
-  atomic_mass_map[170480000] = 47.99564;
-  atomic_mass_map[180480000] = 47.97591;
-  atomic_mass_map[190480000] = 47.965341186;
-  atomic_mass_map[200480000] = 47.952522765;
-  atomic_mass_map[210480000] = 47.952223611;
-  atomic_mass_map[220480000] = 47.947941979;
-  atomic_mass_map[230480000] = 47.952252223;
-  atomic_mass_map[240480000] = 47.954029061;
-  atomic_mass_map[250480000] = 47.96852;
-  atomic_mass_map[260480000] = 47.98023;
-  atomic_mass_map[270480000] = 48.00093;
-  atomic_mass_map[280480000] = 48.017688;
-  atomic_mass_map[160490000] = 49.022762;
-  atomic_mass_map[170490000] = 49.00123;
-  atomic_mass_map[180490000] = 48.9819;
-  atomic_mass_map[190490000] = 48.968210755;
-  atomic_mass_map[200490000] = 48.955662736;
-  atomic_mass_map[210490000] = 48.950014629;
-  atomic_mass_map[220490000] = 48.947865676;
-  atomic_mass_map[230490000] = 48.948511795;
-  atomic_mass_map[240490000] = 48.951333349;
-  atomic_mass_map[250490000] = 48.959595297;
-  atomic_mass_map[260490000] = 48.973429;
-  atomic_mass_map[270490000] = 48.98891;
-  atomic_mass_map[280490000] = 49.0077;
-  atomic_mass_map[170500000] = 50.00905;
-  atomic_mass_map[180500000] = 49.98613;
-  atomic_mass_map[190500000] = 49.972380017;
-  atomic_mass_map[200500000] = 49.957499217;
-  atomic_mass_map[210500000] = 49.952176274;
-  atomic_mass_map[220500000] = 49.944786889;
-  atomic_mass_map[230500000] = 49.947156014;
-  atomic_mass_map[240500000] = 49.946041833;
-  atomic_mass_map[250500000] = 49.954237781;
-  atomic_mass_map[260500000] = 49.962974929;
-  atomic_mass_map[270500000] = 49.98091;
-  atomic_mass_map[280500000] = 49.99474;
-  atomic_mass_map[170510000] = 51.01554;
-  atomic_mass_map[180510000] = 50.9937;
-  atomic_mass_map[190510000] = 50.975828036;
-  atomic_mass_map[200510000] = 50.960988981;
-  atomic_mass_map[210510000] = 50.953591956;
-  atomic_mass_map[220510000] = 50.946610651;
-  atomic_mass_map[230510000] = 50.943957036;
-  atomic_mass_map[240510000] = 50.944765018;
-  atomic_mass_map[250510000] = 50.948208475;
-  atomic_mass_map[260510000] = 50.956841021;
-  atomic_mass_map[270510000] = 50.970647;
-  atomic_mass_map[280510000] = 50.98611;
-  atomic_mass_map[180520000] = 51.99896;
-  atomic_mass_map[190520000] = 51.98224;
-  atomic_mass_map[200520000] = 51.963217145;
-  atomic_mass_map[210520000] = 51.956879479;
-  atomic_mass_map[220520000] = 51.946893006;
-  atomic_mass_map[230520000] = 51.944773007;
-  atomic_mass_map[240520000] = 51.940506231;
-  atomic_mass_map[250520000] = 51.945563949;
-  atomic_mass_map[260520000] = 51.948113146;
-  atomic_mass_map[270520000] = 51.96351;
-  atomic_mass_map[280520000] = 51.9748;
-  atomic_mass_map[290520000] = 51.99671;
-  atomic_mass_map[180530000] = 53.00729;
-  atomic_mass_map[190530000] = 52.98746;
-  atomic_mass_map[200530000] = 52.96945;
-  atomic_mass_map[210530000] = 52.95909;
-  atomic_mass_map[220530000] = 52.949725933;
-  atomic_mass_map[230530000] = 52.944336741;
-  atomic_mass_map[240530000] = 52.940648147;
-  atomic_mass_map[250530000] = 52.941288891;
-  atomic_mass_map[260530000] = 52.945306428;
-  atomic_mass_map[270530000] = 52.954204077;
-  atomic_mass_map[280530000] = 52.96819;
-  atomic_mass_map[290530000] = 52.98459;
-  atomic_mass_map[190540000] = 53.99463;
-  atomic_mass_map[200540000] = 53.9734;
-  atomic_mass_map[210540000] = 53.96393;
-  atomic_mass_map[220540000] = 53.951049547;
-  atomic_mass_map[230540000] = 53.946438617;
-  atomic_mass_map[240540000] = 53.938879158;
-  atomic_mass_map[250540000] = 53.940357614999996;
-  atomic_mass_map[260540000] = 53.939608986;
-  atomic_mass_map[270540000] = 53.948459872;
-  atomic_mass_map[280540000] = 53.957892463;
-  atomic_mass_map[290540000] = 53.97666;
-  atomic_mass_map[300540000] = 53.992039;
-  atomic_mass_map[190550000] = 55.00076;
-  atomic_mass_map[200550000] = 54.9803;
-  atomic_mass_map[210550000] = 54.967818892;
-  atomic_mass_map[220550000] = 54.955268064;
-  atomic_mass_map[230550000] = 54.94724215;
-  atomic_mass_map[240550000] = 54.940838434;
-  atomic_mass_map[250550000] = 54.93804391;
-  atomic_mass_map[260550000] = 54.938291994;
-  atomic_mass_map[270550000] = 54.941997202;
-  atomic_mass_map[280550000] = 54.951330632;
-  atomic_mass_map[290550000] = 54.966038;
-  atomic_mass_map[300550000] = 54.98398;
-  atomic_mass_map[190560000] = 56.00851;
-  atomic_mass_map[200560000] = 55.985079999999996;
-  atomic_mass_map[210560000] = 55.97345;
-  atomic_mass_map[220560000] = 55.957911353;
-  atomic_mass_map[230560000] = 55.95048481;
-  atomic_mass_map[240560000] = 55.940653139;
-  atomic_mass_map[250560000] = 55.938903691;
-  atomic_mass_map[260560000] = 55.934936326;
-  atomic_mass_map[270560000] = 55.939838798;
-  atomic_mass_map[280560000] = 55.942128549;
-  atomic_mass_map[290560000] = 55.95895;
-  atomic_mass_map[300560000] = 55.97254;
-  atomic_mass_map[310560000] = 55.99536;
-  atomic_mass_map[200570000] = 56.99262;
-  atomic_mass_map[210570000] = 56.97777;
-  atomic_mass_map[220570000] = 56.963641626;
-  atomic_mass_map[230570000] = 56.952518869;
-  atomic_mass_map[240570000] = 56.943613013;
-  atomic_mass_map[250570000] = 56.938286096;
-  atomic_mass_map[260570000] = 56.935392841;
-  atomic_mass_map[270570000] = 56.936290574;
-  atomic_mass_map[280570000] = 56.939792184;
-  atomic_mass_map[290570000] = 56.949212498;
-  atomic_mass_map[300570000] = 56.96506;
-  atomic_mass_map[310570000] = 56.9832;
-  atomic_mass_map[200580000] = 57.99794;
-  atomic_mass_map[210580000] = 57.98403;
-  atomic_mass_map[220580000] = 57.9666;
-  atomic_mass_map[230580000] = 57.956715235;
-  atomic_mass_map[240580000] = 57.944353129;
-  atomic_mass_map[250580000] = 57.940066645;
-  atomic_mass_map[260580000] = 57.933274431;
-  atomic_mass_map[270580000] = 57.935752073;
-  atomic_mass_map[280580000] = 57.935342414;
-  atomic_mass_map[290580000] = 57.944533046;
-  atomic_mass_map[300580000] = 57.954591062;
-  atomic_mass_map[310580000] = 57.97478;
-  atomic_mass_map[320580000] = 57.99172;
-  atomic_mass_map[210590000] = 58.98894;
-  atomic_mass_map[220590000] = 58.97247;
-  atomic_mass_map[230590000] = 58.959385659;
-  atomic_mass_map[240590000] = 58.948586367;
-  atomic_mass_map[250590000] = 58.940391113;
-  atomic_mass_map[260590000] = 58.934874338;
-  atomic_mass_map[270590000] = 58.933194288;
-  atomic_mass_map[280590000] = 58.934346202;
-  atomic_mass_map[290590000] = 58.939497482;
-  atomic_mass_map[300590000] = 58.949312657;
-  atomic_mass_map[310590000] = 58.96353;
-  atomic_mass_map[320590000] = 58.98249;
-  atomic_mass_map[210600000] = 59.99565;
-  atomic_mass_map[220600000] = 59.97603;
-  atomic_mass_map[230600000] = 59.96431329;
-  atomic_mass_map[240600000] = 59.950076033;
-  atomic_mass_map[250600000] = 59.943136576;
-  atomic_mass_map[260600000] = 59.9340711;
-  atomic_mass_map[270600000] = 59.933816299;
-  atomic_mass_map[280600000] = 59.930785885;
-  atomic_mass_map[290600000] = 59.937364544;
-  atomic_mass_map[300600000] = 59.941842103;
-  atomic_mass_map[310600000] = 59.95729;
-  atomic_mass_map[320600000] = 59.97036;
-  atomic_mass_map[330600000] = 59.99388;
-  atomic_mass_map[210610000] = 61.001;
-  atomic_mass_map[220610000] = 60.98245;
-  atomic_mass_map[230610000] = 60.96725;
-  atomic_mass_map[240610000] = 60.954422585;
-  atomic_mass_map[250610000] = 60.944452544;
-  atomic_mass_map[260610000] = 60.936746244;
-  atomic_mass_map[270610000] = 60.93247662;
-  atomic_mass_map[280610000] = 60.93105557;
-  atomic_mass_map[290610000] = 60.933457612;
-  atomic_mass_map[300610000] = 60.939507188;
-  atomic_mass_map[310610000] = 60.949398984;
-  atomic_mass_map[320610000] = 60.96379;
-  atomic_mass_map[330610000] = 60.98112;
-  atomic_mass_map[220620000] = 61.98651;
-  atomic_mass_map[230620000] = 61.97265;
-  atomic_mass_map[240620000] = 61.956097451;
-  atomic_mass_map[250620000] = 61.947954;
-  atomic_mass_map[260620000] = 61.936791812;
-  atomic_mass_map[270620000] = 61.934058809;
-  atomic_mass_map[280620000] = 61.928345365;
-  atomic_mass_map[290620000] = 61.932595415;
-  atomic_mass_map[300620000] = 61.934333971;
-  atomic_mass_map[310620000] = 61.944190251;
-  atomic_mass_map[320620000] = 61.95502;
-  atomic_mass_map[330620000] = 61.97361;
-  atomic_mass_map[220630000] = 62.99375;
-  atomic_mass_map[230630000] = 62.97639;
-  atomic_mass_map[240630000] = 62.961650731;
-  atomic_mass_map[250630000] = 62.949664675;
-  atomic_mass_map[260630000] = 62.9402727;
-  atomic_mass_map[270630000] = 62.933600217;
-  atomic_mass_map[280630000] = 62.929669626;
-  atomic_mass_map[290630000] = 62.929597723;
-  atomic_mass_map[300630000] = 62.933211474;
-  atomic_mass_map[310630000] = 62.939294196;
-  atomic_mass_map[320630000] = 62.949628;
-  atomic_mass_map[330630000] = 62.9639;
-  atomic_mass_map[230640000] = 63.98264;
-  atomic_mass_map[240640000] = 63.96408;
-  atomic_mass_map[250640000] = 63.95384937;
-  atomic_mass_map[260640000] = 63.940987763;
-  atomic_mass_map[270640000] = 63.935810764;
-  atomic_mass_map[280640000] = 63.927966816;
-  atomic_mass_map[290640000] = 63.929764342;
-  atomic_mass_map[300640000] = 63.929142013;
-  atomic_mass_map[310640000] = 63.93684044;
-  atomic_mass_map[320640000] = 63.941689913;
-  atomic_mass_map[330640000] = 63.957432;
-  atomic_mass_map[340640000] = 63.97109;
-  atomic_mass_map[230650000] = 64.9875;
-  atomic_mass_map[240650000] = 64.96996;
-  atomic_mass_map[250650000] = 64.95601975;
-  atomic_mass_map[260650000] = 64.945011462;
-  atomic_mass_map[270650000] = 64.936462072;
-  atomic_mass_map[280650000] = 64.930085173;
-  atomic_mass_map[290650000] = 64.927789704;
-  atomic_mass_map[300650000] = 64.92924077;
-  atomic_mass_map[310650000] = 64.932734588;
-  atomic_mass_map[320650000] = 64.939368137;
-  atomic_mass_map[330650000] = 64.949611;
-  atomic_mass_map[340650000] = 64.9644;
-  atomic_mass_map[230660000] = 65.99398;
-  atomic_mass_map[240660000] = 65.97366;
-  atomic_mass_map[250660000] = 65.960546834;
-  atomic_mass_map[260660000] = 65.94624996;
-  atomic_mass_map[270660000] = 65.939442945;
-  atomic_mass_map[280660000] = 65.929139334;
-  atomic_mass_map[290660000] = 65.928869032;
-  atomic_mass_map[300660000] = 65.926033809;
-  atomic_mass_map[310660000] = 65.931589401;
-  atomic_mass_map[320660000] = 65.933862126;
-  atomic_mass_map[330660000] = 65.944148779;
-  atomic_mass_map[340660000] = 65.95559;
-  atomic_mass_map[240670000] = 66.98016;
-  atomic_mass_map[250670000] = 66.96424;
-  atomic_mass_map[260670000] = 66.950543395;
-  atomic_mass_map[270670000] = 66.940609627;
-  atomic_mass_map[280670000] = 66.931569414;
-  atomic_mass_map[290670000] = 66.927730314;
-  atomic_mass_map[300670000] = 66.927127746;
-  atomic_mass_map[310670000] = 66.928202547;
-  atomic_mass_map[320670000] = 66.932733861;
-  atomic_mass_map[330670000] = 66.939251112;
-  atomic_mass_map[340670000] = 66.949994;
-  atomic_mass_map[350670000] = 66.96465;
-  atomic_mass_map[240680000] = 67.98403;
-  atomic_mass_map[250680000] = 67.96962;
-  atomic_mass_map[260680000] = 67.95295155;
-  atomic_mass_map[270680000] = 67.944257589;
-  atomic_mass_map[280680000] = 67.931868789;
-  atomic_mass_map[290680000] = 67.929610889;
-  atomic_mass_map[300680000] = 67.924844554;
-  atomic_mass_map[310680000] = 67.927980485;
-  atomic_mass_map[320680000] = 67.928095307;
-  atomic_mass_map[330680000] = 67.93677413;
-  atomic_mass_map[340680000] = 67.941825238;
-  atomic_mass_map[350680000] = 67.958732;
-  atomic_mass_map[250690000] = 68.97366;
-  atomic_mass_map[260690000] = 68.95807;
-  atomic_mass_map[270690000] = 68.946141268;
-  atomic_mass_map[280690000] = 68.935610269;
-  atomic_mass_map[290690000] = 68.929429269;
-  atomic_mass_map[300690000] = 68.926550682;
-  atomic_mass_map[310690000] = 68.925573541;
-  atomic_mass_map[320690000] = 68.927964481;
-  atomic_mass_map[330690000] = 68.932246302;
-  atomic_mass_map[340690000] = 68.939414847;
-  atomic_mass_map[350690000] = 68.950497297;
-  atomic_mass_map[360690000] = 68.96518;
-  atomic_mass_map[250700000] = 69.97937;
-  atomic_mass_map[260700000] = 69.96102;
-  atomic_mass_map[270700000] = 69.94963;
-  atomic_mass_map[280700000] = 69.936431302;
-  atomic_mass_map[290700000] = 69.932392079;
-  atomic_mass_map[300700000] = 69.925319208;
-  atomic_mass_map[310700000] = 69.926021927;
-  atomic_mass_map[320700000] = 69.92424875;
-  atomic_mass_map[330700000] = 69.930926195;
-  atomic_mass_map[340700000] = 69.933515523;
-  atomic_mass_map[350700000] = 69.944792323;
-  atomic_mass_map[360700000] = 69.95604;
-  atomic_mass_map[250710000] = 70.98368;
-  atomic_mass_map[260710000] = 70.96672;
-  atomic_mass_map[270710000] = 70.952366923;
-  atomic_mass_map[280710000] = 70.940518964;
-  atomic_mass_map[290710000] = 70.932676833;
-  atomic_mass_map[300710000] = 70.927719582;
-  atomic_mass_map[310710000] = 70.924702577;
-  atomic_mass_map[320710000] = 70.924952327;
-  atomic_mass_map[330710000] = 70.927113801;
-  atomic_mass_map[340710000] = 70.932209433;
-  atomic_mass_map[350710000] = 70.939342155;
-  atomic_mass_map[360710000] = 70.950265696;
-  atomic_mass_map[370710000] = 70.96532;
-  atomic_mass_map[260720000] = 71.96983;
-  atomic_mass_map[270720000] = 71.95729;
-  atomic_mass_map[280720000] = 71.941785926;
-  atomic_mass_map[290720000] = 71.935820307;
-  atomic_mass_map[300720000] = 71.926842807;
-  atomic_mass_map[310720000] = 71.926367474;
-  atomic_mass_map[320720000] = 71.922075826;
-  atomic_mass_map[330720000] = 71.926752294;
-  atomic_mass_map[340720000] = 71.927140507;
-  atomic_mass_map[350720000] = 71.936588619;
-  atomic_mass_map[360720000] = 71.942092407;
-  atomic_mass_map[370720000] = 71.95908;
-  atomic_mass_map[260730000] = 72.97572;
-  atomic_mass_map[270730000] = 72.96039;
-  atomic_mass_map[280730000] = 72.946206683;
-  atomic_mass_map[290730000] = 72.936674378;
-  atomic_mass_map[300730000] = 72.929582582;
-  atomic_mass_map[310730000] = 72.925174682;
-  atomic_mass_map[320730000] = 72.923458956;
-  atomic_mass_map[330730000] = 72.923829086;
-  atomic_mass_map[340730000] = 72.926754882;
-  atomic_mass_map[350730000] = 72.931671503;
-  atomic_mass_map[360730000] = 72.939289195;
-  atomic_mass_map[370730000] = 72.950529;
-  atomic_mass_map[380730000] = 72.9657;
-  atomic_mass_map[260740000] = 73.97935;
-  atomic_mass_map[270740000] = 73.96515;
-  atomic_mass_map[280740000] = 73.94798;
-  atomic_mass_map[290740000] = 73.939874862;
-  atomic_mass_map[300740000] = 73.929407262;
-  atomic_mass_map[310740000] = 73.926945727;
-  atomic_mass_map[320740000] = 73.921177761;
-  atomic_mass_map[330740000] = 73.923928598;
-  atomic_mass_map[340740000] = 73.922475934;
-  atomic_mass_map[350740000] = 73.929910177;
-  atomic_mass_map[360740000] = 73.93308402;
-  atomic_mass_map[370740000] = 73.944265894;
-  atomic_mass_map[380740000] = 73.95617;
-  atomic_mass_map[270750000] = 74.96876;
-  atomic_mass_map[280750000] = 74.9525;
-  atomic_mass_map[290750000] = 74.941522606;
-  atomic_mass_map[300750000] = 74.932840246;
-  atomic_mass_map[310750000] = 74.926500246;
-  atomic_mass_map[320750000] = 74.92285837;
-  atomic_mass_map[330750000] = 74.921594567;
-  atomic_mass_map[340750000] = 74.92252287;
-  atomic_mass_map[350750000] = 74.925810452;
-  atomic_mass_map[360750000] = 74.930945746;
-  atomic_mass_map[370750000] = 74.938573201;
-  atomic_mass_map[380750000] = 74.94995277;
-  atomic_mass_map[270760000] = 75.97413;
-  atomic_mass_map[280760000] = 75.95533;
-  atomic_mass_map[290760000] = 75.945275026;
-  atomic_mass_map[300760000] = 75.933114957;
-  atomic_mass_map[310760000] = 75.928827626;
-  atomic_mass_map[320760000] = 75.921402726;
-  atomic_mass_map[330760000] = 75.922392015;
-  atomic_mass_map[340760000] = 75.919213704;
-  atomic_mass_map[350760000] = 75.924541576;
-  atomic_mass_map[360760000] = 75.925910271;
-  atomic_mass_map[370760000] = 75.935073032;
-  atomic_mass_map[380760000] = 75.941762761;
-  atomic_mass_map[390760000] = 75.95856;
-  atomic_mass_map[280770000] = 76.96055;
-  atomic_mass_map[290770000] = 76.94792;
-  atomic_mass_map[300770000] = 76.936887199;
-  atomic_mass_map[310770000] = 76.9291543;
-  atomic_mass_map[320770000] = 76.923549843;
-  atomic_mass_map[330770000] = 76.920647563;
-  atomic_mass_map[340770000] = 76.919914154;
-  atomic_mass_map[350770000] = 76.921379198;
-  atomic_mass_map[360770000] = 76.92467;
-  atomic_mass_map[370770000] = 76.9304016;
-  atomic_mass_map[380770000] = 76.937945455;
-  atomic_mass_map[390770000] = 76.949781;
-  atomic_mass_map[280780000] = 77.96336;
-  atomic_mass_map[290780000] = 77.95223;
-  atomic_mass_map[300780000] = 77.938289206;
-  atomic_mass_map[310780000] = 77.931608845;
-  atomic_mass_map[320780000] = 77.922852908;
-  atomic_mass_map[330780000] = 77.921827773;
-  atomic_mass_map[340780000] = 77.91730928;
-  atomic_mass_map[350780000] = 77.921145895;
-  atomic_mass_map[360780000] = 77.920364944;
-  atomic_mass_map[370780000] = 77.928141868;
-  atomic_mass_map[380780000] = 77.93217998;
-  atomic_mass_map[390780000] = 77.94361;
-  atomic_mass_map[400780000] = 77.95566;
-  atomic_mass_map[280790000] = 78.970252;
-  atomic_mass_map[290790000] = 78.95502;
-  atomic_mass_map[300790000] = 78.942638069;
-  atomic_mass_map[310790000] = 78.932852301;
-  atomic_mass_map[320790000] = 78.925360127;
-  atomic_mass_map[330790000] = 78.920948423;
-  atomic_mass_map[340790000] = 78.918499287;
-  atomic_mass_map[350790000] = 78.918337579;
-  atomic_mass_map[360790000] = 78.920082923;
-  atomic_mass_map[370790000] = 78.923989864;
-  atomic_mass_map[380790000] = 78.929707664;
-  atomic_mass_map[390790000] = 78.937351299;
-  atomic_mass_map[400790000] = 78.94948;
-  atomic_mass_map[290800000] = 79.96089;
-  atomic_mass_map[300800000] = 79.944552931;
-  atomic_mass_map[310800000] = 79.936420775;
-  atomic_mass_map[320800000] = 79.925350775;
-  atomic_mass_map[330800000] = 79.922474584;
-  atomic_mass_map[340800000] = 79.916521762;
-  atomic_mass_map[350800000] = 79.918529788;
-  atomic_mass_map[360800000] = 79.916378084;
-  atomic_mass_map[370800000] = 79.922516444;
-  atomic_mass_map[380800000] = 79.924517516;
-  atomic_mass_map[390800000] = 79.934356096;
-  atomic_mass_map[400800000] = 79.9404;
-  atomic_mass_map[290810000] = 80.965872;
-  atomic_mass_map[300810000] = 80.950402619;
-  atomic_mass_map[310810000] = 80.938133843;
-  atomic_mass_map[320810000] = 80.928832943;
-  atomic_mass_map[330810000] = 80.92213228;
-  atomic_mass_map[340810000] = 80.917993023;
-  atomic_mass_map[350810000] = 80.91628969;
-  atomic_mass_map[360810000] = 80.916591181;
-  atomic_mass_map[370810000] = 80.918993936;
-  atomic_mass_map[380810000] = 80.923211395;
-  atomic_mass_map[390810000] = 80.929455556;
-  atomic_mass_map[400810000] = 80.937308892;
-  atomic_mass_map[410810000] = 80.9496;
-  atomic_mass_map[290820000] = 81.972442;
-  atomic_mass_map[300820000] = 81.95426;
-  atomic_mass_map[310820000] = 81.943176533;
-  atomic_mass_map[320820000] = 81.929774033;
-  atomic_mass_map[330820000] = 81.924741233;
-  atomic_mass_map[340820000] = 81.916699497;
-  atomic_mass_map[350820000] = 81.916803246;
-  atomic_mass_map[360820000] = 81.91348273;
-  atomic_mass_map[370820000] = 81.918209024;
-  atomic_mass_map[380820000] = 81.918399855;
-  atomic_mass_map[390820000] = 81.926931401;
-  atomic_mass_map[400820000] = 81.931354;
-  atomic_mass_map[410820000] = 81.94396;
-  atomic_mass_map[300830000] = 82.96056;
-  atomic_mass_map[310830000] = 82.947120301;
-  atomic_mass_map[320830000] = 82.934539101;
-  atomic_mass_map[330830000] = 82.925206901;
-  atomic_mass_map[340830000] = 82.919118569;
-  atomic_mass_map[350830000] = 82.91517562;
-  atomic_mass_map[360830000] = 82.914127164;
-  atomic_mass_map[370830000] = 82.915114183;
-  atomic_mass_map[380830000] = 82.917554374;
-  atomic_mass_map[390830000] = 82.92248525;
-  atomic_mass_map[400830000] = 82.92924215;
-  atomic_mass_map[410830000] = 82.937293731;
-  atomic_mass_map[420830000] = 82.94988;
-  atomic_mass_map[300840000] = 83.965206;
-  atomic_mass_map[310840000] = 83.95246;
-  atomic_mass_map[320840000] = 83.937575092;
-  atomic_mass_map[330840000] = 83.929303292;
-  atomic_mass_map[340840000] = 83.918466763;
-  atomic_mass_map[350840000] = 83.916496419;
-  atomic_mass_map[360840000] = 83.91149772816;
-  atomic_mass_map[370840000] = 83.914375229;
-  atomic_mass_map[380840000] = 83.913419136;
-  atomic_mass_map[390840000] = 83.920672086;
-  atomic_mass_map[400840000] = 83.923326899;
-  atomic_mass_map[410840000] = 83.934492;
-  atomic_mass_map[420840000] = 83.94149;
-  atomic_mass_map[300850000] = 84.97226;
-  atomic_mass_map[310850000] = 84.95699;
-  atomic_mass_map[320850000] = 84.94296966;
-  atomic_mass_map[330850000] = 84.93216366;
-  atomic_mass_map[340850000] = 84.92226076;
-  atomic_mass_map[350850000] = 84.91564576;
-  atomic_mass_map[360850000] = 84.912527262;
-  atomic_mass_map[370850000] = 84.9117897379;
-  atomic_mass_map[380850000] = 84.912932046;
-  atomic_mass_map[390850000] = 84.916433039;
-  atomic_mass_map[400850000] = 84.921444448;
-  atomic_mass_map[410850000] = 84.928845837;
-  atomic_mass_map[420850000] = 84.938260737;
-  atomic_mass_map[430850000] = 84.95058;
-  atomic_mass_map[310860000] = 85.96301;
-  atomic_mass_map[320860000] = 85.94658;
-  atomic_mass_map[330860000] = 85.936701533;
-  atomic_mass_map[340860000] = 85.924311733;
-  atomic_mass_map[350860000] = 85.918805433;
-  atomic_mass_map[360860000] = 85.91061062693;
-  atomic_mass_map[370860000] = 85.911167425;
-  atomic_mass_map[380860000] = 85.909260608;
-  atomic_mass_map[390860000] = 85.91488598;
-  atomic_mass_map[400860000] = 85.916297204;
-  atomic_mass_map[410860000] = 85.925782798;
-  atomic_mass_map[420860000] = 85.931174817;
-  atomic_mass_map[430860000] = 85.94493;
-  atomic_mass_map[310870000] = 86.968245;
-  atomic_mass_map[320870000] = 86.95268;
-  atomic_mass_map[330870000] = 86.940291718;
-  atomic_mass_map[340870000] = 86.928688618;
-  atomic_mass_map[350870000] = 86.920674018;
-  atomic_mass_map[360870000] = 86.91335476;
-  atomic_mass_map[370870000] = 86.909180531;
-  atomic_mass_map[380870000] = 86.908877531;
-  atomic_mass_map[390870000] = 86.910876138;
-  atomic_mass_map[400870000] = 86.914817988;
-  atomic_mass_map[410870000] = 86.920693747;
-  atomic_mass_map[420870000] = 86.928196201;
-  atomic_mass_map[430870000] = 86.938067187;
-  atomic_mass_map[440870000] = 86.95069;
-  atomic_mass_map[320880000] = 87.95691;
-  atomic_mass_map[330880000] = 87.94555;
-  atomic_mass_map[340880000] = 87.931417492;
-  atomic_mass_map[350880000] = 87.924083292;
-  atomic_mass_map[360880000] = 87.914447881;
-  atomic_mass_map[370880000] = 87.911315592;
-  atomic_mass_map[380880000] = 87.905612542;
-  atomic_mass_map[390880000] = 87.909501563;
-  atomic_mass_map[400880000] = 87.91022129;
-  atomic_mass_map[410880000] = 87.91822171;
-  atomic_mass_map[420880000] = 87.921967781;
-  atomic_mass_map[430880000] = 87.933782381;
-  atomic_mass_map[440880000] = 87.9416;
-  atomic_mass_map[320890000] = 88.96379;
-  atomic_mass_map[330890000] = 88.94976;
-  atomic_mass_map[340890000] = 88.93666906;
-  atomic_mass_map[350890000] = 88.92670456;
-  atomic_mass_map[360890000] = 88.917835451;
-  atomic_mass_map[370890000] = 88.912278298;
-  atomic_mass_map[380890000] = 88.907451095;
-  atomic_mass_map[390890000] = 88.905840348;
-  atomic_mass_map[400890000] = 88.908881441;
-  atomic_mass_map[410890000] = 88.913445073;
-  atomic_mass_map[420890000] = 88.919468151;
-  atomic_mass_map[430890000] = 88.927648651;
-  atomic_mass_map[440890000] = 88.93762;
-  atomic_mass_map[450890000] = 88.950584;
-  atomic_mass_map[320900000] = 89.96863;
-  atomic_mass_map[330900000] = 89.95563;
-  atomic_mass_map[340900000] = 89.940096;
-  atomic_mass_map[350900000] = 89.93129285;
-  atomic_mass_map[360900000] = 89.919527931;
-  atomic_mass_map[370900000] = 89.914798453;
-  atomic_mass_map[380900000] = 89.907730037;
-  atomic_mass_map[390900000] = 89.907143942;
-  atomic_mass_map[400900000] = 89.90469765899999;
-  atomic_mass_map[410900000] = 89.911258449;
-  atomic_mass_map[420900000] = 89.913930861;
-  atomic_mass_map[430900000] = 89.924073921;
-  atomic_mass_map[440900000] = 89.93034438;
-  atomic_mass_map[450900000] = 89.94422;
-  atomic_mass_map[330910000] = 90.96039;
-  atomic_mass_map[340910000] = 90.94596;
-  atomic_mass_map[350910000] = 90.934398619;
-  atomic_mass_map[360910000] = 90.923806311;
-  atomic_mass_map[370910000] = 90.916537169;
-  atomic_mass_map[380910000] = 90.910195442;
-  atomic_mass_map[390910000] = 90.907297442;
-  atomic_mass_map[400910000] = 90.905639587;
-  atomic_mass_map[410910000] = 90.906989658;
-  atomic_mass_map[420910000] = 90.911745312;
-  atomic_mass_map[430910000] = 90.918425397;
-  atomic_mass_map[440910000] = 90.926741859;
-  atomic_mass_map[450910000] = 90.93688;
-  atomic_mass_map[460910000] = 90.95032;
-  atomic_mass_map[330920000] = 91.96674;
-  atomic_mass_map[340920000] = 91.94984;
-  atomic_mass_map[350920000] = 91.939631597;
-  atomic_mass_map[360920000] = 91.926173094;
-  atomic_mass_map[370920000] = 91.919728389;
-  atomic_mass_map[380920000] = 91.91103819;
-  atomic_mass_map[390920000] = 91.908945142;
-  atomic_mass_map[400920000] = 91.905034675;
-  atomic_mass_map[410920000] = 91.907188081;
-  atomic_mass_map[420920000] = 91.906807959;
-  atomic_mass_map[430920000] = 91.915269779;
-  atomic_mass_map[440920000] = 91.920234375;
-  atomic_mass_map[450920000] = 91.932367694;
-  atomic_mass_map[460920000] = 91.94087999999999;
-  atomic_mass_map[340930000] = 92.95629;
-  atomic_mass_map[350930000] = 92.943134;
-  atomic_mass_map[360930000] = 92.931147174;
-  atomic_mass_map[370930000] = 92.922039269;
-  atomic_mass_map[380930000] = 92.914024228;
-  atomic_mass_map[390930000] = 92.909577886;
-  atomic_mass_map[400930000] = 92.906469947;
-  atomic_mass_map[410930000] = 92.906373004;
-  atomic_mass_map[420930000] = 92.906809577;
-  atomic_mass_map[430930000] = 92.910245952;
-  atomic_mass_map[440930000] = 92.917104444;
-  atomic_mass_map[450930000] = 92.925912781;
-  atomic_mass_map[460930000] = 92.936511;
-  atomic_mass_map[470930000] = 92.95033;
-  atomic_mass_map[340940000] = 93.96049;
-  atomic_mass_map[350940000] = 93.9489;
-  atomic_mass_map[360940000] = 93.934140454;
-  atomic_mass_map[370940000] = 93.926394814;
-  atomic_mass_map[380940000] = 93.915355602;
-  atomic_mass_map[390940000] = 93.911590582;
-  atomic_mass_map[400940000] = 93.906310828;
-  atomic_mass_map[410940000] = 93.907278836;
-  atomic_mass_map[420940000] = 93.905084903;
-  atomic_mass_map[430940000] = 93.909653637;
-  atomic_mass_map[440940000] = 93.911342863;
-  atomic_mass_map[450940000] = 93.921730453;
-  atomic_mass_map[460940000] = 93.929037603;
-  atomic_mass_map[470940000] = 93.943734;
-  atomic_mass_map[340950000] = 94.9673;
-  atomic_mass_map[350950000] = 94.95301;
-  atomic_mass_map[360950000] = 94.939710924;
-  atomic_mass_map[370950000] = 94.929260004;
-  atomic_mass_map[380950000] = 94.919352941;
-  atomic_mass_map[390950000] = 94.912816058;
-  atomic_mass_map[400950000] = 94.90803853;
-  atomic_mass_map[410950000] = 94.906832404;
-  atomic_mass_map[420950000] = 94.905838766;
-  atomic_mass_map[430950000] = 94.907653612;
-  atomic_mass_map[440950000] = 94.910405759;
-  atomic_mass_map[450950000] = 94.915897895;
-  atomic_mass_map[460950000] = 94.924889838;
-  atomic_mass_map[470950000] = 94.93602;
-  atomic_mass_map[480950000] = 94.94994;
-  atomic_mass_map[350960000] = 95.95903;
-  atomic_mass_map[360960000] = 95.943016618;
-  atomic_mass_map[370960000] = 95.93413338;
-  atomic_mass_map[380960000] = 95.921706575;
-  atomic_mass_map[390960000] = 95.915896835;
-  atomic_mass_map[400960000] = 95.908271433;
-  atomic_mass_map[410960000] = 95.908097286;
-  atomic_mass_map[420960000] = 95.904676115;
-  atomic_mass_map[430960000] = 95.907868022;
-  atomic_mass_map[440960000] = 95.907590255;
-  atomic_mass_map[450960000] = 95.914453051;
-  atomic_mass_map[460960000] = 95.918215084;
-  atomic_mass_map[470960000] = 95.930743906;
-  atomic_mass_map[480960000] = 95.94034;
-  atomic_mass_map[350970000] = 96.96344;
-  atomic_mass_map[360970000] = 96.949088785;
-  atomic_mass_map[370970000] = 96.937177136;
-  atomic_mass_map[380970000] = 96.92637396;
-  atomic_mass_map[390970000] = 96.918274106;
-  atomic_mass_map[400970000] = 96.910951206;
-  atomic_mass_map[410970000] = 96.908095932;
-  atomic_mass_map[420970000] = 96.906018118;
-  atomic_mass_map[430970000] = 96.906366706;
-  atomic_mass_map[440970000] = 96.90754712;
-  atomic_mass_map[450970000] = 96.911329216;
-  atomic_mass_map[460970000] = 96.916471988;
-  atomic_mass_map[470970000] = 96.923965326;
-  atomic_mass_map[480970000] = 96.9351;
-  atomic_mass_map[490970000] = 96.94934;
-  atomic_mass_map[350980000] = 97.96946;
-  atomic_mass_map[360980000] = 97.95243;
-  atomic_mass_map[370980000] = 97.941686868;
-  atomic_mass_map[380980000] = 97.928688778;
-  atomic_mass_map[390980000] = 97.922382119;
-  atomic_mass_map[400980000] = 97.912728892;
-  atomic_mass_map[410980000] = 97.910326459;
-  atomic_mass_map[420980000] = 97.90540482;
-  atomic_mass_map[430980000] = 97.907212365;
-  atomic_mass_map[440980000] = 97.905286813;
-  atomic_mass_map[450980000] = 97.910707839;
-  atomic_mass_map[460980000] = 97.912698337;
-  atomic_mass_map[470980000] = 97.921559973;
-  atomic_mass_map[480980000] = 97.927389318;
-  atomic_mass_map[490980000] = 97.94214;
-  atomic_mass_map[360990000] = 98.95839;
-  atomic_mass_map[370990000] = 98.945028735;
-  atomic_mass_map[380990000] = 98.932890666;
-  atomic_mass_map[390990000] = 98.924147979;
-  atomic_mass_map[400990000] = 98.916666746;
-  atomic_mass_map[410990000] = 98.911613177;
-  atomic_mass_map[420990000] = 98.907708509;
-  atomic_mass_map[430990000] = 98.906250844;
-  atomic_mass_map[440990000] = 98.905934082;
-  atomic_mass_map[450990000] = 98.908128239;
-  atomic_mass_map[460990000] = 98.911774806;
-  atomic_mass_map[470990000] = 98.917645768;
-  atomic_mass_map[480990000] = 98.924925848;
-  atomic_mass_map[490990000] = 98.93411;
-  atomic_mass_map[500990000] = 98.94853;
-  atomic_mass_map[361000000] = 99.96236999999999;
-  atomic_mass_map[371000000] = 99.95003;
-  atomic_mass_map[381000000] = 99.935769692;
-  atomic_mass_map[391000000] = 99.927714692;
-  atomic_mass_map[401000000] = 99.918000576;
-  atomic_mass_map[411000000] = 99.914327592;
-  atomic_mass_map[421000000] = 99.907471782;
-  atomic_mass_map[431000000] = 99.907653877;
-  atomic_mass_map[441000000] = 99.904214256;
-  atomic_mass_map[451000000] = 99.908117264;
-  atomic_mass_map[461000000] = 99.908504805;
-  atomic_mass_map[471000000] = 99.916115445;
-  atomic_mass_map[481000000] = 99.92034882;
-  atomic_mass_map[491000000] = 99.93095718000001;
-  atomic_mass_map[501000000] = 99.938504196;
-  atomic_mass_map[361010000] = 100.96873;
-  atomic_mass_map[371010000] = 100.954039;
-  atomic_mass_map[381010000] = 100.940351743;
-  atomic_mass_map[391010000] = 100.930147705;
-  atomic_mass_map[401010000] = 100.921447964;
-  atomic_mass_map[411010000] = 100.915310254;
-  atomic_mass_map[421010000] = 100.910341447;
-  atomic_mass_map[431010000] = 100.907309057;
-  atomic_mass_map[441010000] = 100.905576872;
-  atomic_mass_map[451010000] = 100.906160613;
-  atomic_mass_map[461010000] = 100.908286412;
-  atomic_mass_map[471010000] = 100.912683953;
-  atomic_mass_map[481010000] = 100.918586211;
-  atomic_mass_map[491010000] = 100.92634;
-  atomic_mass_map[501010000] = 100.935259244;
-  atomic_mass_map[371020000] = 101.95952;
-  atomic_mass_map[381020000] = 101.943790979;
-  atomic_mass_map[391020000] = 101.934327687;
-  atomic_mass_map[401020000] = 101.92314093;
-  atomic_mass_map[411020000] = 101.918077197;
-  atomic_mass_map[421020000] = 101.910283414;
-  atomic_mass_map[431020000] = 101.909209733;
-  atomic_mass_map[441020000] = 101.904344096;
-  atomic_mass_map[451020000] = 101.906837373;
-  atomic_mass_map[461020000] = 101.905602187;
-  atomic_mass_map[471020000] = 101.911704708;
-  atomic_mass_map[481020000] = 101.914481967;
-  atomic_mass_map[491020000] = 101.924107138;
-  atomic_mass_map[501020000] = 101.930290753;
-  atomic_mass_map[371030000] = 102.96392;
-  atomic_mass_map[381030000] = 102.94909;
-  atomic_mass_map[391030000] = 102.937243004;
-  atomic_mass_map[401030000] = 102.927190678;
-  atomic_mass_map[411030000] = 102.919457238;
-  atomic_mass_map[421030000] = 102.913078578;
-  atomic_mass_map[431030000] = 102.909176131;
-  atomic_mass_map[441030000] = 102.906318627;
-  atomic_mass_map[451030000] = 102.905497993;
-  atomic_mass_map[461030000] = 102.906080949;
-  atomic_mass_map[471030000] = 102.908963138;
-  atomic_mass_map[481030000] = 102.913416517;
-  atomic_mass_map[491030000] = 102.919881915;
-  atomic_mass_map[501030000] = 102.928105264;
-  atomic_mass_map[511030000] = 102.93969;
-  atomic_mass_map[381040000] = 103.95265;
-  atomic_mass_map[391040000] = 103.94196;
-  atomic_mass_map[401040000] = 103.929435691;
-  atomic_mass_map[411040000] = 103.922892491;
-  atomic_mass_map[421040000] = 103.913734373;
-  atomic_mass_map[431040000] = 103.911424888;
-  atomic_mass_map[441040000] = 103.905427481;
-  atomic_mass_map[451040000] = 103.90664922;
-  atomic_mass_map[461040000] = 103.90403054;
-  atomic_mass_map[471040000] = 103.908623864;
-  atomic_mass_map[481040000] = 103.909856386;
-  atomic_mass_map[491040000] = 103.918214541;
-  atomic_mass_map[501040000] = 103.923105204;
-  atomic_mass_map[511040000] = 103.936477804;
-  atomic_mass_map[381050000] = 104.95855;
-  atomic_mass_map[391050000] = 104.94544;
-  atomic_mass_map[401050000] = 104.934008204;
-  atomic_mass_map[411050000] = 104.924946471;
-  atomic_mass_map[421050000] = 104.916968617;
-  atomic_mass_map[431050000] = 104.911654883;
-  atomic_mass_map[441050000] = 104.907747645;
-  atomic_mass_map[451050000] = 104.905688549;
-  atomic_mass_map[461050000] = 104.905079626;
-  atomic_mass_map[471050000] = 104.906525615;
-  atomic_mass_map[481050000] = 104.909463896;
-  atomic_mass_map[491050000] = 104.914502325;
-  atomic_mass_map[501050000] = 104.921268429;
-  atomic_mass_map[511050000] = 104.931275897;
-  atomic_mass_map[521050000] = 104.943304508;
-  atomic_mass_map[381060000] = 105.962651;
-  atomic_mass_map[391060000] = 105.95056;
-  atomic_mass_map[401060000] = 105.93676;
-  atomic_mass_map[411060000] = 105.928931712;
-  atomic_mass_map[421060000] = 105.918259464;
-  atomic_mass_map[431060000] = 105.914357598;
-  atomic_mass_map[441060000] = 105.907329104;
-  atomic_mass_map[451060000] = 105.907286801;
-  atomic_mass_map[461060000] = 105.903480426;
-  atomic_mass_map[471060000] = 105.906663637;
-  atomic_mass_map[481060000] = 105.906459928;
-  atomic_mass_map[491060000] = 105.913463735;
-  atomic_mass_map[501060000] = 105.916957404;
-  atomic_mass_map[511060000] = 105.928637982;
-  atomic_mass_map[521060000] = 105.937499664;
-  atomic_mass_map[381070000] = 106.968975;
-  atomic_mass_map[391070000] = 106.95452;
-  atomic_mass_map[401070000] = 106.94174;
-  atomic_mass_map[411070000] = 106.931593654;
-  atomic_mass_map[421070000] = 106.922105877;
-  atomic_mass_map[431070000] = 106.915460645;
-  atomic_mass_map[441070000] = 106.909972045;
-  atomic_mass_map[451070000] = 106.906747811;
-  atomic_mass_map[461070000] = 106.905128195;
-  atomic_mass_map[471070000] = 106.905091611;
-  atomic_mass_map[481070000] = 106.906612122;
-  atomic_mass_map[491070000] = 106.910290084;
-  atomic_mass_map[501070000] = 106.915713652;
-  atomic_mass_map[511070000] = 106.924150641;
-  atomic_mass_map[521070000] = 106.935011573;
-  atomic_mass_map[531070000] = 106.94678;
-  atomic_mass_map[391080000] = 107.95996;
-  atomic_mass_map[401080000] = 107.94487;
-  atomic_mass_map[411080000] = 107.936074773;
-  atomic_mass_map[421080000] = 107.92403349;
-  atomic_mass_map[431080000] = 107.918495722;
-  atomic_mass_map[441080000] = 107.910188022;
-  atomic_mass_map[451080000] = 107.908714473;
-  atomic_mass_map[461080000] = 107.90389164;
-  atomic_mass_map[471080000] = 107.905950346;
-  atomic_mass_map[481080000] = 107.90418344;
-  atomic_mass_map[491080000] = 107.909693524;
-  atomic_mass_map[501080000] = 107.911894287;
-  atomic_mass_map[511080000] = 107.922226735;
-  atomic_mass_map[521080000] = 107.929380467;
-  atomic_mass_map[531080000] = 107.943481623;
-  atomic_mass_map[391090000] = 108.964358;
-  atomic_mass_map[401090000] = 108.95041;
-  atomic_mass_map[411090000] = 108.939216;
-  atomic_mass_map[421090000] = 108.92842416;
-  atomic_mass_map[431090000] = 108.920256356;
-  atomic_mass_map[441090000] = 108.913325956;
-  atomic_mass_map[451090000] = 108.908748821;
-  atomic_mass_map[461090000] = 108.905950406;
-  atomic_mass_map[471090000] = 108.904755282;
-  atomic_mass_map[481090000] = 108.904986653;
-  atomic_mass_map[491090000] = 108.907151381;
-  atomic_mass_map[501090000] = 108.91129206;
-  atomic_mass_map[511090000] = 108.918141122;
-  atomic_mass_map[521090000] = 108.927304534;
-  atomic_mass_map[531090000] = 108.938085287;
-  atomic_mass_map[541090000] = 108.950434864;
-  atomic_mass_map[401100000] = 109.95396;
-  atomic_mass_map[411100000] = 109.94403;
-  atomic_mass_map[421100000] = 109.930703673;
-  atomic_mass_map[431100000] = 109.923743534;
-  atomic_mass_map[441100000] = 109.914040696;
-  atomic_mass_map[451100000] = 109.911079429;
-  atomic_mass_map[461100000] = 109.905172199;
-  atomic_mass_map[471100000] = 109.906110226;
-  atomic_mass_map[481100000] = 109.903006606;
-  atomic_mass_map[491100000] = 109.90716981;
-  atomic_mass_map[501100000] = 109.907844835;
-  atomic_mass_map[511100000] = 109.916854287;
-  atomic_mass_map[521100000] = 109.922458091;
-  atomic_mass_map[531100000] = 109.935089034;
-  atomic_mass_map[541100000] = 109.944263102;
-  atomic_mass_map[401110000] = 110.959678;
-  atomic_mass_map[411110000] = 110.94753;
-  atomic_mass_map[421110000] = 110.935654257;
-  atomic_mass_map[431110000] = 110.925901257;
-  atomic_mass_map[441110000] = 110.917569857;
-  atomic_mass_map[451110000] = 110.91164231;
-  atomic_mass_map[461110000] = 110.907689679;
-  atomic_mass_map[471110000] = 110.905295923;
-  atomic_mass_map[481110000] = 110.904182872;
-  atomic_mass_map[491110000] = 110.905108458;
-  atomic_mass_map[501110000] = 110.907740127;
-  atomic_mass_map[511110000] = 110.913218189;
-  atomic_mass_map[521110000] = 110.921000589;
-  atomic_mass_map[531110000] = 110.930269214;
-  atomic_mass_map[541110000] = 110.941607206;
-  atomic_mass_map[401120000] = 111.963703;
-  atomic_mass_map[411120000] = 111.95247;
-  atomic_mass_map[421120000] = 111.93831;
-  atomic_mass_map[431120000] = 111.929945813;
-  atomic_mass_map[441120000] = 111.918809234;
-  atomic_mass_map[451120000] = 111.914403222;
-  atomic_mass_map[461120000] = 111.907329698;
-  atomic_mass_map[471120000] = 111.90704855;
-  atomic_mass_map[481120000] = 111.902762868;
-  atomic_mass_map[491120000] = 111.905537694;
-  atomic_mass_map[501120000] = 111.904823874;
-  atomic_mass_map[511120000] = 111.912399903;
-  atomic_mass_map[521120000] = 111.91672785;
-  atomic_mass_map[531120000] = 111.92800455;
-  atomic_mass_map[541120000] = 111.935558982;
-  atomic_mass_map[551120000] = 111.950308558;
-  atomic_mass_map[411130000] = 112.95651;
-  atomic_mass_map[421130000] = 112.94335;
-  atomic_mass_map[431130000] = 112.932569035;
-  atomic_mass_map[441130000] = 112.922843999;
-  atomic_mass_map[451130000] = 112.915439342;
-  atomic_mass_map[461130000] = 112.910261042;
-  atomic_mass_map[471130000] = 112.906572893;
-  atomic_mass_map[481130000] = 112.904408133;
-  atomic_mass_map[491130000] = 112.904061839;
-  atomic_mass_map[501130000] = 112.905175728;
-  atomic_mass_map[511130000] = 112.909374536;
-  atomic_mass_map[521130000] = 112.915891;
-  atomic_mass_map[531130000] = 112.923650064;
-  atomic_mass_map[541130000] = 112.93322165;
-  atomic_mass_map[551130000] = 112.944429144;
-  atomic_mass_map[411140000] = 113.96201;
-  atomic_mass_map[421140000] = 113.94653;
-  atomic_mass_map[431140000] = 113.93691;
-  atomic_mass_map[441140000] = 113.924613554;
-  atomic_mass_map[451140000] = 113.918718294;
-  atomic_mass_map[461140000] = 113.910368554;
-  atomic_mass_map[471140000] = 113.908823031;
-  atomic_mass_map[481140000] = 113.903365086;
-  atomic_mass_map[491140000] = 113.904917909;
-  atomic_mass_map[501140000] = 113.902782695;
-  atomic_mass_map[511140000] = 113.909290189;
-  atomic_mass_map[521140000] = 113.912089;
-  atomic_mass_map[531140000] = 113.92185;
-  atomic_mass_map[541140000] = 113.927980331;
-  atomic_mass_map[551140000] = 113.941296176;
-  atomic_mass_map[561140000] = 113.950660438;
-  atomic_mass_map[411150000] = 114.96634;
-  atomic_mass_map[421150000] = 114.95196;
-  atomic_mass_map[431150000] = 114.93998;
-  atomic_mass_map[441150000] = 114.928819898;
-  atomic_mass_map[451150000] = 114.920311589;
-  atomic_mass_map[461150000] = 114.913658506;
-  atomic_mass_map[471150000] = 114.908767355;
-  atomic_mass_map[481150000] = 114.905437513;
-  atomic_mass_map[491150000] = 114.903878776;
-  atomic_mass_map[501150000] = 114.903344699;
-  atomic_mass_map[511150000] = 114.906598;
-  atomic_mass_map[521150000] = 114.911902;
-  atomic_mass_map[531150000] = 114.918048;
-  atomic_mass_map[541150000] = 114.926293945;
-  atomic_mass_map[551150000] = 114.93591;
-  atomic_mass_map[561150000] = 114.94737;
-  atomic_mass_map[421160000] = 115.955448;
-  atomic_mass_map[431160000] = 115.94476;
-  atomic_mass_map[441160000] = 115.931219195;
-  atomic_mass_map[451160000] = 115.924058528;
-  atomic_mass_map[461160000] = 115.914296979;
-  atomic_mass_map[471160000] = 115.911386812;
-  atomic_mass_map[481160000] = 115.904763148;
-  atomic_mass_map[491160000] = 115.905259995;
-  atomic_mass_map[501160000] = 115.901742797;
-  atomic_mass_map[511160000] = 115.906793115;
-  atomic_mass_map[521160000] = 115.90846;
-  atomic_mass_map[531160000] = 115.916808658;
-  atomic_mass_map[541160000] = 115.921581112;
-  atomic_mass_map[551160000] = 115.933373;
-  atomic_mass_map[561160000] = 115.94128;
-  atomic_mass_map[571160000] = 115.956304;
-  atomic_mass_map[421170000] = 116.96117;
-  atomic_mass_map[431170000] = 116.94806;
-  atomic_mass_map[441170000] = 116.936103;
-  atomic_mass_map[451170000] = 116.926035391;
-  atomic_mass_map[461170000] = 116.917954721;
-  atomic_mass_map[471170000] = 116.911773934;
-  atomic_mass_map[481170000] = 116.907225956;
-  atomic_mass_map[491170000] = 116.904515678;
-  atomic_mass_map[501170000] = 116.902953983;
-  atomic_mass_map[511170000] = 116.904841508;
-  atomic_mass_map[521170000] = 116.908646298;
-  atomic_mass_map[531170000] = 116.913648312;
-  atomic_mass_map[541170000] = 116.920358761;
-  atomic_mass_map[551170000] = 116.928616726;
-  atomic_mass_map[561170000] = 116.93814057;
-  atomic_mass_map[571170000] = 116.949985;
-  atomic_mass_map[431180000] = 117.95299;
-  atomic_mass_map[441180000] = 117.93853;
-  atomic_mass_map[451180000] = 117.930340208;
-  atomic_mass_map[461180000] = 117.9190667;
-  atomic_mass_map[471180000] = 117.914595487;
-  atomic_mass_map[481180000] = 117.906921869;
-  atomic_mass_map[491180000] = 117.906356616;
-  atomic_mass_map[501180000] = 117.901606574;
-  atomic_mass_map[511180000] = 117.905532139;
-  atomic_mass_map[521180000] = 117.905853629;
-  atomic_mass_map[531180000] = 117.913074;
-  atomic_mass_map[541180000] = 117.91617868;
-  atomic_mass_map[551180000] = 117.926559519;
-  atomic_mass_map[561180000] = 117.93306;
-  atomic_mass_map[571180000] = 117.94673;
-  atomic_mass_map[431190000] = 118.95666;
-  atomic_mass_map[441190000] = 118.94357;
-  atomic_mass_map[451190000] = 118.932556954;
-  atomic_mass_map[461190000] = 118.923340223;
-  atomic_mass_map[471190000] = 118.915570287;
-  atomic_mass_map[481190000] = 118.909846851;
-  atomic_mass_map[491190000] = 118.905850708;
-  atomic_mass_map[501190000] = 118.903311172;
-  atomic_mass_map[511190000] = 118.903945471;
-  atomic_mass_map[521190000] = 118.906407108;
-  atomic_mass_map[531190000] = 118.910074;
-  atomic_mass_map[541190000] = 118.915410714;
-  atomic_mass_map[551190000] = 118.92237733;
-  atomic_mass_map[561190000] = 118.930659686;
-  atomic_mass_map[571190000] = 118.94099;
-  atomic_mass_map[581190000] = 118.95271;
-  atomic_mass_map[431200000] = 119.96187;
-  atomic_mass_map[441200000] = 119.94631;
-  atomic_mass_map[451200000] = 119.93686;
-  atomic_mass_map[461200000] = 119.924551089;
-  atomic_mass_map[471200000] = 119.918784768;
-  atomic_mass_map[481200000] = 119.909868068;
-  atomic_mass_map[491200000] = 119.907966567;
-  atomic_mass_map[501200000] = 119.902201634;
-  atomic_mass_map[511200000] = 119.905079385;
-  atomic_mass_map[521200000] = 119.9040593;
-  atomic_mass_map[531200000] = 119.910087251;
-  atomic_mass_map[541200000] = 119.91178427;
-  atomic_mass_map[551200000] = 119.920677279;
-  atomic_mass_map[561200000] = 119.926045;
-  atomic_mass_map[571200000] = 119.93807;
-  atomic_mass_map[581200000] = 119.94654;
-  atomic_mass_map[441210000] = 120.95164;
-  atomic_mass_map[451210000] = 120.93942;
-  atomic_mass_map[461210000] = 120.928950345;
-  atomic_mass_map[471210000] = 120.920125282;
-  atomic_mass_map[481210000] = 120.912963663;
-  atomic_mass_map[491210000] = 120.907851062;
-  atomic_mass_map[501210000] = 120.904242554;
-  atomic_mass_map[511210000] = 120.903811967;
-  atomic_mass_map[521210000] = 120.904943812;
-  atomic_mass_map[531210000] = 120.90740505;
-  atomic_mass_map[541210000] = 120.911453015;
-  atomic_mass_map[551210000] = 120.917227238;
-  atomic_mass_map[561210000] = 120.92405229;
-  atomic_mass_map[571210000] = 120.93315;
-  atomic_mass_map[581210000] = 120.94335;
-  atomic_mass_map[591210000] = 120.95532;
-  atomic_mass_map[441220000] = 121.95447;
-  atomic_mass_map[451220000] = 121.94399;
-  atomic_mass_map[461220000] = 121.930631696;
-  atomic_mass_map[471220000] = 121.923664449;
-  atomic_mass_map[481220000] = 121.913459053;
-  atomic_mass_map[491220000] = 121.910280738;
-  atomic_mass_map[501220000] = 121.903443774;
-  atomic_mass_map[511220000] = 121.905169948;
-  atomic_mass_map[521220000] = 121.903043455;
-  atomic_mass_map[531220000] = 121.907588841;
-  atomic_mass_map[541220000] = 121.908367658;
-  atomic_mass_map[551220000] = 121.916108146;
-  atomic_mass_map[561220000] = 121.919904;
-  atomic_mass_map[571220000] = 121.93071;
-  atomic_mass_map[581220000] = 121.93787;
-  atomic_mass_map[591220000] = 121.95175;
-  atomic_mass_map[441230000] = 122.95989;
-  atomic_mass_map[451230000] = 122.94685;
-  atomic_mass_map[461230000] = 122.93514;
-  atomic_mass_map[471230000] = 122.925337063;
-  atomic_mass_map[481230000] = 122.916892453;
-  atomic_mass_map[491230000] = 122.910433718;
-  atomic_mass_map[501230000] = 122.905725221;
-  atomic_mass_map[511230000] = 122.904213204;
-  atomic_mass_map[521230000] = 122.904269769;
-  atomic_mass_map[531230000] = 122.905588537;
-  atomic_mass_map[541230000] = 122.908481757;
-  atomic_mass_map[551230000] = 122.912996063;
-  atomic_mass_map[561230000] = 122.918781063;
-  atomic_mass_map[571230000] = 122.9263;
-  atomic_mass_map[581230000] = 122.93528;
-  atomic_mass_map[591230000] = 122.94596;
-  atomic_mass_map[441240000] = 123.96305;
-  atomic_mass_map[451240000] = 123.95151;
-  atomic_mass_map[461240000] = 123.93714;
-  atomic_mass_map[471240000] = 123.928931229;
-  atomic_mass_map[481240000] = 123.917657364;
-  atomic_mass_map[491240000] = 123.913182245;
-  atomic_mass_map[501240000] = 123.905276645;
-  atomic_mass_map[511240000] = 123.905934978;
-  atomic_mass_map[521240000] = 123.902817085;
-  atomic_mass_map[531240000] = 123.906209041;
-  atomic_mass_map[541240000] = 123.905891984;
-  atomic_mass_map[551240000] = 123.912257798;
-  atomic_mass_map[561240000] = 123.915093629;
-  atomic_mass_map[571240000] = 123.924574275;
-  atomic_mass_map[581240000] = 123.93031;
-  atomic_mass_map[591240000] = 123.94294;
-  atomic_mass_map[601240000] = 123.9522;
-  atomic_mass_map[451250000] = 124.95469;
-  atomic_mass_map[461250000] = 124.94179;
-  atomic_mass_map[471250000] = 124.931046;
-  atomic_mass_map[481250000] = 124.921257577;
-  atomic_mass_map[491250000] = 124.913604553;
-  atomic_mass_map[501250000] = 124.907786395;
-  atomic_mass_map[511250000] = 124.905253007;
-  atomic_mass_map[521250000] = 124.90442992;
-  atomic_mass_map[531250000] = 124.904629353;
-  atomic_mass_map[541250000] = 124.906394445;
-  atomic_mass_map[551250000] = 124.909727985;
-  atomic_mass_map[561250000] = 124.914471843;
-  atomic_mass_map[571250000] = 124.920815932;
-  atomic_mass_map[581250000] = 124.92844;
-  atomic_mass_map[591250000] = 124.9377;
-  atomic_mass_map[601250000] = 124.9489;
-  atomic_mass_map[451260000] = 125.95946;
-  atomic_mass_map[461260000] = 125.94416;
-  atomic_mass_map[471260000] = 125.93475;
-  atomic_mass_map[481260000] = 125.922429128;
-  atomic_mass_map[491260000] = 125.916507322;
-  atomic_mass_map[501260000] = 125.907658786;
-  atomic_mass_map[511260000] = 125.907252987;
-  atomic_mass_map[521260000] = 125.903310886;
-  atomic_mass_map[531260000] = 125.905623329;
-  atomic_mass_map[541260000] = 125.904298292;
-  atomic_mass_map[551260000] = 125.909446057;
-  atomic_mass_map[561260000] = 125.911250204;
-  atomic_mass_map[571260000] = 125.919512667;
-  atomic_mass_map[581260000] = 125.923971;
-  atomic_mass_map[591260000] = 125.93524;
-  atomic_mass_map[601260000] = 125.94311;
-  atomic_mass_map[611260000] = 125.95792;
-  atomic_mass_map[461270000] = 126.94907;
-  atomic_mass_map[471270000] = 126.93711;
-  atomic_mass_map[481270000] = 126.926472404;
-  atomic_mass_map[491270000] = 126.917446276;
-  atomic_mass_map[501270000] = 126.910389943;
-  atomic_mass_map[511270000] = 126.906924278;
-  atomic_mass_map[521270000] = 126.905225735;
-  atomic_mass_map[531270000] = 126.904471853;
-  atomic_mass_map[541270000] = 126.905182914;
-  atomic_mass_map[551270000] = 126.907417384;
-  atomic_mass_map[561270000] = 126.911091275;
-  atomic_mass_map[571270000] = 126.916375084;
-  atomic_mass_map[581270000] = 126.922727;
-  atomic_mass_map[591270000] = 126.93071;
-  atomic_mass_map[601270000] = 126.94038;
-  atomic_mass_map[611270000] = 126.95192;
-  atomic_mass_map[461280000] = 127.95183;
-  atomic_mass_map[471280000] = 127.94106;
-  atomic_mass_map[481280000] = 127.927812858;
-  atomic_mass_map[491280000] = 127.920401044;
-  atomic_mass_map[501280000] = 127.910507184;
-  atomic_mass_map[511280000] = 127.909145628;
-  atomic_mass_map[521280000] = 127.904461279;
-  atomic_mass_map[531280000] = 127.905808615;
-  atomic_mass_map[541280000] = 127.903531018;
-  atomic_mass_map[551280000] = 127.907748666;
-  atomic_mass_map[561280000] = 127.908341967;
-  atomic_mass_map[571280000] = 127.915592123;
-  atomic_mass_map[581280000] = 127.918911;
-  atomic_mass_map[591280000] = 127.928791;
-  atomic_mass_map[601280000] = 127.93525;
-  atomic_mass_map[611280000] = 127.9487;
-  atomic_mass_map[621280000] = 127.95842;
-  atomic_mass_map[471290000] = 128.94395;
-  atomic_mass_map[481290000] = 128.93182;
-  atomic_mass_map[491290000] = 128.921805301;
-  atomic_mass_map[501290000] = 128.913464711;
-  atomic_mass_map[511290000] = 128.909146665;
-  atomic_mass_map[521290000] = 128.90659646;
-  atomic_mass_map[531290000] = 128.904983669;
-  atomic_mass_map[541290000] = 128.90478086113;
-  atomic_mass_map[551290000] = 128.906065683;
-  atomic_mass_map[561290000] = 128.908680798;
-  atomic_mass_map[571290000] = 128.912694431;
-  atomic_mass_map[581290000] = 128.918102;
-  atomic_mass_map[591290000] = 128.925095;
-  atomic_mass_map[601290000] = 128.933102;
-  atomic_mass_map[611290000] = 128.94323;
-  atomic_mass_map[621290000] = 128.95476;
-  atomic_mass_map[471300000] = 129.950703;
-  atomic_mass_map[481300000] = 129.933940679;
-  atomic_mass_map[491300000] = 129.924976585;
-  atomic_mass_map[501300000] = 129.91397383;
-  atomic_mass_map[511300000] = 129.911662054;
-  atomic_mass_map[521300000] = 129.906222748;
-  atomic_mass_map[531300000] = 129.906670193;
-  atomic_mass_map[541300000] = 129.903509349;
-  atomic_mass_map[551300000] = 129.906709283;
-  atomic_mass_map[561300000] = 129.906320669;
-  atomic_mass_map[571300000] = 129.912369413;
-  atomic_mass_map[581300000] = 129.914736;
-  atomic_mass_map[591300000] = 129.92359;
-  atomic_mass_map[601300000] = 129.928506;
-  atomic_mass_map[611300000] = 129.94053;
-  atomic_mass_map[621300000] = 129.949;
-  atomic_mass_map[631300000] = 129.963689;
-  atomic_mass_map[481310000] = 130.9406;
-  atomic_mass_map[491310000] = 130.926971529;
-  atomic_mass_map[501310000] = 130.917044954;
-  atomic_mass_map[511310000] = 130.911988799;
-  atomic_mass_map[521310000] = 130.908522213;
-  atomic_mass_map[531310000] = 130.906126305;
-  atomic_mass_map[541310000] = 130.905084057;
-  atomic_mass_map[551310000] = 130.905464899;
-  atomic_mass_map[561310000] = 130.906940977;
-  atomic_mass_map[571310000] = 130.91007;
-  atomic_mass_map[581310000] = 130.914429465;
-  atomic_mass_map[591310000] = 130.92023496;
-  atomic_mass_map[601310000] = 130.92724802;
-  atomic_mass_map[611310000] = 130.93567;
-  atomic_mass_map[621310000] = 130.94618;
-  atomic_mass_map[631310000] = 130.957842;
-  atomic_mass_map[481320000] = 131.94604;
-  atomic_mass_map[491320000] = 131.933001273;
-  atomic_mass_map[501320000] = 131.917826725;
-  atomic_mass_map[511320000] = 131.914507691;
-  atomic_mass_map[521320000] = 131.908546716;
-  atomic_mass_map[531320000] = 131.907993514;
-  atomic_mass_map[541320000] = 131.90415508563;
-  atomic_mass_map[551320000] = 131.906433914;
-  atomic_mass_map[561320000] = 131.905061128;
-  atomic_mass_map[571320000] = 131.910118979;
-  atomic_mass_map[581320000] = 131.911463775;
-  atomic_mass_map[591320000] = 131.919255;
-  atomic_mass_map[601320000] = 131.923321237;
-  atomic_mass_map[611320000] = 131.93384;
-  atomic_mass_map[621320000] = 131.94087;
-  atomic_mass_map[631320000] = 131.95467;
-  atomic_mass_map[481330000] = 132.95285;
-  atomic_mass_map[491330000] = 132.93831;
-  atomic_mass_map[501330000] = 132.923913404;
-  atomic_mass_map[511330000] = 132.915273198;
-  atomic_mass_map[521330000] = 132.910968766;
-  atomic_mass_map[531330000] = 132.907796968;
-  atomic_mass_map[541330000] = 132.905910751;
-  atomic_mass_map[551330000] = 132.905451961;
-  atomic_mass_map[561330000] = 132.906007351;
-  atomic_mass_map[571330000] = 132.908218;
-  atomic_mass_map[581330000] = 132.911520402;
-  atomic_mass_map[591330000] = 132.916330561;
-  atomic_mass_map[601330000] = 132.922348;
-  atomic_mass_map[611330000] = 132.929782;
-  atomic_mass_map[621330000] = 132.93856;
-  atomic_mass_map[631330000] = 132.94929;
-  atomic_mass_map[641330000] = 132.96133;
-  atomic_mass_map[491340000] = 133.94454;
-  atomic_mass_map[501340000] = 133.928682064;
-  atomic_mass_map[511340000] = 133.920535676;
-  atomic_mass_map[521340000] = 133.911393959;
-  atomic_mass_map[531340000] = 133.909758836;
-  atomic_mass_map[541340000] = 133.905394664;
-  atomic_mass_map[551340000] = 133.906718503;
-  atomic_mass_map[561340000] = 133.904508182;
-  atomic_mass_map[571340000] = 133.908514011;
-  atomic_mass_map[581340000] = 133.908928142;
-  atomic_mass_map[591340000] = 133.915696729;
-  atomic_mass_map[601340000] = 133.91879021;
-  atomic_mass_map[611340000] = 133.928353;
-  atomic_mass_map[621340000] = 133.93411;
-  atomic_mass_map[631340000] = 133.9464;
-  atomic_mass_map[641340000] = 133.95566;
-  atomic_mass_map[491350000] = 134.95005;
-  atomic_mass_map[501350000] = 134.934908606;
-  atomic_mass_map[511350000] = 134.925185106;
-  atomic_mass_map[521350000] = 134.916555706;
-  atomic_mass_map[531350000] = 134.910048847;
-  atomic_mass_map[541350000] = 134.90722778;
-  atomic_mass_map[551350000] = 134.905977049;
-  atomic_mass_map[561350000] = 134.905688375;
-  atomic_mass_map[571350000] = 134.906984363;
-  atomic_mass_map[581350000] = 134.909160599;
-  atomic_mass_map[591350000] = 134.913111775;
-  atomic_mass_map[601350000] = 134.918181321;
-  atomic_mass_map[611350000] = 134.924823;
-  atomic_mass_map[621350000] = 134.93252;
-  atomic_mass_map[631350000] = 134.94187;
-  atomic_mass_map[641350000] = 134.95245;
-  atomic_mass_map[651350000] = 134.96476;
-  atomic_mass_map[501360000] = 135.93999;
-  atomic_mass_map[511360000] = 135.930745879;
-  atomic_mass_map[521360000] = 135.920100608;
-  atomic_mass_map[531360000] = 135.914604412;
-  atomic_mass_map[541360000] = 135.907214484;
-  atomic_mass_map[551360000] = 135.907311358;
-  atomic_mass_map[561360000] = 135.904575727;
-  atomic_mass_map[571360000] = 135.907634962;
-  atomic_mass_map[581360000] = 135.907129205;
-  atomic_mass_map[591360000] = 135.912677456;
-  atomic_mass_map[601360000] = 135.914976064;
-  atomic_mass_map[611360000] = 135.923584586;
-  atomic_mass_map[621360000] = 135.928275556;
-  atomic_mass_map[631360000] = 135.93962;
-  atomic_mass_map[641360000] = 135.9473;
-  atomic_mass_map[651360000] = 135.96129;
-  atomic_mass_map[501370000] = 136.94655;
-  atomic_mass_map[511370000] = 136.935555;
-  atomic_mass_map[521370000] = 136.925598852;
-  atomic_mass_map[531370000] = 136.918028188;
-  atomic_mass_map[541370000] = 136.911557781;
-  atomic_mass_map[551370000] = 136.907089231;
-  atomic_mass_map[561370000] = 136.905827141;
-  atomic_mass_map[571370000] = 136.906450385;
-  atomic_mass_map[581370000] = 136.907762364;
-  atomic_mass_map[591370000] = 136.91067915;
-  atomic_mass_map[601370000] = 136.914562448;
-  atomic_mass_map[611370000] = 136.920479523;
-  atomic_mass_map[621370000] = 136.926970517;
-  atomic_mass_map[631370000] = 136.93546;
-  atomic_mass_map[641370000] = 136.94502;
-  atomic_mass_map[651370000] = 136.95602;
-  atomic_mass_map[501380000] = 137.95184;
-  atomic_mass_map[511380000] = 137.94145;
-  atomic_mass_map[521380000] = 137.929472226;
-  atomic_mass_map[531380000] = 137.922726402;
-  atomic_mass_map[541380000] = 137.914146273;
-  atomic_mass_map[551380000] = 137.911017089;
-  atomic_mass_map[561380000] = 137.905246995;
-  atomic_mass_map[571380000] = 137.907114919;
-  atomic_mass_map[581380000] = 137.905991089;
-  atomic_mass_map[591380000] = 137.910754405;
-  atomic_mass_map[601380000] = 137.911949718;
-  atomic_mass_map[611380000] = 137.919548077;
-  atomic_mass_map[621380000] = 137.923243991;
-  atomic_mass_map[631380000] = 137.933709;
-  atomic_mass_map[641380000] = 137.94025;
-  atomic_mass_map[651380000] = 137.95312;
-  atomic_mass_map[661380000] = 137.9625;
-  atomic_mass_map[511390000] = 138.94655;
-  atomic_mass_map[521390000] = 138.935367194;
-  atomic_mass_map[531390000] = 138.926506206;
-  atomic_mass_map[541390000] = 138.918792203;
-  atomic_mass_map[551390000] = 138.913363758;
-  atomic_mass_map[561390000] = 138.908841099;
-  atomic_mass_map[571390000] = 138.906356256;
-  atomic_mass_map[581390000] = 138.906655111;
-  atomic_mass_map[591390000] = 138.908940762;
-  atomic_mass_map[601390000] = 138.911953649;
-  atomic_mass_map[611390000] = 138.91679967;
-  atomic_mass_map[621390000] = 138.922296635;
-  atomic_mass_map[631390000] = 138.92979231;
-  atomic_mass_map[641390000] = 138.93813;
-  atomic_mass_map[651390000] = 138.94833;
-  atomic_mass_map[661390000] = 138.95959;
-  atomic_mass_map[511400000] = 139.95283;
-  atomic_mass_map[521400000] = 139.939498567;
-  atomic_mass_map[531400000] = 139.931727;
-  atomic_mass_map[541400000] = 139.921645817;
-  atomic_mass_map[551400000] = 139.917283063;
-  atomic_mass_map[561400000] = 139.91060573;
-  atomic_mass_map[571400000] = 139.909480635;
-  atomic_mass_map[581400000] = 139.905443107;
-  atomic_mass_map[591400000] = 139.909080275;
-  atomic_mass_map[601400000] = 139.909549849;
-  atomic_mass_map[611400000] = 139.916039639;
-  atomic_mass_map[621400000] = 139.918994717;
-  atomic_mass_map[631400000] = 139.928087637;
-  atomic_mass_map[641400000] = 139.933674;
-  atomic_mass_map[651400000] = 139.945805049;
-  atomic_mass_map[661400000] = 139.95402;
-  atomic_mass_map[671400000] = 139.968589;
-  atomic_mass_map[521410000] = 140.9458;
-  atomic_mass_map[531410000] = 140.93569;
-  atomic_mass_map[541410000] = 140.926787184;
-  atomic_mass_map[551410000] = 140.920045491;
-  atomic_mass_map[561410000] = 140.914403333;
-  atomic_mass_map[571410000] = 140.91096603;
-  atomic_mass_map[581410000] = 140.908280674;
-  atomic_mass_map[591410000] = 140.907657568;
-  atomic_mass_map[601410000] = 140.909614653;
-  atomic_mass_map[611410000] = 140.913555084;
-  atomic_mass_map[621410000] = 140.918481636;
-  atomic_mass_map[631410000] = 140.924931754;
-  atomic_mass_map[641410000] = 140.932126;
-  atomic_mass_map[651410000] = 140.941448;
-  atomic_mass_map[661410000] = 140.95128;
-  atomic_mass_map[671410000] = 140.963108;
-  atomic_mass_map[521420000] = 141.95022;
-  atomic_mass_map[531420000] = 141.941202;
-  atomic_mass_map[541420000] = 141.929973098;
-  atomic_mass_map[551420000] = 141.924295991;
-  atomic_mass_map[561420000] = 141.916432382;
-  atomic_mass_map[571420000] = 141.91409089;
-  atomic_mass_map[581420000] = 141.909250375;
-  atomic_mass_map[591420000] = 141.910049607;
-  atomic_mass_map[601420000] = 141.907728996;
-  atomic_mass_map[611420000] = 141.912890411;
-  atomic_mass_map[621420000] = 141.915204385;
-  atomic_mass_map[631420000] = 141.92344169;
-  atomic_mass_map[641420000] = 141.928116;
-  atomic_mass_map[651420000] = 141.939280859;
-  atomic_mass_map[661420000] = 141.946194;
-  atomic_mass_map[671420000] = 141.96001;
-  atomic_mass_map[681420000] = 141.9701;
-  atomic_mass_map[521430000] = 142.95676;
-  atomic_mass_map[531430000] = 142.94565;
-  atomic_mass_map[541430000] = 142.935369554;
-  atomic_mass_map[551430000] = 142.927349327;
-  atomic_mass_map[561430000] = 142.920625293;
-  atomic_mass_map[571430000] = 142.916079512;
-  atomic_mass_map[581430000] = 142.91239212;
-  atomic_mass_map[591430000] = 142.910822796;
-  atomic_mass_map[601430000] = 142.909819989;
-  atomic_mass_map[611430000] = 142.910938262;
-  atomic_mass_map[621430000] = 142.914635303;
-  atomic_mass_map[631430000] = 142.920298681;
-  atomic_mass_map[641430000] = 142.926750682;
-  atomic_mass_map[651430000] = 142.935137335;
-  atomic_mass_map[661430000] = 142.943994335;
-  atomic_mass_map[671430000] = 142.95486;
-  atomic_mass_map[681430000] = 142.96662;
-  atomic_mass_map[531440000] = 143.95139;
-  atomic_mass_map[541440000] = 143.938945079;
-  atomic_mass_map[551440000] = 143.932076313;
-  atomic_mass_map[561440000] = 143.922954866;
-  atomic_mass_map[571440000] = 143.919645589;
-  atomic_mass_map[581440000] = 143.913652939;
-  atomic_mass_map[591440000] = 143.913310859;
-  atomic_mass_map[601440000] = 143.910092974;
-  atomic_mass_map[611440000] = 143.912596396;
-  atomic_mass_map[621440000] = 143.912006466;
-  atomic_mass_map[631440000] = 143.918819553;
-  atomic_mass_map[641440000] = 143.922963;
-  atomic_mass_map[651440000] = 143.933045;
-  atomic_mass_map[661440000] = 143.939269515;
-  atomic_mass_map[671440000] = 143.952109715;
-  atomic_mass_map[681440000] = 143.9607;
-  atomic_mass_map[691440000] = 143.976283;
-  atomic_mass_map[531450000] = 144.95605;
-  atomic_mass_map[541450000] = 144.944719634;
-  atomic_mass_map[551450000] = 144.935527435;
-  atomic_mass_map[561450000] = 144.9275184;
-  atomic_mass_map[571450000] = 144.921808068;
-  atomic_mass_map[581450000] = 144.917265228;
-  atomic_mass_map[591450000] = 144.914518156;
-  atomic_mass_map[601450000] = 144.912579322;
-  atomic_mass_map[611450000] = 144.912755935;
-  atomic_mass_map[621450000] = 144.913417339;
-  atomic_mass_map[631450000] = 144.916272629;
-  atomic_mass_map[641450000] = 144.921712821;
-  atomic_mass_map[651450000] = 144.928821947;
-  atomic_mass_map[661450000] = 144.937473995;
-  atomic_mass_map[671450000] = 144.947267395;
-  atomic_mass_map[681450000] = 144.95805;
-  atomic_mass_map[691450000] = 144.970389;
-  atomic_mass_map[541460000] = 145.948518249;
-  atomic_mass_map[551460000] = 145.940344271;
-  atomic_mass_map[561460000] = 145.930283712;
-  atomic_mass_map[571460000] = 145.925875174;
-  atomic_mass_map[581460000] = 145.918802412;
-  atomic_mass_map[591460000] = 145.91767985;
-  atomic_mass_map[601460000] = 145.913122628;
-  atomic_mass_map[611460000] = 145.914702396;
-  atomic_mass_map[621460000] = 145.913046991;
-  atomic_mass_map[631460000] = 145.917211039;
-  atomic_mass_map[641460000] = 145.918318817;
-  atomic_mass_map[651460000] = 145.927252984;
-  atomic_mass_map[661460000] = 145.93284453;
-  atomic_mass_map[671460000] = 145.944993506;
-  atomic_mass_map[681460000] = 145.95241836;
-  atomic_mass_map[691460000] = 145.966837;
-  atomic_mass_map[541470000] = 146.95426;
-  atomic_mass_map[551470000] = 146.944156156;
-  atomic_mass_map[561470000] = 146.9353039;
-  atomic_mass_map[571470000] = 146.9284178;
-  atomic_mass_map[581470000] = 146.922689913;
-  atomic_mass_map[591470000] = 146.919007518;
-  atomic_mass_map[601470000] = 146.916106136;
-  atomic_mass_map[611470000] = 146.915144988;
-  atomic_mass_map[621470000] = 146.914904435;
-  atomic_mass_map[631470000] = 146.916752659;
-  atomic_mass_map[641470000] = 146.919101384;
-  atomic_mass_map[651470000] = 146.924054788;
-  atomic_mass_map[661470000] = 146.931082715;
-  atomic_mass_map[671470000] = 146.940142296;
-  atomic_mass_map[681470000] = 146.949964459;
-  atomic_mass_map[691470000] = 146.961379891;
-  atomic_mass_map[541480000] = 147.95813;
-  atomic_mass_map[551480000] = 147.949225137;
-  atomic_mass_map[561480000] = 147.938170578;
-  atomic_mass_map[571480000] = 147.9326794;
-  atomic_mass_map[581480000] = 147.924424225;
-  atomic_mass_map[591480000] = 147.922130083;
-  atomic_mass_map[601480000] = 147.916899294;
-  atomic_mass_map[611480000] = 147.917481945;
-  atomic_mass_map[621480000] = 147.914829226;
-  atomic_mass_map[631480000] = 147.918089243;
-  atomic_mass_map[641480000] = 147.918121511;
-  atomic_mass_map[651480000] = 147.924281552;
-  atomic_mass_map[661480000] = 147.927156571;
-  atomic_mass_map[671480000] = 147.937743928;
-  atomic_mass_map[681480000] = 147.944735029;
-  atomic_mass_map[691480000] = 147.958384029;
-  atomic_mass_map[701480000] = 147.96758;
-  atomic_mass_map[551490000] = 148.95302;
-  atomic_mass_map[561490000] = 148.94308;
-  atomic_mass_map[571490000] = 148.93535126;
-  atomic_mass_map[581490000] = 148.9284269;
-  atomic_mass_map[591490000] = 148.9237361;
-  atomic_mass_map[601490000] = 148.920154849;
-  atomic_mass_map[611490000] = 148.918342277;
-  atomic_mass_map[621490000] = 148.917192062;
-  atomic_mass_map[631490000] = 148.917937763;
-  atomic_mass_map[641490000] = 148.919348117;
-  atomic_mass_map[651490000] = 148.923253549;
-  atomic_mass_map[661490000] = 148.927321692;
-  atomic_mass_map[671490000] = 148.933802646;
-  atomic_mass_map[681490000] = 148.942306;
-  atomic_mass_map[691490000] = 148.95289;
-  atomic_mass_map[701490000] = 148.96436;
-  atomic_mass_map[551500000] = 149.95833;
-  atomic_mass_map[561500000] = 149.94605;
-  atomic_mass_map[571500000] = 149.93947;
-  atomic_mass_map[581500000] = 149.93038404200001;
-  atomic_mass_map[591500000] = 149.926676502;
-  atomic_mass_map[601500000] = 149.920902249;
-  atomic_mass_map[611500000] = 149.920990941;
-  atomic_mass_map[621500000] = 149.917282919;
-  atomic_mass_map[631500000] = 149.919707671;
-  atomic_mass_map[641500000] = 149.918664422;
-  atomic_mass_map[651500000] = 149.923664941;
-  atomic_mass_map[661500000] = 149.925593264;
-  atomic_mass_map[671500000] = 149.933498408;
-  atomic_mass_map[681500000] = 149.937915567;
-  atomic_mass_map[691500000] = 149.95009;
-  atomic_mass_map[701500000] = 149.95852;
-  atomic_mass_map[711500000] = 149.973548;
-  atomic_mass_map[551510000] = 150.96258;
-  atomic_mass_map[561510000] = 150.95127;
-  atomic_mass_map[571510000] = 150.94232;
-  atomic_mass_map[581510000] = 150.9342722;
-  atomic_mass_map[591510000] = 150.928309285;
-  atomic_mass_map[601510000] = 150.923840289;
-  atomic_mass_map[611510000] = 150.921217539;
-  atomic_mass_map[621510000] = 150.919939796;
-  atomic_mass_map[631510000] = 150.919857803;
-  atomic_mass_map[641510000] = 150.92035595;
-  atomic_mass_map[651510000] = 150.923109599;
-  atomic_mass_map[661510000] = 150.926191564;
-  atomic_mass_map[671510000] = 150.931698345;
-  atomic_mass_map[681510000] = 150.937448567;
-  atomic_mass_map[691510000] = 150.945487875;
-  atomic_mass_map[701510000] = 150.955402497;
-  atomic_mass_map[711510000] = 150.967677;
-  atomic_mass_map[561520000] = 151.95481;
-  atomic_mass_map[571520000] = 151.94682;
-  atomic_mass_map[581520000] = 151.9366;
-  atomic_mass_map[591520000] = 151.9315529;
-  atomic_mass_map[601520000] = 151.924692216;
-  atomic_mass_map[611520000] = 151.923506181;
-  atomic_mass_map[621520000] = 151.919739721;
-  atomic_mass_map[631520000] = 151.921752184;
-  atomic_mass_map[641520000] = 151.919799494;
-  atomic_mass_map[651520000] = 151.924082936;
-  atomic_mass_map[661520000] = 151.924725286;
-  atomic_mass_map[671520000] = 151.931723623;
-  atomic_mass_map[681520000] = 151.935057085;
-  atomic_mass_map[691520000] = 151.944422;
-  atomic_mass_map[701520000] = 151.9502727;
-  atomic_mass_map[711520000] = 151.96412;
-  atomic_mass_map[561530000] = 152.96036;
-  atomic_mass_map[571530000] = 152.95036;
-  atomic_mass_map[581530000] = 152.94093;
-  atomic_mass_map[591530000] = 152.933903539;
-  atomic_mass_map[601530000] = 152.927717978;
-  atomic_mass_map[611530000] = 152.924156686;
-  atomic_mass_map[621530000] = 152.92210465;
-  atomic_mass_map[631530000] = 152.921238003;
-  atomic_mass_map[641530000] = 152.921758027;
-  atomic_mass_map[651530000] = 152.923442403;
-  atomic_mass_map[661530000] = 152.925772378;
-  atomic_mass_map[671530000] = 152.930206429;
-  atomic_mass_map[681530000] = 152.93508044;
-  atomic_mass_map[691530000] = 152.942040101;
-  atomic_mass_map[701530000] = 152.94932;
-  atomic_mass_map[711530000] = 152.958751054;
-  atomic_mass_map[721530000] = 152.97069;
-  atomic_mass_map[571540000] = 153.95517;
-  atomic_mass_map[581540000] = 153.9438;
-  atomic_mass_map[591540000] = 153.937525741;
-  atomic_mass_map[601540000] = 153.929484894;
-  atomic_mass_map[611540000] = 153.926471531;
-  atomic_mass_map[621540000] = 153.922216861;
-  atomic_mass_map[631540000] = 153.922986962;
-  atomic_mass_map[641540000] = 153.92087406;
-  atomic_mass_map[651540000] = 153.924684767;
-  atomic_mass_map[661540000] = 153.924429277;
-  atomic_mass_map[671540000] = 153.930606834;
-  atomic_mass_map[681540000] = 153.932790842;
-  atomic_mass_map[691540000] = 153.941570033;
-  atomic_mass_map[701540000] = 153.946395655;
-  atomic_mass_map[711540000] = 153.957364;
-  atomic_mass_map[721540000] = 153.96486;
-  atomic_mass_map[571550000] = 154.95901;
-  atomic_mass_map[581550000] = 154.94855;
-  atomic_mass_map[591550000] = 154.940509281;
-  atomic_mass_map[601550000] = 154.933135691;
-  atomic_mass_map[611550000] = 154.928137048;
-  atomic_mass_map[621550000] = 154.924647748;
-  atomic_mass_map[631550000] = 154.922901107;
-  atomic_mass_map[641550000] = 154.922630473;
-  atomic_mass_map[651550000] = 154.923510547;
-  atomic_mass_map[661550000] = 154.925759086;
-  atomic_mass_map[671550000] = 154.929104049;
-  atomic_mass_map[681550000] = 154.933215911;
-  atomic_mass_map[691550000] = 154.93920966;
-  atomic_mass_map[701550000] = 154.945783132;
-  atomic_mass_map[711550000] = 154.9543206;
-  atomic_mass_map[721550000] = 154.96311;
-  atomic_mass_map[731550000] = 154.974245;
-  atomic_mass_map[581560000] = 155.95183;
-  atomic_mass_map[591560000] = 155.94464;
-  atomic_mass_map[601560000] = 155.935078894;
-  atomic_mass_map[611560000] = 155.931117516;
-  atomic_mass_map[621560000] = 155.925536067;
-  atomic_mass_map[631560000] = 155.924760494;
-  atomic_mass_map[641560000] = 155.922131241;
-  atomic_mass_map[651560000] = 155.924755181;
-  atomic_mass_map[661560000] = 155.924284713;
-  atomic_mass_map[671560000] = 155.929706112;
-  atomic_mass_map[681560000] = 155.931067313;
-  atomic_mass_map[691560000] = 155.938991573;
-  atomic_mass_map[701560000] = 155.942824698;
-  atomic_mass_map[711560000] = 155.953032522;
-  atomic_mass_map[721560000] = 155.959347805;
-  atomic_mass_map[731560000] = 155.97203;
-  atomic_mass_map[581570000] = 156.95705;
-  atomic_mass_map[591570000] = 156.94789;
-  atomic_mass_map[601570000] = 156.939386061;
-  atomic_mass_map[611570000] = 156.933121393;
-  atomic_mass_map[621570000] = 156.928418698;
-  atomic_mass_map[631570000] = 156.925433446;
-  atomic_mass_map[641570000] = 156.923968569;
-  atomic_mass_map[651570000] = 156.924033028;
-  atomic_mass_map[661570000] = 156.92547066;
-  atomic_mass_map[671570000] = 156.928254427;
-  atomic_mass_map[681570000] = 156.931948658;
-  atomic_mass_map[691570000] = 156.93694412;
-  atomic_mass_map[701570000] = 156.942645349;
-  atomic_mass_map[711570000] = 156.950126667;
-  atomic_mass_map[721570000] = 156.958236;
-  atomic_mass_map[731570000] = 156.968176167;
-  atomic_mass_map[741570000] = 156.97884;
-  atomic_mass_map[591580000] = 157.95241;
-  atomic_mass_map[601580000] = 157.94197;
-  atomic_mass_map[611580000] = 157.936565144;
-  atomic_mass_map[621580000] = 157.929951004;
-  atomic_mass_map[631580000] = 157.927798606;
-  atomic_mass_map[641580000] = 157.924112348;
-  atomic_mass_map[651580000] = 157.925420947;
-  atomic_mass_map[661580000] = 157.924415875;
-  atomic_mass_map[671580000] = 157.928945969;
-  atomic_mass_map[681580000] = 157.929893474;
-  atomic_mass_map[691580000] = 157.936979525;
-  atomic_mass_map[701580000] = 157.939870549;
-  atomic_mass_map[711580000] = 157.949315507;
-  atomic_mass_map[721580000] = 157.954801092;
-  atomic_mass_map[731580000] = 157.966541;
-  atomic_mass_map[741580000] = 157.974562;
-  atomic_mass_map[591590000] = 158.95589;
-  atomic_mass_map[601590000] = 158.94653;
-  atomic_mass_map[611590000] = 158.939286502;
-  atomic_mass_map[621590000] = 158.933217226;
-  atomic_mass_map[631590000] = 158.929100067;
-  atomic_mass_map[641590000] = 158.926396969;
-  atomic_mass_map[651590000] = 158.92535471;
-  atomic_mass_map[661590000] = 158.925746958;
-  atomic_mass_map[671590000] = 158.927719703;
-  atomic_mass_map[681590000] = 158.93069181;
-  atomic_mass_map[691590000] = 158.934975;
-  atomic_mass_map[701590000] = 158.940054623;
-  atomic_mass_map[711590000] = 158.946635615;
-  atomic_mass_map[721590000] = 158.953995669;
-  atomic_mass_map[731590000] = 158.963022556;
-  atomic_mass_map[741590000] = 158.972638;
-  atomic_mass_map[751590000] = 158.984179;
-  atomic_mass_map[601600000] = 159.9494;
-  atomic_mass_map[611600000] = 159.9431;
-  atomic_mass_map[621600000] = 159.935335311;
-  atomic_mass_map[631600000] = 159.931850939;
-  atomic_mass_map[641600000] = 159.927062411;
-  atomic_mass_map[651600000] = 159.927175556;
-  atomic_mass_map[661600000] = 159.925204646;
-  atomic_mass_map[671600000] = 159.928736606;
-  atomic_mass_map[681600000] = 159.92907713;
-  atomic_mass_map[691600000] = 159.935263106;
-  atomic_mass_map[701600000] = 159.937557406;
-  atomic_mass_map[711600000] = 159.946033;
-  atomic_mass_map[721600000] = 159.950690749;
-  atomic_mass_map[731600000] = 159.96148751;
-  atomic_mass_map[741600000] = 159.968462584;
-  atomic_mass_map[751600000] = 159.981823;
-  atomic_mass_map[601610000] = 160.95428;
-  atomic_mass_map[611610000] = 160.94607;
-  atomic_mass_map[621610000] = 160.93916017;
-  atomic_mass_map[631610000] = 160.933664091;
-  atomic_mass_map[641610000] = 160.929677476;
-  atomic_mass_map[651610000] = 160.927577825;
-  atomic_mass_map[661610000] = 160.926940492;
-  atomic_mass_map[671610000] = 160.927861547;
-  atomic_mass_map[681610000] = 160.930004599;
-  atomic_mass_map[691610000] = 160.933549;
-  atomic_mass_map[701610000] = 160.937907138;
-  atomic_mass_map[711610000] = 160.943572;
-  atomic_mass_map[721610000] = 160.95027837;
-  atomic_mass_map[731610000] = 160.958452265;
-  atomic_mass_map[741610000] = 160.967197;
-  atomic_mass_map[751610000] = 160.977572951;
-  atomic_mass_map[761610000] = 160.989029;
-  atomic_mass_map[611620000] = 161.95022;
-  atomic_mass_map[621620000] = 161.94146;
-  atomic_mass_map[631620000] = 161.936988761;
-  atomic_mass_map[641620000] = 161.930993017;
-  atomic_mass_map[651620000] = 161.92949536;
-  atomic_mass_map[661620000] = 161.926805573;
-  atomic_mass_map[671620000] = 161.929102274;
-  atomic_mass_map[681620000] = 161.928788364;
-  atomic_mass_map[691620000] = 161.934002277;
-  atomic_mass_map[701620000] = 161.935773604;
-  atomic_mass_map[711620000] = 161.943282776;
-  atomic_mass_map[721620000] = 161.947214837;
-  atomic_mass_map[731620000] = 161.957294083;
-  atomic_mass_map[741620000] = 161.963499142;
-  atomic_mass_map[751620000] = 161.975844;
-  atomic_mass_map[761620000] = 161.984431;
-  atomic_mass_map[611630000] = 162.95357;
-  atomic_mass_map[621630000] = 162.94555;
-  atomic_mass_map[631630000] = 162.939195675;
-  atomic_mass_map[641630000] = 162.934176855;
-  atomic_mass_map[651630000] = 162.930654659;
-  atomic_mass_map[661630000] = 162.928738284;
-  atomic_mass_map[671630000] = 162.928741027;
-  atomic_mass_map[681630000] = 162.930040797;
-  atomic_mass_map[691630000] = 162.932659172;
-  atomic_mass_map[701630000] = 162.936339632;
-  atomic_mass_map[711630000] = 162.941179;
-  atomic_mass_map[721630000] = 162.947112946;
-  atomic_mass_map[731630000] = 162.95433711;
-  atomic_mass_map[741630000] = 162.962524342;
-  atomic_mass_map[751630000] = 162.97207986;
-  atomic_mass_map[761630000] = 162.98241;
-  atomic_mass_map[621640000] = 163.94836;
-  atomic_mass_map[631640000] = 163.942744;
-  atomic_mass_map[641640000] = 163.93583;
-  atomic_mass_map[651640000] = 163.933357961;
-  atomic_mass_map[661640000] = 163.929181874;
-  atomic_mass_map[671640000] = 163.930240273;
-  atomic_mass_map[681640000] = 163.929208791;
-  atomic_mass_map[691640000] = 163.933543614;
-  atomic_mass_map[701640000] = 163.93449493399999;
-  atomic_mass_map[711640000] = 163.941339;
-  atomic_mass_map[721640000] = 163.944370845;
-  atomic_mass_map[731640000] = 163.953534;
-  atomic_mass_map[741640000] = 163.958960683;
-  atomic_mass_map[751640000] = 163.97045287;
-  atomic_mass_map[761640000] = 163.978021712;
-  atomic_mass_map[771640000] = 163.991909;
-  atomic_mass_map[621650000] = 164.95297;
-  atomic_mass_map[631650000] = 164.945587;
-  atomic_mass_map[641650000] = 164.93936;
-  atomic_mass_map[651650000] = 164.93498;
-  atomic_mass_map[661650000] = 164.931710456;
-  atomic_mass_map[671650000] = 164.930328835;
-  atomic_mass_map[681650000] = 164.930734496;
-  atomic_mass_map[691650000] = 164.93244314;
-  atomic_mass_map[701650000] = 164.935270241;
-  atomic_mass_map[711650000] = 164.939406758;
-  atomic_mass_map[721650000] = 164.944567;
-  atomic_mass_map[731650000] = 164.950780572;
-  atomic_mass_map[741650000] = 164.958280788;
-  atomic_mass_map[751650000] = 164.96710266;
-  atomic_mass_map[761650000] = 164.976602;
-  atomic_mass_map[771650000] = 164.987501;
-  atomic_mass_map[631660000] = 165.94962;
-  atomic_mass_map[641660000] = 165.94146;
-  atomic_mass_map[651660000] = 165.937859521;
-  atomic_mass_map[661660000] = 165.932813863;
-  atomic_mass_map[671660000] = 165.932290927;
-  atomic_mass_map[681660000] = 165.93029953;
-  atomic_mass_map[691660000] = 165.9335606;
-  atomic_mass_map[701660000] = 165.933874749;
-  atomic_mass_map[711660000] = 165.939859;
-  atomic_mass_map[721660000] = 165.94218;
-  atomic_mass_map[731660000] = 165.950512;
-  atomic_mass_map[741660000] = 165.95503121;
-  atomic_mass_map[751660000] = 165.965760821;
-  atomic_mass_map[761660000] = 165.972692476;
-  atomic_mass_map[771660000] = 165.985664;
-  atomic_mass_map[781660000] = 165.994855;
-  atomic_mass_map[631670000] = 166.95289;
-  atomic_mass_map[641670000] = 166.94545;
-  atomic_mass_map[651670000] = 166.93996;
-  atomic_mass_map[661670000] = 166.935661379;
-  atomic_mass_map[671670000] = 166.93313855;
-  atomic_mass_map[681670000] = 166.932054617;
-  atomic_mass_map[691670000] = 166.932856192;
-  atomic_mass_map[701670000] = 166.934952988;
-  atomic_mass_map[711670000] = 166.93827;
-  atomic_mass_map[721670000] = 166.9426;
-  atomic_mass_map[731670000] = 166.948093;
-  atomic_mass_map[741670000] = 166.95480456;
-  atomic_mass_map[751670000] = 166.962595;
-  atomic_mass_map[761670000] = 166.971548768;
-  atomic_mass_map[771670000] = 166.981666315;
-  atomic_mass_map[781670000] = 166.992695;
-  atomic_mass_map[641680000] = 167.94808;
-  atomic_mass_map[651680000] = 167.9434;
-  atomic_mass_map[661680000] = 167.937133273;
-  atomic_mass_map[671680000] = 167.935522173;
-  atomic_mass_map[681680000] = 167.932376688;
-  atomic_mass_map[691680000] = 167.934177409;
-  atomic_mass_map[701680000] = 167.933889602;
-  atomic_mass_map[711680000] = 167.938735635;
-  atomic_mass_map[721680000] = 167.940568;
-  atomic_mass_map[731680000] = 167.948047;
-  atomic_mass_map[741680000] = 167.951805537;
-  atomic_mass_map[751680000] = 167.961572608;
-  atomic_mass_map[761680000] = 167.967807751;
-  atomic_mass_map[771680000] = 167.979906642;
-  atomic_mass_map[781680000] = 167.988128665;
-  atomic_mass_map[641690000] = 168.9526;
-  atomic_mass_map[651690000] = 168.94597;
-  atomic_mass_map[661690000] = 168.940313531;
-  atomic_mass_map[671690000] = 168.936878189;
-  atomic_mass_map[681690000] = 168.93459685;
-  atomic_mass_map[691690000] = 168.934217889;
-  atomic_mass_map[701690000] = 168.935182512;
-  atomic_mass_map[711690000] = 168.937644149;
-  atomic_mass_map[721690000] = 168.941259;
-  atomic_mass_map[731690000] = 168.946011;
-  atomic_mass_map[741690000] = 168.951778845;
-  atomic_mass_map[751690000] = 168.958766063;
-  atomic_mass_map[761690000] = 168.967017574;
-  atomic_mass_map[771690000] = 168.976298488;
-  atomic_mass_map[781690000] = 168.986567;
-  atomic_mass_map[791690000] = 168.99808;
-  atomic_mass_map[651700000] = 169.94984;
-  atomic_mass_map[661700000] = 169.94239;
-  atomic_mass_map[671700000] = 169.939624846;
-  atomic_mass_map[681700000] = 169.93547023;
-  atomic_mass_map[691700000] = 169.935806032;
-  atomic_mass_map[701700000] = 169.934766376;
-  atomic_mass_map[711700000] = 169.938478365;
-  atomic_mass_map[721700000] = 169.939609;
-  atomic_mass_map[731700000] = 169.946175;
-  atomic_mass_map[741700000] = 169.949231588;
-  atomic_mass_map[751700000] = 169.958220071;
-  atomic_mass_map[761700000] = 169.963578454;
-  atomic_mass_map[771700000] = 169.974922;
-  atomic_mass_map[781700000] = 169.982496345;
-  atomic_mass_map[791700000] = 169.995972;
-  atomic_mass_map[651710000] = 170.95273;
-  atomic_mass_map[661710000] = 170.94612;
-  atomic_mass_map[671710000] = 170.941471022;
-  atomic_mass_map[681710000] = 170.938035681;
-  atomic_mass_map[691710000] = 170.936433871;
-  atomic_mass_map[701710000] = 170.936330208;
-  atomic_mass_map[711710000] = 170.93791696;
-  atomic_mass_map[721710000] = 170.940492;
-  atomic_mass_map[731710000] = 170.944476;
-  atomic_mass_map[741710000] = 170.949451;
-  atomic_mass_map[751710000] = 170.955716;
-  atomic_mass_map[761710000] = 170.963173969;
-  atomic_mass_map[771710000] = 170.971640252;
-  atomic_mass_map[781710000] = 170.981245248;
-  atomic_mass_map[791710000] = 170.991875791;
-  atomic_mass_map[801710000] = 171.003529;
-  atomic_mass_map[661720000] = 171.94846;
-  atomic_mass_map[671720000] = 171.94473;
-  atomic_mass_map[681720000] = 171.939361858;
-  atomic_mass_map[691720000] = 171.938405521;
-  atomic_mass_map[701720000] = 171.936385872;
-  atomic_mass_map[711720000] = 171.939089103;
-  atomic_mass_map[721720000] = 171.939449716;
-  atomic_mass_map[731720000] = 171.944895;
-  atomic_mass_map[741720000] = 171.947292;
-  atomic_mass_map[751720000] = 171.955419665;
-  atomic_mass_map[761720000] = 171.960017317;
-  atomic_mass_map[771720000] = 171.970607036;
-  atomic_mass_map[781720000] = 171.977350921;
-  atomic_mass_map[791720000] = 171.989942284;
-  atomic_mass_map[801720000] = 171.998808967;
-  atomic_mass_map[661730000] = 172.95283;
-  atomic_mass_map[671730000] = 172.94702;
-  atomic_mass_map[681730000] = 172.9424;
-  atomic_mass_map[691730000] = 172.939608371;
-  atomic_mass_map[701730000] = 172.938215136;
-  atomic_mass_map[711730000] = 172.938934029;
-  atomic_mass_map[721730000] = 172.940513;
-  atomic_mass_map[731730000] = 172.94375;
-  atomic_mass_map[741730000] = 172.947689;
-  atomic_mass_map[751730000] = 172.953243;
-  atomic_mass_map[761730000] = 172.959808465;
-  atomic_mass_map[771730000] = 172.967505636;
-  atomic_mass_map[781730000] = 172.976443058;
-  atomic_mass_map[791730000] = 172.986240924;
-  atomic_mass_map[801730000] = 172.997091;
-  atomic_mass_map[671740000] = 173.95095;
-  atomic_mass_map[681740000] = 173.94423;
-  atomic_mass_map[691740000] = 173.942172953;
-  atomic_mass_map[701740000] = 173.938866437;
-  atomic_mass_map[711740000] = 173.940340854;
-  atomic_mass_map[721740000] = 173.940046141;
-  atomic_mass_map[731740000] = 173.944454;
-  atomic_mass_map[741740000] = 173.946079;
-  atomic_mass_map[751740000] = 173.953115;
-  atomic_mass_map[761740000] = 173.957063507;
-  atomic_mass_map[771740000] = 173.966861045;
-  atomic_mass_map[781740000] = 173.972819528;
-  atomic_mass_map[791740000] = 173.984717;
-  atomic_mass_map[801740000] = 173.992864748;
-  atomic_mass_map[671750000] = 174.95362;
-  atomic_mass_map[681750000] = 174.94777;
-  atomic_mass_map[691750000] = 174.9438412;
-  atomic_mass_map[701750000] = 174.941280797;
-  atomic_mass_map[711750000] = 174.940775191;
-  atomic_mass_map[721750000] = 174.941509187;
-  atomic_mass_map[731750000] = 174.943737;
-  atomic_mass_map[741750000] = 174.946717;
-  atomic_mass_map[751750000] = 174.951381;
-  atomic_mass_map[761750000] = 174.956945313;
-  atomic_mass_map[771750000] = 174.964149589;
-  atomic_mass_map[781750000] = 174.972409721;
-  atomic_mass_map[791750000] = 174.981303712;
-  atomic_mass_map[801750000] = 174.991440747;
-  atomic_mass_map[681760000] = 175.94994;
-  atomic_mass_map[691760000] = 175.946999449;
-  atomic_mass_map[701760000] = 175.942576447;
-  atomic_mass_map[711760000] = 175.94268968;
-  atomic_mass_map[721760000] = 175.941407628;
-  atomic_mass_map[731760000] = 175.944857;
-  atomic_mass_map[741760000] = 175.945634;
-  atomic_mass_map[751760000] = 175.951623;
-  atomic_mass_map[761760000] = 175.954806;
-  atomic_mass_map[771760000] = 175.963650389;
-  atomic_mass_map[781760000] = 175.968938362;
-  atomic_mass_map[791760000] = 175.980250432;
-  atomic_mass_map[801760000] = 175.987360863;
-  atomic_mass_map[811760000] = 176.000624028;
-  atomic_mass_map[681770000] = 176.95399;
-  atomic_mass_map[691770000] = 176.94904;
-  atomic_mass_map[701770000] = 176.945265586;
-  atomic_mass_map[711770000] = 176.943761525;
-  atomic_mass_map[721770000] = 176.943227717;
-  atomic_mass_map[731770000] = 176.944479469;
-  atomic_mass_map[741770000] = 176.946643;
-  atomic_mass_map[751770000] = 176.950328;
-  atomic_mass_map[761770000] = 176.954965628;
-  atomic_mass_map[771770000] = 176.9613015;
-  atomic_mass_map[781770000] = 176.968469537;
-  atomic_mass_map[791770000] = 176.976870439;
-  atomic_mass_map[801770000] = 176.986277319;
-  atomic_mass_map[811770000] = 176.996430829;
-  atomic_mass_map[691780000] = 177.95264;
-  atomic_mass_map[701780000] = 177.946651444;
-  atomic_mass_map[711780000] = 177.945958018;
-  atomic_mass_map[721780000] = 177.943705833;
-  atomic_mass_map[731780000] = 177.945678;
-  atomic_mass_map[741780000] = 177.945883303;
-  atomic_mass_map[751780000] = 177.950989;
-  atomic_mass_map[761780000] = 177.953253627;
-  atomic_mass_map[771780000] = 177.961082;
-  atomic_mass_map[781780000] = 177.965649523;
-  atomic_mass_map[791780000] = 177.97603192;
-  atomic_mass_map[801780000] = 177.982483769;
-  atomic_mass_map[811780000] = 177.994854;
-  atomic_mass_map[821780000] = 178.003831243;
-  atomic_mass_map[691790000] = 178.95534;
-  atomic_mass_map[701790000] = 178.95004;
-  atomic_mass_map[711790000] = 178.947330935;
-  atomic_mass_map[721790000] = 178.945823212;
-  atomic_mass_map[731790000] = 178.945936555;
-  atomic_mass_map[741790000] = 178.947077043;
-  atomic_mass_map[751790000] = 178.94998913;
-  atomic_mass_map[761790000] = 178.953816881;
-  atomic_mass_map[771790000] = 178.959120178;
-  atomic_mass_map[781790000] = 178.965358953;
-  atomic_mass_map[791790000] = 178.973173654;
-  atomic_mass_map[801790000] = 178.981831329;
-  atomic_mass_map[811790000] = 178.991110696;
-  atomic_mass_map[821790000] = 179.002201112;
-  atomic_mass_map[701800000] = 179.95212;
-  atomic_mass_map[711800000] = 179.94988825;
-  atomic_mass_map[721800000] = 179.946557042;
-  atomic_mass_map[731800000] = 179.947464832;
-  atomic_mass_map[741800000] = 179.946710805;
-  atomic_mass_map[751800000] = 179.950791568;
-  atomic_mass_map[761800000] = 179.952375485;
-  atomic_mass_map[771800000] = 179.959229446;
-  atomic_mass_map[781800000] = 179.963031955;
-  atomic_mass_map[791800000] = 179.972523397;
-  atomic_mass_map[801800000] = 179.978260335;
-  atomic_mass_map[811800000] = 179.990056524;
-  atomic_mass_map[821800000] = 179.997928286;
-  atomic_mass_map[701810000] = 180.95589;
-  atomic_mass_map[711810000] = 180.951908;
-  atomic_mass_map[721810000] = 180.949108338;
-  atomic_mass_map[731810000] = 180.947995769;
-  atomic_mass_map[741810000] = 180.948197783;
-  atomic_mass_map[751810000] = 180.950057673;
-  atomic_mass_map[761810000] = 180.953247188;
-  atomic_mass_map[771810000] = 180.957625456;
-  atomic_mass_map[781810000] = 180.963097588;
-  atomic_mass_map[791810000] = 180.970079047;
-  atomic_mass_map[801810000] = 180.977819371;
-  atomic_mass_map[811810000] = 180.986259979;
-  atomic_mass_map[821810000] = 180.99665331;
-  atomic_mass_map[711820000] = 181.95504;
-  atomic_mass_map[721820000] = 181.950561185;
-  atomic_mass_map[731820000] = 181.950151853;
-  atomic_mass_map[741820000] = 181.948203945;
-  atomic_mass_map[751820000] = 181.951209869;
-  atomic_mass_map[761820000] = 181.952110187;
-  atomic_mass_map[771820000] = 181.958076296;
-  atomic_mass_map[781820000] = 181.961171823;
-  atomic_mass_map[791820000] = 181.969617874;
-  atomic_mass_map[801820000] = 181.974689351;
-  atomic_mass_map[811820000] = 181.985713159;
-  atomic_mass_map[821820000] = 181.992672466;
-  atomic_mass_map[711830000] = 182.957363;
-  atomic_mass_map[721830000] = 182.953530444;
-  atomic_mass_map[731830000] = 182.95137262;
-  atomic_mass_map[741830000] = 182.950222748;
-  atomic_mass_map[751830000] = 182.950819638;
-  atomic_mass_map[761830000] = 182.953124719;
-  atomic_mass_map[771830000] = 182.956839968;
-  atomic_mass_map[781830000] = 182.961596804;
-  atomic_mass_map[791830000] = 182.967590635;
-  atomic_mass_map[801830000] = 182.974444783;
-  atomic_mass_map[811830000] = 182.982192839;
-  atomic_mass_map[821830000] = 182.991872098;
-  atomic_mass_map[711840000] = 183.96091;
-  atomic_mass_map[721840000] = 183.955446243;
-  atomic_mass_map[731840000] = 183.954007694;
-  atomic_mass_map[741840000] = 183.950930916;
-  atomic_mass_map[751840000] = 183.952522809;
-  atomic_mass_map[761840000] = 183.952488536;
-  atomic_mass_map[771840000] = 183.957476;
-  atomic_mass_map[781840000] = 183.959915113;
-  atomic_mass_map[791840000] = 183.967451524;
-  atomic_mass_map[801840000] = 183.971713528;
-  atomic_mass_map[811840000] = 183.981885851;
-  atomic_mass_map[821840000] = 183.988135701;
-  atomic_mass_map[831840000] = 184.001274756;
-  atomic_mass_map[711850000] = 184.96362;
-  atomic_mass_map[721850000] = 184.958862;
-  atomic_mass_map[731850000] = 184.955559084;
-  atomic_mass_map[741850000] = 184.953418974;
-  atomic_mass_map[751850000] = 184.952954486;
-  atomic_mass_map[761850000] = 184.954041741;
-  atomic_mass_map[771850000] = 184.956698;
-  atomic_mass_map[781850000] = 184.960613659;
-  atomic_mass_map[791850000] = 184.965789569;
-  atomic_mass_map[801850000] = 184.971899388;
-  atomic_mass_map[811850000] = 184.97878905;
-  atomic_mass_map[821850000] = 184.987610004;
-  atomic_mass_map[831850000] = 184.9976;
-  atomic_mass_map[721860000] = 185.960897;
-  atomic_mass_map[731860000] = 185.958550667;
-  atomic_mass_map[741860000] = 185.954362771;
-  atomic_mass_map[751860000] = 185.954985595;
-  atomic_mass_map[761860000] = 185.953835044;
-  atomic_mass_map[771860000] = 185.957944153;
-  atomic_mass_map[781860000] = 185.959350812;
-  atomic_mass_map[791860000] = 185.965952703;
-  atomic_mass_map[801860000] = 185.969362272;
-  atomic_mass_map[811860000] = 185.978650841;
-  atomic_mass_map[821860000] = 185.984238331;
-  atomic_mass_map[831860000] = 185.996643681;
-  atomic_mass_map[841860000] = 186.004393241;
-  atomic_mass_map[721870000] = 186.96477;
-  atomic_mass_map[731870000] = 186.960386;
-  atomic_mass_map[741870000] = 186.957158841;
-  atomic_mass_map[751870000] = 186.955750071;
-  atomic_mass_map[761870000] = 186.955747422;
-  atomic_mass_map[771870000] = 186.957542;
-  atomic_mass_map[781870000] = 186.960616976;
-  atomic_mass_map[791870000] = 186.964543155;
-  atomic_mass_map[801870000] = 186.969814428;
-  atomic_mass_map[811870000] = 186.975906348;
-  atomic_mass_map[821870000] = 186.983910895;
-  atomic_mass_map[831870000] = 186.993147184;
-  atomic_mass_map[841870000] = 187.003041054;
-  atomic_mass_map[721880000] = 187.96685;
-  atomic_mass_map[731880000] = 187.963916;
-  atomic_mass_map[741880000] = 187.958486177;
-  atomic_mass_map[751880000] = 187.95811151;
-  atomic_mass_map[761880000] = 187.955835174;
-  atomic_mass_map[771880000] = 187.958828095;
-  atomic_mass_map[781880000] = 187.959388889;
-  atomic_mass_map[791880000] = 187.965349392;
-  atomic_mass_map[801880000] = 187.967566887;
-  atomic_mass_map[811880000] = 187.976020886;
-  atomic_mass_map[821880000] = 187.980874815;
-  atomic_mass_map[831880000] = 187.992286943;
-  atomic_mass_map[841880000] = 187.999415569;
-  atomic_mass_map[721890000] = 188.97084;
-  atomic_mass_map[731890000] = 188.96583;
-  atomic_mass_map[741890000] = 188.961763;
-  atomic_mass_map[751890000] = 188.95922602;
-  atomic_mass_map[761890000] = 188.958144162;
-  atomic_mass_map[771890000] = 188.958715028;
-  atomic_mass_map[781890000] = 188.960831282;
-  atomic_mass_map[791890000] = 188.963948286;
-  atomic_mass_map[801890000] = 188.968194927;
-  atomic_mass_map[811890000] = 188.973588471;
-  atomic_mass_map[821890000] = 188.980807;
-  atomic_mass_map[831890000] = 188.989194984;
-  atomic_mass_map[841890000] = 188.998473429;
-  atomic_mass_map[731900000] = 189.96939;
-  atomic_mass_map[741900000] = 189.963090589;
-  atomic_mass_map[751900000] = 189.96174426;
-  atomic_mass_map[761900000] = 189.958443702;
-  atomic_mass_map[771900000] = 189.960541215;
-  atomic_mass_map[781900000] = 189.959929707;
-  atomic_mass_map[791900000] = 189.96469839;
-  atomic_mass_map[801900000] = 189.966322735;
-  atomic_mass_map[811900000] = 189.973828;
-  atomic_mass_map[821900000] = 189.978081999;
-  atomic_mass_map[831900000] = 189.988621561;
-  atomic_mass_map[841900000] = 189.995100569;
-  atomic_mass_map[731910000] = 190.97156;
-  atomic_mass_map[741910000] = 190.966531;
-  atomic_mass_map[751910000] = 190.963121551;
-  atomic_mass_map[761910000] = 190.960926361;
-  atomic_mass_map[771910000] = 190.960589293;
-  atomic_mass_map[781910000] = 190.961672912;
-  atomic_mass_map[791910000] = 190.963702248;
-  atomic_mass_map[801910000] = 190.96715716;
-  atomic_mass_map[811910000] = 190.971784199;
-  atomic_mass_map[821910000] = 190.978276;
-  atomic_mass_map[831910000] = 190.985786556;
-  atomic_mass_map[841910000] = 190.994558462;
-  atomic_mass_map[851910000] = 191.004147909;
-  atomic_mass_map[731920000] = 191.97514;
-  atomic_mass_map[741920000] = 191.96817;
-  atomic_mass_map[751920000] = 191.966088;
-  atomic_mass_map[761920000] = 191.961476998;
-  atomic_mass_map[771920000] = 191.962600247;
-  atomic_mass_map[781920000] = 191.961038746;
-  atomic_mass_map[791920000] = 191.964813694;
-  atomic_mass_map[801920000] = 191.965634702;
-  atomic_mass_map[811920000] = 191.972225;
-  atomic_mass_map[821920000] = 191.975775008;
-  atomic_mass_map[831920000] = 191.985469058;
-  atomic_mass_map[841920000] = 191.991335925;
-  atomic_mass_map[851920000] = 192.003151707;
-  atomic_mass_map[741930000] = 192.97178;
-  atomic_mass_map[751930000] = 192.967541;
-  atomic_mass_map[761930000] = 192.96414787;
-  atomic_mass_map[771930000] = 192.962921587;
-  atomic_mass_map[781930000] = 192.96298238;
-  atomic_mass_map[791930000] = 192.964137257;
-  atomic_mass_map[801930000] = 192.966652658;
-  atomic_mass_map[811930000] = 192.970501998;
-  atomic_mass_map[821930000] = 192.976173234;
-  atomic_mass_map[831930000] = 192.982959813;
-  atomic_mass_map[841930000] = 192.991025678;
-  atomic_mass_map[851930000] = 192.999927418;
-  atomic_mass_map[861930000] = 193.009707979;
-  atomic_mass_map[741940000] = 193.97367;
-  atomic_mass_map[751940000] = 193.97076;
-  atomic_mass_map[761940000] = 193.96517724;
-  atomic_mass_map[771940000] = 193.965073536;
-  atomic_mass_map[781940000] = 193.96268085;
-  atomic_mass_map[791940000] = 193.965417754;
-  atomic_mass_map[801940000] = 193.965449112;
-  atomic_mass_map[811940000] = 193.971081412;
-  atomic_mass_map[821940000] = 193.97401225;
-  atomic_mass_map[831940000] = 193.982785;
-  atomic_mass_map[841940000] = 193.988186101;
-  atomic_mass_map[851940000] = 193.999236139;
-  atomic_mass_map[861940000] = 194.006144389;
-  atomic_mass_map[751950000] = 194.97254;
-  atomic_mass_map[761950000] = 194.968318;
-  atomic_mass_map[771950000] = 194.96597473;
-  atomic_mass_map[781950000] = 194.964791719;
-  atomic_mass_map[791950000] = 194.965035225;
-  atomic_mass_map[801950000] = 194.96672054;
-  atomic_mass_map[811950000] = 194.969774268;
-  atomic_mass_map[821950000] = 194.974542922;
-  atomic_mass_map[831950000] = 194.980648781;
-  atomic_mass_map[841950000] = 194.988125532;
-  atomic_mass_map[851950000] = 194.996268546;
-  atomic_mass_map[861950000] = 195.005421673;
-  atomic_mass_map[751960000] = 195.9758;
-  atomic_mass_map[761960000] = 195.969641463;
-  atomic_mass_map[771960000] = 195.968397112;
-  atomic_mass_map[781960000] = 195.964952091;
-  atomic_mass_map[791960000] = 195.966569908;
-  atomic_mass_map[801960000] = 195.96583256;
-  atomic_mass_map[811960000] = 195.970481193;
-  atomic_mass_map[821960000] = 195.972774233;
-  atomic_mass_map[831960000] = 195.980666509;
-  atomic_mass_map[841960000] = 195.985525902;
-  atomic_mass_map[851960000] = 195.995799619;
-  atomic_mass_map[861960000] = 196.002115998;
-  atomic_mass_map[751970000] = 196.97799;
-  atomic_mass_map[761970000] = 196.97283;
-  atomic_mass_map[771970000] = 196.969655415;
-  atomic_mass_map[781970000] = 196.967340687;
-  atomic_mass_map[791970000] = 196.966568786;
-  atomic_mass_map[801970000] = 196.967212847;
-  atomic_mass_map[811970000] = 196.96957589;
-  atomic_mass_map[821970000] = 196.973431166;
-  atomic_mass_map[831970000] = 196.978865099;
-  atomic_mass_map[841970000] = 196.985659522;
-  atomic_mass_map[851970000] = 196.993189187;
-  atomic_mass_map[861970000] = 197.00158462;
-  atomic_mass_map[751980000] = 197.9816;
-  atomic_mass_map[761980000] = 197.97441;
-  atomic_mass_map[771980000] = 197.97228;
-  atomic_mass_map[781980000] = 197.96789492;
-  atomic_mass_map[791980000] = 197.96824242;
-  atomic_mass_map[801980000] = 197.966768602;
-  atomic_mass_map[811980000] = 197.970483065;
-  atomic_mass_map[821980000] = 197.972034077;
-  atomic_mass_map[831980000] = 197.979206;
-  atomic_mass_map[841980000] = 197.983389132;
-  atomic_mass_map[851980000] = 197.992784;
-  atomic_mass_map[861980000] = 197.998679156;
-  atomic_mass_map[761990000] = 198.97801;
-  atomic_mass_map[771990000] = 198.973805301;
-  atomic_mass_map[781990000] = 198.970595224;
-  atomic_mass_map[791990000] = 198.968765282;
-  atomic_mass_map[801990000] = 198.968280643;
-  atomic_mass_map[811990000] = 198.969877;
-  atomic_mass_map[821990000] = 198.97291268;
-  atomic_mass_map[831990000] = 198.97767301;
-  atomic_mass_map[841990000] = 198.983667115;
-  atomic_mass_map[851990000] = 198.990527654;
-  atomic_mass_map[861990000] = 198.998389856;
-  atomic_mass_map[871990000] = 199.007258594;
-  atomic_mass_map[762000000] = 199.97984;
-  atomic_mass_map[772000000] = 199.9768;
-  atomic_mass_map[782000000] = 199.971442807;
-  atomic_mass_map[792000000] = 199.970756456;
-  atomic_mass_map[802000000] = 199.96832659;
-  atomic_mass_map[812000000] = 199.970963258;
-  atomic_mass_map[822000000] = 199.971818893;
-  atomic_mass_map[832000000] = 199.978131179;
-  atomic_mass_map[842000000] = 199.98179879;
-  atomic_mass_map[852000000] = 199.990351015;
-  atomic_mass_map[862000000] = 199.995690431;
-  atomic_mass_map[872000000] = 200.006586003;
-  atomic_mass_map[762010000] = 200.98364;
-  atomic_mass_map[772010000] = 200.97864;
-  atomic_mass_map[782010000] = 200.974513112;
-  atomic_mass_map[792010000] = 200.971657484;
-  atomic_mass_map[802010000] = 200.970302839;
-  atomic_mass_map[812010000] = 200.970822212;
-  atomic_mass_map[822010000] = 200.972882917;
-  atomic_mass_map[832010000] = 200.977010416;
-  atomic_mass_map[842010000] = 200.982259806;
-  atomic_mass_map[852010000] = 200.988417147;
-  atomic_mass_map[862010000] = 200.99562801;
-  atomic_mass_map[872010000] = 201.003866593;
-  atomic_mass_map[882010000] = 201.012712;
-  atomic_mass_map[762020000] = 201.98595;
-  atomic_mass_map[772020000] = 201.98199;
-  atomic_mass_map[782020000] = 201.975639;
-  atomic_mass_map[792020000] = 201.973856;
-  atomic_mass_map[802020000] = 201.9706434;
-  atomic_mass_map[812020000] = 201.972102441;
-  atomic_mass_map[822020000] = 201.972152026;
-  atomic_mass_map[832020000] = 201.977733861;
-  atomic_mass_map[842020000] = 201.980757657;
-  atomic_mass_map[852020000] = 201.988630302;
-  atomic_mass_map[862020000] = 201.993264277;
-  atomic_mass_map[872020000] = 202.00332;
-  atomic_mass_map[882020000] = 202.009759744;
-  atomic_mass_map[772030000] = 202.98423;
-  atomic_mass_map[782030000] = 202.97893;
-  atomic_mass_map[792030000] = 202.975154446;
-  atomic_mass_map[802030000] = 202.972872837;
-  atomic_mass_map[812030000] = 202.972344593;
-  atomic_mass_map[822030000] = 202.973391126;
-  atomic_mass_map[832030000] = 202.976892779;
-  atomic_mass_map[842030000] = 202.981416133;
-  atomic_mass_map[852030000] = 202.98694299;
-  atomic_mass_map[862030000] = 202.993387741;
-  atomic_mass_map[872030000] = 203.000940729;
-  atomic_mass_map[882030000] = 203.009304274;
-  atomic_mass_map[772040000] = 203.9896;
-  atomic_mass_map[782040000] = 203.98076;
-  atomic_mass_map[792040000] = 203.977831;
-  atomic_mass_map[802040000] = 203.973493981;
-  atomic_mass_map[812040000] = 203.9738639;
-  atomic_mass_map[822040000] = 203.973043981;
-  atomic_mass_map[832040000] = 203.977836062;
-  atomic_mass_map[842040000] = 203.980310339;
-  atomic_mass_map[852040000] = 203.987251198;
-  atomic_mass_map[862040000] = 203.991429922;
-  atomic_mass_map[872040000] = 204.000652059;
-  atomic_mass_map[882040000] = 204.006491866;
-  atomic_mass_map[782050000] = 204.98608;
-  atomic_mass_map[792050000] = 204.97985;
-  atomic_mass_map[802050000] = 204.976073417;
-  atomic_mass_map[812050000] = 204.974427801;
-  atomic_mass_map[822050000] = 204.974482157;
-  atomic_mass_map[832050000] = 204.977386694;
-  atomic_mass_map[842050000] = 204.981203091;
-  atomic_mass_map[852050000] = 204.986075861;
-  atomic_mass_map[862050000] = 204.99171884;
-  atomic_mass_map[872050000] = 204.998593858;
-  atomic_mass_map[882050000] = 205.006268245;
-  atomic_mass_map[782060000] = 205.98966;
-  atomic_mass_map[792060000] = 205.98474;
-  atomic_mass_map[802060000] = 205.977514401;
-  atomic_mass_map[812060000] = 205.976110589;
-  atomic_mass_map[822060000] = 205.974465683;
-  atomic_mass_map[832060000] = 205.978499317;
-  atomic_mass_map[842060000] = 205.980473991;
-  atomic_mass_map[852060000] = 205.986656933;
-  atomic_mass_map[862060000] = 205.990214219;
-  atomic_mass_map[872060000] = 205.998666132;
-  atomic_mass_map[882060000] = 206.003828053;
-  atomic_mass_map[892060000] = 206.014452;
-  atomic_mass_map[792070000] = 206.9884;
-  atomic_mass_map[802070000] = 206.9823;
-  atomic_mass_map[812070000] = 206.977419712;
-  atomic_mass_map[822070000] = 206.975897297;
-  atomic_mass_map[832070000] = 206.978471022;
-  atomic_mass_map[842070000] = 206.981593762;
-  atomic_mass_map[852070000] = 206.985800332;
-  atomic_mass_map[862070000] = 206.990730254;
-  atomic_mass_map[872070000] = 206.996946478;
-  atomic_mass_map[882070000] = 207.003799159;
-  atomic_mass_map[892070000] = 207.01196583;
-  atomic_mass_map[792080000] = 207.99345;
-  atomic_mass_map[802080000] = 207.985759;
-  atomic_mass_map[812080000] = 207.982019001;
-  atomic_mass_map[822080000] = 207.976652481;
-  atomic_mass_map[832080000] = 207.97974253;
-  atomic_mass_map[842080000] = 207.981246092;
-  atomic_mass_map[852080000] = 207.986613302;
-  atomic_mass_map[862080000] = 207.989634687;
-  atomic_mass_map[872080000] = 207.997138132;
-  atomic_mass_map[882080000] = 208.001841122;
-  atomic_mass_map[892080000] = 208.011550406;
-  atomic_mass_map[902080000] = 208.017900275;
-  atomic_mass_map[792090000] = 208.99735;
-  atomic_mass_map[802090000] = 208.99072;
-  atomic_mass_map[812090000] = 208.985359353;
-  atomic_mass_map[822090000] = 208.981090461;
-  atomic_mass_map[832090000] = 208.980399068;
-  atomic_mass_map[842090000] = 208.982430836;
-  atomic_mass_map[852090000] = 208.986170215;
-  atomic_mass_map[862090000] = 208.99041451;
-  atomic_mass_map[872090000] = 208.995954932;
-  atomic_mass_map[882090000] = 209.001990455;
-  atomic_mass_map[892090000] = 209.009494762;
-  atomic_mass_map[902090000] = 209.017752974;
-  atomic_mass_map[792100000] = 210.0025;
-  atomic_mass_map[802100000] = 209.99424;
-  atomic_mass_map[812100000] = 209.990073958;
-  atomic_mass_map[822100000] = 209.984188861;
-  atomic_mass_map[832100000] = 209.984120705;
-  atomic_mass_map[842100000] = 209.982874076;
-  atomic_mass_map[852100000] = 209.987147898;
-  atomic_mass_map[862100000] = 209.989689107;
-  atomic_mass_map[872100000] = 209.996422409;
-  atomic_mass_map[882100000] = 210.000494169;
-  atomic_mass_map[892100000] = 210.009436052;
-  atomic_mass_map[902100000] = 210.015093642;
-  atomic_mass_map[802110000] = 210.99933;
-  atomic_mass_map[812110000] = 210.993475;
-  atomic_mass_map[822110000] = 210.988737125;
-  atomic_mass_map[832110000] = 210.987269741;
-  atomic_mass_map[842110000] = 210.986653562;
-  atomic_mass_map[852110000] = 210.987496614;
-  atomic_mass_map[862110000] = 210.99060111;
-  atomic_mass_map[872110000] = 210.995555723;
-  atomic_mass_map[882110000] = 211.000893214;
-  atomic_mass_map[892110000] = 211.007731899;
-  atomic_mass_map[902110000] = 211.014929468;
-  atomic_mass_map[802120000] = 212.00296;
-  atomic_mass_map[812120000] = 211.998335;
-  atomic_mass_map[822120000] = 211.991897703;
-  atomic_mass_map[832120000] = 211.991286026;
-  atomic_mass_map[842120000] = 211.988868376;
-  atomic_mass_map[852120000] = 211.990737688;
-  atomic_mass_map[862120000] = 211.990703919;
-  atomic_mass_map[872120000] = 211.996225652;
-  atomic_mass_map[882120000] = 211.999786715;
-  atomic_mass_map[892120000] = 212.007813171;
-  atomic_mass_map[902120000] = 212.012987595;
-  atomic_mass_map[912120000] = 212.023202993;
-  atomic_mass_map[802130000] = 213.00823;
-  atomic_mass_map[812130000] = 213.001915;
-  atomic_mass_map[822130000] = 212.996562894;
-  atomic_mass_map[832130000] = 212.994385067;
-  atomic_mass_map[842130000] = 212.992857623;
-  atomic_mass_map[852130000] = 212.992936978;
-  atomic_mass_map[862130000] = 212.993883069;
-  atomic_mass_map[872130000] = 212.996186041;
-  atomic_mass_map[882130000] = 213.000384258;
-  atomic_mass_map[892130000] = 213.00660902;
-  atomic_mass_map[902130000] = 213.013009223;
-  atomic_mass_map[912130000] = 213.021109239;
-  atomic_mass_map[802140000] = 214.012;
-  atomic_mass_map[812140000] = 214.00694;
-  atomic_mass_map[822140000] = 213.999805917;
-  atomic_mass_map[832140000] = 213.998711926;
-  atomic_mass_map[842140000] = 213.995201683;
-  atomic_mass_map[852140000] = 213.996372066;
-  atomic_mass_map[862140000] = 213.995362956;
-  atomic_mass_map[872140000] = 213.998971333;
-  atomic_mass_map[882140000] = 214.000099727;
-  atomic_mass_map[892140000] = 214.006918488;
-  atomic_mass_map[902140000] = 214.011500159;
-  atomic_mass_map[912140000] = 214.020918483;
-  atomic_mass_map[802150000] = 215.0174;
-  atomic_mass_map[812150000] = 215.01064;
-  atomic_mass_map[822150000] = 215.004741;
-  atomic_mass_map[832150000] = 215.001769823;
-  atomic_mass_map[842150000] = 214.999420146;
-  atomic_mass_map[852150000] = 214.998652849;
-  atomic_mass_map[862150000] = 214.99874589;
-  atomic_mass_map[872150000] = 215.000341838;
-  atomic_mass_map[882150000] = 215.00272042;
-  atomic_mass_map[892150000] = 215.006474511;
-  atomic_mass_map[902150000] = 215.011724774;
-  atomic_mass_map[912150000] = 215.019182929;
-  atomic_mass_map[802160000] = 216.02132;
-  atomic_mass_map[812160000] = 216.0158;
-  atomic_mass_map[822160000] = 216.00803;
-  atomic_mass_map[832160000] = 216.006305989;
-  atomic_mass_map[842160000] = 216.001915186;
-  atomic_mass_map[852160000] = 216.002423555;
-  atomic_mass_map[862160000] = 216.000271859;
-  atomic_mass_map[872160000] = 216.003189865;
-  atomic_mass_map[882160000] = 216.003533423;
-  atomic_mass_map[892160000] = 216.008743482;
-  atomic_mass_map[902160000] = 216.011056007;
-  atomic_mass_map[912160000] = 216.019108913;
-  atomic_mass_map[812170000] = 217.01966;
-  atomic_mass_map[822170000] = 217.01314;
-  atomic_mass_map[832170000] = 217.009372;
-  atomic_mass_map[842170000] = 217.006318159;
-  atomic_mass_map[852170000] = 217.004719222;
-  atomic_mass_map[862170000] = 217.003928018;
-  atomic_mass_map[872170000] = 217.004632282;
-  atomic_mass_map[882170000] = 217.006320726;
-  atomic_mass_map[892170000] = 217.009343872;
-  atomic_mass_map[902170000] = 217.013116701;
-  atomic_mass_map[912170000] = 217.018325363;
-  atomic_mass_map[922170000] = 217.024661;
-  atomic_mass_map[812180000] = 218.02479;
-  atomic_mass_map[822180000] = 218.01659;
-  atomic_mass_map[832180000] = 218.014188;
-  atomic_mass_map[842180000] = 218.008973546;
-  atomic_mass_map[852180000] = 218.008694723;
-  atomic_mass_map[862180000] = 218.005601586;
-  atomic_mass_map[872180000] = 218.007578653;
-  atomic_mass_map[882180000] = 218.007140631;
-  atomic_mass_map[892180000] = 218.01164164;
-  atomic_mass_map[902180000] = 218.013276331;
-  atomic_mass_map[912180000] = 218.020058579;
-  atomic_mass_map[922180000] = 218.023523472;
-  atomic_mass_map[822190000] = 219.02177;
-  atomic_mass_map[832190000] = 219.01748;
-  atomic_mass_map[842190000] = 219.013614;
-  atomic_mass_map[852190000] = 219.011161848;
-  atomic_mass_map[862190000] = 219.009480361;
-  atomic_mass_map[872190000] = 219.009252427;
-  atomic_mass_map[882190000] = 219.010085484;
-  atomic_mass_map[892190000] = 219.01242073;
-  atomic_mass_map[902190000] = 219.015537481;
-  atomic_mass_map[912190000] = 219.019904029;
-  atomic_mass_map[922190000] = 219.02499913;
-  atomic_mass_map[932190000] = 219.03143;
-  atomic_mass_map[822200000] = 220.02541;
-  atomic_mass_map[832200000] = 220.02235;
-  atomic_mass_map[842200000] = 220.016386;
-  atomic_mass_map[852200000] = 220.015433;
-  atomic_mass_map[862200000] = 220.01139413;
-  atomic_mass_map[872200000] = 220.012327702;
-  atomic_mass_map[882200000] = 220.011025872;
-  atomic_mass_map[892200000] = 220.014754854;
-  atomic_mass_map[902200000] = 220.015748148;
-  atomic_mass_map[912200000] = 220.021705;
-  atomic_mass_map[922200000] = 220.02462;
-  atomic_mass_map[932200000] = 220.03254;
-  atomic_mass_map[832210000] = 221.02587;
-  atomic_mass_map[842210000] = 221.021228;
-  atomic_mass_map[852210000] = 221.018017;
-  atomic_mass_map[862210000] = 221.015537076;
-  atomic_mass_map[872210000] = 221.014255163;
-  atomic_mass_map[882210000] = 221.01391768;
-  atomic_mass_map[892210000] = 221.015591579;
-  atomic_mass_map[902210000] = 221.018184072;
-  atomic_mass_map[912210000] = 221.021874941;
-  atomic_mass_map[922210000] = 221.026284;
-  atomic_mass_map[932210000] = 221.03204;
-  atomic_mass_map[832220000] = 222.03078;
-  atomic_mass_map[842220000] = 222.02414;
-  atomic_mass_map[852220000] = 222.022494;
-  atomic_mass_map[862220000] = 222.017578246;
-  atomic_mass_map[872220000] = 222.017552192;
-  atomic_mass_map[882220000] = 222.015374846;
-  atomic_mass_map[892220000] = 222.017844181;
-  atomic_mass_map[902220000] = 222.018468521;
-  atomic_mass_map[912220000] = 222.023784;
-  atomic_mass_map[922220000] = 222.026003;
-  atomic_mass_map[932220000] = 222.0333;
-  atomic_mass_map[832230000] = 223.0345;
-  atomic_mass_map[842230000] = 223.02907;
-  atomic_mass_map[852230000] = 223.025151;
-  atomic_mass_map[862230000] = 223.021889286;
-  atomic_mass_map[872230000] = 223.019736013;
-  atomic_mass_map[882230000] = 223.018502327;
-  atomic_mass_map[892230000] = 223.019137747;
-  atomic_mass_map[902230000] = 223.020811853;
-  atomic_mass_map[912230000] = 223.023962614;
-  atomic_mass_map[922230000] = 223.027739187;
-  atomic_mass_map[932230000] = 223.03285;
-  atomic_mass_map[832240000] = 224.03947;
-  atomic_mass_map[842240000] = 224.03211;
-  atomic_mass_map[852240000] = 224.029749;
-  atomic_mass_map[862240000] = 224.024095805;
-  atomic_mass_map[872240000] = 224.023398;
-  atomic_mass_map[882240000] = 224.020211968;
-  atomic_mass_map[892240000] = 224.021723163;
-  atomic_mass_map[902240000] = 224.021464382;
-  atomic_mass_map[912240000] = 224.025617614;
-  atomic_mass_map[922240000] = 224.027605163;
-  atomic_mass_map[932240000] = 224.03422;
-  atomic_mass_map[842250000] = 225.03707;
-  atomic_mass_map[852250000] = 225.03263;
-  atomic_mass_map[862250000] = 225.028485574;
-  atomic_mass_map[872250000] = 225.025572682;
-  atomic_mass_map[882250000] = 225.023611857;
-  atomic_mass_map[892250000] = 225.023229987;
-  atomic_mass_map[902250000] = 225.023951363;
-  atomic_mass_map[912250000] = 225.026131009;
-  atomic_mass_map[922250000] = 225.02939135;
-  atomic_mass_map[932250000] = 225.033910892;
-  atomic_mass_map[842260000] = 226.04031;
-  atomic_mass_map[852260000] = 226.03716;
-  atomic_mass_map[862260000] = 226.030861382;
-  atomic_mass_map[872260000] = 226.029566;
-  atomic_mass_map[882260000] = 226.02541033;
-  atomic_mass_map[892260000] = 226.026098383;
-  atomic_mass_map[902260000] = 226.024903383;
-  atomic_mass_map[912260000] = 226.027948082;
-  atomic_mass_map[922260000] = 226.029339101;
-  atomic_mass_map[932260000] = 226.035188;
-  atomic_mass_map[842270000] = 227.04539;
-  atomic_mass_map[852270000] = 227.04024;
-  atomic_mass_map[862270000] = 227.035304396;
-  atomic_mass_map[872270000] = 227.031869;
-  atomic_mass_map[882270000] = 227.029178349;
-  atomic_mass_map[892270000] = 227.027752283;
-  atomic_mass_map[902270000] = 227.027704227;
-  atomic_mass_map[912270000] = 227.028805351;
-  atomic_mass_map[922270000] = 227.031156773;
-  atomic_mass_map[932270000] = 227.034957129;
-  atomic_mass_map[852280000] = 228.04475;
-  atomic_mass_map[862280000] = 228.037835418;
-  atomic_mass_map[872280000] = 228.035823175;
-  atomic_mass_map[882280000] = 228.031070728;
-  atomic_mass_map[892280000] = 228.031021547;
-  atomic_mass_map[902280000] = 228.028741272;
-  atomic_mass_map[912280000] = 228.031051673;
-  atomic_mass_map[922280000] = 228.031371492;
-  atomic_mass_map[932280000] = 228.036066866;
-  atomic_mass_map[942280000] = 228.038732491;
-  atomic_mass_map[852290000] = 229.04812;
-  atomic_mass_map[862290000] = 229.042257277;
-  atomic_mass_map[872290000] = 229.038298;
-  atomic_mass_map[882290000] = 229.034942262;
-  atomic_mass_map[892290000] = 229.032955884;
-  atomic_mass_map[902290000] = 229.031762713;
-  atomic_mass_map[912290000] = 229.032097236;
-  atomic_mass_map[922290000] = 229.03350628;
-  atomic_mass_map[932290000] = 229.036264139;
-  atomic_mass_map[942290000] = 229.040143614;
-  atomic_mass_map[862300000] = 230.04514;
-  atomic_mass_map[872300000] = 230.042416349;
-  atomic_mass_map[882300000] = 230.037054781;
-  atomic_mass_map[892300000] = 230.036327;
-  atomic_mass_map[902300000] = 230.03313413;
-  atomic_mass_map[912300000] = 230.034541047;
-  atomic_mass_map[922300000] = 230.033940096;
-  atomic_mass_map[932300000] = 230.037827926;
-  atomic_mass_map[942300000] = 230.039650283;
-  atomic_mass_map[952300000] = 230.04609;
-  atomic_mass_map[862310000] = 231.04987;
-  atomic_mass_map[872310000] = 231.045158;
-  atomic_mass_map[882310000] = 231.041027087;
-  atomic_mass_map[892310000] = 231.038393;
-  atomic_mass_map[902310000] = 231.036304628;
-  atomic_mass_map[912310000] = 231.035884243;
-  atomic_mass_map[922310000] = 231.036293861;
-  atomic_mass_map[932310000] = 231.038245364;
-  atomic_mass_map[942310000] = 231.041101511;
-  atomic_mass_map[952310000] = 231.04556;
-  atomic_mass_map[872320000] = 232.049368;
-  atomic_mass_map[882320000] = 232.04347527;
-  atomic_mass_map[892320000] = 232.042034;
-  atomic_mass_map[902320000] = 232.03805576;
-  atomic_mass_map[912320000] = 232.038591737;
-  atomic_mass_map[922320000] = 232.037156297;
-  atomic_mass_map[932320000] = 232.040109;
-  atomic_mass_map[942320000] = 232.041184582;
-  atomic_mass_map[952320000] = 232.04645;
-  atomic_mass_map[962320000] = 232.049817;
-  atomic_mass_map[872330000] = 233.05264;
-  atomic_mass_map[882330000] = 233.047582;
-  atomic_mass_map[892330000] = 233.044346;
-  atomic_mass_map[902330000] = 233.041582278;
-  atomic_mass_map[912330000] = 233.040247222;
-  atomic_mass_map[922330000] = 233.039635525;
-  atomic_mass_map[932330000] = 233.040740989;
-  atomic_mass_map[942330000] = 233.042997716;
-  atomic_mass_map[952330000] = 233.046445;
-  atomic_mass_map[962330000] = 233.050770001;
-  atomic_mass_map[882340000] = 234.050342;
-  atomic_mass_map[892340000] = 234.048139;
-  atomic_mass_map[902340000] = 234.043601407;
-  atomic_mass_map[912340000] = 234.043307161;
-  atomic_mass_map[922340000] = 234.040952306;
-  atomic_mass_map[932340000] = 234.042895256;
-  atomic_mass_map[942340000] = 234.043317387;
-  atomic_mass_map[952340000] = 234.047731;
-  atomic_mass_map[962340000] = 234.050160237;
-  atomic_mass_map[972340000] = 234.057267;
-  atomic_mass_map[882350000] = 235.05497;
-  atomic_mass_map[892350000] = 235.05084;
-  atomic_mass_map[902350000] = 235.047255;
-  atomic_mass_map[912350000] = 235.045399;
-  atomic_mass_map[922350000] = 235.043930131;
-  atomic_mass_map[932350000] = 235.044063487;
-  atomic_mass_map[942350000] = 235.045286206;
-  atomic_mass_map[952350000] = 235.047908245;
-  atomic_mass_map[962350000] = 235.051542;
-  atomic_mass_map[972350000] = 235.05658;
-  atomic_mass_map[892360000] = 236.054988;
-  atomic_mass_map[902360000] = 236.049657;
-  atomic_mass_map[912360000] = 236.048668;
-  atomic_mass_map[922360000] = 236.04556821;
-  atomic_mass_map[932360000] = 236.046569744;
-  atomic_mass_map[942360000] = 236.046058109;
-  atomic_mass_map[952360000] = 236.049428;
-  atomic_mass_map[962360000] = 236.051374477;
-  atomic_mass_map[972360000] = 236.05748;
-  atomic_mass_map[892370000] = 237.05827;
-  atomic_mass_map[902370000] = 237.053629;
-  atomic_mass_map[912370000] = 237.051023;
-  atomic_mass_map[922370000] = 237.048730378;
-  atomic_mass_map[932370000] = 237.048173649;
-  atomic_mass_map[942370000] = 237.04840983;
-  atomic_mass_map[952370000] = 237.049996;
-  atomic_mass_map[962370000] = 237.052869294;
-  atomic_mass_map[972370000] = 237.0571;
-  atomic_mass_map[982370000] = 237.062197789;
-  atomic_mass_map[902380000] = 238.056496;
-  atomic_mass_map[912380000] = 238.054637;
-  atomic_mass_map[922380000] = 238.050788423;
-  atomic_mass_map[932380000] = 238.050946611;
-  atomic_mass_map[942380000] = 238.049560111;
-  atomic_mass_map[952380000] = 238.051984542;
-  atomic_mass_map[962380000] = 238.05308142;
-  atomic_mass_map[972380000] = 238.058204;
-  atomic_mass_map[982380000] = 238.06149;
-  atomic_mass_map[902390000] = 239.06077;
-  atomic_mass_map[912390000] = 239.05726;
-  atomic_mass_map[922390000] = 239.054293475;
-  atomic_mass_map[932390000] = 239.052939241;
-  atomic_mass_map[942390000] = 239.052163591;
-  atomic_mass_map[952390000] = 239.053024699;
-  atomic_mass_map[962390000] = 239.054910117;
-  atomic_mass_map[972390000] = 239.058241;
-  atomic_mass_map[982390000] = 239.062529;
-  atomic_mass_map[992390000] = 239.06823;
-  atomic_mass_map[912400000] = 240.06098;
-  atomic_mass_map[922400000] = 240.056593356;
-  atomic_mass_map[932400000] = 240.056165427;
-  atomic_mass_map[942400000] = 240.05381375;
-  atomic_mass_map[952400000] = 240.055300384;
-  atomic_mass_map[962400000] = 240.055529681;
-  atomic_mass_map[972400000] = 240.059759;
-  atomic_mass_map[982400000] = 240.062255728;
-  atomic_mass_map[992400000] = 240.06892;
-  atomic_mass_map[912410000] = 241.06408;
-  atomic_mass_map[922410000] = 241.06033;
-  atomic_mass_map[932410000] = 241.058252636;
-  atomic_mass_map[942410000] = 241.056851661;
-  atomic_mass_map[952410000] = 241.056829349;
-  atomic_mass_map[962410000] = 241.05765317;
-  atomic_mass_map[972410000] = 241.060155;
-  atomic_mass_map[982410000] = 241.06369;
-  atomic_mass_map[992410000] = 241.06856;
-  atomic_mass_map[1002410000] = 241.07421;
-  atomic_mass_map[922420000] = 242.062932;
-  atomic_mass_map[932420000] = 242.061641379;
-  atomic_mass_map[942420000] = 242.058742809;
-  atomic_mass_map[952420000] = 242.059549364;
-  atomic_mass_map[962420000] = 242.058836039;
-  atomic_mass_map[972420000] = 242.061982;
-  atomic_mass_map[982420000] = 242.063754274;
-  atomic_mass_map[992420000] = 242.069567;
-  atomic_mass_map[1002420000] = 242.07343;
-  atomic_mass_map[922430000] = 243.06699;
-  atomic_mass_map[932430000] = 243.06428;
-  atomic_mass_map[942430000] = 243.062003595;
-  atomic_mass_map[952430000] = 243.061381302;
-  atomic_mass_map[962430000] = 243.061389325;
-  atomic_mass_map[972430000] = 243.063007791;
-  atomic_mass_map[982430000] = 243.065477;
-  atomic_mass_map[992430000] = 243.06951;
-  atomic_mass_map[1002430000] = 243.074465;
-  atomic_mass_map[932440000] = 244.06785;
-  atomic_mass_map[942440000] = 244.06420526;
-  atomic_mass_map[952440000] = 244.064285052;
-  atomic_mass_map[962440000] = 244.062752783;
-  atomic_mass_map[972440000] = 244.065180979;
-  atomic_mass_map[982440000] = 244.066000801;
-  atomic_mass_map[992440000] = 244.070883;
-  atomic_mass_map[1002440000] = 244.074038;
-  atomic_mass_map[932450000] = 245.0708;
-  atomic_mass_map[942450000] = 245.067826058;
-  atomic_mass_map[952450000] = 245.066454834;
-  atomic_mass_map[962450000] = 245.065491454;
-  atomic_mass_map[972450000] = 245.066361821;
-  atomic_mass_map[982450000] = 245.068048677;
-  atomic_mass_map[992450000] = 245.071249;
-  atomic_mass_map[1002450000] = 245.075349;
-  atomic_mass_map[1012450000] = 245.080808;
-  atomic_mass_map[942460000] = 246.070205458;
-  atomic_mass_map[952460000] = 246.069775;
-  atomic_mass_map[962460000] = 246.067223841;
-  atomic_mass_map[972460000] = 246.068673126;
-  atomic_mass_map[982460000] = 246.068805531;
-  atomic_mass_map[992460000] = 246.072896;
-  atomic_mass_map[1002460000] = 246.07535047;
-  atomic_mass_map[1012460000] = 246.081713;
-  atomic_mass_map[942470000] = 247.07419;
-  atomic_mass_map[952470000] = 247.072093;
-  atomic_mass_map[962470000] = 247.070354131;
-  atomic_mass_map[972470000] = 247.070307302;
-  atomic_mass_map[982470000] = 247.070965463;
-  atomic_mass_map[992470000] = 247.073622017;
-  atomic_mass_map[1002470000] = 247.076945;
-  atomic_mass_map[1012470000] = 247.081522;
-  atomic_mass_map[952480000] = 248.075753;
-  atomic_mass_map[962480000] = 248.072349862;
-  atomic_mass_map[972480000] = 248.073088;
-  atomic_mass_map[982480000] = 248.072185066;
-  atomic_mass_map[992480000] = 248.075471;
-  atomic_mass_map[1002480000] = 248.077186463;
-  atomic_mass_map[1012480000] = 248.082823;
-  atomic_mass_map[1022480000] = 248.08655;
-  atomic_mass_map[952490000] = 249.07848;
-  atomic_mass_map[962490000] = 249.075954767;
-  atomic_mass_map[972490000] = 249.074987676;
-  atomic_mass_map[982490000] = 249.074853903;
-  atomic_mass_map[992490000] = 249.076411;
-  atomic_mass_map[1002490000] = 249.07892755;
-  atomic_mass_map[1012490000] = 249.082914;
-  atomic_mass_map[1022490000] = 249.087797;
-  atomic_mass_map[962500000] = 250.078358313;
-  atomic_mass_map[972500000] = 250.078316698;
-  atomic_mass_map[982500000] = 250.076406244;
-  atomic_mass_map[992500000] = 250.078612;
-  atomic_mass_map[1002500000] = 250.079521034;
-  atomic_mass_map[1012500000] = 250.084415;
-  atomic_mass_map[1022500000] = 250.087562;
-  atomic_mass_map[962510000] = 251.082286441;
-  atomic_mass_map[972510000] = 251.080762009;
-  atomic_mass_map[982510000] = 251.079588625;
-  atomic_mass_map[992510000] = 251.079993586;
-  atomic_mass_map[1002510000] = 251.08153989;
-  atomic_mass_map[1012510000] = 251.084774376;
-  atomic_mass_map[1022510000] = 251.088944;
-  atomic_mass_map[1032510000] = 251.09418;
-  atomic_mass_map[962520000] = 252.08487;
-  atomic_mass_map[972520000] = 252.084311;
-  atomic_mass_map[982520000] = 252.081627199;
-  atomic_mass_map[992520000] = 252.082979865;
-  atomic_mass_map[1002520000] = 252.08246706;
-  atomic_mass_map[1012520000] = 252.086432;
-  atomic_mass_map[1022520000] = 252.088966908;
-  atomic_mass_map[1032520000] = 252.095264;
-  atomic_mass_map[972530000] = 253.08688;
-  atomic_mass_map[982530000] = 253.085134499;
-  atomic_mass_map[992530000] = 253.084825715;
-  atomic_mass_map[1002530000] = 253.085184571;
-  atomic_mass_map[1012530000] = 253.087144;
-  atomic_mass_map[1022530000] = 253.090564103;
-  atomic_mass_map[1032530000] = 253.095091;
-  atomic_mass_map[1042530000] = 253.100438;
-  atomic_mass_map[972540000] = 254.0906;
-  atomic_mass_map[982540000] = 254.087324263;
-  atomic_mass_map[992540000] = 254.088022199;
-  atomic_mass_map[1002540000] = 254.086854397;
-  atomic_mass_map[1012540000] = 254.089592;
-  atomic_mass_map[1022540000] = 254.090955661;
-  atomic_mass_map[1032540000] = 254.096483;
-  atomic_mass_map[1042540000] = 254.100053;
-  atomic_mass_map[982550000] = 255.091048;
-  atomic_mass_map[992550000] = 255.090274958;
-  atomic_mass_map[1002550000] = 255.089964038;
-  atomic_mass_map[1012550000] = 255.091084149;
-  atomic_mass_map[1022550000] = 255.093191404;
-  atomic_mass_map[1032550000] = 255.096562404;
-  atomic_mass_map[1042550000] = 255.101268;
-  atomic_mass_map[1052550000] = 255.107068;
-  atomic_mass_map[982560000] = 256.093442;
-  atomic_mass_map[992560000] = 256.093599;
-  atomic_mass_map[1002560000] = 256.091774469;
-  atomic_mass_map[1012560000] = 256.093889;
-  atomic_mass_map[1022560000] = 256.09428287;
-  atomic_mass_map[1032560000] = 256.09849403;
-  atomic_mass_map[1042560000] = 256.101152218;
-  atomic_mass_map[1052560000] = 256.10789;
-  atomic_mass_map[992570000] = 257.095979;
-  atomic_mass_map[1002570000] = 257.095106078;
-  atomic_mass_map[1012570000] = 257.095542387;
-  atomic_mass_map[1022570000] = 257.09688783;
-  atomic_mass_map[1032570000] = 257.099418;
-  atomic_mass_map[1042570000] = 257.10291812;
-  atomic_mass_map[1052570000] = 257.107578;
-  atomic_mass_map[992580000] = 258.09952;
-  atomic_mass_map[1002580000] = 258.097077;
-  atomic_mass_map[1012580000] = 258.098431496;
-  atomic_mass_map[1022580000] = 258.098207;
-  atomic_mass_map[1032580000] = 258.101755;
-  atomic_mass_map[1042580000] = 258.103427679;
-  atomic_mass_map[1052580000] = 258.109285;
-  atomic_mass_map[1062580000] = 258.112983;
-  atomic_mass_map[1002590000] = 259.100597;
-  atomic_mass_map[1012590000] = 259.100511;
-  atomic_mass_map[1022590000] = 259.101032;
-  atomic_mass_map[1032590000] = 259.102902;
-  atomic_mass_map[1042590000] = 259.105596;
-  atomic_mass_map[1052590000] = 259.109491866;
-  atomic_mass_map[1062590000] = 259.114396;
-  atomic_mass_map[1002600000] = 260.102809;
-  atomic_mass_map[1012600000] = 260.103653;
-  atomic_mass_map[1022600000] = 260.102644;
-  atomic_mass_map[1032600000] = 260.105505;
-  atomic_mass_map[1042600000] = 260.106441;
-  atomic_mass_map[1052600000] = 260.111297;
-  atomic_mass_map[1062600000] = 260.114384105;
-  atomic_mass_map[1072600000] = 260.121659;
-  atomic_mass_map[1012610000] = 261.105828;
-  atomic_mass_map[1022610000] = 261.105697;
-  atomic_mass_map[1032610000] = 261.106884;
-  atomic_mass_map[1042610000] = 261.108773401;
-  atomic_mass_map[1052610000] = 261.111917;
-  atomic_mass_map[1062610000] = 261.115949461;
-  atomic_mass_map[1072610000] = 261.121455;
-  atomic_mass_map[1012620000] = 262.109101;
-  atomic_mass_map[1022620000] = 262.107464;
-  atomic_mass_map[1032620000] = 262.109612;
-  atomic_mass_map[1042620000] = 262.109925;
-  atomic_mass_map[1052620000] = 262.114072;
-  atomic_mass_map[1062620000] = 262.116336679;
-  atomic_mass_map[1072620000] = 262.122967;
-  atomic_mass_map[1022630000] = 263.110715;
-  atomic_mass_map[1032630000] = 263.111359;
-  atomic_mass_map[1042630000] = 263.112495;
-  atomic_mass_map[1052630000] = 263.11499;
-  atomic_mass_map[1062630000] = 263.118294;
-  atomic_mass_map[1072630000] = 263.122916;
-  atomic_mass_map[1082630000] = 263.128522;
-  atomic_mass_map[1022640000] = 264.112734;
-  atomic_mass_map[1032640000] = 264.114201;
-  atomic_mass_map[1042640000] = 264.113879;
-  atomic_mass_map[1052640000] = 264.117405;
-  atomic_mass_map[1062640000] = 264.118931;
-  atomic_mass_map[1072640000] = 264.124593;
-  atomic_mass_map[1082640000] = 264.128356917;
-  atomic_mass_map[1032650000] = 265.116193;
-  atomic_mass_map[1042650000] = 265.116684;
-  atomic_mass_map[1052650000] = 265.118613;
-  atomic_mass_map[1062650000] = 265.121093;
-  atomic_mass_map[1072650000] = 265.124914;
-  atomic_mass_map[1082650000] = 265.129792986;
-  atomic_mass_map[1092650000] = 265.135996;
-  atomic_mass_map[1032660000] = 266.119831;
-  atomic_mass_map[1042660000] = 266.118172;
-  atomic_mass_map[1052660000] = 266.121029;
-  atomic_mass_map[1062660000] = 266.121975;
-  atomic_mass_map[1072660000] = 266.126794;
-  atomic_mass_map[1082660000] = 266.1300464;
-  atomic_mass_map[1092660000] = 266.137374;
-  atomic_mass_map[1042670000] = 267.121789;
-  atomic_mass_map[1052670000] = 267.122465;
-  atomic_mass_map[1062670000] = 267.124357;
-  atomic_mass_map[1072670000] = 267.127501;
-  atomic_mass_map[1082670000] = 267.131673;
-  atomic_mass_map[1092670000] = 267.137189;
-  atomic_mass_map[1102670000] = 267.143768;
-  atomic_mass_map[1042680000] = 268.123968;
-  atomic_mass_map[1052680000] = 268.125671;
-  atomic_mass_map[1062680000] = 268.125392;
-  atomic_mass_map[1072680000] = 268.129692;
-  atomic_mass_map[1082680000] = 268.131865;
-  atomic_mass_map[1092680000] = 268.138649;
-  atomic_mass_map[1102680000] = 268.143478;
-  atomic_mass_map[1052690000] = 269.127911;
-  atomic_mass_map[1062690000] = 269.128627;
-  atomic_mass_map[1072690000] = 269.130416;
-  atomic_mass_map[1082690000] = 269.133753;
-  atomic_mass_map[1092690000] = 269.138822;
-  atomic_mass_map[1102690000] = 269.144752124;
-  atomic_mass_map[1052700000] = 270.131356;
-  atomic_mass_map[1062700000] = 270.130427;
-  atomic_mass_map[1072700000] = 270.133363;
-  atomic_mass_map[1082700000] = 270.13429;
-  atomic_mass_map[1092700000] = 270.140327;
-  atomic_mass_map[1102700000] = 270.144584153;
-  atomic_mass_map[1062710000] = 271.133933;
-  atomic_mass_map[1072710000] = 271.135256;
-  atomic_mass_map[1082710000] = 271.13717;
-  atomic_mass_map[1092710000] = 271.140744;
-  atomic_mass_map[1102710000] = 271.145946;
-  atomic_mass_map[1062720000] = 272.13589;
-  atomic_mass_map[1072720000] = 272.138264;
-  atomic_mass_map[1082720000] = 272.138495;
-  atomic_mass_map[1092720000] = 272.143406;
-  atomic_mass_map[1102720000] = 272.14602;
-  atomic_mass_map[1112720000] = 272.153273;
-  atomic_mass_map[1062730000] = 273.13958;
-  atomic_mass_map[1072730000] = 273.14024;
-  atomic_mass_map[1082730000] = 273.141679;
-  atomic_mass_map[1092730000] = 273.144399;
-  atomic_mass_map[1102730000] = 273.14856;
-  atomic_mass_map[1112730000] = 273.153127;
-  atomic_mass_map[1072740000] = 274.143548;
-  atomic_mass_map[1082740000] = 274.143304;
-  atomic_mass_map[1092740000] = 274.147245;
-  atomic_mass_map[1102740000] = 274.149411;
-  atomic_mass_map[1112740000] = 274.155253;
-  atomic_mass_map[1072750000] = 275.14567;
-  atomic_mass_map[1082750000] = 275.146668;
-  atomic_mass_map[1092750000] = 275.14882;
-  atomic_mass_map[1102750000] = 275.152033;
-  atomic_mass_map[1112750000] = 275.155939;
-  atomic_mass_map[1082760000] = 276.148455;
-  atomic_mass_map[1092760000] = 276.151594;
-  atomic_mass_map[1102760000] = 276.153025;
-  atomic_mass_map[1112760000] = 276.158334;
-  atomic_mass_map[1122760000] = 276.16141;
-  atomic_mass_map[1082770000] = 277.151899;
-  atomic_mass_map[1092770000] = 277.153268;
-  atomic_mass_map[1102770000] = 277.155914;
-  atomic_mass_map[1112770000] = 277.159069;
-  atomic_mass_map[1122770000] = 277.163641;
-  atomic_mass_map[1092780000] = 278.156307;
-  atomic_mass_map[1102780000] = 278.15704;
-  atomic_mass_map[1112780000] = 278.161493;
-  atomic_mass_map[1122780000] = 278.164156;
-  atomic_mass_map[1132780000] = 278.170578;
-  atomic_mass_map[1092790000] = 279.158075;
-  atomic_mass_map[1102790000] = 279.160097;
-  atomic_mass_map[1112790000] = 279.162722;
-  atomic_mass_map[1122790000] = 279.166542;
-  atomic_mass_map[1132790000] = 279.17095;
-  atomic_mass_map[1102800000] = 280.161311;
-  atomic_mass_map[1112800000] = 280.165138;
-  atomic_mass_map[1122800000] = 280.167147;
-  atomic_mass_map[1132800000] = 280.17293;
-  atomic_mass_map[1102810000] = 281.164511;
-  atomic_mass_map[1112810000] = 281.16636;
-  atomic_mass_map[1122810000] = 281.169746;
-  atomic_mass_map[1132810000] = 281.17348;
-  atomic_mass_map[1112820000] = 282.169119;
-  atomic_mass_map[1122820000] = 282.170496;
-  atomic_mass_map[1132820000] = 282.175672;
-  atomic_mass_map[1112830000] = 283.170544;
-  atomic_mass_map[1122830000] = 283.17327;
-  atomic_mass_map[1132830000] = 283.176571;
-  atomic_mass_map[1122840000] = 284.174156;
-  atomic_mass_map[1132840000] = 284.178727;
-  atomic_mass_map[1122850000] = 285.177117;
-  atomic_mass_map[1132850000] = 285.179727;
-  atomic_mass_map[1142850000] = 285.183643;
-  atomic_mass_map[1132860000] = 286.182208;
-  atomic_mass_map[1142860000] = 286.184235;
-  atomic_mass_map[1132870000] = 287.183389;
-  atomic_mass_map[1142870000] = 287.186783;
-  atomic_mass_map[1152870000] = 287.190704;
-  atomic_mass_map[1142880000] = 288.187572;
-  atomic_mass_map[1152880000] = 288.19274;
-  atomic_mass_map[1142890000] = 289.190419;
-  atomic_mass_map[1152890000] = 289.193627;
-  atomic_mass_map[1162890000] = 289.198162;
-  atomic_mass_map[1152900000] = 290.195975;
-  atomic_mass_map[1162900000] = 290.198638;
-  atomic_mass_map[1152910000] = 291.197071;
-  atomic_mass_map[1162910000] = 291.201077;
-  atomic_mass_map[1172910000] = 291.205535;
-  atomic_mass_map[1162920000] = 292.201742;
-  atomic_mass_map[1172920000] = 292.207463;
-  atomic_mass_map[1162930000] = 293.204487;
-  atomic_mass_map[1172930000] = 293.208236;
-  atomic_mass_map[1182930000] = 293.213562;
-  atomic_mass_map[1172940000] = 294.210462;
-  atomic_mass_map[1182940000] = 294.213921;
-  atomic_mass_map[1182950000] = 295.21624;
+double pyne::_atomic_mass_memory(int nuc) {
+  return _atomic_table_find(atomic_mass_table_nucs,
+    atomic_mass_table_values, atomic_mass_table_size, nuc);
 }
 
+double pyne::_natural_abund_memory(int nuc) {
+  return _atomic_table_find(natural_abund_table_nucs,
+    natural_abund_table_values, natural_abund_table_size, nuc);
+}
 
-void pyne::_insert_abund_map() {
-  natural_abund_map[10010000] = 99.9885;
-  natural_abund_map[10020000] = 0.0115;
-  natural_abund_map[20030000] = 0.000134;
-  natural_abund_map[20040000] = 99.999866;
-  natural_abund_map[30060000] = 7.59;
-  natural_abund_map[30070000] = 92.41;
-  natural_abund_map[40090000] = 100.0;
-  natural_abund_map[50100000] = 19.9;
-  natural_abund_map[50110000] = 80.1;
-  natural_abund_map[60120000] = 98.93;
-  natural_abund_map[60130000] = 1.07;
-  natural_abund_map[70140000] = 99.636;
-  natural_abund_map[70150000] = 0.364;
-  natural_abund_map[80160000] = 99.757;
-  natural_abund_map[80170000] = 0.038;
-  natural_abund_map[80180000] = 0.205;
-  natural_abund_map[90190000] = 100.0;
-  natural_abund_map[100200000] = 90.48;
-  natural_abund_map[100210000] = 0.27;
-  natural_abund_map[100220000] = 9.25;
-  natural_abund_map[110230000] = 100.0;
-  natural_abund_map[120240000] = 78.99;
-  natural_abund_map[120250000] = 10.00;
-  natural_abund_map[120260000] = 11.01;
-  natural_abund_map[130270000] = 100.0;
-  natural_abund_map[140280000] = 92.223;
-  natural_abund_map[140290000] = 4.685;
-  natural_abund_map[140300000] = 3.092;
-  natural_abund_map[150310000] = 100.0;
-  natural_abund_map[160320000] = 94.99;
-  natural_abund_map[160330000] = 0.75;
-  natural_abund_map[160340000] = 4.25;
-  natural_abund_map[160360000] = 0.01;
-  natural_abund_map[170350000] = 75.76;
-  natural_abund_map[170370000] = 24.24;
-  natural_abund_map[180360000] = 0.3336;
-  natural_abund_map[180380000] = 0.0629;
-  natural_abund_map[180400000] = 99.6035;
-  natural_abund_map[190390000] = 93.2581;
-  natural_abund_map[190400000] = 0.0117;
-  natural_abund_map[190410000] = 6.7302;
-  natural_abund_map[200400000] = 96.941;
-  natural_abund_map[200420000] = 0.647;
-  natural_abund_map[200430000] = 0.135;
-  natural_abund_map[200440000] = 2.086;
-  natural_abund_map[200460000] = 0.004;
-  natural_abund_map[200480000] = 0.187;
-  natural_abund_map[210450000] = 100.0;
-  natural_abund_map[220460000] = 8.25;
-  natural_abund_map[220470000] = 7.44;
-  natural_abund_map[220480000] = 73.72;
-  natural_abund_map[220490000] = 5.41;
-  natural_abund_map[220500000] = 5.18;
-  natural_abund_map[230500000] = 0.250;
-  natural_abund_map[230510000] = 99.750;
-  natural_abund_map[240500000] = 4.345;
-  natural_abund_map[240520000] = 83.789;
-  natural_abund_map[240530000] = 9.501;
-  natural_abund_map[240540000] = 2.365;
-  natural_abund_map[250550000] = 100.0;
-  natural_abund_map[260540000] = 5.845;
-  natural_abund_map[260560000] = 91.754;
-  natural_abund_map[260570000] = 2.119;
-  natural_abund_map[260580000] = 0.282;
-  natural_abund_map[270590000] = 100.0;
-  natural_abund_map[280580000] = 68.077;
-  natural_abund_map[280600000] = 26.223;
-  natural_abund_map[280610000] = 1.1399;
-  natural_abund_map[280620000] = 3.6346;
-  natural_abund_map[280640000] = 0.9255;
-  natural_abund_map[290630000] = 69.15;
-  natural_abund_map[290650000] = 30.85;
-  natural_abund_map[300640000] = 49.17;
-  natural_abund_map[300660000] = 27.73;
-  natural_abund_map[300670000] = 4.04;
-  natural_abund_map[300680000] = 18.45;
-  natural_abund_map[300700000] = 0.61;
-  natural_abund_map[310690000] = 60.108;
-  natural_abund_map[310710000] = 39.892;
-  natural_abund_map[320700000] = 20.57;
-  natural_abund_map[320720000] = 27.45;
-  natural_abund_map[320730000] = 7.75;
-  natural_abund_map[320740000] = 36.50;
-  natural_abund_map[320760000] = 7.73;
-  natural_abund_map[330750000] = 100.0;
-  natural_abund_map[340740000] = 0.89;
-  natural_abund_map[340760000] = 9.37;
-  natural_abund_map[340770000] = 7.63;
-  natural_abund_map[340780000] = 23.77;
-  natural_abund_map[340800000] = 49.61;
-  natural_abund_map[340820000] = 8.73;
-  natural_abund_map[350790000] = 50.69;
-  natural_abund_map[350810000] = 49.31;
-  natural_abund_map[360780000] = 0.355;
-  natural_abund_map[360800000] = 2.286;
-  natural_abund_map[360820000] = 11.593;
-  natural_abund_map[360830000] = 11.500;
-  natural_abund_map[360840000] = 56.987;
-  natural_abund_map[360860000] = 17.279;
-  natural_abund_map[370850000] = 72.17;
-  natural_abund_map[370870000] = 27.83;
-  natural_abund_map[380840000] = 0.56;
-  natural_abund_map[380860000] = 9.86;
-  natural_abund_map[380870000] = 7.00;
-  natural_abund_map[380880000] = 82.58;
-  natural_abund_map[390890000] = 100.0;
-  natural_abund_map[400900000] = 51.45;
-  natural_abund_map[400910000] = 11.22;
-  natural_abund_map[400920000] = 17.15;
-  natural_abund_map[400940000] = 17.38;
-  natural_abund_map[400960000] = 2.80;
-  natural_abund_map[410930000] = 100.0;
-  natural_abund_map[420920000] = 14.53;
-  natural_abund_map[420940000] = 9.15;
-  natural_abund_map[420950000] = 15.84;
-  natural_abund_map[420960000] = 16.67;
-  natural_abund_map[420970000] = 9.60;
-  natural_abund_map[420980000] = 24.39;
-  natural_abund_map[421000000] = 9.82;
-  natural_abund_map[440960000] = 5.54;
-  natural_abund_map[440980000] = 1.87;
-  natural_abund_map[440990000] = 12.76;
-  natural_abund_map[441000000] = 12.60;
-  natural_abund_map[441010000] = 17.06;
-  natural_abund_map[441020000] = 31.55;
-  natural_abund_map[441040000] = 18.62;
-  natural_abund_map[451030000] = 100.0;
-  natural_abund_map[461020000] = 1.02;
-  natural_abund_map[461040000] = 11.14;
-  natural_abund_map[461050000] = 22.33;
-  natural_abund_map[461060000] = 27.33;
-  natural_abund_map[461080000] = 26.46;
-  natural_abund_map[461100000] = 11.72;
-  natural_abund_map[471070000] = 51.839;
-  natural_abund_map[471090000] = 48.161;
-  natural_abund_map[481060000] = 1.25;
-  natural_abund_map[481080000] = 0.89;
-  natural_abund_map[481100000] = 12.49;
-  natural_abund_map[481110000] = 12.80;
-  natural_abund_map[481120000] = 24.13;
-  natural_abund_map[481130000] = 12.22;
-  natural_abund_map[481140000] = 28.73;
-  natural_abund_map[481160000] = 7.49;
-  natural_abund_map[491130000] = 4.29;
-  natural_abund_map[491150000] = 95.71;
-  natural_abund_map[501120000] = 0.97;
-  natural_abund_map[501140000] = 0.66;
-  natural_abund_map[501150000] = 0.34;
-  natural_abund_map[501160000] = 14.54;
-  natural_abund_map[501170000] = 7.68;
-  natural_abund_map[501180000] = 24.22;
-  natural_abund_map[501190000] = 8.59;
-  natural_abund_map[501200000] = 32.58;
-  natural_abund_map[501220000] = 4.63;
-  natural_abund_map[501240000] = 5.79;
-  natural_abund_map[511210000] = 57.21;
-  natural_abund_map[511230000] = 42.79;
-  natural_abund_map[521200000] = 0.09;
-  natural_abund_map[521220000] = 2.55;
-  natural_abund_map[521230000] = 0.89;
-  natural_abund_map[521240000] = 4.74;
-  natural_abund_map[521250000] = 7.07;
-  natural_abund_map[521260000] = 18.84;
-  natural_abund_map[521280000] = 31.74;
-  natural_abund_map[521300000] = 34.08;
-  natural_abund_map[531270000] = 100.0;
-  natural_abund_map[541240000] = 0.0952;
-  natural_abund_map[541260000] = 0.0890;
-  natural_abund_map[541280000] = 1.9102;
-  natural_abund_map[541290000] = 26.4006;
-  natural_abund_map[541300000] = 4.0710;
-  natural_abund_map[541310000] = 21.2324;
-  natural_abund_map[541320000] = 26.9086;
-  natural_abund_map[541340000] = 10.4357;
-  natural_abund_map[541360000] = 8.8573;
-  natural_abund_map[551330000] = 100.0;
-  natural_abund_map[561300000] = 0.106;
-  natural_abund_map[561320000] = 0.101;
-  natural_abund_map[561340000] = 2.417;
-  natural_abund_map[561350000] = 6.592;
-  natural_abund_map[561360000] = 7.854;
-  natural_abund_map[561370000] = 11.232;
-  natural_abund_map[561380000] = 71.698;
-  natural_abund_map[571380000] = 0.08881;
-  natural_abund_map[571390000] = 99.91119;
-  natural_abund_map[581360000] = 0.185;
-  natural_abund_map[581380000] = 0.251;
-  natural_abund_map[581400000] = 88.450;
-  natural_abund_map[581420000] = 11.114;
-  natural_abund_map[591410000] = 100.0;
-  natural_abund_map[601420000] = 27.152;
-  natural_abund_map[601430000] = 12.174;
-  natural_abund_map[601440000] = 23.798;
-  natural_abund_map[601450000] = 8.293;
-  natural_abund_map[601460000] = 17.189;
-  natural_abund_map[601480000] = 5.756;
-  natural_abund_map[601500000] = 5.638;
-  natural_abund_map[621440000] = 3.07;
-  natural_abund_map[621470000] = 14.99;
-  natural_abund_map[621480000] = 11.24;
-  natural_abund_map[621490000] = 13.82;
-  natural_abund_map[621500000] = 7.38;
-  natural_abund_map[621520000] = 26.75;
-  natural_abund_map[621540000] = 22.75;
-  natural_abund_map[631510000] = 47.81;
-  natural_abund_map[631530000] = 52.19;
-  natural_abund_map[641520000] = 0.20;
-  natural_abund_map[641540000] = 2.18;
-  natural_abund_map[641550000] = 14.80;
-  natural_abund_map[641560000] = 20.47;
-  natural_abund_map[641570000] = 15.65;
-  natural_abund_map[641580000] = 24.84;
-  natural_abund_map[641600000] = 21.86;
-  natural_abund_map[651590000] = 100.0;
-  natural_abund_map[661560000] = 0.056;
-  natural_abund_map[661580000] = 0.095;
-  natural_abund_map[661600000] = 2.329;
-  natural_abund_map[661610000] = 18.889;
-  natural_abund_map[661620000] = 25.475;
-  natural_abund_map[661630000] = 24.896;
-  natural_abund_map[661640000] = 28.260;
-  natural_abund_map[671650000] = 100.0;
-  natural_abund_map[681620000] = 0.139;
-  natural_abund_map[681640000] = 1.601;
-  natural_abund_map[681660000] = 33.503;
-  natural_abund_map[681670000] = 22.869;
-  natural_abund_map[681680000] = 26.978;
-  natural_abund_map[681700000] = 14.910;
-  natural_abund_map[691690000] = 100.0;
-  natural_abund_map[701680000] = 0.123;
-  natural_abund_map[701700000] = 2.982;
-  natural_abund_map[701710000] = 14.09;
-  natural_abund_map[701720000] = 21.68;
-  natural_abund_map[701730000] = 16.103;
-  natural_abund_map[701740000] = 32.026;
-  natural_abund_map[701760000] = 12.996;
-  natural_abund_map[711750000] = 97.401;
-  natural_abund_map[711760000] = 2.599;
-  natural_abund_map[721740000] = 0.16;
-  natural_abund_map[721760000] = 5.26;
-  natural_abund_map[721770000] = 18.60;
-  natural_abund_map[721780000] = 27.28;
-  natural_abund_map[721790000] = 13.62;
-  natural_abund_map[721800000] = 35.08;
-  natural_abund_map[731800000] = 0.01201;
-  natural_abund_map[731810000] = 99.98799;
-  natural_abund_map[741800000] = 0.12;
-  natural_abund_map[741820000] = 26.50;
-  natural_abund_map[741830000] = 14.31;
-  natural_abund_map[741840000] = 30.64;
-  natural_abund_map[741860000] = 28.43;
-  natural_abund_map[751850000] = 37.40;
-  natural_abund_map[751870000] = 62.60;
-  natural_abund_map[761840000] = 0.02;
-  natural_abund_map[761860000] = 1.59;
-  natural_abund_map[761870000] = 1.96;
-  natural_abund_map[761880000] = 13.24;
-  natural_abund_map[761890000] = 16.15;
-  natural_abund_map[761900000] = 26.26;
-  natural_abund_map[761920000] = 40.78;
-  natural_abund_map[771910000] = 37.3;
-  natural_abund_map[771930000] = 62.7;
-  natural_abund_map[781900000] = 0.012;
-  natural_abund_map[781920000] = 0.782;
-  natural_abund_map[781940000] = 32.86;
-  natural_abund_map[781950000] = 33.78;
-  natural_abund_map[781960000] = 25.21;
-  natural_abund_map[781980000] = 7.356;
-  natural_abund_map[791970000] = 100.0;
-  natural_abund_map[801960000] = 0.15;
-  natural_abund_map[801980000] = 9.97;
-  natural_abund_map[801990000] = 16.87;
-  natural_abund_map[802000000] = 23.10;
-  natural_abund_map[802010000] = 13.18;
-  natural_abund_map[802020000] = 29.86;
-  natural_abund_map[802040000] = 6.87;
-  natural_abund_map[812030000] = 29.52;
-  natural_abund_map[812050000] = 70.48;
-  natural_abund_map[822040000] = 1.4;
-  natural_abund_map[822060000] = 24.1;
-  natural_abund_map[822070000] = 22.1;
-  natural_abund_map[822080000] = 52.4;
-  natural_abund_map[832090000] = 100.0;
-  natural_abund_map[902320000] = 100.0;
-  natural_abund_map[912310000] = 100.0;
-  natural_abund_map[922340000] = 0.0054;
-  natural_abund_map[922350000] = 0.7204;
-  natural_abund_map[922380000] = 99.2742;
+void pyne::_load_atomic_mass_map_memory() {
+  // the tables are sorted, so every insert goes at the end
+  for (size_t i = 0; i < atomic_mass_table_size; ++i)
+    atomic_mass_map.insert(atomic_mass_map.end(), std::make_pair(
+      atomic_mass_table_nucs[i], atomic_mass_table_values[i]));
+  for (size_t i = 0; i < natural_abund_table_size; ++i)
+    natural_abund_map.insert(natural_abund_map.end(), std::make_pair(
+      natural_abund_table_nucs[i], natural_abund_table_values[i]));
 }
+
+constexpr int pyne::atomic_mass_table_nucs[3436] = {
+  10000000, 10010000, 10020000, 10030000, 10040000, 10050000, 10060000,
+  10070000, 20000000, 20030000, 20040000, 20050000, 20060000, 20070000,
+  20080000, 20090000, 20100000, 30000000, 30030000, 30040000, 30050000,
+  30060000, 30070000, 30080000, 30090000, 30100000, 30110000, 30120000,
+  30130000, 40000000, 40050000, 40060000, 40070000, 40080000, 40090000,
+  40100000, 40110000, 40120000, 40130000, 40140000, 40150000, 40160000,
+  50000000, 50060000, 50070000, 50080000, 50090000, 50100000, 50110000,
+  50120000, 50130000, 50140000, 50150000, 50160000, 50170000, 50180000,
+  50190000, 50200000, 50210000, 60000000, 60080000, 60090000, 60100000,
+  60110000, 60120000, 60130000, 60140000, 60150000, 60160000, 60170000,
+  60180000, 60190000, 60200000, 60210000, 60220000, 60230000, 70000000,
+  70100000, 70110000, 70120000, 70130000, 70140000, 70150000, 70160000,
+  70170000, 70180000, 70190000, 70200000, 70210000, 70220000, 70230000,
+  70240000, 70250000, 80000000, 80120000, 80130000, 80140000, 80150000,
+  80160000, 80170000, 80180000, 80190000, 80200000, 80210000, 80220000,
+  80230000, 80240000, 80250000, 80260000, 80270000, 80280000, 90000000,
+  90140000, 90150000, 90160000, 90170000, 90180000, 90190000, 90200000,
+  90210000, 90220000, 90230000, 90240000, 90250000, 90260000, 90270000,
+  90280000, 90290000, 90300000, 90310000, 100000000, 100160000, 100170000,
+  100180000, 100190000, 100200000, 100210000, 100220000, 100230000, 100240000,
+  100250000, 100260000, 100270000, 100280000, 100290000, 100300000, 100310000,
+  100320000, 100330000, 100340000, 110000000, 110180000, 110190000, 110200000,
+  110210000, 110220000, 110230000, 110240000, 110250000, 110260000, 110270000,
+  110280000, 110290000, 110300000, 110310000, 110320000, 110330000, 110340000,
+  110350000, 110360000, 110370000, 120000000, 120190000, 120200000, 120210000,
+  120220000, 120230000, 120240000, 120250000, 120260000, 120270000, 120280000,
+  120290000, 120300000, 120310000, 120320000, 120330000, 120340000, 120350000,
+  120360000, 120370000, 120380000, 120390000, 120400000, 130000000, 130210000,
+  130220000, 130230000, 130240000, 130250000, 130260000, 130270000, 130280000,
+  130290000, 130300000, 130310000, 130320000, 130330000, 130340000, 130350000,
+  130360000, 130370000, 130380000, 130390000, 130400000, 130410000, 130420000,
+  130430000, 140000000, 140220000, 140230000, 140240000, 140250000, 140260000,
+  140270000, 140280000, 140290000, 140300000, 140310000, 140320000, 140330000,
+  140340000, 140350000, 140360000, 140370000, 140380000, 140390000, 140400000,
+  140410000, 140420000, 140430000, 140440000, 140450000, 150000000, 150240000,
+  150250000, 150260000, 150270000, 150280000, 150290000, 150300000, 150310000,
+  150320000, 150330000, 150340000, 150350000, 150360000, 150370000, 150380000,
+  150390000, 150400000, 150410000, 150420000, 150430000, 150440000, 150450000,
+  150460000, 150470000, 160000000, 160260000, 160270000, 160280000, 160290000,
+  160300000, 160310000, 160320000, 160330000, 160340000, 160350000, 160360000,
+  160370000, 160380000, 160390000, 160400000, 160410000, 160420000, 160430000,
+  160440000, 160450000, 160460000, 160470000, 160480000, 160490000, 170000000,
+  170280000, 170290000, 170300000, 170310000, 170320000, 170330000, 170340000,
+  170350000, 170360000, 170370000, 170380000, 170390000, 170400000, 170410000,
+  170420000, 170430000, 170440000, 170450000, 170460000, 170470000, 170480000,
+  170490000, 170500000, 170510000, 180000000, 180300000, 180310000, 180320000,
+  180330000, 180340000, 180350000, 180360000, 180370000, 180380000, 180390000,
+  180400000, 180410000, 180420000, 180430000, 180440000, 180450000, 180460000,
+  180470000, 180480000, 180490000, 180500000, 180510000, 180520000, 180530000,
+  190000000, 190320000, 190330000, 190340000, 190350000, 190360000, 190370000,
+  190380000, 190390000, 190400000, 190410000, 190420000, 190430000, 190440000,
+  190450000, 190460000, 190470000, 190480000, 190490000, 190500000, 190510000,
+  190520000, 190530000, 190540000, 190550000, 190560000, 200000000, 200340000,
+  200350000, 200360000, 200370000, 200380000, 200390000, 200400000, 200410000,
+  200420000, 200430000, 200440000, 200450000, 200460000, 200470000, 200480000,
+  200490000, 200500000, 200510000, 200520000, 200530000, 200540000, 200550000,
+  200560000, 200570000, 200580000, 210000000, 210360000, 210370000, 210380000,
+  210390000, 210400000, 210410000, 210420000, 210430000, 210440000, 210450000,
+  210460000, 210470000, 210480000, 210490000, 210500000, 210510000, 210520000,
+  210530000, 210540000, 210550000, 210560000, 210570000, 210580000, 210590000,
+  210600000, 210610000, 220000000, 220380000, 220390000, 220400000, 220410000,
+  220420000, 220430000, 220440000, 220450000, 220460000, 220470000, 220480000,
+  220490000, 220500000, 220510000, 220520000, 220530000, 220540000, 220550000,
+  220560000, 220570000, 220580000, 220590000, 220600000, 220610000, 220620000,
+  220630000, 230000000, 230400000, 230410000, 230420000, 230430000, 230440000,
+  230450000, 230460000, 230470000, 230480000, 230490000, 230500000, 230510000,
+  230520000, 230530000, 230540000, 230550000, 230560000, 230570000, 230580000,
+  230590000, 230600000, 230610000, 230620000, 230630000, 230640000, 230650000,
+  230660000, 240000000, 240420000, 240430000, 240440000, 240450000, 240460000,
+  240470000, 240480000, 240490000, 240500000, 240510000, 240520000, 240530000,
+  240540000, 240550000, 240560000, 240570000, 240580000, 240590000, 240600000,
+  240610000, 240620000, 240630000, 240640000, 240650000, 240660000, 240670000,
+  240680000, 250000000, 250440000, 250450000, 250460000, 250470000, 250480000,
+  250490000, 250500000, 250510000, 250520000, 250530000, 250540000, 250550000,
+  250560000, 250570000, 250580000, 250590000, 250600000, 250610000, 250620000,
+  250630000, 250640000, 250650000, 250660000, 250670000, 250680000, 250690000,
+  250700000, 250710000, 260000000, 260450000, 260460000, 260470000, 260480000,
+  260490000, 260500000, 260510000, 260520000, 260530000, 260540000, 260550000,
+  260560000, 260570000, 260580000, 260590000, 260600000, 260610000, 260620000,
+  260630000, 260640000, 260650000, 260660000, 260670000, 260680000, 260690000,
+  260700000, 260710000, 260720000, 260730000, 260740000, 270000000, 270470000,
+  270480000, 270490000, 270500000, 270510000, 270520000, 270530000, 270540000,
+  270550000, 270560000, 270570000, 270580000, 270590000, 270600000, 270610000,
+  270620000, 270630000, 270640000, 270650000, 270660000, 270670000, 270680000,
+  270690000, 270700000, 270710000, 270720000, 270730000, 270740000, 270750000,
+  270760000, 280000000, 280480000, 280490000, 280500000, 280510000, 280520000,
+  280530000, 280540000, 280550000, 280560000, 280570000, 280580000, 280590000,
+  280600000, 280610000, 280620000, 280630000, 280640000, 280650000, 280660000,
+  280670000, 280680000, 280690000, 280700000, 280710000, 280720000, 280730000,
+  280740000, 280750000, 280760000, 280770000, 280780000, 280790000, 290000000,
+  290520000, 290530000, 290540000, 290550000, 290560000, 290570000, 290580000,
+  290590000, 290600000, 290610000, 290620000, 290630000, 290640000, 290650000,
+  290660000, 290670000, 290680000, 290690000, 290700000, 290710000, 290720000,
+  290730000, 290740000, 290750000, 290760000, 290770000, 290780000, 290790000,
+  290800000, 290810000, 290820000, 300000000, 300540000, 300550000, 300560000,
+  300570000, 300580000, 300590000, 300600000, 300610000, 300620000, 300630000,
+  300640000, 300650000, 300660000, 300670000, 300680000, 300690000, 300700000,
+  300710000, 300720000, 300730000, 300740000, 300750000, 300760000, 300770000,
+  300780000, 300790000, 300800000, 300810000, 300820000, 300830000, 300840000,
+  300850000, 310000000, 310560000, 310570000, 310580000, 310590000, 310600000,
+  310610000, 310620000, 310630000, 310640000, 310650000, 310660000, 310670000,
+  310680000, 310690000, 310700000, 310710000, 310720000, 310730000, 310740000,
+  310750000, 310760000, 310770000, 310780000, 310790000, 310800000, 310810000,
+  310820000, 310830000, 310840000, 310850000, 310860000, 310870000, 320000000,
+  320580000, 320590000, 320600000, 320610000, 320620000, 320630000, 320640000,
+  320650000, 320660000, 320670000, 320680000, 320690000, 320700000, 320710000,
+  320720000, 320730000, 320740000, 320750000, 320760000, 320770000, 320780000,
+  320790000, 320800000, 320810000, 320820000, 320830000, 320840000, 320850000,
+  320860000, 320870000, 320880000, 320890000, 320900000, 330000000, 330600000,
+  330610000, 330620000, 330630000, 330640000, 330650000, 330660000, 330670000,
+  330680000, 330690000, 330700000, 330710000, 330720000, 330730000, 330740000,
+  330750000, 330760000, 330770000, 330780000, 330790000, 330800000, 330810000,
+  330820000, 330830000, 330840000, 330850000, 330860000, 330870000, 330880000,
+  330890000, 330900000, 330910000, 330920000, 340000000, 340640000, 340650000,
+  340660000, 340670000, 340680000, 340690000, 340700000, 340710000, 340720000,
+  340730000, 340740000, 340750000, 340760000, 340770000, 340780000, 340790000,
+  340800000, 340810000, 340820000, 340830000, 340840000, 340850000, 340860000,
+  340870000, 340880000, 340890000, 340900000, 340910000, 340920000, 340930000,
+  340940000, 340950000, 350000000, 350670000, 350680000, 350690000, 350700000,
+  350710000, 350720000, 350730000, 350740000, 350750000, 350760000, 350770000,
+  350780000, 350790000, 350800000, 350810000, 350820000, 350830000, 350840000,
+  350850000, 350860000, 350870000, 350880000, 350890000, 350900000, 350910000,
+  350920000, 350930000, 350940000, 350950000, 350960000, 350970000, 350980000,
+  360000000, 360690000, 360700000, 360710000, 360720000, 360730000, 360740000,
+  360750000, 360760000, 360770000, 360780000, 360790000, 360800000, 360810000,
+  360820000, 360830000, 360840000, 360850000, 360860000, 360870000, 360880000,
+  360890000, 360900000, 360910000, 360920000, 360930000, 360940000, 360950000,
+  360960000, 360970000, 360980000, 360990000, 361000000, 361010000, 370000000,
+  370710000, 370720000, 370730000, 370740000, 370750000, 370760000, 370770000,
+  370780000, 370790000, 370800000, 370810000, 370820000, 370830000, 370840000,
+  370850000, 370860000, 370870000, 370880000, 370890000, 370900000, 370910000,
+  370920000, 370930000, 370940000, 370950000, 370960000, 370970000, 370980000,
+  370990000, 371000000, 371010000, 371020000, 371030000, 380000000, 380730000,
+  380740000, 380750000, 380760000, 380770000, 380780000, 380790000, 380800000,
+  380810000, 380820000, 380830000, 380840000, 380850000, 380860000, 380870000,
+  380880000, 380890000, 380900000, 380910000, 380920000, 380930000, 380940000,
+  380950000, 380960000, 380970000, 380980000, 380990000, 381000000, 381010000,
+  381020000, 381030000, 381040000, 381050000, 381060000, 381070000, 390000000,
+  390760000, 390770000, 390780000, 390790000, 390800000, 390810000, 390820000,
+  390830000, 390840000, 390850000, 390860000, 390870000, 390880000, 390890000,
+  390900000, 390910000, 390920000, 390930000, 390940000, 390950000, 390960000,
+  390970000, 390980000, 390990000, 391000000, 391010000, 391020000, 391030000,
+  391040000, 391050000, 391060000, 391070000, 391080000, 391090000, 400000000,
+  400780000, 400790000, 400800000, 400810000, 400820000, 400830000, 400840000,
+  400850000, 400860000, 400870000, 400880000, 400890000, 400900000, 400910000,
+  400920000, 400930000, 400940000, 400950000, 400960000, 400970000, 400980000,
+  400990000, 401000000, 401010000, 401020000, 401030000, 401040000, 401050000,
+  401060000, 401070000, 401080000, 401090000, 401100000, 401110000, 401120000,
+  410000000, 410810000, 410820000, 410830000, 410840000, 410850000, 410860000,
+  410870000, 410880000, 410890000, 410900000, 410910000, 410920000, 410930000,
+  410940000, 410950000, 410960000, 410970000, 410980000, 410990000, 411000000,
+  411010000, 411020000, 411030000, 411040000, 411050000, 411060000, 411070000,
+  411080000, 411090000, 411100000, 411110000, 411120000, 411130000, 411140000,
+  411150000, 420000000, 420830000, 420840000, 420850000, 420860000, 420870000,
+  420880000, 420890000, 420900000, 420910000, 420920000, 420930000, 420940000,
+  420950000, 420960000, 420970000, 420980000, 420990000, 421000000, 421010000,
+  421020000, 421030000, 421040000, 421050000, 421060000, 421070000, 421080000,
+  421090000, 421100000, 421110000, 421120000, 421130000, 421140000, 421150000,
+  421160000, 421170000, 430850000, 430860000, 430870000, 430880000, 430890000,
+  430900000, 430910000, 430920000, 430930000, 430940000, 430950000, 430960000,
+  430970000, 430980000, 430990000, 431000000, 431010000, 431020000, 431030000,
+  431040000, 431050000, 431060000, 431070000, 431080000, 431090000, 431100000,
+  431110000, 431120000, 431130000, 431140000, 431150000, 431160000, 431170000,
+  431180000, 431190000, 431200000, 440000000, 440870000, 440880000, 440890000,
+  440900000, 440910000, 440920000, 440930000, 440940000, 440950000, 440960000,
+  440970000, 440980000, 440990000, 441000000, 441010000, 441020000, 441030000,
+  441040000, 441050000, 441060000, 441070000, 441080000, 441090000, 441100000,
+  441110000, 441120000, 441130000, 441140000, 441150000, 441160000, 441170000,
+  441180000, 441190000, 441200000, 441210000, 441220000, 441230000, 441240000,
+  450000000, 450890000, 450900000, 450910000, 450920000, 450930000, 450940000,
+  450950000, 450960000, 450970000, 450980000, 450990000, 451000000, 451010000,
+  451020000, 451030000, 451040000, 451050000, 451060000, 451070000, 451080000,
+  451090000, 451100000, 451110000, 451120000, 451130000, 451140000, 451150000,
+  451160000, 451170000, 451180000, 451190000, 451200000, 451210000, 451220000,
+  451230000, 451240000, 451250000, 451260000, 460000000, 460910000, 460920000,
+  460930000, 460940000, 460950000, 460960000, 460970000, 460980000, 460990000,
+  461000000, 461010000, 461020000, 461030000, 461040000, 461050000, 461060000,
+  461070000, 461080000, 461090000, 461100000, 461110000, 461120000, 461130000,
+  461140000, 461150000, 461160000, 461170000, 461180000, 461190000, 461200000,
+  461210000, 461220000, 461230000, 461240000, 461250000, 461260000, 461270000,
+  461280000, 470000000, 470930000, 470940000, 470950000, 470960000, 470970000,
+  470980000, 470990000, 471000000, 471010000, 471020000, 471030000, 471040000,
+  471050000, 471060000, 471070000, 471080000, 471090000, 471100000, 471110000,
+  471120000, 471130000, 471140000, 471150000, 471160000, 471170000, 471180000,
+  471190000, 471200000, 471210000, 471220000, 471230000, 471240000, 471250000,
+  471260000, 471270000, 471280000, 471290000, 471300000, 480000000, 480950000,
+  480960000, 480970000, 480980000, 480990000, 481000000, 481010000, 481020000,
+  481030000, 481040000, 481050000, 481060000, 481070000, 481080000, 481090000,
+  481100000, 481110000, 481120000, 481130000, 481140000, 481150000, 481160000,
+  481170000, 481180000, 481190000, 481200000, 481210000, 481220000, 481230000,
+  481240000, 481250000, 481260000, 481270000, 481280000, 481290000, 481300000,
+  481310000, 481320000, 481330000, 490000000, 490970000, 490980000, 490990000,
+  491000000, 491010000, 491020000, 491030000, 491040000, 491050000, 491060000,
+  491070000, 491080000, 491090000, 491100000, 491110000, 491120000, 491130000,
+  491140000, 491150000, 491160000, 491170000, 491180000, 491190000, 491200000,
+  491210000, 491220000, 491230000, 491240000, 491250000, 491260000, 491270000,
+  491280000, 491290000, 491300000, 491310000, 491320000, 491330000, 491340000,
+  491350000, 500000000, 500990000, 501000000, 501010000, 501020000, 501030000,
+  501040000, 501050000, 501060000, 501070000, 501080000, 501090000, 501100000,
+  501110000, 501120000, 501130000, 501140000, 501150000, 501160000, 501170000,
+  501180000, 501190000, 501200000, 501210000, 501220000, 501230000, 501240000,
+  501250000, 501260000, 501270000, 501280000, 501290000, 501300000, 501310000,
+  501320000, 501330000, 501340000, 501350000, 501360000, 501370000, 501380000,
+  510000000, 511030000, 511040000, 511050000, 511060000, 511070000, 511080000,
+  511090000, 511100000, 511110000, 511120000, 511130000, 511140000, 511150000,
+  511160000, 511170000, 511180000, 511190000, 511200000, 511210000, 511220000,
+  511230000, 511240000, 511250000, 511260000, 511270000, 511280000, 511290000,
+  511300000, 511310000, 511320000, 511330000, 511340000, 511350000, 511360000,
+  511370000, 511380000, 511390000, 511400000, 520000000, 521050000, 521060000,
+  521070000, 521080000, 521090000, 521100000, 521110000, 521120000, 521130000,
+  521140000, 521150000, 521160000, 521170000, 521180000, 521190000, 521200000,
+  521210000, 521220000, 521230000, 521240000, 521250000, 521260000, 521270000,
+  521280000, 521290000, 521300000, 521310000, 521320000, 521330000, 521340000,
+  521350000, 521360000, 521370000, 521380000, 521390000, 521400000, 521410000,
+  521420000, 521430000, 530000000, 531070000, 531080000, 531090000, 531100000,
+  531110000, 531120000, 531130000, 531140000, 531150000, 531160000, 531170000,
+  531180000, 531190000, 531200000, 531210000, 531220000, 531230000, 531240000,
+  531250000, 531260000, 531270000, 531280000, 531290000, 531300000, 531310000,
+  531320000, 531330000, 531340000, 531350000, 531360000, 531370000, 531380000,
+  531390000, 531400000, 531410000, 531420000, 531430000, 531440000, 531450000,
+  540000000, 541090000, 541100000, 541110000, 541120000, 541130000, 541140000,
+  541150000, 541160000, 541170000, 541180000, 541190000, 541200000, 541210000,
+  541220000, 541230000, 541240000, 541250000, 541260000, 541270000, 541280000,
+  541290000, 541300000, 541310000, 541320000, 541330000, 541340000, 541350000,
+  541360000, 541370000, 541380000, 541390000, 541400000, 541410000, 541420000,
+  541430000, 541440000, 541450000, 541460000, 541470000, 541480000, 550000000,
+  551120000, 551130000, 551140000, 551150000, 551160000, 551170000, 551180000,
+  551190000, 551200000, 551210000, 551220000, 551230000, 551240000, 551250000,
+  551260000, 551270000, 551280000, 551290000, 551300000, 551310000, 551320000,
+  551330000, 551340000, 551350000, 551360000, 551370000, 551380000, 551390000,
+  551400000, 551410000, 551420000, 551430000, 551440000, 551450000, 551460000,
+  551470000, 551480000, 551490000, 551500000, 551510000, 560000000, 561140000,
+  561150000, 561160000, 561170000, 561180000, 561190000, 561200000, 561210000,
+  561220000, 561230000, 561240000, 561250000, 561260000, 561270000, 561280000,
+  561290000, 561300000, 561310000, 561320000, 561330000, 561340000, 561350000,
+  561360000, 561370000, 561380000, 561390000, 561400000, 561410000, 561420000,
+  561430000, 561440000, 561450000, 561460000, 561470000, 561480000, 561490000,
+  561500000, 561510000, 561520000, 561530000, 570000000, 571160000, 571170000,
+  571180000, 571190000, 571200000, 571210000, 571220000, 571230000, 571240000,
+  571250000, 571260000, 571270000, 571280000, 571290000, 571300000, 571310000,
+  571320000, 571330000, 571340000, 571350000, 571360000, 571370000, 571380000,
+  571390000, 571400000, 571410000, 571420000, 571430000, 571440000, 571450000,
+  571460000, 571470000, 571480000, 571490000, 571500000, 571510000, 571520000,
+  571530000, 571540000, 571550000, 580000000, 581190000, 581200000, 581210000,
+  581220000, 581230000, 581240000, 581250000, 581260000, 581270000, 581280000,
+  581290000, 581300000, 581310000, 581320000, 581330000, 581340000, 581350000,
+  581360000, 581370000, 581380000, 581390000, 581400000, 581410000, 581420000,
+  581430000, 581440000, 581450000, 581460000, 581470000, 581480000, 581490000,
+  581500000, 581510000, 581520000, 581530000, 581540000, 581550000, 581560000,
+  581570000, 590000000, 591210000, 591220000, 591230000, 591240000, 591250000,
+  591260000, 591270000, 591280000, 591290000, 591300000, 591310000, 591320000,
+  591330000, 591340000, 591350000, 591360000, 591370000, 591380000, 591390000,
+  591400000, 591410000, 591420000, 591430000, 591440000, 591450000, 591460000,
+  591470000, 591480000, 591490000, 591500000, 591510000, 591520000, 591530000,
+  591540000, 591550000, 591560000, 591570000, 591580000, 591590000, 600000000,
+  601240000, 601250000, 601260000, 601270000, 601280000, 601290000, 601300000,
+  601310000, 601320000, 601330000, 601340000, 601350000, 601360000, 601370000,
+  601380000, 601390000, 601400000, 601410000, 601420000, 601430000, 601440000,
+  601450000, 601460000, 601470000, 601480000, 601490000, 601500000, 601510000,
+  601520000, 601530000, 601540000, 601550000, 601560000, 601570000, 601580000,
+  601590000, 601600000, 601610000, 611260000, 611270000, 611280000, 611290000,
+  611300000, 611310000, 611320000, 611330000, 611340000, 611350000, 611360000,
+  611370000, 611380000, 611390000, 611400000, 611410000, 611420000, 611430000,
+  611440000, 611450000, 611460000, 611470000, 611480000, 611490000, 611500000,
+  611510000, 611520000, 611530000, 611540000, 611550000, 611560000, 611570000,
+  611580000, 611590000, 611600000, 611610000, 611620000, 611630000, 620000000,
+  621280000, 621290000, 621300000, 621310000, 621320000, 621330000, 621340000,
+  621350000, 621360000, 621370000, 621380000, 621390000, 621400000, 621410000,
+  621420000, 621430000, 621440000, 621450000, 621460000, 621470000, 621480000,
+  621490000, 621500000, 621510000, 621520000, 621530000, 621540000, 621550000,
+  621560000, 621570000, 621580000, 621590000, 621600000, 621610000, 621620000,
+  621630000, 621640000, 621650000, 630000000, 631300000, 631310000, 631320000,
+  631330000, 631340000, 631350000, 631360000, 631370000, 631380000, 631390000,
+  631400000, 631410000, 631420000, 631430000, 631440000, 631450000, 631460000,
+  631470000, 631480000, 631490000, 631500000, 631510000, 631520000, 631530000,
+  631540000, 631550000, 631560000, 631570000, 631580000, 631590000, 631600000,
+  631610000, 631620000, 631630000, 631640000, 631650000, 631660000, 631670000,
+  640000000, 641330000, 641340000, 641350000, 641360000, 641370000, 641380000,
+  641390000, 641400000, 641410000, 641420000, 641430000, 641440000, 641450000,
+  641460000, 641470000, 641480000, 641490000, 641500000, 641510000, 641520000,
+  641530000, 641540000, 641550000, 641560000, 641570000, 641580000, 641590000,
+  641600000, 641610000, 641620000, 641630000, 641640000, 641650000, 641660000,
+  641670000, 641680000, 641690000, 650000000, 651350000, 651360000, 651370000,
+  651380000, 651390000, 651400000, 651410000, 651420000, 651430000, 651440000,
+  651450000, 651460000, 651470000, 651480000, 651490000, 651500000, 651510000,
+  651520000, 651530000, 651540000, 651550000, 651560000, 651570000, 651580000,
+  651590000, 651600000, 651610000, 651620000, 651630000, 651640000, 651650000,
+  651660000, 651670000, 651680000, 651690000, 651700000, 651710000, 660000000,
+  661380000, 661390000, 661400000, 661410000, 661420000, 661430000, 661440000,
+  661450000, 661460000, 661470000, 661480000, 661490000, 661500000, 661510000,
+  661520000, 661530000, 661540000, 661550000, 661560000, 661570000, 661580000,
+  661590000, 661600000, 661610000, 661620000, 661630000, 661640000, 661650000,
+  661660000, 661670000, 661680000, 661690000, 661700000, 661710000, 661720000,
+  661730000, 670000000, 671400000, 671410000, 671420000, 671430000, 671440000,
+  671450000, 671460000, 671470000, 671480000, 671490000, 671500000, 671510000,
+  671520000, 671530000, 671540000, 671550000, 671560000, 671570000, 671580000,
+  671590000, 671600000, 671610000, 671620000, 671630000, 671640000, 671650000,
+  671660000, 671670000, 671680000, 671690000, 671700000, 671710000, 671720000,
+  671730000, 671740000, 671750000, 680000000, 681420000, 681430000, 681440000,
+  681450000, 681460000, 681470000, 681480000, 681490000, 681500000, 681510000,
+  681520000, 681530000, 681540000, 681550000, 681560000, 681570000, 681580000,
+  681590000, 681600000, 681610000, 681620000, 681630000, 681640000, 681650000,
+  681660000, 681670000, 681680000, 681690000, 681700000, 681710000, 681720000,
+  681730000, 681740000, 681750000, 681760000, 681770000, 690000000, 691440000,
+  691450000, 691460000, 691470000, 691480000, 691490000, 691500000, 691510000,
+  691520000, 691530000, 691540000, 691550000, 691560000, 691570000, 691580000,
+  691590000, 691600000, 691610000, 691620000, 691630000, 691640000, 691650000,
+  691660000, 691670000, 691680000, 691690000, 691700000, 691710000, 691720000,
+  691730000, 691740000, 691750000, 691760000, 691770000, 691780000, 691790000,
+  700000000, 701480000, 701490000, 701500000, 701510000, 701520000, 701530000,
+  701540000, 701550000, 701560000, 701570000, 701580000, 701590000, 701600000,
+  701610000, 701620000, 701630000, 701640000, 701650000, 701660000, 701670000,
+  701680000, 701690000, 701700000, 701710000, 701720000, 701730000, 701740000,
+  701750000, 701760000, 701770000, 701780000, 701790000, 701800000, 701810000,
+  710000000, 711500000, 711510000, 711520000, 711530000, 711540000, 711550000,
+  711560000, 711570000, 711580000, 711590000, 711600000, 711610000, 711620000,
+  711630000, 711640000, 711650000, 711660000, 711670000, 711680000, 711690000,
+  711700000, 711710000, 711720000, 711730000, 711740000, 711750000, 711760000,
+  711770000, 711780000, 711790000, 711800000, 711810000, 711820000, 711830000,
+  711840000, 711850000, 720000000, 721530000, 721540000, 721550000, 721560000,
+  721570000, 721580000, 721590000, 721600000, 721610000, 721620000, 721630000,
+  721640000, 721650000, 721660000, 721670000, 721680000, 721690000, 721700000,
+  721710000, 721720000, 721730000, 721740000, 721750000, 721760000, 721770000,
+  721780000, 721790000, 721800000, 721810000, 721820000, 721830000, 721840000,
+  721850000, 721860000, 721870000, 721880000, 721890000, 730000000, 731550000,
+  731560000, 731570000, 731580000, 731590000, 731600000, 731610000, 731620000,
+  731630000, 731640000, 731650000, 731660000, 731670000, 731680000, 731690000,
+  731700000, 731710000, 731720000, 731730000, 731740000, 731750000, 731760000,
+  731770000, 731780000, 731790000, 731800000, 731810000, 731820000, 731830000,
+  731840000, 731850000, 731860000, 731870000, 731880000, 731890000, 731900000,
+  731910000, 731920000, 740000000, 741570000, 741580000, 741590000, 741600000,
+  741610000, 741620000, 741630000, 741640000, 741650000, 741660000, 741670000,
+  741680000, 741690000, 741700000, 741710000, 741720000, 741730000, 741740000,
+  741750000, 741760000, 741770000, 741780000, 741790000, 741800000, 741810000,
+  741820000, 741830000, 741840000, 741850000, 741860000, 741870000, 741880000,
+  741890000, 741900000, 741910000, 741920000, 741930000, 741940000, 750000000,
+  751590000, 751600000, 751610000, 751620000, 751630000, 751640000, 751650000,
+  751660000, 751670000, 751680000, 751690000, 751700000, 751710000, 751720000,
+  751730000, 751740000, 751750000, 751760000, 751770000, 751780000, 751790000,
+  751800000, 751810000, 751820000, 751830000, 751840000, 751850000, 751860000,
+  751870000, 751880000, 751890000, 751900000, 751910000, 751920000, 751930000,
+  751940000, 751950000, 751960000, 751970000, 751980000, 760000000, 761610000,
+  761620000, 761630000, 761640000, 761650000, 761660000, 761670000, 761680000,
+  761690000, 761700000, 761710000, 761720000, 761730000, 761740000, 761750000,
+  761760000, 761770000, 761780000, 761790000, 761800000, 761810000, 761820000,
+  761830000, 761840000, 761850000, 761860000, 761870000, 761880000, 761890000,
+  761900000, 761910000, 761920000, 761930000, 761940000, 761950000, 761960000,
+  761970000, 761980000, 761990000, 762000000, 762010000, 762020000, 770000000,
+  771640000, 771650000, 771660000, 771670000, 771680000, 771690000, 771700000,
+  771710000, 771720000, 771730000, 771740000, 771750000, 771760000, 771770000,
+  771780000, 771790000, 771800000, 771810000, 771820000, 771830000, 771840000,
+  771850000, 771860000, 771870000, 771880000, 771890000, 771900000, 771910000,
+  771920000, 771930000, 771940000, 771950000, 771960000, 771970000, 771980000,
+  771990000, 772000000, 772010000, 772020000, 772030000, 772040000, 780000000,
+  781660000, 781670000, 781680000, 781690000, 781700000, 781710000, 781720000,
+  781730000, 781740000, 781750000, 781760000, 781770000, 781780000, 781790000,
+  781800000, 781810000, 781820000, 781830000, 781840000, 781850000, 781860000,
+  781870000, 781880000, 781890000, 781900000, 781910000, 781920000, 781930000,
+  781940000, 781950000, 781960000, 781970000, 781980000, 781990000, 782000000,
+  782010000, 782020000, 782030000, 782040000, 782050000, 782060000, 790000000,
+  791690000, 791700000, 791710000, 791720000, 791730000, 791740000, 791750000,
+  791760000, 791770000, 791780000, 791790000, 791800000, 791810000, 791820000,
+  791830000, 791840000, 791850000, 791860000, 791870000, 791880000, 791890000,
+  791900000, 791910000, 791920000, 791930000, 791940000, 791950000, 791960000,
+  791970000, 791980000, 791990000, 792000000, 792010000, 792020000, 792030000,
+  792040000, 792050000, 792060000, 792070000, 792080000, 792090000, 792100000,
+  800000000, 801710000, 801720000, 801730000, 801740000, 801750000, 801760000,
+  801770000, 801780000, 801790000, 801800000, 801810000, 801820000, 801830000,
+  801840000, 801850000, 801860000, 801870000, 801880000, 801890000, 801900000,
+  801910000, 801920000, 801930000, 801940000, 801950000, 801960000, 801970000,
+  801980000, 801990000, 802000000, 802010000, 802020000, 802030000, 802040000,
+  802050000, 802060000, 802070000, 802080000, 802090000, 802100000, 802110000,
+  802120000, 802130000, 802140000, 802150000, 802160000, 810000000, 811760000,
+  811770000, 811780000, 811790000, 811800000, 811810000, 811820000, 811830000,
+  811840000, 811850000, 811860000, 811870000, 811880000, 811890000, 811900000,
+  811910000, 811920000, 811930000, 811940000, 811950000, 811960000, 811970000,
+  811980000, 811990000, 812000000, 812010000, 812020000, 812030000, 812040000,
+  812050000, 812060000, 812070000, 812080000, 812090000, 812100000, 812110000,
+  812120000, 812130000, 812140000, 812150000, 812160000, 812170000, 812180000,
+  820000000, 821780000, 821790000, 821800000, 821810000, 821820000, 821830000,
+  821840000, 821850000, 821860000, 821870000, 821880000, 821890000, 821900000,
+  821910000, 821920000, 821930000, 821940000, 821950000, 821960000, 821970000,
+  821980000, 821990000, 822000000, 822010000, 822020000, 822030000, 822040000,
+  822050000, 822060000, 822070000, 822080000, 822090000, 822100000, 822110000,
+  822120000, 822130000, 822140000, 822150000, 822160000, 822170000, 822180000,
+  822190000, 822200000, 830000000, 831840000, 831850000, 831860000, 831870000,
+  831880000, 831890000, 831900000, 831910000, 831920000, 831930000, 831940000,
+  831950000, 831960000, 831970000, 831980000, 831990000, 832000000, 832010000,
+  832020000, 832030000, 832040000, 832050000, 832060000, 832070000, 832080000,
+  832090000, 832100000, 832110000, 832120000, 832130000, 832140000, 832150000,
+  832160000, 832170000, 832180000, 832190000, 832200000, 832210000, 832220000,
+  832230000, 832240000, 841860000, 841870000, 841880000, 841890000, 841900000,
+  841910000, 841920000, 841930000, 841940000, 841950000, 841960000, 841970000,
+  841980000, 841990000, 842000000, 842010000, 842020000, 842030000, 842040000,
+  842050000, 842060000, 842070000, 842080000, 842090000, 842100000, 842110000,
+  842120000, 842130000, 842140000, 842150000, 842160000, 842170000, 842180000,
+  842190000, 842200000, 842210000, 842220000, 842230000, 842240000, 842250000,
+  842260000, 842270000, 851910000, 851920000, 851930000, 851940000, 851950000,
+  851960000, 851970000, 851980000, 851990000, 852000000, 852010000, 852020000,
+  852030000, 852040000, 852050000, 852060000, 852070000, 852080000, 852090000,
+  852100000, 852110000, 852120000, 852130000, 852140000, 852150000, 852160000,
+  852170000, 852180000, 852190000, 852200000, 852210000, 852220000, 852230000,
+  852240000, 852250000, 852260000, 852270000, 852280000, 852290000, 861930000,
+  861940000, 861950000, 861960000, 861970000, 861980000, 861990000, 862000000,
+  862010000, 862020000, 862030000, 862040000, 862050000, 862060000, 862070000,
+  862080000, 862090000, 862100000, 862110000, 862120000, 862130000, 862140000,
+  862150000, 862160000, 862170000, 862180000, 862190000, 862200000, 862210000,
+  862220000, 862230000, 862240000, 862250000, 862260000, 862270000, 862280000,
+  862290000, 862300000, 862310000, 871990000, 872000000, 872010000, 872020000,
+  872030000, 872040000, 872050000, 872060000, 872070000, 872080000, 872090000,
+  872100000, 872110000, 872120000, 872130000, 872140000, 872150000, 872160000,
+  872170000, 872180000, 872190000, 872200000, 872210000, 872220000, 872230000,
+  872240000, 872250000, 872260000, 872270000, 872280000, 872290000, 872300000,
+  872310000, 872320000, 872330000, 882010000, 882020000, 882030000, 882040000,
+  882050000, 882060000, 882070000, 882080000, 882090000, 882100000, 882110000,
+  882120000, 882130000, 882140000, 882150000, 882160000, 882170000, 882180000,
+  882190000, 882200000, 882210000, 882220000, 882230000, 882240000, 882250000,
+  882260000, 882270000, 882280000, 882290000, 882300000, 882310000, 882320000,
+  882330000, 882340000, 882350000, 892060000, 892070000, 892080000, 892090000,
+  892100000, 892110000, 892120000, 892130000, 892140000, 892150000, 892160000,
+  892170000, 892180000, 892190000, 892200000, 892210000, 892220000, 892230000,
+  892240000, 892250000, 892260000, 892270000, 892280000, 892290000, 892300000,
+  892310000, 892320000, 892330000, 892340000, 892350000, 892360000, 892370000,
+  900000000, 902080000, 902090000, 902100000, 902110000, 902120000, 902130000,
+  902140000, 902150000, 902160000, 902170000, 902180000, 902190000, 902200000,
+  902210000, 902220000, 902230000, 902240000, 902250000, 902260000, 902270000,
+  902280000, 902290000, 902300000, 902310000, 902320000, 902330000, 902340000,
+  902350000, 902360000, 902370000, 902380000, 902390000, 910000000, 912120000,
+  912130000, 912140000, 912150000, 912160000, 912170000, 912180000, 912190000,
+  912200000, 912210000, 912220000, 912230000, 912240000, 912250000, 912260000,
+  912270000, 912280000, 912290000, 912300000, 912310000, 912320000, 912330000,
+  912340000, 912350000, 912360000, 912370000, 912380000, 912390000, 912400000,
+  912410000, 920000000, 922170000, 922180000, 922190000, 922200000, 922210000,
+  922220000, 922230000, 922240000, 922250000, 922260000, 922270000, 922280000,
+  922290000, 922300000, 922310000, 922320000, 922330000, 922340000, 922350000,
+  922360000, 922370000, 922380000, 922390000, 922400000, 922410000, 922420000,
+  922430000, 932190000, 932200000, 932210000, 932220000, 932230000, 932240000,
+  932250000, 932260000, 932270000, 932280000, 932290000, 932300000, 932310000,
+  932320000, 932330000, 932340000, 932350000, 932360000, 932370000, 932380000,
+  932390000, 932400000, 932410000, 932420000, 932430000, 932440000, 932450000,
+  942280000, 942290000, 942300000, 942310000, 942320000, 942330000, 942340000,
+  942350000, 942360000, 942370000, 942380000, 942390000, 942400000, 942410000,
+  942420000, 942430000, 942440000, 942450000, 942460000, 942470000, 952300000,
+  952310000, 952320000, 952330000, 952340000, 952350000, 952360000, 952370000,
+  952380000, 952390000, 952400000, 952410000, 952420000, 952430000, 952440000,
+  952450000, 952460000, 952470000, 952480000, 952490000, 962320000, 962330000,
+  962340000, 962350000, 962360000, 962370000, 962380000, 962390000, 962400000,
+  962410000, 962420000, 962430000, 962440000, 962450000, 962460000, 962470000,
+  962480000, 962490000, 962500000, 962510000, 962520000, 972340000, 972350000,
+  972360000, 972370000, 972380000, 972390000, 972400000, 972410000, 972420000,
+  972430000, 972440000, 972450000, 972460000, 972470000, 972480000, 972490000,
+  972500000, 972510000, 972520000, 972530000, 972540000, 982370000, 982380000,
+  982390000, 982400000, 982410000, 982420000, 982430000, 982440000, 982450000,
+  982460000, 982470000, 982480000, 982490000, 982500000, 982510000, 982520000,
+  982530000, 982540000, 982550000, 982560000, 992390000, 992400000, 992410000,
+  992420000, 992430000, 992440000, 992450000, 992460000, 992470000, 992480000,
+  992490000, 992500000, 992510000, 992520000, 992530000, 992540000, 992550000,
+  992560000, 992570000, 992580000, 1002410000, 1002420000, 1002430000,
+  1002440000, 1002450000, 1002460000, 1002470000, 1002480000, 1002490000,
+  1002500000, 1002510000, 1002520000, 1002530000, 1002540000, 1002550000,
+  1002560000, 1002570000, 1002580000, 1002590000, 1002600000, 1012450000,
+  1012460000, 1012470000, 1012480000, 1012490000, 1012500000, 1012510000,
+  1012520000, 1012530000, 1012540000, 1012550000, 1012560000, 1012570000,
+  1012580000, 1012590000, 1012600000, 1012610000, 1012620000, 1022480000,
+  1022490000, 1022500000, 1022510000, 1022520000, 1022530000, 1022540000,
+  1022550000, 1022560000, 1022570000, 1022580000, 1022590000, 1022600000,
+  1022610000, 1022620000, 1022630000, 1022640000, 1032510000, 1032520000,
+  1032530000, 1032540000, 1032550000, 1032560000, 1032570000, 1032580000,
+  1032590000, 1032600000, 1032610000, 1032620000, 1032630000, 1032640000,
+  1032650000, 1032660000, 1042530000, 1042540000, 1042550000, 1042560000,
+  1042570000, 1042580000, 1042590000, 1042600000, 1042610000, 1042620000,
+  1042630000, 1042640000, 1042650000, 1042660000, 1042670000, 1042680000,
+  1052550000, 1052560000, 1052570000, 1052580000, 1052590000, 1052600000,
+  1052610000, 1052620000, 1052630000, 1052640000, 1052650000, 1052660000,
+  1052670000, 1052680000, 1052690000, 1052700000, 1062580000, 1062590000,
+  1062600000, 1062610000, 1062620000, 1062630000, 1062640000, 1062650000,
+  1062660000, 1062670000, 1062680000, 1062690000, 1062700000, 1062710000,
+  1062720000, 1062730000, 1072600000, 1072610000, 1072620000, 1072630000,
+  1072640000, 1072650000, 1072660000, 1072670000, 1072680000, 1072690000,
+  1072700000, 1072710000, 1072720000, 1072730000, 1072740000, 1072750000,
+  1082630000, 1082640000, 1082650000, 1082660000, 1082670000, 1082680000,
+  1082690000, 1082700000, 1082710000, 1082720000, 1082730000, 1082740000,
+  1082750000, 1082760000, 1082770000, 1092650000, 1092660000, 1092670000,
+  1092680000, 1092690000, 1092700000, 1092710000, 1092720000, 1092730000,
+  1092740000, 1092750000, 1092760000, 1092770000, 1092780000, 1092790000,
+  1102670000, 1102680000, 1102690000, 1102700000, 1102710000, 1102720000,
+  1102730000, 1102740000, 1102750000, 1102760000, 1102770000, 1102780000,
+  1102790000, 1102800000, 1102810000, 1112720000, 1112730000, 1112740000,
+  1112750000, 1112760000, 1112770000, 1112780000, 1112790000, 1112800000,
+  1112810000, 1112820000, 1112830000, 1122760000, 1122770000, 1122780000,
+  1122790000, 1122800000, 1122810000, 1122820000, 1122830000, 1122840000,
+  1122850000, 1132780000, 1132790000, 1132800000, 1132810000, 1132820000,
+  1132830000, 1132840000, 1132850000, 1132860000, 1132870000, 1142850000,
+  1142860000, 1142870000, 1142880000, 1142890000, 1152870000, 1152880000,
+  1152890000, 1152900000, 1152910000, 1162890000, 1162900000, 1162910000,
+  1162920000, 1162930000, 1172910000, 1172920000, 1172930000, 1172940000,
+  1182930000, 1182940000, 1182950000,
+};
+
+constexpr double pyne::atomic_mass_table_values[3436] = {
+  1.0079407540557774, 1.00782503223, 2.01410177812, 3.01604927791, 4.026431864,
+  5.035311489, 6.044955433, 7.052749, 4.002601932120928, 3.01602932008,
+  4.00260325413, 5.012057224, 6.018885891, 7.027990654, 8.03393439,
+  9.043946494, 10.052788655, 6.9400366029079965, 3.030775, 4.027185559,
+  5.0125378, 6.01512288742, 7.01600343659, 8.022486246, 9.026790191,
+  10.035483453, 11.043723581, 12.052517322, 13.062631523, 9.012183065, 5.03987,
+  6.019726411, 7.016928717, 8.005305102, 9.012183065, 10.013534695,
+  11.021661081, 12.026922082, 13.036134506, 14.04289292, 15.05342,
+  16.061672036, 10.811028042205997, 6.0508, 7.029712, 8.024607326, 9.013329649,
+  10.012936949, 11.009305355, 12.014352658, 13.017780166, 14.025404012,
+  15.03108768, 16.039841663, 17.046989906, 18.055660189, 19.0631, 20.07207,
+  21.08129, 12.01073589673525, 8.037643042, 9.031037204, 10.016853307,
+  11.011433563, 12.0, 13.00335483507, 14.00324198843, 15.010599256,
+  16.014701252, 17.02257747, 18.026750708, 19.034796372, 20.040319754, 21.049,
+  22.057531496, 23.06889, 14.006703211445798, 10.04165363, 11.026091034,
+  12.018613187, 13.005738609, 14.00307400443, 15.00010889888, 16.006101925,
+  17.008448873, 18.014077565, 19.017021603, 20.023365807, 21.02710824,
+  22.034394934, 23.04114, 24.05039, 25.0601, 15.999404924318279, 12.034261836,
+  13.024815446, 14.008596359, 15.003065618, 15.99491461957, 16.9991317565,
+  17.99915961286, 19.00357797, 20.004075354, 21.008654813, 22.009966057,
+  23.015695922, 24.019861, 25.029358986, 26.03728745, 27.04772, 28.05591,
+  18.99840316273, 14.034315207, 15.018042853, 16.011465725, 17.002095237,
+  18.000937325, 18.99840316273, 19.999981252, 20.999948889, 22.002998813,
+  23.003556696, 24.008115485, 25.012199229, 26.020037768, 27.026441,
+  28.035342095, 29.04254, 30.05165, 31.059709, 20.180046380493117,
+  16.025750197, 17.017713963, 18.005708703, 19.001880907, 19.99244017617,
+  20.993846685, 21.991385114, 22.994466905, 23.99361065, 24.997788707,
+  26.000514705, 27.007553268, 28.012121998, 29.019753, 30.024734, 31.033087,
+  32.03972, 33.04938, 34.056728, 22.98976928196, 18.026878252, 19.013880272,
+  20.007354426, 20.997654695, 21.994437411, 22.98976928196, 23.99096295,
+  24.989953969, 25.992634649, 26.994076531, 27.998939, 29.002877073,
+  30.009097932, 31.013162656, 32.020193, 33.02573, 34.03359, 35.040623,
+  36.049288, 37.057051, 24.3050516198371, 19.034169186, 20.018850004,
+  21.01171614, 21.999570648, 22.994124208, 23.985041697, 24.985836976,
+  25.982592968, 26.984340624, 27.983876728, 28.988617393, 29.990462926,
+  30.996648032, 31.999110239, 33.005327145, 34.008935481, 35.01679, 36.021879,
+  37.03037, 38.03658, 39.045384, 40.05218, 26.981538530999998, 21.028975,
+  22.01954, 23.007244351, 23.999948883, 24.990428102, 25.986891904,
+  26.981538530999998, 27.98191021, 28.98045649, 29.98296022, 30.983945171,
+  31.988085239, 32.990908977, 33.996705398, 34.999764, 36.006388, 37.010531,
+  38.017402, 39.02254, 40.03003, 41.03638, 42.04384, 43.05147,
+  28.085498705705955, 22.03579, 23.02544, 24.011534538, 25.004108808,
+  25.992333845, 26.986704811, 27.97692653465, 28.9764946649, 29.973770136,
+  30.975363194, 31.974151539, 32.977976964, 33.978575569, 34.984583476,
+  35.986695219, 36.99292074, 37.995523, 39.002491, 40.005829, 41.013011,
+  42.01778, 43.0248, 44.03061, 45.03995, 30.97376199842, 24.03577, 25.02119,
+  26.01178, 26.999224406, 27.992326585, 28.981800794, 29.978313753,
+  30.97376199842, 31.973907643, 32.971725694, 33.973645886, 34.973314062,
+  35.978259625, 36.979606841, 37.984251583, 38.986227208, 39.991331748,
+  40.994654, 42.001084, 43.005024, 44.01121, 45.01645, 46.02446, 47.03139,
+  32.06478740613632, 26.02907, 27.01828, 28.004372766, 28.996611456,
+  29.984907033, 30.979557007, 31.97207117441, 32.97145890982, 33.967867004,
+  34.96903231, 35.967080706, 36.971125514, 37.971163328, 38.975134197,
+  39.975482562, 40.979593451, 41.9810651, 42.986907635, 43.990118848,
+  44.995717, 46.00004, 47.00795, 48.0137, 49.022762, 35.452937582608, 28.02954,
+  29.01478, 30.00477, 30.992414203, 31.985684637, 32.977451989, 33.973762485,
+  34.968852682, 35.968306809, 36.965902602, 37.968010436, 38.968008176,
+  39.970415469, 40.970684525, 41.973254804, 42.973888584, 43.977874543,
+  44.98029, 45.985174, 46.98916, 47.99564, 49.00123, 50.00905, 51.01554,
+  39.947798563599406, 30.02307, 31.012124, 31.997637826, 32.989925546,
+  33.98027009, 34.975257586, 35.967545105, 36.966776331, 37.962732106,
+  38.964313038, 39.96238312372, 40.96450057, 41.963045736, 42.965636055,
+  43.964923815, 44.968039733, 45.968082712, 46.972934865, 47.97591, 48.9819,
+  49.98613, 50.9937, 51.99896, 53.00729, 39.098300910115334, 32.02265,
+  33.00756, 33.99869, 34.988005407, 35.98130201, 36.973375889, 37.969081117,
+  38.96370648643, 39.963998166, 40.96182525792, 41.962402306, 42.960734702,
+  43.961586985, 44.960691493, 45.961981586, 46.961661614, 47.965341186,
+  48.968210755, 49.972380017, 50.975828036, 51.98224, 52.98746, 53.99463,
+  55.00076, 56.00851, 40.07802251104616, 34.01487, 35.00514, 35.993074404,
+  36.985897852, 37.976319224, 38.970710813, 39.962590863, 40.962277924,
+  41.95861783, 42.958766438, 43.955481561, 44.95618635, 45.953689023,
+  46.954542430000004, 47.952522765, 48.955662736, 49.957499217, 50.960988981,
+  51.963217145, 52.96945, 53.9734, 54.9803, 55.985079999999996, 56.99262,
+  57.99794, 44.955908275, 36.01648, 37.00374, 37.99512, 38.984784968,
+  39.977967291, 40.969251105, 41.965516532, 42.961150474, 43.959402875,
+  44.955908275, 45.955168257, 46.95240374, 47.952223611, 48.950014629,
+  49.952176274, 50.953591956, 51.956879479, 52.95909, 53.96393, 54.967818892,
+  55.97345, 56.97777, 57.98403, 58.98894, 59.99565, 61.001, 47.86674496132841,
+  38.01145, 39.00236, 39.990498719, 40.983148, 41.973049034, 42.96852252,
+  43.959689949, 44.958121983, 45.952627718, 46.951758787, 47.947941979,
+  48.947865676, 49.944786889, 50.946610651, 51.946893006, 52.949725933,
+  53.951049547, 54.955268064, 55.957911353, 56.963641626, 57.9666, 58.97247,
+  59.97603, 60.98245, 61.98651, 62.99375, 50.941465033445, 40.01276, 41.00021,
+  41.99182, 42.980766, 43.97411, 44.96577482, 45.960198775, 46.954904914,
+  47.952252223, 48.948511795, 49.947156014, 50.943957036, 51.944773007,
+  52.944336741, 53.946438617, 54.94724215, 55.95048481, 56.952518869,
+  57.956715235, 58.959385659, 59.96431329, 60.96725, 61.97265, 62.97639,
+  63.98264, 64.9875, 65.99398, 51.99613175606961, 42.0067, 42.99753, 43.98536,
+  44.97905, 45.968358861, 46.962897359, 47.954029061, 48.951333349,
+  49.946041833, 50.944765018, 51.940506231, 52.940648147, 53.938879158,
+  54.940838434, 55.940653139, 56.943613013, 57.944353129, 58.948586367,
+  59.950076033, 60.954422585, 61.956097451, 62.961650731, 63.96408, 64.96996,
+  65.97366, 66.98016, 67.98403, 54.93804391, 44.00715, 44.99449, 45.98609,
+  46.975775, 47.96852, 48.959595297, 49.954237781, 50.948208475, 51.945563949,
+  52.941288891, 53.940357614999996, 54.93804391, 55.938903691, 56.938286096,
+  57.940066645, 58.940391113, 59.943136576, 60.944452544, 61.947954,
+  62.949664675, 63.95384937, 64.95601975, 65.960546834, 66.96424, 67.96962,
+  68.97366, 69.97937, 70.98368, 55.84514442998595, 45.014419, 46.00063,
+  46.99185, 47.98023, 48.973429, 49.962974929, 50.956841021, 51.948113146,
+  52.945306428, 53.939608986, 54.938291994, 55.934936326, 56.935392841,
+  57.933274431, 58.934874338, 59.9340711, 60.936746244, 61.936791812,
+  62.9402727, 63.940987763, 64.945011462, 65.94624996, 66.950543395,
+  67.95295155, 68.95807, 69.96102, 70.96672, 71.96983, 72.97572, 73.97935,
+  58.933194288, 47.01057, 48.00093, 48.98891, 49.98091, 50.970647, 51.96351,
+  52.954204077, 53.948459872, 54.941997202, 55.939838798, 56.936290574,
+  57.935752073, 58.933194288, 59.933816299, 60.93247662, 61.934058809,
+  62.933600217, 63.935810764, 64.936462072, 65.939442945, 66.940609627,
+  67.944257589, 68.946141268, 69.94963, 70.952366923, 71.95729, 72.96039,
+  73.96515, 74.96876, 75.97413, 58.693347113763124, 48.017688, 49.0077,
+  49.99474, 50.98611, 51.9748, 52.96819, 53.957892463, 54.951330632,
+  55.942128549, 56.939792184, 57.935342414, 58.934346202, 59.930785885,
+  60.93105557, 61.928345365, 62.929669626, 63.927966816, 64.930085173,
+  65.929139334, 66.931569414, 67.931868789, 68.935610269, 69.936431302,
+  70.940518964, 71.941785926, 72.946206683, 73.94798, 74.9525, 75.95533,
+  76.96055, 77.96336, 78.970252, 63.5460399491385, 51.99671, 52.98459,
+  53.97666, 54.966038, 55.95895, 56.949212498, 57.944533046, 58.939497482,
+  59.937364544, 60.933457612, 61.932595415, 62.929597723, 63.929764342,
+  64.927789704, 65.928869032, 66.927730314, 67.929610889, 68.929429269,
+  69.932392079, 70.932676833, 71.935820307, 72.936674378, 73.939874862,
+  74.941522606, 75.945275026, 76.94792, 77.95223, 78.95502, 79.96089,
+  80.965872, 81.972442, 65.377782531348, 53.992039, 54.98398, 55.97254,
+  56.96506, 57.954591062, 58.949312657, 59.941842103, 60.939507188,
+  61.934333971, 62.933211474, 63.929142013, 64.92924077, 65.926033809,
+  66.927127746, 67.924844554, 68.926550682, 69.925319208, 70.927719582,
+  71.926842807, 72.929582582, 73.929407262, 74.932840246, 75.933114957,
+  76.936887199, 77.938289206, 78.942638069, 79.944552931, 80.950402619,
+  81.95426, 82.96056, 83.965206, 84.97226, 69.72306609604112, 55.99536,
+  56.9832, 57.97478, 58.96353, 59.95729, 60.949398984, 61.944190251,
+  62.939294196, 63.93684044, 64.932734588, 65.931589401, 66.928202547,
+  67.927980485, 68.925573541, 69.926021927, 70.924702577, 71.926367474,
+  72.925174682, 73.926945727, 74.926500246, 75.928827626, 76.9291543,
+  77.931608845, 78.932852301, 79.936420775, 80.938133843, 81.943176533,
+  82.947120301, 83.95246, 84.95699, 85.96301, 86.968245, 72.62755016468678,
+  57.99172, 58.98249, 59.97036, 60.96379, 61.95502, 62.949628, 63.941689913,
+  64.939368137, 65.933862126, 66.932733861, 67.928095307, 68.927964481,
+  69.92424875, 70.924952327, 71.922075826, 72.923458956, 73.921177761,
+  74.92285837, 75.921402726, 76.923549843, 77.922852908, 78.925360127,
+  79.925350775, 80.928832943, 81.929774033, 82.934539101, 83.937575092,
+  84.94296966, 85.94658, 86.95268, 87.95691, 88.96379, 89.96863, 74.921594567,
+  59.99388, 60.98112, 61.97361, 62.9639, 63.957432, 64.949611, 65.944148779,
+  66.939251112, 67.93677413, 68.932246302, 69.930926195, 70.927113801,
+  71.926752294, 72.923829086, 73.923928598, 74.921594567, 75.922392015,
+  76.920647563, 77.921827773, 78.920948423, 79.922474584, 80.92213228,
+  81.924741233, 82.925206901, 83.929303292, 84.93216366, 85.936701533,
+  86.940291718, 87.94555, 88.94976, 89.95563, 90.96039, 91.96674,
+  78.9593885378999, 63.97109, 64.9644, 65.95559, 66.949994, 67.941825238,
+  68.939414847, 69.933515523, 70.932209433, 71.927140507, 72.926754882,
+  73.922475934, 74.92252287, 75.919213704, 76.919914154, 77.91730928,
+  78.918499287, 79.916521762, 80.917993023, 81.916699497, 82.919118569,
+  83.918466763, 84.92226076, 85.924311733, 86.928688618, 87.931417492,
+  88.93666906, 89.940096, 90.94596, 91.94984, 92.95629, 93.96049, 94.9673,
+  79.9035277649341, 66.96465, 67.958732, 68.950497297, 69.944792323,
+  70.939342155, 71.936588619, 72.931671503, 73.929910177, 74.925810452,
+  75.924541576, 76.921379198, 77.921145895, 78.918337579, 79.918529788,
+  80.91628969, 81.916803246, 82.91517562, 83.916496419, 84.91564576,
+  85.918805433, 86.920674018, 87.924083292, 88.92670456, 89.93129285,
+  90.934398619, 91.939631597, 92.943134, 93.9489, 94.95301, 95.95903, 96.96344,
+  97.96946, 83.79799999587411, 68.96518, 69.95604, 70.950265696, 71.942092407,
+  72.939289195, 73.93308402, 74.930945746, 75.925910271, 76.92467,
+  77.920364944, 78.920082923, 79.916378084, 80.916591181, 81.91348273,
+  82.914127164, 83.91149772816, 84.912527262, 85.91061062693, 86.91335476,
+  87.914447881, 88.917835451, 89.919527931, 90.923806311, 91.926173094,
+  92.931147174, 93.934140454, 94.939710924, 95.943016618, 96.949088785,
+  97.95243, 98.95839, 99.96236999999999, 100.96873, 85.46766359561973,
+  70.96532, 71.95908, 72.950529, 73.944265894, 74.938573201, 75.935073032,
+  76.9304016, 77.928141868, 78.923989864, 79.922516444, 80.918993936,
+  81.918209024, 82.915114183, 83.914375229, 84.9117897379, 85.911167425,
+  86.909180531, 87.911315592, 88.912278298, 89.914798453, 90.916537169,
+  91.919728389, 92.922039269, 93.926394814, 94.929260004, 95.93413338,
+  96.937177136, 97.941686868, 98.945028735, 99.95003, 100.954039, 101.95952,
+  102.96392, 87.61664450746399, 72.9657, 73.95617, 74.94995277, 75.941762761,
+  76.937945455, 77.93217998, 78.929707664, 79.924517516, 80.923211395,
+  81.918399855, 82.917554374, 83.913419136, 84.912932046, 85.909260608,
+  86.908877531, 87.905612542, 88.907451095, 89.907730037, 90.910195442,
+  91.91103819, 92.914024228, 93.915355602, 94.919352941, 95.921706575,
+  96.92637396, 97.928688778, 98.932890666, 99.935769692, 100.940351743,
+  101.943790979, 102.94909, 103.95265, 104.95855, 105.962651, 106.968975,
+  88.905840348, 75.95856, 76.949781, 77.94361, 78.937351299, 79.934356096,
+  80.929455556, 81.926931401, 82.92248525, 83.920672086, 84.916433039,
+  85.91488598, 86.910876138, 87.909501563, 88.905840348, 89.907143942,
+  90.907297442, 91.908945142, 92.909577886, 93.911590582, 94.912816058,
+  95.915896835, 96.918274106, 97.922382119, 98.924147979, 99.927714692,
+  100.930147705, 101.934327687, 102.937243004, 103.94196, 104.94544, 105.95056,
+  106.95452, 107.95996, 108.964358, 91.2236415760098, 77.95566, 78.94948,
+  79.9404, 80.937308892, 81.931354, 82.92924215, 83.923326899, 84.921444448,
+  85.916297204, 86.914817988, 87.91022129, 88.908881441, 89.90469765899999,
+  90.905639587, 91.905034675, 92.906469947, 93.906310828, 94.90803853,
+  95.908271433, 96.910951206, 97.912728892, 98.916666746, 99.918000576,
+  100.921447964, 101.92314093, 102.927190678, 103.929435691, 104.934008204,
+  105.93676, 106.94174, 107.94487, 108.95041, 109.95396, 110.959678,
+  111.963703, 92.906373004, 80.9496, 81.94396, 82.937293731, 83.934492,
+  84.928845837, 85.925782798, 86.920693747, 87.91822171, 88.913445073,
+  89.911258449, 90.906989658, 91.907188081, 92.906373004, 93.907278836,
+  94.906832404, 95.908097286, 96.908095932, 97.910326459, 98.911613177,
+  99.914327592, 100.915310254, 101.918077197, 102.919457238, 103.922892491,
+  104.924946471, 105.928931712, 106.931593654, 107.936074773, 108.939216,
+  109.94403, 110.94753, 111.95247, 112.95651, 113.96201, 114.96634,
+  95.9597885378905, 82.94988, 83.94149, 84.938260737, 85.931174817,
+  86.928196201, 87.921967781, 88.919468151, 89.913930861, 90.911745312,
+  91.906807959, 92.906809577, 93.905084903, 94.905838766, 95.904676115,
+  96.906018118, 97.90540482, 98.907708509, 99.907471782, 100.910341447,
+  101.910283414, 102.913078578, 103.913734373, 104.916968617, 105.918259464,
+  106.922105877, 107.92403349, 108.92842416, 109.930703673, 110.935654257,
+  111.93831, 112.94335, 113.94653, 114.95196, 115.955448, 116.96117, 84.95058,
+  85.94493, 86.938067187, 87.933782381, 88.927648651, 89.924073921,
+  90.918425397, 91.915269779, 92.910245952, 93.909653637, 94.907653612,
+  95.907868022, 96.906366706, 97.907212365, 98.906250844, 99.907653877,
+  100.907309057, 101.909209733, 102.909176131, 103.911424888, 104.911654883,
+  105.914357598, 106.915460645, 107.918495722, 108.920256356, 109.923743534,
+  110.925901257, 111.929945813, 112.932569035, 113.93691, 114.93998, 115.94476,
+  116.94806, 117.95299, 118.95666, 119.96187, 101.0649401222627, 86.95069,
+  87.9416, 88.93762, 89.93034438, 90.926741859, 91.920234375, 92.917104444,
+  93.911342863, 94.910405759, 95.907590255, 96.90754712, 97.905286813,
+  98.905934082, 99.904214256, 100.905576872, 101.904344096, 102.906318627,
+  103.905427481, 104.907747645, 105.907329104, 106.909972045, 107.910188022,
+  108.913325956, 109.914040696, 110.917569857, 111.918809234, 112.922843999,
+  113.924613554, 114.928819898, 115.931219195, 116.936103, 117.93853,
+  118.94357, 119.94631, 120.95164, 121.95447, 122.95989, 123.96305,
+  102.90549799299998, 88.950584, 89.94422, 90.93688, 91.932367694,
+  92.925912781, 93.921730453, 94.915897895, 95.914453051, 96.911329216,
+  97.910707839, 98.908128239, 99.908117264, 100.906160613, 101.906837373,
+  102.905497993, 103.90664922, 104.905688549, 105.907286801, 106.906747811,
+  107.908714473, 108.908748821, 109.911079429, 110.91164231, 111.914403222,
+  112.915439342, 113.918718294, 114.920311589, 115.924058528, 116.926035391,
+  117.930340208, 118.932556954, 119.93686, 120.93942, 121.94399, 122.94685,
+  123.95151, 124.95469, 125.95946, 106.41532753504181, 90.95032,
+  91.94087999999999, 92.936511, 93.929037603, 94.924889838, 95.918215084,
+  96.916471988, 97.912698337, 98.911774806, 99.908504805, 100.908286412,
+  101.905602187, 102.906080949, 103.90403054, 104.905079626, 105.903480426,
+  106.905128195, 107.90389164, 108.905950406, 109.905172199, 110.907689679,
+  111.907329698, 112.910261042, 113.910368554, 114.913658506, 115.914296979,
+  116.917954721, 117.9190667, 118.923340223, 119.924551089, 120.928950345,
+  121.930631696, 122.93514, 123.93714, 124.94179, 125.94416, 126.94907,
+  127.95183, 107.8681496315903, 92.95033, 93.943734, 94.93602, 95.930743906,
+  96.923965326, 97.921559973, 98.917645768, 99.916115445, 100.912683953,
+  101.911704708, 102.908963138, 103.908623864, 104.906525615, 105.906663637,
+  106.905091611, 107.905950346, 108.904755282, 109.906110226, 110.905295923,
+  111.90704855, 112.906572893, 113.908823031, 114.908767355, 115.911386812,
+  116.911773934, 117.914595487, 118.915570287, 119.918784768, 120.920125282,
+  121.923664449, 122.925337063, 123.928931229, 124.931046, 125.93475,
+  126.93711, 127.94106, 128.94395, 129.950703, 112.4115578173154, 94.94994,
+  95.94034, 96.9351, 97.927389318, 98.924925848, 99.92034882, 100.918586211,
+  101.914481967, 102.913416517, 103.909856386, 104.909463896, 105.906459928,
+  106.906612122, 107.90418344, 108.904986653, 109.903006606, 110.904182872,
+  111.902762868, 112.904408133, 113.903365086, 114.905437513, 115.904763148,
+  116.907225956, 117.906921869, 118.909846851, 119.909868068, 120.912963663,
+  121.913459053, 122.916892453, 123.917657364, 124.921257577, 125.922429128,
+  126.926472404, 127.927812858, 128.93182, 129.933940679, 130.9406, 131.94604,
+  132.95285, 114.81808662940269, 96.94934, 97.94214, 98.93411,
+  99.93095718000001, 100.92634, 101.924107138, 102.919881915, 103.918214541,
+  104.914502325, 105.913463735, 106.910290084, 107.909693524, 108.907151381,
+  109.90716981, 110.905108458, 111.905537694, 112.904061839, 113.904917909,
+  114.903878776, 115.905259995, 116.904515678, 117.906356616, 118.905850708,
+  119.907966567, 120.907851062, 121.910280738, 122.910433718, 123.913182245,
+  124.913604553, 125.916507322, 126.917446276, 127.920401044, 128.921805301,
+  129.924976585, 130.926971529, 131.933001273, 132.93831, 133.94454, 134.95005,
+  118.71011259665609, 98.94853, 99.938504196, 100.935259244, 101.930290753,
+  102.928105264, 103.923105204, 104.921268429, 105.916957404, 106.915713652,
+  107.911894287, 108.91129206, 109.907844835, 110.907740127, 111.904823874,
+  112.905175728, 113.902782695, 114.903344699, 115.901742797, 116.902953983,
+  117.901606574, 118.903311172, 119.902201634, 120.904242554, 121.903443774,
+  122.905725221, 123.905276645, 124.907786395, 125.907658786, 126.910389943,
+  127.910507184, 128.913464711, 129.91397383, 130.917044954, 131.917826725,
+  132.923913404, 133.928682064, 134.934908606, 135.93999, 136.94655, 137.95184,
+  121.7597836563123, 102.93969, 103.936477804, 104.931275897, 105.928637982,
+  106.924150641, 107.922226735, 108.918141122, 109.916854287, 110.913218189,
+  111.912399903, 112.909374536, 113.909290189, 114.906598, 115.906793115,
+  116.904841508, 117.905532139, 118.903945471, 119.905079385, 120.903811967,
+  121.905169948, 122.904213204, 123.905934978, 124.905253007, 125.907252987,
+  126.906924278, 127.909145628, 128.909146665, 129.911662054, 130.911988799,
+  131.914507691, 132.915273198, 133.920535676, 134.925185106, 135.930745879,
+  136.935555, 137.94145, 138.94655, 139.95283, 127.603126480985, 104.943304508,
+  105.937499664, 106.935011573, 107.929380467, 108.927304534, 109.922458091,
+  110.921000589, 111.91672785, 112.915891, 113.912089, 114.911902, 115.90846,
+  116.908646298, 117.905853629, 118.906407108, 119.9040593, 120.904943812,
+  121.903043455, 122.904269769, 123.902817085, 124.90442992, 125.903310886,
+  126.905225735, 127.904461279, 128.90659646, 129.906222748, 130.908522213,
+  131.908546716, 132.910968766, 133.911393959, 134.916555706, 135.920100608,
+  136.925598852, 137.929472226, 138.935367194, 139.939498567, 140.9458,
+  141.95022, 142.95676, 126.90447185299999, 106.94678, 107.943481623,
+  108.938085287, 109.935089034, 110.930269214, 111.92800455, 112.923650064,
+  113.92185, 114.918048, 115.916808658, 116.913648312, 117.913074, 118.910074,
+  119.910087251, 120.90740505, 121.907588841, 122.905588537, 123.906209041,
+  124.904629353, 125.905623329, 126.904471853, 127.905808615, 128.904983669,
+  129.906670193, 130.906126305, 131.907993514, 132.907796968, 133.909758836,
+  134.910048847, 135.914604412, 136.918028188, 137.922726402, 138.926506206,
+  139.931727, 140.93569, 141.941202, 142.94565, 143.95139, 144.95605,
+  131.29276144790845, 108.950434864, 109.944263102, 110.941607206,
+  111.935558982, 112.93322165, 113.927980331, 114.926293945, 115.921581112,
+  116.920358761, 117.91617868, 118.915410714, 119.91178427, 120.911453015,
+  121.908367658, 122.908481757, 123.905891984, 124.906394445, 125.904298292,
+  126.905182914, 127.903531018, 128.90478086113, 129.903509349, 130.905084057,
+  131.90415508563, 132.905910751, 133.905394664, 134.90722778, 135.907214484,
+  136.911557781, 137.914146273, 138.918792203, 139.921645817, 140.926787184,
+  141.929973098, 142.935369554, 143.938945079, 144.944719634, 145.948518249,
+  146.95426, 147.95813, 132.905451961, 111.950308558, 112.944429144,
+  113.941296176, 114.93591, 115.933373, 116.928616726, 117.926559519,
+  118.92237733, 119.920677279, 120.917227238, 121.916108146, 122.912996063,
+  123.912257798, 124.909727985, 125.909446057, 126.907417384, 127.907748666,
+  128.906065683, 129.906709283, 130.905464899, 131.906433914, 132.905451961,
+  133.906718503, 134.905977049, 135.907311358, 136.907089231, 137.911017089,
+  138.913363758, 139.917283063, 140.920045491, 141.924295991, 142.927349327,
+  143.932076313, 144.935527435, 145.940344271, 146.944156156, 147.949225137,
+  148.95302, 149.95833, 150.96258, 137.32689162463817, 113.950660438,
+  114.94737, 115.94128, 116.93814057, 117.93306, 118.930659686, 119.926045,
+  120.92405229, 121.919904, 122.918781063, 123.915093629, 124.914471843,
+  125.911250204, 126.911091275, 127.908341967, 128.908680798, 129.906320669,
+  130.906940977, 131.905061128, 132.906007351, 133.904508182, 134.905688375,
+  135.904575727, 136.905827141, 137.905246995, 138.908841099, 139.91060573,
+  140.914403333, 141.916432382, 142.920625293, 143.922954866, 144.9275184,
+  145.930283712, 146.9353039, 147.938170578, 148.94308, 149.94605, 150.95127,
+  151.95481, 152.96036, 138.90546882976864, 115.956304, 116.949985, 117.94673,
+  118.94099, 119.93807, 120.93315, 121.93071, 122.9263, 123.924574275,
+  124.920815932, 125.919512667, 126.916375084, 127.915592123, 128.912694431,
+  129.912369413, 130.91007, 131.910118979, 132.908218, 133.908514011,
+  134.906984363, 135.907634962, 136.906450385, 137.907114919, 138.906356256,
+  139.909480635, 140.91096603, 141.91409089, 142.916079512, 143.919645589,
+  144.921808068, 145.925875174, 146.9284178, 147.9326794, 148.93535126,
+  149.93947, 150.94232, 151.94682, 152.95036, 153.95517, 154.95901,
+  140.11573074148163, 118.95271, 119.94654, 120.94335, 121.93787, 122.93528,
+  123.93031, 124.92844, 125.923971, 126.922727, 127.918911, 128.918102,
+  129.914736, 130.914429465, 131.911463775, 132.911520402, 133.908928142,
+  134.909160599, 135.907129205, 136.907762364, 137.905991089, 138.906655111,
+  139.905443107, 140.908280674, 141.909250375, 142.91239212, 143.913652939,
+  144.917265228, 145.918802412, 146.922689913, 147.924424225, 148.9284269,
+  149.93038404200001, 150.9342722, 151.9366, 152.94093, 153.9438, 154.94855,
+  155.95183, 156.95705, 140.907657568, 120.95532, 121.95175, 122.94596,
+  123.94294, 124.9377, 125.93524, 126.93071, 127.928791, 128.925095, 129.92359,
+  130.92023496, 131.919255, 132.916330561, 133.915696729, 134.913111775,
+  135.912677456, 136.91067915, 137.910754405, 138.908940762, 139.909080275,
+  140.907657568, 141.910049607, 142.910822796, 143.913310859, 144.914518156,
+  145.91767985, 146.919007518, 147.922130083, 148.9237361, 149.926676502,
+  150.928309285, 151.9315529, 152.933903539, 153.937525741, 154.940509281,
+  155.94464, 156.94789, 157.95241, 158.95589, 144.24159603226894, 123.9522,
+  124.9489, 125.94311, 126.94038, 127.93525, 128.933102, 129.928506,
+  130.92724802, 131.923321237, 132.922348, 133.91879021, 134.918181321,
+  135.914976064, 136.914562448, 137.911949718, 138.911953649, 139.909549849,
+  140.909614653, 141.907728996, 142.909819989, 143.910092974, 144.912579322,
+  145.913122628, 146.916106136, 147.916899294, 148.920154849, 149.920902249,
+  150.923840289, 151.924692216, 152.927717978, 153.929484894, 154.933135691,
+  155.935078894, 156.939386061, 157.94197, 158.94653, 159.9494, 160.95428,
+  125.95792, 126.95192, 127.9487, 128.94323, 129.94053, 130.93567, 131.93384,
+  132.929782, 133.928353, 134.924823, 135.923584586, 136.920479523,
+  137.919548077, 138.91679967, 139.916039639, 140.913555084, 141.912890411,
+  142.910938262, 143.912596396, 144.912755935, 145.914702396, 146.915144988,
+  147.917481945, 148.918342277, 149.920990941, 150.921217539, 151.923506181,
+  152.924156686, 153.926471531, 154.928137048, 155.931117516, 156.933121393,
+  157.936565144, 158.939286502, 159.9431, 160.94607, 161.95022, 162.95357,
+  150.3663557119507, 127.95842, 128.95476, 129.949, 130.94618, 131.94087,
+  132.93856, 133.93411, 134.93252, 135.928275556, 136.926970517, 137.923243991,
+  138.922296635, 139.918994717, 140.918481636, 141.915204385, 142.914635303,
+  143.912006466, 144.913417339, 145.913046991, 146.914904435, 147.914829226,
+  148.917192062, 149.917282919, 150.919939796, 151.919739721, 152.92210465,
+  153.922216861, 154.924647748, 155.925536067, 156.928418698, 157.929951004,
+  158.933217226, 159.935335311, 160.93916017, 161.94146, 162.94555, 163.94836,
+  164.95297, 151.96437812938, 129.963689, 130.957842, 131.95467, 132.94929,
+  133.9464, 134.94187, 135.93962, 136.93546, 137.933709, 138.92979231,
+  139.928087637, 140.924931754, 141.92344169, 142.920298681, 143.918819553,
+  144.916272629, 145.917211039, 146.916752659, 147.918089243, 148.917937763,
+  149.919707671, 150.919857803, 151.921752184, 152.921238003, 153.922986962,
+  154.922901107, 155.924760494, 156.925433446, 157.927798606, 158.929100067,
+  159.931850939, 160.933664091, 161.936988761, 162.939195675, 163.942744,
+  164.945587, 165.94962, 166.95289, 157.252130659869, 132.96133, 133.95566,
+  134.95245, 135.9473, 136.94502, 137.94025, 138.93813, 139.933674, 140.932126,
+  141.928116, 142.926750682, 143.922963, 144.921712821, 145.918318817,
+  146.919101384, 147.918121511, 148.919348117, 149.918664422, 150.92035595,
+  151.919799494, 152.921758027, 153.92087406, 154.922630473, 155.922131241,
+  156.923968569, 157.924112348, 158.926396969, 159.927062411, 160.929677476,
+  161.930993017, 162.934176855, 163.93583, 164.93936, 165.94146, 166.94545,
+  167.94808, 168.9526, 158.92535471, 134.96476, 135.96129, 136.95602,
+  137.95312, 138.94833, 139.945805049, 140.941448, 141.939280859,
+  142.935137335, 143.933045, 144.928821947, 145.927252984, 146.924054788,
+  147.924281552, 148.923253549, 149.923664941, 150.923109599, 151.924082936,
+  152.923442403, 153.924684767, 154.923510547, 155.924755181, 156.924033028,
+  157.925420947, 158.92535471, 159.927175556, 160.927577825, 161.92949536,
+  162.930654659, 163.933357961, 164.93498, 165.937859521, 166.93996, 167.9434,
+  168.94597, 169.94984, 170.95273, 162.49947280075855, 137.9625, 138.95959,
+  139.95402, 140.95128, 141.946194, 142.943994335, 143.939269515,
+  144.937473995, 145.93284453, 146.931082715, 147.927156571, 148.927321692,
+  149.925593264, 150.926191564, 151.924725286, 152.925772378, 153.924429277,
+  154.925759086, 155.924284713, 156.92547066, 157.924415875, 158.925746958,
+  159.925204646, 160.926940492, 161.926805573, 162.928738284, 163.929181874,
+  164.931710456, 165.932813863, 166.935661379, 167.937133273, 168.940313531,
+  169.94239, 170.94612, 171.94846, 172.95283, 164.930328835, 139.968589,
+  140.963108, 141.96001, 142.95486, 143.952109715, 144.947267395,
+  145.944993506, 146.940142296, 147.937743928, 148.933802646, 149.933498408,
+  150.931698345, 151.931723623, 152.930206429, 153.930606834, 154.929104049,
+  155.929706112, 156.928254427, 157.928945969, 158.927719703, 159.928736606,
+  160.927861547, 161.929102274, 162.928741027, 163.930240273, 164.930328835,
+  165.932290927, 166.93313855, 167.935522173, 168.936878189, 169.939624846,
+  170.941471022, 171.94473, 172.94702, 173.95095, 174.95362,
+  167.25908266464916, 141.9701, 142.96662, 143.9607, 144.95805, 145.95241836,
+  146.949964459, 147.944735029, 148.942306, 149.937915567, 150.937448567,
+  151.935057085, 152.93508044, 153.932790842, 154.933215911, 155.931067313,
+  156.931948658, 157.929893474, 158.93069181, 159.92907713, 160.930004599,
+  161.928788364, 162.930040797, 163.929208791, 164.930734496, 165.93029953,
+  166.932054617, 167.932376688, 168.93459685, 169.93547023, 170.938035681,
+  171.939361858, 172.9424, 173.94423, 174.94777, 175.94994, 176.95399,
+  168.934217889, 143.976283, 144.970389, 145.966837, 146.961379891,
+  147.958384029, 148.95289, 149.95009, 150.945487875, 151.944422,
+  152.942040101, 153.941570033, 154.93920966, 155.938991573, 156.93694412,
+  157.936979525, 158.934975, 159.935263106, 160.933549, 161.934002277,
+  162.932659172, 163.933543614, 164.93244314, 165.9335606, 166.932856192,
+  167.934177409, 168.934217889, 169.935806032, 170.936433871, 171.938405521,
+  172.939608371, 173.942172953, 174.9438412, 175.946999449, 176.94904,
+  177.95264, 178.95534, 173.05415018441542, 147.96758, 148.96436, 149.95852,
+  150.955402497, 151.9502727, 152.94932, 153.946395655, 154.945783132,
+  155.942824698, 156.942645349, 157.939870549, 158.940054623, 159.937557406,
+  160.937907138, 161.935773604, 162.936339632, 163.93449493399999,
+  164.935270241, 165.933874749, 166.934952988, 167.933889602, 168.935182512,
+  169.934766376, 170.936330208, 171.936385872, 172.938215136, 173.938866437,
+  174.941280797, 175.942576447, 176.945265586, 177.946651444, 178.95004,
+  179.95212, 180.95589, 174.9668149485691, 149.973548, 150.967677, 151.96412,
+  152.958751054, 153.957364, 154.9543206, 155.953032522, 156.950126667,
+  157.949315507, 158.946635615, 159.946033, 160.943572, 161.943282776,
+  162.941179, 163.941339, 164.939406758, 165.939859, 166.93827, 167.938735635,
+  168.937644149, 169.938478365, 170.93791696, 171.939089103, 172.938934029,
+  173.940340854, 174.940775191, 175.94268968, 176.943761525, 177.945958018,
+  178.947330935, 179.94988825, 180.951908, 181.95504, 182.957363, 183.96091,
+  184.96362, 178.4849787534708, 152.97069, 153.96486, 154.96311, 155.959347805,
+  156.958236, 157.954801092, 158.953995669, 159.950690749, 160.95027837,
+  161.947214837, 162.947112946, 163.944370845, 164.944567, 165.94218, 166.9426,
+  167.940568, 168.941259, 169.939609, 170.940492, 171.939449716, 172.940513,
+  173.940046141, 174.941509187, 175.941407628, 176.943227717, 177.943705833,
+  178.945823212, 179.946557042, 180.949108338, 181.950561185, 182.953530444,
+  183.955446243, 184.958862, 185.960897, 186.96477, 187.96685, 188.97084,
+  180.94787560523443, 154.974245, 155.97203, 156.968176167, 157.966541,
+  158.963022556, 159.96148751, 160.958452265, 161.957294083, 162.95433711,
+  163.953534, 164.950780572, 165.950512, 166.948093, 167.948047, 168.946011,
+  169.946175, 170.944476, 171.944895, 172.94375, 173.944454, 174.943737,
+  175.944857, 176.944479469, 177.945678, 178.945936555, 179.947464832,
+  180.947995769, 181.950151853, 182.95137262, 183.954007694, 184.955559084,
+  185.958550667, 186.960386, 187.963916, 188.96583, 189.96939, 190.97156,
+  191.97514, 183.8417775420875, 156.97884, 157.974562, 158.972638,
+  159.968462584, 160.967197, 161.963499142, 162.962524342, 163.958960683,
+  164.958280788, 165.95503121, 166.95480456, 167.951805537, 168.951778845,
+  169.949231588, 170.949451, 171.947292, 172.947689, 173.946079, 174.946717,
+  175.945634, 176.946643, 177.945883303, 178.947077043, 179.946710805,
+  180.948197783, 181.948203945, 182.950222748, 183.950930916, 184.953418974,
+  185.954362771, 186.957158841, 187.958486177, 188.961763, 189.963090589,
+  190.966531, 191.96817, 192.97178, 193.97367, 186.20670452221, 158.984179,
+  159.981823, 160.977572951, 161.975844, 162.97207986, 163.97045287,
+  164.96710266, 165.965760821, 166.962595, 167.961572608, 168.958766063,
+  169.958220071, 170.955716, 171.955419665, 172.953243, 173.953115, 174.951381,
+  175.951623, 176.950328, 177.950989, 178.94998913, 179.950791568,
+  180.950057673, 181.951209869, 182.950819638, 183.952522809, 184.952954486,
+  185.954985595, 186.955750071, 187.95811151, 188.95922602, 189.96174426,
+  190.963121551, 191.966088, 192.967541, 193.97076, 194.97254, 195.9758,
+  196.97799, 197.9816, 190.22485961950818, 160.989029, 161.984431, 162.98241,
+  163.978021712, 164.976602, 165.972692476, 166.971548768, 167.967807751,
+  168.967017574, 169.963578454, 170.963173969, 171.960017317, 172.959808465,
+  173.957063507, 174.956945313, 175.954806, 176.954965628, 177.953253627,
+  178.953816881, 179.952375485, 180.953247188, 181.952110187, 182.953124719,
+  183.952488536, 184.954041741, 185.953835044, 186.955747422, 187.955835174,
+  188.958144162, 189.958443702, 190.960926361, 191.961476998, 192.96414787,
+  193.96517724, 194.968318, 195.969641463, 196.97283, 197.97441, 198.97801,
+  199.97984, 200.98364, 201.98595, 192.21605164133803, 163.991909, 164.987501,
+  165.985664, 166.981666315, 167.979906642, 168.976298488, 169.974922,
+  170.971640252, 171.970607036, 172.967505636, 173.966861045, 174.964149589,
+  175.963650389, 176.9613015, 177.961082, 178.959120178, 179.959229446,
+  180.957625456, 181.958076296, 182.956839968, 183.957476, 184.956698,
+  185.957944153, 186.957542, 187.958828095, 188.958715028, 189.960541215,
+  190.960589293, 191.962600247, 192.962921587, 193.965073536, 194.96597473,
+  195.968397112, 196.969655415, 197.97228, 198.973805301, 199.9768, 200.97864,
+  201.98199, 202.98423, 203.9896, 195.0844568570031, 165.994855, 166.992695,
+  167.988128665, 168.986567, 169.982496345, 170.981245248, 171.977350921,
+  172.976443058, 173.972819528, 174.972409721, 175.968938362, 176.968469537,
+  177.965649523, 178.965358953, 179.963031955, 180.963097588, 181.961171823,
+  182.961596804, 183.959915113, 184.960613659, 185.959350812, 186.960616976,
+  187.959388889, 188.960831282, 189.959929707, 190.961672912, 191.961038746,
+  192.96298238, 193.96268085, 194.964791719, 195.964952091, 196.967340687,
+  197.96789492, 198.970595224, 199.971442807, 200.974513112, 201.975639,
+  202.97893, 203.98076, 204.98608, 205.98966, 196.96656878600004, 168.99808,
+  169.995972, 170.991875791, 171.989942284, 172.986240924, 173.984717,
+  174.981303712, 175.980250432, 176.976870439, 177.97603192, 178.973173654,
+  179.972523397, 180.970079047, 181.969617874, 182.967590635, 183.967451524,
+  184.965789569, 185.965952703, 186.964543155, 187.965349392, 188.963948286,
+  189.96469839, 190.963702248, 191.964813694, 192.964137257, 193.965417754,
+  194.965035225, 195.966569908, 196.966568786, 197.96824242, 198.968765282,
+  199.970756456, 200.971657484, 201.973856, 202.975154446, 203.977831,
+  204.97985, 205.98474, 206.9884, 207.99345, 208.99735, 210.0025,
+  200.59916703513838, 171.003529, 171.998808967, 172.997091, 173.992864748,
+  174.991440747, 175.987360863, 176.986277319, 177.982483769, 178.981831329,
+  179.978260335, 180.977819371, 181.974689351, 182.974444783, 183.971713528,
+  184.971899388, 185.969362272, 186.969814428, 187.967566887, 188.968194927,
+  189.966322735, 190.96715716, 191.965634702, 192.966652658, 193.965449112,
+  194.96672054, 195.96583256, 196.967212847, 197.966768602, 198.968280643,
+  199.96832659, 200.970302839, 201.9706434, 202.972872837, 203.973493981,
+  204.976073417, 205.977514401, 206.9823, 207.985759, 208.99072, 209.99424,
+  210.99933, 212.00296, 213.00823, 214.012, 215.0174, 216.02132,
+  204.3834128379984, 176.000624028, 176.996430829, 177.994854, 178.991110696,
+  179.990056524, 180.986259979, 181.985713159, 182.982192839, 183.981885851,
+  184.97878905, 185.978650841, 186.975906348, 187.976020886, 188.973588471,
+  189.973828, 190.971784199, 191.972225, 192.970501998, 193.971081412,
+  194.969774268, 195.970481193, 196.96957589, 197.970483065, 198.969877,
+  199.970963258, 200.970822212, 201.972102441, 202.972344593, 203.9738639,
+  204.974427801, 205.976110589, 206.977419712, 207.982019001, 208.985359353,
+  209.990073958, 210.993475, 211.998335, 213.001915, 214.00694, 215.01064,
+  216.0158, 217.01966, 218.02479, 207.216908048018, 178.003831243,
+  179.002201112, 179.997928286, 180.99665331, 181.992672466, 182.991872098,
+  183.988135701, 184.987610004, 185.984238331, 186.983910895, 187.980874815,
+  188.980807, 189.978081999, 190.978276, 191.975775008, 192.976173234,
+  193.97401225, 194.974542922, 195.972774233, 196.973431166, 197.972034077,
+  198.97291268, 199.971818893, 200.972882917, 201.972152026, 202.973391126,
+  203.973043981, 204.974482157, 205.974465683, 206.975897297, 207.976652481,
+  208.981090461, 209.984188861, 210.988737125, 211.991897703, 212.996562894,
+  213.999805917, 215.004741, 216.00803, 217.01314, 218.01659, 219.02177,
+  220.02541, 208.980399068, 184.001274756, 184.9976, 185.996643681,
+  186.993147184, 187.992286943, 188.989194984, 189.988621561, 190.985786556,
+  191.985469058, 192.982959813, 193.982785, 194.980648781, 195.980666509,
+  196.978865099, 197.979206, 198.97767301, 199.978131179, 200.977010416,
+  201.977733861, 202.976892779, 203.977836062, 204.977386694, 205.978499317,
+  206.978471022, 207.97974253, 208.980399068, 209.984120705, 210.987269741,
+  211.991286026, 212.994385067, 213.998711926, 215.001769823, 216.006305989,
+  217.009372, 218.014188, 219.01748, 220.02235, 221.02587, 222.03078, 223.0345,
+  224.03947, 186.004393241, 187.003041054, 187.999415569, 188.998473429,
+  189.995100569, 190.994558462, 191.991335925, 192.991025678, 193.988186101,
+  194.988125532, 195.985525902, 196.985659522, 197.983389132, 198.983667115,
+  199.98179879, 200.982259806, 201.980757657, 202.981416133, 203.980310339,
+  204.981203091, 205.980473991, 206.981593762, 207.981246092, 208.982430836,
+  209.982874076, 210.986653562, 211.988868376, 212.992857623, 213.995201683,
+  214.999420146, 216.001915186, 217.006318159, 218.008973546, 219.013614,
+  220.016386, 221.021228, 222.02414, 223.02907, 224.03211, 225.03707,
+  226.04031, 227.04539, 191.004147909, 192.003151707, 192.999927418,
+  193.999236139, 194.996268546, 195.995799619, 196.993189187, 197.992784,
+  198.990527654, 199.990351015, 200.988417147, 201.988630302, 202.98694299,
+  203.987251198, 204.986075861, 205.986656933, 206.985800332, 207.986613302,
+  208.986170215, 209.987147898, 210.987496614, 211.990737688, 212.992936978,
+  213.996372066, 214.998652849, 216.002423555, 217.004719222, 218.008694723,
+  219.011161848, 220.015433, 221.018017, 222.022494, 223.025151, 224.029749,
+  225.03263, 226.03716, 227.04024, 228.04475, 229.04812, 193.009707979,
+  194.006144389, 195.005421673, 196.002115998, 197.00158462, 197.998679156,
+  198.998389856, 199.995690431, 200.99562801, 201.993264277, 202.993387741,
+  203.991429922, 204.99171884, 205.990214219, 206.990730254, 207.989634687,
+  208.99041451, 209.989689107, 210.99060111, 211.990703919, 212.993883069,
+  213.995362956, 214.99874589, 216.000271859, 217.003928018, 218.005601586,
+  219.009480361, 220.01139413, 221.015537076, 222.017578246, 223.021889286,
+  224.024095805, 225.028485574, 226.030861382, 227.035304396, 228.037835418,
+  229.042257277, 230.04514, 231.04987, 199.007258594, 200.006586003,
+  201.003866593, 202.00332, 203.000940729, 204.000652059, 204.998593858,
+  205.998666132, 206.996946478, 207.997138132, 208.995954932, 209.996422409,
+  210.995555723, 211.996225652, 212.996186041, 213.998971333, 215.000341838,
+  216.003189865, 217.004632282, 218.007578653, 219.009252427, 220.012327702,
+  221.014255163, 222.017552192, 223.019736013, 224.023398, 225.025572682,
+  226.029566, 227.031869, 228.035823175, 229.038298, 230.042416349, 231.045158,
+  232.049368, 233.05264, 201.012712, 202.009759744, 203.009304274,
+  204.006491866, 205.006268245, 206.003828053, 207.003799159, 208.001841122,
+  209.001990455, 210.000494169, 211.000893214, 211.999786715, 213.000384258,
+  214.000099727, 215.00272042, 216.003533423, 217.006320726, 218.007140631,
+  219.010085484, 220.011025872, 221.01391768, 222.015374846, 223.018502327,
+  224.020211968, 225.023611857, 226.02541033, 227.029178349, 228.031070728,
+  229.034942262, 230.037054781, 231.041027087, 232.04347527, 233.047582,
+  234.050342, 235.05497, 206.014452, 207.01196583, 208.011550406,
+  209.009494762, 210.009436052, 211.007731899, 212.007813171, 213.00660902,
+  214.006918488, 215.006474511, 216.008743482, 217.009343872, 218.01164164,
+  219.01242073, 220.014754854, 221.015591579, 222.017844181, 223.019137747,
+  224.021723163, 225.023229987, 226.026098383, 227.027752283, 228.031021547,
+  229.032955884, 230.036327, 231.038393, 232.042034, 233.044346, 234.048139,
+  235.05084, 236.054988, 237.05827, 232.03805576, 208.017900275, 209.017752974,
+  210.015093642, 211.014929468, 212.012987595, 213.013009223, 214.011500159,
+  215.011724774, 216.011056007, 217.013116701, 218.013276331, 219.015537481,
+  220.015748148, 221.018184072, 222.018468521, 223.020811853, 224.021464382,
+  225.023951363, 226.024903383, 227.027704227, 228.028741272, 229.031762713,
+  230.03313413, 231.036304628, 232.03805576, 233.041582278, 234.043601407,
+  235.047255, 236.049657, 237.053629, 238.056496, 239.06077, 231.035884243,
+  212.023202993, 213.021109239, 214.020918483, 215.019182929, 216.019108913,
+  217.018325363, 218.020058579, 219.019904029, 220.021705, 221.021874941,
+  222.023784, 223.023962614, 224.025617614, 225.026131009, 226.027948082,
+  227.028805351, 228.031051673, 229.032097236, 230.034541047, 231.035884243,
+  232.038591737, 233.040247222, 234.043307161, 235.045399, 236.048668,
+  237.051023, 238.054637, 239.05726, 240.06098, 241.06408, 238.02891048471406,
+  217.024661, 218.023523472, 219.02499913, 220.02462, 221.026284, 222.026003,
+  223.027739187, 224.027605163, 225.02939135, 226.029339101, 227.031156773,
+  228.031371492, 229.03350628, 230.033940096, 231.036293861, 232.037156297,
+  233.039635525, 234.040952306, 235.043930131, 236.04556821, 237.048730378,
+  238.050788423, 239.054293475, 240.056593356, 241.06033, 242.062932,
+  243.06699, 219.03143, 220.03254, 221.03204, 222.0333, 223.03285, 224.03422,
+  225.033910892, 226.035188, 227.034957129, 228.036066866, 229.036264139,
+  230.037827926, 231.038245364, 232.040109, 233.040740989, 234.042895256,
+  235.044063487, 236.046569744, 237.048173649, 238.050946611, 239.052939241,
+  240.056165427, 241.058252636, 242.061641379, 243.06428, 244.06785, 245.0708,
+  228.038732491, 229.040143614, 230.039650283, 231.041101511, 232.041184582,
+  233.042997716, 234.043317387, 235.045286206, 236.046058109, 237.04840983,
+  238.049560111, 239.052163591, 240.05381375, 241.056851661, 242.058742809,
+  243.062003595, 244.06420526, 245.067826058, 246.070205458, 247.07419,
+  230.04609, 231.04556, 232.04645, 233.046445, 234.047731, 235.047908245,
+  236.049428, 237.049996, 238.051984542, 239.053024699, 240.055300384,
+  241.056829349, 242.059549364, 243.061381302, 244.064285052, 245.066454834,
+  246.069775, 247.072093, 248.075753, 249.07848, 232.049817, 233.050770001,
+  234.050160237, 235.051542, 236.051374477, 237.052869294, 238.05308142,
+  239.054910117, 240.055529681, 241.05765317, 242.058836039, 243.061389325,
+  244.062752783, 245.065491454, 246.067223841, 247.070354131, 248.072349862,
+  249.075954767, 250.078358313, 251.082286441, 252.08487, 234.057267,
+  235.05658, 236.05748, 237.0571, 238.058204, 239.058241, 240.059759,
+  241.060155, 242.061982, 243.063007791, 244.065180979, 245.066361821,
+  246.068673126, 247.070307302, 248.073088, 249.074987676, 250.078316698,
+  251.080762009, 252.084311, 253.08688, 254.0906, 237.062197789, 238.06149,
+  239.062529, 240.062255728, 241.06369, 242.063754274, 243.065477,
+  244.066000801, 245.068048677, 246.068805531, 247.070965463, 248.072185066,
+  249.074853903, 250.076406244, 251.079588625, 252.081627199, 253.085134499,
+  254.087324263, 255.091048, 256.093442, 239.06823, 240.06892, 241.06856,
+  242.069567, 243.06951, 244.070883, 245.071249, 246.072896, 247.073622017,
+  248.075471, 249.076411, 250.078612, 251.079993586, 252.082979865,
+  253.084825715, 254.088022199, 255.090274958, 256.093599, 257.095979,
+  258.09952, 241.07421, 242.07343, 243.074465, 244.074038, 245.075349,
+  246.07535047, 247.076945, 248.077186463, 249.07892755, 250.079521034,
+  251.08153989, 252.08246706, 253.085184571, 254.086854397, 255.089964038,
+  256.091774469, 257.095106078, 258.097077, 259.100597, 260.102809, 245.080808,
+  246.081713, 247.081522, 248.082823, 249.082914, 250.084415, 251.084774376,
+  252.086432, 253.087144, 254.089592, 255.091084149, 256.093889, 257.095542387,
+  258.098431496, 259.100511, 260.103653, 261.105828, 262.109101, 248.08655,
+  249.087797, 250.087562, 251.088944, 252.088966908, 253.090564103,
+  254.090955661, 255.093191404, 256.09428287, 257.09688783, 258.098207,
+  259.101032, 260.102644, 261.105697, 262.107464, 263.110715, 264.112734,
+  251.09418, 252.095264, 253.095091, 254.096483, 255.096562404, 256.09849403,
+  257.099418, 258.101755, 259.102902, 260.105505, 261.106884, 262.109612,
+  263.111359, 264.114201, 265.116193, 266.119831, 253.100438, 254.100053,
+  255.101268, 256.101152218, 257.10291812, 258.103427679, 259.105596,
+  260.106441, 261.108773401, 262.109925, 263.112495, 264.113879, 265.116684,
+  266.118172, 267.121789, 268.123968, 255.107068, 256.10789, 257.107578,
+  258.109285, 259.109491866, 260.111297, 261.111917, 262.114072, 263.11499,
+  264.117405, 265.118613, 266.121029, 267.122465, 268.125671, 269.127911,
+  270.131356, 258.112983, 259.114396, 260.114384105, 261.115949461,
+  262.116336679, 263.118294, 264.118931, 265.121093, 266.121975, 267.124357,
+  268.125392, 269.128627, 270.130427, 271.133933, 272.13589, 273.13958,
+  260.121659, 261.121455, 262.122967, 263.122916, 264.124593, 265.124914,
+  266.126794, 267.127501, 268.129692, 269.130416, 270.133363, 271.135256,
+  272.138264, 273.14024, 274.143548, 275.14567, 263.128522, 264.128356917,
+  265.129792986, 266.1300464, 267.131673, 268.131865, 269.133753, 270.13429,
+  271.13717, 272.138495, 273.141679, 274.143304, 275.146668, 276.148455,
+  277.151899, 265.135996, 266.137374, 267.137189, 268.138649, 269.138822,
+  270.140327, 271.140744, 272.143406, 273.144399, 274.147245, 275.14882,
+  276.151594, 277.153268, 278.156307, 279.158075, 267.143768, 268.143478,
+  269.144752124, 270.144584153, 271.145946, 272.14602, 273.14856, 274.149411,
+  275.152033, 276.153025, 277.155914, 278.15704, 279.160097, 280.161311,
+  281.164511, 272.153273, 273.153127, 274.155253, 275.155939, 276.158334,
+  277.159069, 278.161493, 279.162722, 280.165138, 281.16636, 282.169119,
+  283.170544, 276.16141, 277.163641, 278.164156, 279.166542, 280.167147,
+  281.169746, 282.170496, 283.17327, 284.174156, 285.177117, 278.170578,
+  279.17095, 280.17293, 281.17348, 282.175672, 283.176571, 284.178727,
+  285.179727, 286.182208, 287.183389, 285.183643, 286.184235, 287.186783,
+  288.187572, 289.190419, 287.190704, 288.19274, 289.193627, 290.195975,
+  291.197071, 289.198162, 290.198638, 291.201077, 292.201742, 293.204487,
+  291.205535, 292.207463, 293.208236, 294.210462, 293.213562, 294.213921,
+  295.21624,
+};
+
+constexpr int pyne::natural_abund_table_nucs[288] = {
+  10010000, 10020000, 20030000, 20040000, 30060000, 30070000, 40090000,
+  50100000, 50110000, 60120000, 60130000, 70140000, 70150000, 80160000,
+  80170000, 80180000, 90190000, 100200000, 100210000, 100220000, 110230000,
+  120240000, 120250000, 120260000, 130270000, 140280000, 140290000, 140300000,
+  150310000, 160320000, 160330000, 160340000, 160360000, 170350000, 170370000,
+  180360000, 180380000, 180400000, 190390000, 190400000, 190410000, 200400000,
+  200420000, 200430000, 200440000, 200460000, 200480000, 210450000, 220460000,
+  220470000, 220480000, 220490000, 220500000, 230500000, 230510000, 240500000,
+  240520000, 240530000, 240540000, 250550000, 260540000, 260560000, 260570000,
+  260580000, 270590000, 280580000, 280600000, 280610000, 280620000, 280640000,
+  290630000, 290650000, 300640000, 300660000, 300670000, 300680000, 300700000,
+  310690000, 310710000, 320700000, 320720000, 320730000, 320740000, 320760000,
+  330750000, 340740000, 340760000, 340770000, 340780000, 340800000, 340820000,
+  350790000, 350810000, 360780000, 360800000, 360820000, 360830000, 360840000,
+  360860000, 370850000, 370870000, 380840000, 380860000, 380870000, 380880000,
+  390890000, 400900000, 400910000, 400920000, 400940000, 400960000, 410930000,
+  420920000, 420940000, 420950000, 420960000, 420970000, 420980000, 421000000,
+  440960000, 440980000, 440990000, 441000000, 441010000, 441020000, 441040000,
+  451030000, 461020000, 461040000, 461050000, 461060000, 461080000, 461100000,
+  471070000, 471090000, 481060000, 481080000, 481100000, 481110000, 481120000,
+  481130000, 481140000, 481160000, 491130000, 491150000, 501120000, 501140000,
+  501150000, 501160000, 501170000, 501180000, 501190000, 501200000, 501220000,
+  501240000, 511210000, 511230000, 521200000, 521220000, 521230000, 521240000,
+  521250000, 521260000, 521280000, 521300000, 531270000, 541240000, 541260000,
+  541280000, 541290000, 541300000, 541310000, 541320000, 541340000, 541360000,
+  551330000, 561300000, 561320000, 561340000, 561350000, 561360000, 561370000,
+  561380000, 571380000, 571390000, 581360000, 581380000, 581400000, 581420000,
+  591410000, 601420000, 601430000, 601440000, 601450000, 601460000, 601480000,
+  601500000, 621440000, 621470000, 621480000, 621490000, 621500000, 621520000,
+  621540000, 631510000, 631530000, 641520000, 641540000, 641550000, 641560000,
+  641570000, 641580000, 641600000, 651590000, 661560000, 661580000, 661600000,
+  661610000, 661620000, 661630000, 661640000, 671650000, 681620000, 681640000,
+  681660000, 681670000, 681680000, 681700000, 691690000, 701680000, 701700000,
+  701710000, 701720000, 701730000, 701740000, 701760000, 711750000, 711760000,
+  721740000, 721760000, 721770000, 721780000, 721790000, 721800000, 731800000,
+  731810000, 741800000, 741820000, 741830000, 741840000, 741860000, 751850000,
+  751870000, 761840000, 761860000, 761870000, 761880000, 761890000, 761900000,
+  761920000, 771910000, 771930000, 781900000, 781920000, 781940000, 781950000,
+  781960000, 781980000, 791970000, 801960000, 801980000, 801990000, 802000000,
+  802010000, 802020000, 802040000, 812030000, 812050000, 822040000, 822060000,
+  822070000, 822080000, 832090000, 902320000, 912310000, 922340000, 922350000,
+  922380000,
+};
+
+constexpr double pyne::natural_abund_table_values[288] = {
+  99.9885e-2, 0.0115e-2, 0.000134e-2, 99.999866e-2, 7.59e-2, 92.41e-2,
+  100.0e-2, 19.9e-2, 80.1e-2, 98.93e-2, 1.07e-2, 99.636e-2, 0.364e-2,
+  99.757e-2, 0.038e-2, 0.205e-2, 100.0e-2, 90.48e-2, 0.27e-2, 9.25e-2,
+  100.0e-2, 78.99e-2, 10.00e-2, 11.01e-2, 100.0e-2, 92.223e-2, 4.685e-2,
+  3.092e-2, 100.0e-2, 94.99e-2, 0.75e-2, 4.25e-2, 0.01e-2, 75.76e-2, 24.24e-2,
+  0.3336e-2, 0.0629e-2, 99.6035e-2, 93.2581e-2, 0.0117e-2, 6.7302e-2,
+  96.941e-2, 0.647e-2, 0.135e-2, 2.086e-2, 0.004e-2, 0.187e-2, 100.0e-2,
+  8.25e-2, 7.44e-2, 73.72e-2, 5.41e-2, 5.18e-2, 0.250e-2, 99.750e-2, 4.345e-2,
+  83.789e-2, 9.501e-2, 2.365e-2, 100.0e-2, 5.845e-2, 91.754e-2, 2.119e-2,
+  0.282e-2, 100.0e-2, 68.077e-2, 26.223e-2, 1.1399e-2, 3.6346e-2, 0.9255e-2,
+  69.15e-2, 30.85e-2, 49.17e-2, 27.73e-2, 4.04e-2, 18.45e-2, 0.61e-2,
+  60.108e-2, 39.892e-2, 20.57e-2, 27.45e-2, 7.75e-2, 36.50e-2, 7.73e-2,
+  100.0e-2, 0.89e-2, 9.37e-2, 7.63e-2, 23.77e-2, 49.61e-2, 8.73e-2, 50.69e-2,
+  49.31e-2, 0.355e-2, 2.286e-2, 11.593e-2, 11.500e-2, 56.987e-2, 17.279e-2,
+  72.17e-2, 27.83e-2, 0.56e-2, 9.86e-2, 7.00e-2, 82.58e-2, 100.0e-2, 51.45e-2,
+  11.22e-2, 17.15e-2, 17.38e-2, 2.80e-2, 100.0e-2, 14.53e-2, 9.15e-2, 15.84e-2,
+  16.67e-2, 9.60e-2, 24.39e-2, 9.82e-2, 5.54e-2, 1.87e-2, 12.76e-2, 12.60e-2,
+  17.06e-2, 31.55e-2, 18.62e-2, 100.0e-2, 1.02e-2, 11.14e-2, 22.33e-2,
+  27.33e-2, 26.46e-2, 11.72e-2, 51.839e-2, 48.161e-2, 1.25e-2, 0.89e-2,
+  12.49e-2, 12.80e-2, 24.13e-2, 12.22e-2, 28.73e-2, 7.49e-2, 4.29e-2, 95.71e-2,
+  0.97e-2, 0.66e-2, 0.34e-2, 14.54e-2, 7.68e-2, 24.22e-2, 8.59e-2, 32.58e-2,
+  4.63e-2, 5.79e-2, 57.21e-2, 42.79e-2, 0.09e-2, 2.55e-2, 0.89e-2, 4.74e-2,
+  7.07e-2, 18.84e-2, 31.74e-2, 34.08e-2, 100.0e-2, 0.0952e-2, 0.0890e-2,
+  1.9102e-2, 26.4006e-2, 4.0710e-2, 21.2324e-2, 26.9086e-2, 10.4357e-2,
+  8.8573e-2, 100.0e-2, 0.106e-2, 0.101e-2, 2.417e-2, 6.592e-2, 7.854e-2,
+  11.232e-2, 71.698e-2, 0.08881e-2, 99.91119e-2, 0.185e-2, 0.251e-2, 88.450e-2,
+  11.114e-2, 100.0e-2, 27.152e-2, 12.174e-2, 23.798e-2, 8.293e-2, 17.189e-2,
+  5.756e-2, 5.638e-2, 3.07e-2, 14.99e-2, 11.24e-2, 13.82e-2, 7.38e-2, 26.75e-2,
+  22.75e-2, 47.81e-2, 52.19e-2, 0.20e-2, 2.18e-2, 14.80e-2, 20.47e-2, 15.65e-2,
+  24.84e-2, 21.86e-2, 100.0e-2, 0.056e-2, 0.095e-2, 2.329e-2, 18.889e-2,
+  25.475e-2, 24.896e-2, 28.260e-2, 100.0e-2, 0.139e-2, 1.601e-2, 33.503e-2,
+  22.869e-2, 26.978e-2, 14.910e-2, 100.0e-2, 0.123e-2, 2.982e-2, 14.09e-2,
+  21.68e-2, 16.103e-2, 32.026e-2, 12.996e-2, 97.401e-2, 2.599e-2, 0.16e-2,
+  5.26e-2, 18.60e-2, 27.28e-2, 13.62e-2, 35.08e-2, 0.01201e-2, 99.98799e-2,
+  0.12e-2, 26.50e-2, 14.31e-2, 30.64e-2, 28.43e-2, 37.40e-2, 62.60e-2, 0.02e-2,
+  1.59e-2, 1.96e-2, 13.24e-2, 16.15e-2, 26.26e-2, 40.78e-2, 37.3e-2, 62.7e-2,
+  0.012e-2, 0.782e-2, 32.86e-2, 33.78e-2, 25.21e-2, 7.356e-2, 100.0e-2,
+  0.15e-2, 9.97e-2, 16.87e-2, 23.10e-2, 13.18e-2, 29.86e-2, 6.87e-2, 29.52e-2,
+  70.48e-2, 1.4e-2, 24.1e-2, 22.1e-2, 52.4e-2, 100.0e-2, 100.0e-2, 100.0e-2,
+  0.0054e-2, 0.7204e-2, 99.2742e-2,
+};
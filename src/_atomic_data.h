@@ -3,6 +3,7 @@
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 !!!!!! This file has been autogenerated, modify atomicgen.py !!!!!!!!!!
+!!!!!!          DO NOT MODIFY THIS FILE BY HAND!!            !!!!!!!!!!
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -11,21 +12,37 @@
 /// /author Andrew Davis (andrew.davis@wisc.edu)
 ///
 /// /brief Implements all the fundamental atomic & nuclear data data
+#ifndef PYNE_2MXWDMJ4UBFSTHPZ4QKCEOIQKU
+#define PYNE_2MXWDMJ4UBFSTHPZ4QKCEOIQKU
 #include <map>
+#include <stddef.h>
 
 namespace pyne
 {
-  /// main function to be called when you wish to load the nuclide data
-  /// into memory
-  void _load_atomic_mass_map_memory();
-  /// function to create mapping from nuclides in id form
-  /// to their atomic masses
+  /// Number of nuclides in the built-in atomic mass table.
+  const size_t atomic_mass_table_size = 3436;
+  /// Nuclides in id form of the built-in atomic mass table, sorted.
+  extern const int atomic_mass_table_nucs[atomic_mass_table_size];
+  /// Atomic masses [amu] of atomic_mass_table_nucs, natural elements
+  /// included.
+  extern const double atomic_mass_table_values[atomic_mass_table_size];
 
-  void _insert_atomic_mass_map();
+  /// Number of nuclides in the built-in natural abundance table.
+  const size_t natural_abund_table_size = 288;
+  /// Nuclides in id form of the built-in natural abundance table, sorted.
+  extern const int natural_abund_table_nucs[natural_abund_table_size];
+  /// Natural abundances [atom fraction] of natural_abund_table_nucs.
+  extern const double natural_abund_table_values[natural_abund_table_size];
 
-  /// function to create mapping from nuclides in id form
-  /// to their natural abundances
-  void _insert_abund_map();
+  /// Atomic mass [amu] of \a nuc in id form from the built-in table, or
+  /// a negative value if it is not there.  Needs no loading or locking.
+  double _atomic_mass_memory(int nuc);
+  /// Natural abundance [atom fraction] of \a nuc in id form from the
+  /// built-in table, or a negative value if it is not there.
+  double _natural_abund_memory(int nuc);
+  /// Copies the built-in tables into atomic_mass_map and
+  /// natural_abund_map, keeping any entries already there.
+  void _load_atomic_mass_map_memory();
 
   /// Mapping from nuclides in id form to their natural abundances
   extern std::map<int,double> natural_abund_map;
@@ -37,3 +54,4 @@ namespace pyne
   /// abdundance
   extern std::map<int,double> atomic_mass_error_map;
 } // namespace pyne
+#endif  // PYNE_2MXWDMJ4UBFSTHPZ4QKCEOIQKU
@@ -8,6 +8,8 @@
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
+#include <algorithm>
+
 #ifndef PYNE_IS_AMALGAMATED
 #include "decay.h"
 #endif
@@ -15,74 +17,69 @@
 namespace pyne {
 namespace decayers {
 
-void decay_h(double t, std::map<int, double>::const_iterator &it, std::map<int, double> &outcomp, double (&out)[4]) {
-  //using std::exp2;
-  switch (it->first) {
-    case 10010000: {
-      out[0] += it->second;
-      break;
-    } case 10020000: {
-      out[1] += it->second;
-      break;
-    } case 10030000: {
-      double b0 = exp2(-2.572085e-09*t);
-      out[2] += (it->second) * (b0);
-      out[3] += (it->second) * (-1.000000e+00*b0 + 1.0);
-      break;
-    } default: {
-      outcomp.insert(*it);
-      break;
-    }
-  }
+const int all_nucs [4] = {
+  10010000, 10020000, 10030000, 20030000
+};
+
+namespace {
+// Bateman solutions of the decay chains of all_nucs, see decay_chains.h.
+const int exp_ptr [5] = {
+  0, 0, 0, 1, 1};
+
+const double exp_a [1] = {
+  -2.572085e-09};
+
+const int term_ptr [5] = {
+  0, 1, 2, 5, 6};
+
+const int term_child [6] = {
+  0, 1, 2, 3, 3, 3};
+
+const int term_exp [6] = {
+  0, 0, 1, 1, 0, 0};
+
+const unsigned char term_tpow [6] = {
+  0, 0, 0, 0, 0, 0};
+
+const double term_k [6] = {
+  1.0, 1.0, 1.0, -1.0, 1.0, 1.0};
+}  // namespace
+
+const DecayChains& all_chains() {
+  static const DecayChains chains = {
+    4, all_nucs, exp_ptr, exp_a, term_ptr, term_child,
+    term_exp, term_tpow, term_k, 1};
+  return chains;
 }
 
-void decay_he(double t, std::map<int, double>::const_iterator &it, std::map<int, double> &outcomp, double (&out)[4]) {
-  //using std::exp2;
-  switch (it->first) {
-    case 20030000: {
-      out[3] += it->second;
-      break;
-    } default: {
-      outcomp.insert(*it);
-      break;
-    }
-  }
+void decay(const double* x, double t, double* out) {
+  double work [2];
+  std::fill(out, out + 4, 0.0);
+  bateman(all_chains(), x, t, out, work);
+}
+
+void decay(const double* x, const double* times, int ntimes, double* out) {
+  // in blocks of eight times, so that the work space fits on the stack
+  double work [16];
+  std::fill(out, out + (size_t) ntimes * 4, 0.0);
+  for (int j = 0; j < ntimes; j += 8)
+    bateman(all_chains(), x, times + j, std::min(8, ntimes - j),
+            out + (size_t) j * 4, work);
 }
 
 std::map<int, double> decay(std::map<int, double> comp, double t) {
-  // setup
-  using std::map;
-  int nuc;
-  int i = 0;
-  double out [4] = {};  // init to zero
-  map<int, double> outcomp;
-
-  // body
-  map<int, double>::const_iterator it = comp.begin();
-  for (; it != comp.end(); ++it) {
-    switch (nucname::znum(it->first)) {
-      case 1:
-        decay_h(t, it, outcomp, out);
-        break;
-      case 2:
-        decay_he(t, it, outcomp, out);
-        break;
-      default:
-        outcomp.insert(*it);
-        break;
-    }
-  }
-
-  // cleanup
-  for (i = 0; i < 4; ++i)
-    if (out[i] > 0.0)
-      outcomp[all_nucs[i]] = out[i];
-  return outcomp;
+  return bateman(all_chains(), all_nucs_index(), comp, t);
 }
 
-const int all_nucs [4] = {
-  10010000, 10020000, 10030000, 20030000
-};
+std::vector<double> decay(const std::map<int, double>& comp,
+                          const std::vector<double>& times) {
+  return bateman(all_chains(), all_nucs_index(), comp, times);
+}
+
+const NuclideIndex& all_nucs_index() {
+  static const NuclideIndex index (all_nucs, 4);
+  return index;
+}
 
 }  // namespace decayers
 }  // namespace pyne
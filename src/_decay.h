@@ -12,11 +12,13 @@
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
 #include <map>
-//#include <cmath>
+#include <vector>
 
 #ifndef PYNE_IS_AMALGAMATED
 #include "data.h"
 #include "nucname.h"
+#include "nuclide_index.h"
+#include "decay_chains.h"
 #endif
 
 namespace pyne {
@@ -24,8 +26,32 @@ namespace decayers {
 
 extern const int all_nucs[4];
 
+/// The nuclides of all_nucs in id form, as a dense index.
+const NuclideIndex& all_nucs_index();
+
+/// The decay chains of all_nucs, for bateman().
+const DecayChains& all_chains();
+
+/// Decays the atom fractions \a x for time \a t [s] into \a out.  Both
+/// are dense in all_nucs order, and nothing is allocated.
+void decay(const double* x, double t, double* out);
+
+/// Decays the atom fractions \a x to each of the \a ntimes \a times [s].
+/// Row j of \a out, all_nucs long, is set to the result at times[j].
+/// Nothing is allocated.
+void decay(const double* x, const double* times, int ntimes, double* out);
+
+/// Decays the composition \a comp for time \a t [s].  Nuclides that are
+/// not in all_nucs are passed through unchanged.
 std::map<int, double> decay(std::map<int, double> comp, double t);
 
+/// Decays \a comp to each of \a times [s] in one pass over the chains.
+/// Returns the atom fractions as a dense times.size() x all_nucs matrix,
+/// row-major with nuclides in all_nucs order.  Nuclides that are not in
+/// all_nucs are dropped.
+std::vector<double> decay(const std::map<int, double>& comp,
+                          const std::vector<double>& times);
+
 }  // namespace decayers
 }  // namespace pyne
 
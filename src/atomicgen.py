@@ -40,39 +40,56 @@ def write_if_diff(filename, contents, verbose=True):
         f.write(contents)
 
 
-def generate_header():
+def generate_header(nmass, nabund):
     """Creates the header file."""
     header_file = AUTOGEN_WARNING
     header_file += "/// /file atomic_nuclear_data.h\n"
     header_file += "/// /author Andrew Davis (andrew.davis@wisc.edu)\n"
     header_file += "///\n"
     header_file += "/// /brief Implements all the fundamental atomic & nuclear data data\n"
+    header_file += "#ifndef PYNE_2MXWDMJ4UBFSTHPZ4QKCEOIQKU\n"
+    header_file += "#define PYNE_2MXWDMJ4UBFSTHPZ4QKCEOIQKU\n"
     header_file += "#include <map>\n"
+    header_file += "#include <stddef.h>\n"
     header_file += "\n"
     header_file += "namespace pyne\n"
     header_file += "{\n"
-    header_file += "  /// main function to be called when you wish to load the nuclide data \n"
-    header_file += "  /// into memory \n"
+    header_file += "  /// Number of nuclides in the built-in atomic mass table.\n"
+    header_file += "  const size_t atomic_mass_table_size = {0};\n".format(nmass)
+    header_file += "  /// Nuclides in id form of the built-in atomic mass table, sorted.\n"
+    header_file += "  extern const int atomic_mass_table_nucs[atomic_mass_table_size];\n"
+    header_file += "  /// Atomic masses [amu] of atomic_mass_table_nucs, natural elements\n"
+    header_file += "  /// included.\n"
+    header_file += "  extern const double atomic_mass_table_values[atomic_mass_table_size];\n"
+    header_file += "\n"
+    header_file += "  /// Number of nuclides in the built-in natural abundance table.\n"
+    header_file += "  const size_t natural_abund_table_size = {0};\n".format(nabund)
+    header_file += "  /// Nuclides in id form of the built-in natural abundance table, sorted.\n"
+    header_file += "  extern const int natural_abund_table_nucs[natural_abund_table_size];\n"
+    header_file += "  /// Natural abundances [atom fraction] of natural_abund_table_nucs.\n"
+    header_file += "  extern const double natural_abund_table_values[natural_abund_table_size];\n"
+    header_file += "\n"
+    header_file += "  /// Atomic mass [amu] of \\a nuc in id form from the built-in table, or\n"
+    header_file += "  /// a negative value if it is not there.  Needs no loading or locking.\n"
+    header_file += "  double _atomic_mass_memory(int nuc);\n"
+    header_file += "  /// Natural abundance [atom fraction] of \\a nuc in id form from the\n"
+    header_file += "  /// built-in table, or a negative value if it is not there.\n"
+    header_file += "  double _natural_abund_memory(int nuc);\n"
+    header_file += "  /// Copies the built-in tables into atomic_mass_map and\n"
+    header_file += "  /// natural_abund_map, keeping any entries already there.\n"
     header_file += "  void _load_atomic_mass_map_memory();\n"
-    header_file += "  /// function to create mapping from nuclides in id form\n"
-    header_file += "  /// to their atomic masses\n"
-    header_file += "  \n"
-    header_file += "  void _insert_atomic_mass_map();\n"
-    header_file += "  \n"
-    header_file += "  /// function to create mapping from nuclides in id form \n"
-    header_file += "  /// to their natural abundances\n"
-    header_file += "  void _insert_abund_map();\n"
-    header_file += "  \n"
+    header_file += "\n"
     header_file += "  /// Mapping from nuclides in id form to their natural abundances\n"
     header_file += "  extern std::map<int,double> natural_abund_map;\n"
-    header_file += "  \n"
+    header_file += "\n"
     header_file += "  /// Mapping from nuclides in id form to their atomic masses.\n"
     header_file += "  extern std::map<int,double> atomic_mass_map;\n"
-    header_file += "  \n"
-    header_file += "  /// Mapping from nuclides in id form to the associated error in \n"
-    header_file += "  /// abdundance \n"
+    header_file += "\n"
+    header_file += "  /// Mapping from nuclides in id form to the associated error in\n"
+    header_file += "  /// abdundance\n"
     header_file += "  extern std::map<int,double> atomic_mass_error_map;\n"
     header_file += "} // namespace pyne\n"
+    header_file += "#endif  // PYNE_2MXWDMJ4UBFSTHPZ4QKCEOIQKU\n"
     return header_file
 
 
@@ -94,8 +111,9 @@ def generate_atomic_mass_errors():
 
 
 def generate_atomic_mass():
-    """Generate atomic masses"""
-    atomic_mass = ""
+    """Generate atomic masses, as a dict from nuclides in id form to masses.
+    Later entries for the same nuclide win."""
+    atomic_mass = {}
     amdc_regex = re.compile('[ \d-]*? (\d{1,3})[ ]{1,4}(\d{1,3}) [A-Z][a-z]? .*? '
                             '(\\d{1,3}) ([ #.\d]{5,12}) ([ #.\d]+)[ ]*?$')
     with open(MASS_FILE, 'r') as f:
@@ -105,13 +123,14 @@ def generate_atomic_mass():
                 continue
             nuc = (10000000 * int(m.group(1))) + (10000 * int(m.group(2)))
             mass = float(m.group(3)) + 1E-6 * float(m.group(4).strip().replace('#',''))
-            atomic_mass += "  atomic_mass_map["+str(nuc)+"] = "+str(mass)+";\n"
+            atomic_mass[nuc] = mass
     return atomic_mass
 
 
 def generate_abundances():
-    """Generate abundances"""
-    isotopic_abundances = ""
+    """Generate abundances, as a dict from nuclides in id form to the
+    abundance strings of the data file, in percent."""
+    isotopic_abundances = {}
     with open(ABUN_FILE, 'r') as f:
         for line in f:
             # tokenise the line
@@ -123,67 +142,102 @@ def generate_abundances():
                     # ignore the comment line
             if tokens[0] != "#":
                 tokens[3] = tokens[3].replace("\n","")
-                isotopic_abundances += "  natural_abund_map["+str((int(tokens[0])*10000000)+(int(tokens[2])*10000))+"] = "+str(tokens[3])+";\n"
+                nuc = (int(tokens[0])*10000000)+(int(tokens[2])*10000)
+                isotopic_abundances[nuc] = tokens[3]
     return isotopic_abundances
 
 
-def generate_cpp():
+def element_masses(masses, abundances):
+    """Natural element atomic weights from the isotopic masses and the
+    abundances in percent, for the elements that occur naturally."""
+    weights = {}
+    for nuc, abund in sorted(abundances.items()):
+        z = nuc // 10000000
+        weights[z*10000000] = (weights.get(z*10000000, 0.0) +
+                               float(abund) * masses.get(nuc, 0.0) / 100.0)
+    return dict((nuc, w) for nuc, w in weights.items() if 0.0 < w)
+
+
+def generate_array(ctype, name, values):
+    """A sorted constexpr array definition, wrapped to 80 columns."""
+    lines = []
+    line = " "
+    for v in values:
+        item = " " + v + ","
+        if len(line) + len(item) > 79:
+            lines.append(line)
+            line = " "
+        line += item
+    lines.append(line)
+    array = "constexpr " + ctype + " pyne::" + name + "[" + str(len(values)) + "] = {\n"
+    array += "\n".join(lines) + "\n"
+    array += "};\n"
+    return array
+
+
+def generate_cpp(masses, abundances):
     """Generates the source file."""
+    mass_nucs = sorted(masses)
+    abund_nucs = sorted(abundances)
     cpp_file = AUTOGEN_WARNING
     cpp_file += "// Implements basic nuclear data functions.\n"
     cpp_file += "#ifndef PYNE_IS_AMALGAMATED\n"
     cpp_file += "#include \"atomic_data.h\"\n"
     cpp_file += "#include \"nucname.h\"\n"
     cpp_file += "#endif\n"
-    cpp_file += "  \n"
-    cpp_file += "void pyne::_load_atomic_mass_map_memory() { \n"
-    cpp_file += "  // header version of atomic weight table data \n"
-    cpp_file += "  //see if the data table is already loaded\n"
-    cpp_file += "  if(!atomic_mass_map.empty()) {\n"
-    cpp_file += "    return;\n"
-    cpp_file += "  } else { \n"
-    cpp_file += "    _insert_atomic_mass_map();\n"
-    cpp_file += "  }\n"
-    cpp_file += "  //see if the data table is already loaded\n"
-    cpp_file += "  if(!natural_abund_map.empty()) {\n"
-    cpp_file += "    return;\n"
-    cpp_file += "  } else { \n"
-    cpp_file += "    _insert_abund_map();\n"
-    cpp_file += "  }\n"
-    cpp_file += "  // calculate the atomic_masses of the elements \n"
-    cpp_file += "  std::map<int,double> :: iterator it;\n"
-    cpp_file += "  \n"
-    cpp_file += "  for (int z = 1; z <= 92 ; z++) {\n"
-    cpp_file += "  // loop through the natural abundance map\n"
-    cpp_file += "  double element_atomic_weight = 0.0;\n"
-    cpp_file += "  for (it = natural_abund_map.begin(); it != natural_abund_map.end() ; ++it){\n"
-    cpp_file += "   // if the atomic number of the abudance matches the\n"
-    cpp_file += "   // that of index\n"
-    cpp_file += "   if(pyne::nucname::znum(it->first) == z) {\n"
-    cpp_file += "      // take atomic abundance and multiply by mass\n"
-    cpp_file += "      // to get the mass of that nuclide / 100 since abundance is in %\n"
-    cpp_file += "      element_atomic_weight += (it->second*atomic_mass_map[it->first]/100.0);\n"
-    cpp_file += "    }\n"
-    cpp_file += "  }\n"
-    cpp_file += "  // insert the abundance of the element into the list\n"
-    cpp_file += "  atomic_mass_map[z*10000000] = element_atomic_weight;\n"
-    cpp_file += " }\n"
+    cpp_file += "\n"
+    cpp_file += "#include <algorithm>\n"
+    cpp_file += "\n"
+    cpp_file += "// binary search of a sorted table, negative if nuc is not there\n"
+    cpp_file += "static double _atomic_table_find(const int* nucs, const double* values,\n"
+    cpp_file += "                                 size_t n, int nuc) {\n"
+    cpp_file += "  const int* it = std::lower_bound(nucs, nucs + n, nuc);\n"
+    cpp_file += "  if (it == nucs + n || *it != nuc)\n"
+    cpp_file += "    return -1.0;\n"
+    cpp_file += "  return values[it - nucs];\n"
+    cpp_file += "}\n"
+    cpp_file += "\n"
+    cpp_file += "double pyne::_atomic_mass_memory(int nuc) {\n"
+    cpp_file += "  return _atomic_table_find(atomic_mass_table_nucs,\n"
+    cpp_file += "    atomic_mass_table_values, atomic_mass_table_size, nuc);\n"
     cpp_file += "}\n"
-    cpp_file += "\n\n"
-    cpp_file += "void pyne::_insert_atomic_mass_map() { \n"
-    cpp_file += generate_atomic_mass()
+    cpp_file += "\n"
+    cpp_file += "double pyne::_natural_abund_memory(int nuc) {\n"
+    cpp_file += "  return _atomic_table_find(natural_abund_table_nucs,\n"
+    cpp_file += "    natural_abund_table_values, natural_abund_table_size, nuc);\n"
     cpp_file += "}\n"
-    cpp_file += "\n\n"
-    cpp_file += "void pyne::_insert_abund_map() { \n"
-    cpp_file += generate_abundances()
+    cpp_file += "\n"
+    cpp_file += "void pyne::_load_atomic_mass_map_memory() {\n"
+    cpp_file += "  // the tables are sorted, so every insert goes at the end\n"
+    cpp_file += "  for (size_t i = 0; i < atomic_mass_table_size; ++i)\n"
+    cpp_file += "    atomic_mass_map.insert(atomic_mass_map.end(), std::make_pair(\n"
+    cpp_file += "      atomic_mass_table_nucs[i], atomic_mass_table_values[i]));\n"
+    cpp_file += "  for (size_t i = 0; i < natural_abund_table_size; ++i)\n"
+    cpp_file += "    natural_abund_map.insert(natural_abund_map.end(), std::make_pair(\n"
+    cpp_file += "      natural_abund_table_nucs[i], natural_abund_table_values[i]));\n"
     cpp_file += "}\n"
+    cpp_file += "\n"
+    cpp_file += generate_array("int", "atomic_mass_table_nucs",
+                               [str(nuc) for nuc in mass_nucs])
+    cpp_file += "\n"
+    cpp_file += generate_array("double", "atomic_mass_table_values",
+                               [repr(masses[nuc]) for nuc in mass_nucs])
+    cpp_file += "\n"
+    cpp_file += generate_array("int", "natural_abund_table_nucs",
+                               [str(nuc) for nuc in abund_nucs])
+    cpp_file += "\n"
+    cpp_file += generate_array("double", "natural_abund_table_values",
+                               [abundances[nuc] + "e-2" for nuc in abund_nucs])
     return cpp_file
 
 
 def main(args=()):
     """Entry point for atomic data."""
-    header = generate_header()
-    source = generate_cpp()
+    masses = generate_atomic_mass()
+    abundances = generate_abundances()
+    masses.update(element_masses(masses, abundances))
+    header = generate_header(len(masses), len(abundances))
+    source = generate_cpp(masses, abundances)
     write_if_diff("atomic_data.h", header)
     write_if_diff("atomic_data.cpp", source)
 
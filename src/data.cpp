@@ -4,6 +4,15 @@
 #include "atomic_data.h"
 #endif
 
+#include <stdint.h>
+#include <chrono>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#include <sys/stat.h>
+
 //
 // Math Helpers
 //
@@ -39,20 +48,316 @@ std::map<std::string, std::string> pyne::get_data_checksums() {
 std::map<std::string, std::string> pyne::data_checksums =
   pyne::get_data_checksums();
 
+/***********************************/
+/*** nuc_data snapshot Functions ***/
+/***********************************/
+
+namespace {
+  // Layout of a snapshot file: a header, nblocks directory entries and the
+  // block payloads.  All integers are native endian; the header records
+  // enough of the writer's ABI to reject files from another platform.
+  const char snapshot_magic[8] = {'P', 'Y', 'N', 'E', 'S', 'N', 'P', '\0'};
+  const uint32_t snapshot_version = 2;
+  const uint32_t snapshot_endian = 0x01020304;
+  const size_t snapshot_align = 16;
+
+  struct snapshot_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t nblocks;
+    uint64_t checksum;   // FNV-1a of everything after the header
+    uint64_t file_size;
+    uint32_t size_t_width;
+    uint32_t endian;
+    uint64_t source_size;   // nuc_data.h5 the tables were read from
+    int64_t source_mtime;
+  };
+
+  struct snapshot_entry {
+    char name[48];
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  uint64_t snapshot_fnv1a(const char* data, size_t n, uint64_t h) {
+    for (size_t i = 0; i < n; ++i) {
+      h ^= (unsigned char) data[i];
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+
+  const uint64_t snapshot_fnv1a_basis = 14695981039346656037ULL;
+}
+
+pyne::data_source_stamp pyne::nuc_data_stamp(std::string path) {
+  data_source_stamp stamp = {0, 0};
+  struct stat st;
+  if (stat(path.c_str(), &st) == 0) {
+    stamp.size = (unsigned long long) st.st_size;
+    stamp.mtime = (long long) st.st_mtime;
+  }
+  return stamp;
+}
+
+void pyne::data_snapshot::open(std::string path, bool verify) {
+  close();
+  FILE* f = fopen(path.c_str(), "rb");
+  if (f == NULL)
+    throw pyne::FileNotFound(path);
+  fseek(f, 0, SEEK_END);
+  long flen = ftell(f);
+  if (flen < (long) sizeof(snapshot_header)) {
+    fclose(f);
+    throw InvalidDataSnapshot(path + " is too short to be a nuc_data snapshot");
+  }
+  length = (size_t) flen;
+#ifndef _WIN32
+  fclose(f);
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw pyne::FileNotFound(path);
+  void* m = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (m == MAP_FAILED) {
+    length = 0;
+    throw InvalidDataSnapshot("could not map " + path);
+  }
+  addr = (char*) m;
+  mapped = true;
+#else
+  // no mmap here, read the whole file into 16 byte aligned memory instead
+  addr = (char*) malloc(length + snapshot_align);
+  mapped = false;
+  fseek(f, 0, SEEK_SET);
+  size_t nread = fread(addr, 1, length, f);
+  fclose(f);
+  if (nread != length) {
+    close();
+    throw InvalidDataSnapshot("could not read " + path);
+  }
+#endif
+
+  const snapshot_header* hdr = (const snapshot_header*) addr;
+  std::string err;
+  if (memcmp(hdr->magic, snapshot_magic, sizeof(snapshot_magic)) != 0)
+    err = " is not a nuc_data snapshot";
+  else if (hdr->version != snapshot_version)
+    err = " has an unsupported snapshot version";
+  else if (hdr->endian != snapshot_endian ||
+           hdr->size_t_width != sizeof(size_t))
+    err = " was written on an incompatible platform";
+  else if (hdr->file_size != length ||
+           sizeof(snapshot_header) + hdr->nblocks * sizeof(snapshot_entry) >
+           length)
+    err = " is truncated";
+  else if (verify && hdr->checksum != snapshot_fnv1a(addr +
+           sizeof(snapshot_header), length - sizeof(snapshot_header),
+           snapshot_fnv1a_basis))
+    err = " failed its checksum";
+  if (!err.empty()) {
+    close();
+    throw InvalidDataSnapshot(path + err);
+  }
+
+  const snapshot_entry* dir = (const snapshot_entry*) (addr +
+    sizeof(snapshot_header));
+  for (uint32_t b = 0; b < hdr->nblocks; ++b) {
+    if (dir[b].offset > length || dir[b].size > length - dir[b].offset) {
+      close();
+      throw InvalidDataSnapshot(path + " has a block outside of the file");
+    }
+    std::string name(dir[b].name, strnlen(dir[b].name, sizeof(dir[b].name)));
+    blocks[name] = data_span<char>(addr + dir[b].offset, dir[b].size);
+  }
+}
+
+void pyne::data_snapshot::close() {
+  if (addr != NULL) {
+#ifndef _WIN32
+    if (mapped)
+      munmap(addr, length);
+    else
+      free(addr);
+#else
+    free(addr);
+#endif
+  }
+  addr = NULL;
+  length = 0;
+  mapped = false;
+  blocks.clear();
+}
+
+pyne::data_source_stamp pyne::data_snapshot::source() const {
+  data_source_stamp stamp = {0, 0};
+  if (addr != NULL) {
+    const snapshot_header* hdr = (const snapshot_header*) addr;
+    stamp.size = hdr->source_size;
+    stamp.mtime = hdr->source_mtime;
+  }
+  return stamp;
+}
+
+pyne::data_span<char> pyne::data_snapshot::block(std::string name) const {
+  std::map<std::string, data_span<char> >::const_iterator it =
+    blocks.find(name);
+  if (it == blocks.end())
+    return data_span<char>();
+  return it->second;
+}
+
+void pyne::data_snapshot::write(std::string path,
+const std::vector<data_block>& blocks, const data_source_stamp& source) {
+  snapshot_header hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  memcpy(hdr.magic, snapshot_magic, sizeof(snapshot_magic));
+  hdr.version = snapshot_version;
+  hdr.nblocks = blocks.size();
+  hdr.size_t_width = sizeof(size_t);
+  hdr.endian = snapshot_endian;
+  hdr.source_size = source.size;
+  hdr.source_mtime = source.mtime;
+
+  // lay out the directory, then each payload on an aligned offset
+  std::vector<snapshot_entry> dir(blocks.size());
+  uint64_t pos = sizeof(snapshot_header) + blocks.size() *
+                 sizeof(snapshot_entry);
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    if (blocks[b].name.size() >= sizeof(dir[b].name))
+      throw pyne::ValueError("snapshot block name too long: " + blocks[b].name);
+    memset(&dir[b], 0, sizeof(snapshot_entry));
+    memcpy(dir[b].name, blocks[b].name.c_str(), blocks[b].name.size());
+    pos = (pos + snapshot_align - 1) / snapshot_align * snapshot_align;
+    dir[b].offset = pos;
+    dir[b].size = blocks[b].size;
+    pos += blocks[b].size;
+  }
+  hdr.file_size = pos;
+
+  const char zeros[snapshot_align] = {0};
+  uint64_t h = snapshot_fnv1a((const char*) (dir.empty() ? NULL : &dir[0]),
+                              dir.size() * sizeof(snapshot_entry),
+                              snapshot_fnv1a_basis);
+  pos = sizeof(snapshot_header) + dir.size() * sizeof(snapshot_entry);
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    h = snapshot_fnv1a(zeros, dir[b].offset - pos, h);
+    h = snapshot_fnv1a(blocks[b].data, blocks[b].size, h);
+    pos = dir[b].offset + blocks[b].size;
+  }
+  hdr.checksum = h;
+
+  // write to a temporary name first so readers never see a partial file
+  std::string tmp = path + ".tmp";
+  FILE* f = fopen(tmp.c_str(), "wb");
+  if (f == NULL)
+    throw InvalidDataSnapshot("could not write " + tmp);
+  bool ok = fwrite(&hdr, sizeof(hdr), 1, f) == 1;
+  if (!dir.empty())
+    ok = ok && fwrite(&dir[0], sizeof(snapshot_entry), dir.size(), f) ==
+         dir.size();
+  pos = sizeof(snapshot_header) + dir.size() * sizeof(snapshot_entry);
+  for (size_t b = 0; ok && b < blocks.size(); ++b) {
+    size_t pad = dir[b].offset - pos;
+    ok = pad == 0 || fwrite(zeros, 1, pad, f) == pad;
+    ok = ok && (blocks[b].size == 0 ||
+                fwrite(blocks[b].data, 1, blocks[b].size, f) == blocks[b].size);
+    pos = dir[b].offset + blocks[b].size;
+  }
+  ok = (fclose(f) == 0) && ok;
+  if (!ok || rename(tmp.c_str(), path.c_str()) != 0) {
+    remove(tmp.c_str());
+    throw InvalidDataSnapshot("could not write " + path);
+  }
+}
+
+// The snapshot that loaders consult before falling back to nuc_data.h5.
+static pyne::data_snapshot snapshot;
+
+void pyne::load_data_snapshot(std::string path, bool verify) {
+  if (snapshot.is_open())
+    throw InvalidDataSnapshot("a nuc_data snapshot is already loaded");
+  snapshot.open(path, verify);
+  // without a nuc_data.h5 there is nothing for the snapshot to be stale against
+  data_source_stamp cur = nuc_data_stamp(NUC_DATA_PATH);
+  data_source_stamp src = snapshot.source();
+  if (cur.size != 0 && (cur.size != src.size || cur.mtime != src.mtime)) {
+    snapshot.close();
+    throw InvalidDataSnapshot(path + " was written from a different " +
+                              NUC_DATA_PATH + "; rewrite the snapshot");
+  }
+}
+
+bool pyne::data_snapshot_loaded() {
+  return snapshot.is_open();
+}
+
+// Returns a typed view of a snapshot block, empty if it is missing or if the
+// snapshot is not loaded.
+template<typename T> static pyne::data_span<T> _snapshot_array(
+std::string name) {
+  pyne::data_span<char> b = snapshot.block(name);
+  if (b.size() % sizeof(T) != 0)
+    throw pyne::InvalidDataSnapshot("block " + name + " has the wrong size");
+  return pyne::data_span<T>((const T*) b.data(), b.size() / sizeof(T));
+}
+
+
+// The serial HDF5 library is not thread-safe, so loaders hold this lock while
+// they have nuc_data.h5 open and build their tables after releasing it.
+static std::mutex h5_mutex;
+
+
 /*****************************/
 /*** atomic_mass Functions ***/
 /*****************************/
 std::map<int, double> pyne::atomic_mass_map = std::map<int, double>();
 
+// Every table below is published once through its data_once guard and is
+// read-only afterwards; lookups for missing nuclides compute their fallback
+// guesses on the fly rather than inserting them into the shared maps.
+static pyne::data_once atomic_mass_once;
+// Without nuc_data.h5, lookups go straight to the built-in constexpr tables
+// and the maps are only filled for code that iterates over them.
+static bool atomic_mass_builtin = false;
+static pyne::data_once atomic_mass_builtin_once;
+
+// Picks the source of the atomic mass data, without filling the maps when it
+// is the built-in table.
+static void _ensure_atomic_mass_source() {
+  atomic_mass_once.call(pyne::_load_atomic_mass_map);
+}
+
+void pyne::_ensure_atomic_mass_map() {
+  _ensure_atomic_mass_source();
+  if (atomic_mass_builtin)
+    atomic_mass_builtin_once.call(pyne::_load_atomic_mass_map_memory);
+}
+
 void pyne::_load_atomic_mass_map() {
   // Loads the important parts of atomic_wight table into atomic_mass_map
 
+  // Use the snapshot when one is loaded
+  data_span<int> snap_nucs = _snapshot_array<int>("atomic_mass.nuc");
+  if (!snap_nucs.empty()) {
+    data_span<double> mass = _snapshot_array<double>("atomic_mass.mass");
+    data_span<double> abund = _snapshot_array<double>("atomic_mass.abund");
+    if (mass.size() != snap_nucs.size() || abund.size() != snap_nucs.size())
+      throw InvalidDataSnapshot("atomic_mass columns differ in length");
+    for (size_t n = 0; n < snap_nucs.size(); ++n) {
+      atomic_mass_map.insert(std::make_pair(snap_nucs[n], mass[n]));
+      natural_abund_map.insert(std::make_pair(snap_nucs[n], abund[n]));
+    }
+    return;
+  }
+
   //Check to see if the file is in HDF5 format.
   if (!pyne::file_exists(pyne::NUC_DATA_PATH)) {
-    pyne::_load_atomic_mass_map_memory();
+    atomic_mass_builtin = true;
     return;
   }
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
@@ -79,6 +384,7 @@ void pyne::_load_atomic_mass_map() {
   // close the nuc_data library, before doing anything stupid
   H5Dclose(atomic_mass_set);
   H5Fclose(nuc_data_h5);
+  h5_lock.unlock();
 
   // Ok now that we have the array of structs, put it in the map
   for(int n = 0; n < atomic_mass_length; n++) {
@@ -93,46 +399,32 @@ void pyne::_load_atomic_mass_map() {
 
 
 double pyne::atomic_mass(int nuc) {
-  // Find the nuclide's mass in AMU
-  std::map<int, double>::iterator nuc_iter, nuc_end;
+  // Fill up the map with values from the nuc_data.h5, if it is not loaded.
+  // Don't fail if we can't load the library.
+  _ensure_atomic_mass_source();
 
-  nuc_iter = atomic_mass_map.find(nuc);
-  nuc_end = atomic_mass_map.end();
-
-  // First check if we already have the nuc mass in the map
-  if (nuc_iter != nuc_end) {
-    return (*nuc_iter).second;
-  }
-
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (atomic_mass_map.empty()) {
-    // Don't fail if we can't load the library
-    _load_atomic_mass_map();
-    return atomic_mass(nuc);
+  // Find the nuclide's mass in AMU
+  if (atomic_mass_builtin) {
+    double mass = _atomic_mass_memory(nuc);
+    if (0.0 <= mass)
+      return mass;
+  } else {
+    std::map<int, double>::const_iterator nuc_iter = atomic_mass_map.find(nuc);
+    if (nuc_iter != atomic_mass_map.end())
+      return nuc_iter->second;
   }
 
-  double aw;
   int nucid = nucname::id(nuc);
 
   // If in an excited state, return the ground
   // state mass...not strictly true, but good guess.
-  if (0 < nucid%10000) {
-    aw = atomic_mass((nucid/10000)*10000);
-    if (atomic_mass_map.count(nuc) != 1) {
-      atomic_mass_map.insert(std::pair<int, double>(nuc, aw));
-    }
-    return aw;
-  };
+  if (0 < nucid%10000)
+    return atomic_mass((nucid/10000)*10000);
 
   // Finally, if none of these work,
   // take a best guess based on the
   // aaa number.
-  aw = (double) ((nucid/10000)%1000);
-  if (atomic_mass_map.count(nuc) != 1) {
-    atomic_mass_map.insert(std::pair<int, double>(nuc, aw));
-  }
-  return aw;
+  return (double) ((nucid/10000)%1000);
 }
 
 
@@ -147,6 +439,14 @@ double pyne::atomic_mass(std::string nuc) {
   return atomic_mass(nuc_zz);
 }
 
+std::vector<double> pyne::atomic_mass(const NuclideIndex& index) {
+  std::vector<double> result (index.size(), 0.0);
+  for (int i = 0; i < index.size(); ++i)
+    if (index.nuc(i) >= 0)
+      result[i] = atomic_mass(index.nuc(i));
+  return result;
+}
+
 
 /*******************************/
 /*** natural_abund functions ***/
@@ -155,41 +455,32 @@ double pyne::atomic_mass(std::string nuc) {
 std::map<int, double> pyne::natural_abund_map = std::map<int, double>();
 
 double pyne::natural_abund(int nuc) {
-  // Find the nuclide's natural abundance
-  std::map<int, double>::iterator nuc_iter, nuc_end;
-
-  nuc_iter = natural_abund_map.find(nuc);
-  nuc_end = natural_abund_map.end();
-
-  // First check if we already have the nuc mass in the map
-  if (nuc_iter != nuc_end)
-    return (*nuc_iter).second;
+  // Fill up the map with values from the nuc_data.h5, if it is not loaded.
+  // Don't fail if we can't load the library.
+  _ensure_atomic_mass_source();
 
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (natural_abund_map.empty()) {
-    // Don't fail if we can't load the library
-      _load_atomic_mass_map();
-      return natural_abund(nuc);
+  // Find the nuclide's natural abundance
+  if (atomic_mass_builtin) {
+    double abund = _natural_abund_memory(nuc);
+    if (0.0 <= abund)
+      return abund;
+  } else {
+    std::map<int, double>::const_iterator nuc_iter = natural_abund_map.find(
+      nuc);
+    if (nuc_iter != natural_abund_map.end())
+      return nuc_iter->second;
   }
 
-  double na;
   int nucid = nucname::id(nuc);
 
   // If in an excited state, return the ground
   // state abundance...not strictly true, but good guess.
-  if (0 < nucid%10000) {
-    na = natural_abund((nucid/10000)*10000);
-    natural_abund_map[nuc] = na;
-    return na;
-  }
+  if (0 < nucid%10000)
+    return natural_abund((nucid/10000)*10000);
 
   // Finally, if none of these work,
-  // take a best guess based on the
-  // aaa number.
-  na = 0.0;
-  natural_abund_map[nuc] = na;
-  return na;
+  // assume the nuclide does not occur naturally.
+  return 0.0;
 }
 
 
@@ -213,10 +504,25 @@ double pyne::natural_abund(std::string nuc) {
 void pyne::_load_q_val_map() {
   // Loads the important parts of q_value table into q_value_map
 
+  // Use the snapshot when one is loaded
+  data_span<int> snap_nucs = _snapshot_array<int>("q_values.nuc");
+  if (!snap_nucs.empty()) {
+    data_span<double> q = _snapshot_array<double>("q_values.q_val");
+    data_span<double> gf = _snapshot_array<double>("q_values.gamma_frac");
+    if (q.size() != snap_nucs.size() || gf.size() != snap_nucs.size())
+      throw InvalidDataSnapshot("q_values columns differ in length");
+    for (size_t n = 0; n < snap_nucs.size(); ++n) {
+      q_val_map[snap_nucs[n]] = q[n];
+      gamma_frac_map[snap_nucs[n]] = gf[n];
+    }
+    return;
+  }
+
   //Check to see if the file is in HDF5 format.
   if (!pyne::file_exists(pyne::NUC_DATA_PATH))
     throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
@@ -242,6 +548,7 @@ void pyne::_load_q_val_map() {
   // close the nuc_data library, before doing anything stupid
   H5Dclose(q_val_set);
   H5Fclose(nuc_data_h5);
+  h5_lock.unlock();
 
   // Ok now that we have the array of structs, put it in the map
   for(int n = 0; n < q_val_length; n++) {
@@ -254,32 +561,27 @@ void pyne::_load_q_val_map() {
 
 std::map<int, double> pyne::q_val_map = std::map<int, double>();
 
-double pyne::q_val(int nuc) {
-  // Find the nuclide's q_val in MeV/fission
-  std::map<int, double>::iterator nuc_iter, nuc_end;
+static pyne::data_once q_val_once;
 
-  nuc_iter = q_val_map.find(nuc);
-  nuc_end = q_val_map.end();
+static void _ensure_q_val_map() {
+  q_val_once.call(pyne::_load_q_val_map);
+}
 
-  // First check if we already have the nuc q_val in the map
-  if (nuc_iter != nuc_end)
-    return (*nuc_iter).second;
+double pyne::q_val(int nuc) {
+  // Fill up the map with values from the nuc_data.h5 if it is not loaded.
+  _ensure_q_val_map();
 
-  // Next, fill up the map with values from the nuc_data.h5 if the map is empty.
-  if (q_val_map.empty()) {
-      _load_q_val_map();
-      return q_val(nuc);
-  };
+  // Find the nuclide's q_val in MeV/fission
+  std::map<int, double>::const_iterator nuc_iter = q_val_map.find(nuc);
+  if (nuc_iter != q_val_map.end())
+    return nuc_iter->second;
 
-  double qv;
   int nucid = nucname::id(nuc);
   if (nucid != nuc)
     return q_val(nucid);
 
   // If nuclide is not found, return 0
-  qv = 0.0;
-  q_val_map[nuc] = qv;
-  return qv;
+  return 0.0;
 }
 
 
@@ -302,31 +604,20 @@ double pyne::q_val(std::string nuc) {
 std::map<int, double> pyne::gamma_frac_map = std::map<int, double>();
 
 double pyne::gamma_frac(int nuc) {
-  // Find the nuclide's fraction of Q that comes from gammas
-  std::map<int, double>::iterator nuc_iter, nuc_end;
-
-  nuc_iter = gamma_frac_map.find(nuc);
-  nuc_end = gamma_frac_map.end();
-
-  // First check if we already have the gamma_frac in the map
-  if (nuc_iter != nuc_end)
-    return (*nuc_iter).second;
+  // Fill up the map with values from nuc_data.h5 if it is not loaded.
+  _ensure_q_val_map();
 
-  // Next, fill up the map with values from nuc_data.h5 if the map is empty.
-  if (gamma_frac_map.empty()) {
-      _load_q_val_map();
-      return gamma_frac(nuc);
-  }
+  // Find the nuclide's fraction of Q that comes from gammas
+  std::map<int, double>::const_iterator nuc_iter = gamma_frac_map.find(nuc);
+  if (nuc_iter != gamma_frac_map.end())
+    return nuc_iter->second;
 
-  double gf;
   int nucid = nucname::id(nuc);
   if (nucid != nuc)
     return gamma_frac(nucid);
 
   // If nuclide is not found, return 0
-  gf = 0.0;
-  gamma_frac_map[nucid] = gf;
-  return gf;
+  return 0.0;
 }
 
 
@@ -363,6 +654,7 @@ void pyne::_load_dose_map(std::map<int, dose>& dm, std::string source_path) {
   if (!pyne::file_exists(pyne::NUC_DATA_PATH))
     throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
@@ -408,6 +700,7 @@ void pyne::_load_dose_map(std::map<int, dose>& dm, std::string source_path) {
   H5Dclose(dose_set);
   H5Tclose(string_type_);
   H5Fclose(nuc_data_h5);
+  h5_lock.unlock();
 
   delete[] dose_array;
 }
@@ -429,19 +722,25 @@ std::string source_string(int source) {
   return source_location;
 }
 
-std::map<int, pyne::dose>& dose_source_map(int source) {
+static pyne::data_once dose_once[3];
+
+const std::map<int, pyne::dose>& dose_source_map(int source) {
   std::map<int, pyne::dose>* dm;
+  int i;
   if (source == 1) {
     dm = &pyne::doe_dose_map;
+    i = 1;
   } else if (source == 2) {
     dm = &pyne::genii_dose_map;
+    i = 2;
   } else {
     dm = &pyne::epa_dose_map;
+    i = 0;
   }
-  if (dm->empty()) {
-      std::string source_path = source_string(source);
-      _load_dose_map(*dm, source_path);
-  }
+  std::string source_path = source_string(source);
+  dose_once[i].call([dm, &source_path]() {
+    _load_dose_map(*dm, source_path);
+  });
   return *dm;
 }
 
@@ -456,11 +755,11 @@ std::map<int, pyne::dose> pyne::genii_dose_map;
 
 /// External Air
 double pyne::ext_air_dose(int nuc, int source) {
-  std::map<int, pyne::dose>& dm = dose_source_map(source);
-  int nucid = nucname::id(nuc);
+  const std::map<int, pyne::dose>& dm = dose_source_map(source);
+  std::map<int, pyne::dose>::const_iterator it = dm.find(nucname::id(nuc));
 
-  if (dm.count(nucid)==1) {
-    return dm[nucid].ext_air_dose;
+  if (it != dm.end()) {
+    return it->second.ext_air_dose;
   } else {
     return -1;
   }
@@ -479,11 +778,11 @@ double pyne::ext_air_dose(std::string nuc, int source) {
 
 /// Dose Ratio
 double pyne::dose_ratio(int nuc, int source) {
-  std::map<int, pyne::dose>& dm = dose_source_map(source);
-  int nucid = nucname::id(nuc);
+  const std::map<int, pyne::dose>& dm = dose_source_map(source);
+  std::map<int, pyne::dose>::const_iterator it = dm.find(nucname::id(nuc));
 
-  if (dm.count(nucid)==1) {
-    return dm[nucid].ratio;
+  if (it != dm.end()) {
+    return it->second.ratio;
   } else {
     return -1;
   }
@@ -505,11 +804,11 @@ double pyne::dose_ratio(std::string nuc, int source) {
 ///
 
 double pyne::ext_soil_dose(int nuc, int source) {
-  std::map<int, pyne::dose>& dm = dose_source_map(source);
-  int nucid = nucname::id(nuc);
+  const std::map<int, pyne::dose>& dm = dose_source_map(source);
+  std::map<int, pyne::dose>::const_iterator it = dm.find(nucname::id(nuc));
 
-  if (dm.count(nucid)==1) {
-    return dm[nucid].ext_soil_dose;
+  if (it != dm.end()) {
+    return it->second.ext_soil_dose;
   } else {
     return -1;
   }
@@ -533,11 +832,11 @@ double pyne::ext_soil_dose(std::string nuc, int source) {
 
 /// Ingestion
 double pyne::ingest_dose(int nuc, int source) {
-  std::map<int, pyne::dose>& dm = dose_source_map(source);
-  int nucid = nucname::id(nuc);
+  const std::map<int, pyne::dose>& dm = dose_source_map(source);
+  std::map<int, pyne::dose>::const_iterator it = dm.find(nucname::id(nuc));
 
-  if (dm.count(nucid)==1) {
-    return dm[nucid].ingest_dose;
+  if (it != dm.end()) {
+    return it->second.ingest_dose;
   } else {
     return -1;
   }
@@ -555,11 +854,11 @@ double pyne::ingest_dose(std::string nuc, int source) {
 
 /// Fluid Fraction
 double pyne::dose_fluid_frac(int nuc, int source) {
-  std::map<int, pyne::dose>& dm = dose_source_map(source);
-  int nucid = nucname::id(nuc);
+  const std::map<int, pyne::dose>& dm = dose_source_map(source);
+  std::map<int, pyne::dose>::const_iterator it = dm.find(nucname::id(nuc));
 
-  if (dm.count(nucid)==1) {
-    return dm[nucid].fluid_frac;
+  if (it != dm.end()) {
+    return it->second.fluid_frac;
   } else {
     return -1;
   }
@@ -582,11 +881,11 @@ double pyne::dose_fluid_frac(std::string nuc, int source) {
 
 /// Inhalation
 double pyne::inhale_dose(int nuc, int source) {
-  std::map<int, pyne::dose>& dm = dose_source_map(source);
-  int nucid = nucname::id(nuc);
+  const std::map<int, pyne::dose>& dm = dose_source_map(source);
+  std::map<int, pyne::dose>::const_iterator it = dm.find(nucname::id(nuc));
 
-  if (dm.count(nucid)==1) {
-    return dm[nucid].inhale_dose;
+  if (it != dm.end()) {
+    return it->second.inhale_dose;
   } else {
     return -1;
   }
@@ -604,11 +903,11 @@ double pyne::inhale_dose(std::string nuc, int source) {
 
 /// Lung Model
 std::string pyne::dose_lung_model(int nuc, int source) {
-  std::map<int, pyne::dose>& dm = dose_source_map(source);
-  int nucid = nucname::id(nuc);
+  const std::map<int, pyne::dose>& dm = dose_source_map(source);
+  std::map<int, pyne::dose>::const_iterator it = dm.find(nucname::id(nuc));
 
-  if (dm.count(nucid)==1) {
-    return std::string(1, dm[nucid].lung_mod);
+  if (it != dm.end()) {
+    return std::string(1, it->second.lung_mod);
   } else {
     return "Nada";
   }
@@ -633,6 +932,39 @@ std::map<int, xd_complex_t> pyne::b_coherent_map = std::map<int, xd_complex_t>()
 std::map<int, xd_complex_t> pyne::b_incoherent_map = std::map<int, xd_complex_t>();
 std::map<int, double> pyne::b_map = std::map<int, double>();
 
+static pyne::data_once scattering_lengths_once;
+
+static void _ensure_scattering_lengths() {
+  scattering_lengths_once.call(pyne::_load_scattering_lengths);
+}
+
+// Guesses a scattering length for a nuclide missing from \a bmap, first from
+// a nuclide with the same A-number, then from one with the same Z-number.
+static xd_complex_t _guess_scattering_length(int nuc,
+    const std::map<int, xd_complex_t>& bmap) {
+  int nucid = pyne::nucname::id(nuc);
+  int znum = pyne::nucname::znum(nucid);
+  int anum = pyne::nucname::anum(nucid);
+  std::map<int, xd_complex_t>::const_iterator nuc_iter;
+
+  // Try to find a nuclide with matching A-number
+  for (nuc_iter = bmap.begin(); nuc_iter != bmap.end(); ++nuc_iter)
+    if (anum == pyne::nucname::anum(nuc_iter->first))
+      return nuc_iter->second;
+
+  // Try to find a nuclide with matching Z-number
+  for (nuc_iter = bmap.begin(); nuc_iter != bmap.end(); ++nuc_iter)
+    if (znum == pyne::nucname::znum(nuc_iter->first))
+      return nuc_iter->second;
+
+  // Finally, if none of these work,
+  // just return zero...
+  xd_complex_t b;
+  b.re = 0.0;
+  b.im = 0.0;
+  return b;
+}
+
 
 void pyne::_load_scattering_lengths() {
   // Loads the important parts of atomic_wight table into atomic_mass_map
@@ -642,6 +974,7 @@ void pyne::_load_scattering_lengths() {
   if (!pyne::file_exists(pyne::NUC_DATA_PATH))
     throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
@@ -674,6 +1007,7 @@ void pyne::_load_scattering_lengths() {
   // close the nuc_data library, before doing anything stupid
   status = H5Dclose(scat_len_set);
   status = H5Fclose(nuc_data_h5);
+  h5_lock.unlock();
 
   // Ok now that we have the array of stucts, put it in the maps
   for(int n = 0; n < scat_len_length; n++) {
@@ -692,56 +1026,15 @@ void pyne::_load_scattering_lengths() {
 
 
 xd_complex_t pyne::b_coherent(int nuc) {
-  // Find the nuclide's bound scattering length in cm
-  std::map<int, xd_complex_t>::iterator nuc_iter, nuc_end;
-
-  nuc_iter = b_coherent_map.find(nuc);
-  nuc_end = b_coherent_map.end();
-
-  // First check if we already have the nuc in the map
-  if (nuc_iter != nuc_end)
-    return (*nuc_iter).second;
-
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (b_coherent_map.empty()) {
-    _load_scattering_lengths();
-    return b_coherent(nuc);
-  }
-
-  xd_complex_t bc;
-  int nucid = nucname::id(nuc);
-  int znum = nucname::znum(nucid);
-  int anum = nucname::anum(nucid);
-
-  // Try to find a nuclide with matching A-number
-  nuc_iter = b_coherent_map.begin();
-  while (nuc_iter != nuc_end) {
-    if (anum == nucname::anum((*nuc_iter).first)) {
-      bc = (*nuc_iter).second;
-      b_coherent_map[nuc] = bc;
-      return bc;
-    }
-    nuc_iter++;
-  }
+  // Fill up the map with values from the nuc_data.h5, if it is not loaded.
+  _ensure_scattering_lengths();
 
-  // Try to find a nuclide with matching Z-number
-  nuc_iter = b_coherent_map.begin();
-  while (nuc_iter != nuc_end) {
-    if (znum == nucname::znum((*nuc_iter).first)) {
-      bc = (*nuc_iter).second;
-      b_coherent_map[nuc] = bc;
-      return bc;
-    }
-    nuc_iter++;
-  }
+  // Find the nuclide's bound scattering length in cm
+  std::map<int, xd_complex_t>::const_iterator nuc_iter = b_coherent_map.find(nuc);
+  if (nuc_iter != b_coherent_map.end())
+    return nuc_iter->second;
 
-  // Finally, if none of these work,
-  // just return zero...
-  bc.re = 0.0;
-  bc.im = 0.0;
-  b_coherent_map[nuc] = bc;
-  return bc;
+  return _guess_scattering_length(nuc, b_coherent_map);
 }
 
 
@@ -764,56 +1057,15 @@ xd_complex_t pyne::b_coherent(std::string nuc) {
 
 
 xd_complex_t pyne::b_incoherent(int nuc) {
-  // Find the nuclide's bound inchoherent scattering length in cm
-  std::map<int, xd_complex_t>::iterator nuc_iter, nuc_end;
-
-  nuc_iter = b_incoherent_map.find(nuc);
-  nuc_end = b_incoherent_map.end();
-
-  // First check if we already have the nuc in the map
-  if (nuc_iter != nuc_end)
-    return (*nuc_iter).second;
-
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (b_incoherent_map.empty()) {
-    _load_scattering_lengths();
-    return b_incoherent(nuc);
-  }
-
-  xd_complex_t bi;
-  int nucid = nucname::id(nuc);
-  int znum = nucname::znum(nucid);
-  int anum = nucname::anum(nucid);
-
-  // Try to find a nuclide with matching A-number
-  nuc_iter = b_incoherent_map.begin();
-  while (nuc_iter != nuc_end) {
-    if (anum == nucname::anum((*nuc_iter).first)) {
-      bi = (*nuc_iter).second;
-      b_incoherent_map[nuc] = bi;
-      return bi;
-    }
-    nuc_iter++;
-  }
+  // Fill up the map with values from the nuc_data.h5, if it is not loaded.
+  _ensure_scattering_lengths();
 
-  // Try to find a nuclide with matching Z-number
-  nuc_iter = b_incoherent_map.begin();
-  while (nuc_iter != nuc_end) {
-    if (znum == nucname::znum((*nuc_iter).first)) {
-      bi = (*nuc_iter).second;
-      b_incoherent_map[nuc] = bi;
-      return bi;
-    }
-    nuc_iter++;
-  }
+  // Find the nuclide's bound inchoherent scattering length in cm
+  std::map<int, xd_complex_t>::const_iterator nuc_iter = b_incoherent_map.find(nuc);
+  if (nuc_iter != b_incoherent_map.end())
+    return nuc_iter->second;
 
-  // Finally, if none of these work,
-  // just return zero...
-  bi.re = 0.0;
-  bi.im = 0.0;
-  b_incoherent_map[nuc] = bi;
-  return bi;
+  return _guess_scattering_length(nuc, b_incoherent_map);
 }
 
 
@@ -834,7 +1086,7 @@ xd_complex_t pyne::b_incoherent(std::string nuc) {
 
 double pyne::b(int nuc) {
   // Find the nuclide's bound scattering length in cm
-  std::map<int, double>::iterator nuc_iter, nuc_end;
+  std::map<int, double>::const_iterator nuc_iter, nuc_end;
 
   nuc_iter = b_map.find(nuc);
   nuc_end = b_map.end();
@@ -872,6 +1124,12 @@ double pyne::b(std::string nuc) {
 std::map<std::pair<int, int>, double> pyne::wimsdfpy_data = \
   std::map<std::pair<int, int>, double>();
 
+static pyne::data_once wimsdfpy_once;
+
+static void _ensure_wimsdfpy() {
+  wimsdfpy_once.call(pyne::_load_wimsdfpy);
+}
+
 void pyne::_load_wimsdfpy() {
   herr_t status;
 
@@ -879,6 +1137,7 @@ void pyne::_load_wimsdfpy() {
   if (!pyne::file_exists(pyne::NUC_DATA_PATH))
     throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
@@ -909,6 +1168,7 @@ void pyne::_load_wimsdfpy() {
   // close the nuc_data library, before doing anything stupid
   status = H5Dclose(wimsdfpy_set);
   status = H5Fclose(nuc_data_h5);
+  h5_lock.unlock();
 
   // Ok now that we have the array of stucts, put it in the maps
   for(int n=0; n < wimsdfpy_length; n++) {
@@ -923,6 +1183,12 @@ void pyne::_load_wimsdfpy() {
 std::map<std::pair<int, int>, pyne::ndsfpysub> pyne::ndsfpy_data = \
   std::map<std::pair<int, int>, pyne::ndsfpysub>();
 
+static pyne::data_once ndsfpy_once;
+
+static void _ensure_ndsfpy() {
+  ndsfpy_once.call(pyne::_load_ndsfpy);
+}
+
 void pyne::_load_ndsfpy() {
   herr_t status;
 
@@ -930,6 +1196,7 @@ void pyne::_load_ndsfpy() {
   if (!pyne::file_exists(pyne::NUC_DATA_PATH))
     throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
@@ -970,6 +1237,7 @@ void pyne::_load_ndsfpy() {
   // close the nuc_data library, before doing anything stupid
   status = H5Dclose(ndsfpy_set);
   status = H5Fclose(nuc_data_h5);
+  h5_lock.unlock();
 
   ndsfpysub ndsfpysub_temp;
 
@@ -994,16 +1262,23 @@ double pyne::fpyield(std::pair<int, int> from_to, int source, bool get_error) {
   // Note that this may be expanded eventually to include other
   // sources of fission product data.
 
+  // Fill up the maps with values from the nuc_data.h5, if they are
+  // not loaded.
+  if (source == 0)
+    _ensure_wimsdfpy();
+  else
+    _ensure_ndsfpy();
+
   // Find the parent/child pair branch ratio as a fraction
   if (source == 0) {
-    std::map<std::pair<int, int>, double>::iterator fpy_iter, fpy_end;
+    std::map<std::pair<int, int>, double>::const_iterator fpy_iter, fpy_end;
     fpy_iter = wimsdfpy_data.find(from_to);
     fpy_end = wimsdfpy_data.end();
     if (fpy_iter != fpy_end)
         //if (get_error == true) return 0;
         return (*fpy_iter).second;
   } else {
-    std::map<std::pair<int, int>, ndsfpysub>::iterator fpy_iter, fpy_end;
+    std::map<std::pair<int, int>, ndsfpysub>::const_iterator fpy_iter, fpy_end;
     fpy_iter = ndsfpy_data.find(from_to);
     fpy_end = ndsfpy_data.end();
     if (fpy_iter != fpy_end) {
@@ -1027,22 +1302,9 @@ double pyne::fpyield(std::pair<int, int> from_to, int source, bool get_error) {
     }
   }
 
-
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if ((source == 0 ) && (wimsdfpy_data.empty())) {
-    _load_wimsdfpy();
-    return fpyield(from_to, 0, get_error);
-  }else if (ndsfpy_data.empty()) {
-    _load_ndsfpy();
-    return fpyield(from_to, source, get_error);
-  }
-
   // Finally, if none of these work,
   // assume the value is stable
-  double fpy = 0.0;
-  wimsdfpy_data[from_to] = fpy;
-  return fpy;
+  return 0.0;
 }
 
 double pyne::fpyield(int from_nuc, int to_nuc, int source, bool get_error) {
@@ -1061,6 +1323,90 @@ double pyne::fpyield(std::string from_nuc, std::string to_nuc, int source,
                                      nucname::id(to_nuc)), source, get_error);
 }
 
+// yield matrices, one for WIMSD and one per NDS energy with and without
+// errors
+static pyne::data_once fpyield_matrix_once[7];
+static pyne::fpyield_csr fpyield_matrices[7];
+
+// Appends the (parent, child, yield) triples, which come sorted by parent and
+// then child, to m's rows, dropping zero yields.
+static void _fpyield_csr_add(pyne::fpyield_csr& m, int parent, int child,
+                             double value) {
+  if (value == 0.0)
+    return;
+  if (m.parents.empty() || m.parents.back() != parent) {
+    m.parents.push_back(parent);
+    m.indptr.push_back(m.children.size());
+  }
+  m.children.push_back(child);
+  m.values.push_back(value);
+}
+
+static void _build_fpyield_csr(pyne::fpyield_csr& m, int source,
+                               bool get_error) {
+  if (source == 0) {
+    std::map<std::pair<int, int>, double>::const_iterator it;
+    for (it = pyne::wimsdfpy_data.begin(); it != pyne::wimsdfpy_data.end();
+         ++it)
+      _fpyield_csr_add(m, it->first.first, it->first.second, it->second);
+  } else {
+    std::map<std::pair<int, int>, pyne::ndsfpysub>::const_iterator it;
+    for (it = pyne::ndsfpy_data.begin(); it != pyne::ndsfpy_data.end();
+         ++it) {
+      const pyne::ndsfpysub& y = it->second;
+      double value;
+      if (source == 1)
+        value = get_error ? y.yield_thermal_err : y.yield_thermal;
+      else if (source == 2)
+        value = get_error ? y.yield_fast_err : y.yield_fast;
+      else
+        value = get_error ? y.yield_14MeV_err : y.yield_14MeV;
+      _fpyield_csr_add(m, it->first.first, it->first.second, value);
+    }
+  }
+  m.indptr.push_back(m.children.size());
+
+  // transpose by counting the entries of each product
+  m.products = m.children;
+  std::sort(m.products.begin(), m.products.end());
+  m.products.erase(std::unique(m.products.begin(), m.products.end()),
+                   m.products.end());
+  m.product_indptr.assign(m.products.size() + 1, 0);
+  std::vector<size_t> col (m.children.size());
+  for (size_t k = 0; k < m.children.size(); ++k) {
+    col[k] = std::lower_bound(m.products.begin(), m.products.end(),
+                              m.children[k]) - m.products.begin();
+    ++m.product_indptr[col[k] + 1];
+  }
+  for (size_t j = 0; j < m.products.size(); ++j)
+    m.product_indptr[j + 1] += m.product_indptr[j];
+  m.product_parents.resize(m.children.size());
+  m.entry_of.resize(m.children.size());
+  std::vector<size_t> next (m.product_indptr.begin(),
+                            m.product_indptr.end() - 1);
+  for (size_t i = 0; i < m.parents.size(); ++i)
+    for (size_t k = m.indptr[i]; k < m.indptr[i + 1]; ++k) {
+      size_t pos = next[col[k]]++;
+      m.product_parents[pos] = m.parents[i];
+      m.entry_of[pos] = k;
+    }
+}
+
+const pyne::fpyield_csr& pyne::fpyield_matrix(int source, bool get_error) {
+  if (source < 0 || 3 < source)
+    throw ValueError("fission product yield source must be 0, 1, 2 or 3, not "
+                     + to_str(source));
+  if (source == 0)
+    _ensure_wimsdfpy();
+  else
+    _ensure_ndsfpy();
+  int slot = (source == 0) ? 0 : source + (get_error ? 3 : 0);
+  fpyield_matrix_once[slot].call([slot, source, get_error]() {
+    _build_fpyield_csr(fpyield_matrices[slot], source, get_error);
+  });
+  return fpyield_matrices[slot];
+}
+
 
 /***********************/
 /*** decay functions ***/
@@ -1070,150 +1416,443 @@ double pyne::fpyield(std::string from_nuc, std::string to_nuc, int source,
 // Data access tools
 //
 
-bool pyne::swapmapcompare::operator()(const std::pair<int, double>& lhs,
-const std::pair<int, double>& rhs) const {
-    return lhs.second<rhs.second || (!(rhs.second<lhs.second) &&
-      lhs.first<rhs.first);
+// The guard for the full table of the struct U.
+template<typename U> static pyne::data_once& _data_once() {
+  static pyne::data_once once;
+  return once;
+}
+
+// Loads the table for the struct U from the nuc_data.h5 exactly once.
+template<typename U> static void _ensure_data() {
+  _data_once<U>().call(pyne::_load_data<U>);
+}
+
+// Where a parent-keyed decay table lives in nuc_data.h5, how its rows are
+// described and filtered, and which members the decay_table is keyed on.
+template<typename U> struct decay_source;
+
+template<> struct decay_source<pyne::decay> {
+  typedef int key_type;
+  static const char* path() {return "/decay/decays";};
+  static const char* parent_name() {return "parent";};
+  static size_t parent_offset() {return offsetof(pyne::decay, parent);};
+  static size_t key_offset() {return offsetof(pyne::decay, child);};
+  static bool keep(const pyne::decay&) {return true;};
+  static hid_t desc();
+};
+
+template<> struct decay_source<pyne::gamma> {
+  typedef double key_type;
+  static const char* path() {return "/decay/gammas";};
+  static const char* parent_name() {return "parent_nuc";};
+  static size_t parent_offset() {return offsetof(pyne::gamma, parent_nuc);};
+  static size_t key_offset() {return offsetof(pyne::gamma, energy);};
+  static bool keep(const pyne::gamma& r) {
+    return (r.parent_nuc != 0) && !isnan(r.energy);
+  };
+  static hid_t desc();
+};
+
+template<> struct decay_source<pyne::alpha> {
+  typedef double key_type;
+  static const char* path() {return "/decay/alphas";};
+  static const char* parent_name() {return "from_nuc";};
+  static size_t parent_offset() {return offsetof(pyne::alpha, from_nuc);};
+  static size_t key_offset() {return offsetof(pyne::alpha, energy);};
+  static bool keep(const pyne::alpha& r) {
+    return (r.from_nuc != 0) && !isnan(r.energy);
+  };
+  static hid_t desc();
+};
+
+template<> struct decay_source<pyne::beta> {
+  typedef double key_type;
+  static const char* path() {return "/decay/betas";};
+  static const char* parent_name() {return "from_nuc";};
+  static size_t parent_offset() {return offsetof(pyne::beta, from_nuc);};
+  static size_t key_offset() {return offsetof(pyne::beta, avg_energy);};
+  static bool keep(const pyne::beta& r) {
+    return (r.from_nuc != 0) && !isnan(r.avg_energy);
+  };
+  static hid_t desc();
+};
+
+template<> struct decay_source<pyne::ecbp> {
+  typedef double key_type;
+  static const char* path() {return "/decay/ecbp";};
+  static const char* parent_name() {return "from_nuc";};
+  static size_t parent_offset() {return offsetof(pyne::ecbp, from_nuc);};
+  static size_t key_offset() {return offsetof(pyne::ecbp, avg_energy);};
+  static bool keep(const pyne::ecbp& r) {
+    return (r.from_nuc != 0) && !isnan(r.avg_energy);
+  };
+  static hid_t desc();
+};
+
+static void _check_nuc_data() {
+  //Check to see if the file is in HDF5 format.
+  if (!pyne::file_exists(pyne::NUC_DATA_PATH))
+    throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
+
+  bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
+  if (!ish5)
+    throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
+}
+
+// Reads the whole of U's dataset into \a table.
+template<typename U> static void _read_decay_table(
+pyne::decay_table<U>& table) {
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
+  _check_nuc_data();
+  hid_t desc = decay_source<U>::desc();
+
+  // Open the HDF5 file and the data set
+  hid_t nuc_data_h5 = H5Fopen(pyne::NUC_DATA_PATH.c_str(), H5F_ACC_RDONLY,
+                              H5P_DEFAULT);
+  hid_t data_set = H5Dopen2(nuc_data_h5, decay_source<U>::path(), H5P_DEFAULT);
+  hid_t data_space = H5Dget_space(data_set);
+  int length = H5Sget_simple_extent_npoints(data_space);
+
+  // Read in the data
+  std::vector<U> array(length);
+  if (length > 0)
+    H5Dread(data_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT, &array[0]);
+
+  // close the nuc_data library, before doing anything stupid
+  H5Sclose(data_space);
+  H5Dclose(data_set);
+  H5Fclose(nuc_data_h5);
+  typename pyne::decay_table<U>::layout_type members =
+    pyne::decay_table<U>::layout(desc);
+  H5Tclose(desc);
+  h5_lock.unlock();
+
+  std::vector<U> rows;
+  rows.reserve(length);
+  for (int i = 0; i < length; ++i) {
+    if (decay_source<U>::keep(array[i]))
+      rows.push_back(array[i]);
+  }
+  table.template assign<typename decay_source<U>::key_type>(rows.empty() ?
+    NULL : &rows[0], rows.size(), members, decay_source<U>::parent_offset(),
+    decay_source<U>::key_offset());
+}
+
+//
+// Selective loading
+//
+
+size_t pyne::selective_load_limit = 64;
+
+// Parents of a decay table read on their own, for when only a few are needed.
+// Each parent's rows go into a small table of their own that is never
+// modified or freed afterwards, so views handed out remain valid.
+template<typename U> class decay_parent_store {
+  public:
+    ~decay_parent_store() {
+      typename std::map<int, pyne::decay_table<U>*>::iterator it;
+      for (it = tables.begin(); it != tables.end(); ++it)
+        delete it->second;
+    };
+
+    // The table holding only \a parent's rows, or NULL if not yet read.
+    const pyne::decay_table<U>* find(int parent) {
+      std::lock_guard<std::mutex> lock(mtx);
+      typename std::map<int, pyne::decay_table<U>*>::const_iterator it =
+        tables.find(parent);
+      return it == tables.end() ? NULL : it->second;
+    };
+
+    size_t size() {
+      std::lock_guard<std::mutex> lock(mtx);
+      return tables.size();
+    };
+
+    // Reads the rows of every parent in \a parents that is not yet stored,
+    // selecting them all with one set of hyperslabs.
+    void load(const std::vector<int>& parents) {
+      std::lock_guard<std::mutex> lock(mtx);
+      std::vector<int> missing;
+      for (size_t i = 0; i < parents.size(); ++i)
+        if (tables.count(parents[i]) == 0)
+          missing.push_back(parents[i]);
+      std::sort(missing.begin(), missing.end());
+      missing.erase(std::unique(missing.begin(), missing.end()),
+                    missing.end());
+      if (missing.empty())
+        return;
+
+      std::unique_lock<std::mutex> h5_lock (h5_mutex);
+      _check_nuc_data();
+      hid_t nuc_data_h5 = H5Fopen(pyne::NUC_DATA_PATH.c_str(), H5F_ACC_RDONLY,
+                                  H5P_DEFAULT);
+      if (!h5wrap::path_exists(nuc_data_h5, decay_source<U>::path())) {
+        H5Fclose(nuc_data_h5);
+        throw h5wrap::PathNotFound(pyne::NUC_DATA_PATH,
+                                   decay_source<U>::path());
+      }
+      hid_t data_set = H5Dopen2(nuc_data_h5, decay_source<U>::path(),
+                                H5P_DEFAULT);
+      if (index.empty())
+        index.build(data_set, decay_source<U>::parent_name());
+
+      hid_t file_space = H5Dget_space(data_set);
+      H5Sselect_none(file_space);
+      hsize_t nsel = 0;
+      for (size_t i = 0; i < missing.size(); ++i) {
+        std::pair<size_t, size_t> r = index.runs(missing[i]);
+        for (size_t k = r.first; k < r.second; ++k) {
+          H5Sselect_hyperslab(file_space, H5S_SELECT_OR, &index.starts[k],
+                              NULL, &index.counts[k], NULL);
+          nsel += index.counts[k];
+        }
+      }
+      std::vector<U> array(nsel);
+      if (nsel > 0) {
+        hid_t desc = decay_source<U>::desc();
+        hid_t mem_space = H5Screate_simple(1, &nsel, NULL);
+        H5Dread(data_set, desc, mem_space, file_space, H5P_DEFAULT,
+                &array[0]);
+        H5Sclose(mem_space);
+        H5Tclose(desc);
+      }
+      H5Sclose(file_space);
+      H5Dclose(data_set);
+      H5Fclose(nuc_data_h5);
+      hid_t desc = decay_source<U>::desc();
+      typename pyne::decay_table<U>::layout_type members =
+        pyne::decay_table<U>::layout(desc);
+      H5Tclose(desc);
+      h5_lock.unlock();
+
+      // split the selection by parent, keeping the full table's filter
+      std::map<int, std::vector<U> > by_parent;
+      for (size_t i = 0; i < missing.size(); ++i)
+        by_parent[missing[i]];
+      for (size_t i = 0; i < array.size(); ++i) {
+        int parent = *(const int*) ((const char*) &array[i] +
+                                    decay_source<U>::parent_offset());
+        if (decay_source<U>::keep(array[i]))
+          by_parent[parent].push_back(array[i]);
+      }
+      typename std::map<int, std::vector<U> >::iterator it;
+      for (it = by_parent.begin(); it != by_parent.end(); ++it) {
+        pyne::decay_table<U>* t = new pyne::decay_table<U>();
+        t->template assign<typename decay_source<U>::key_type>(
+          it->second.empty() ? NULL : &it->second[0], it->second.size(),
+          members, decay_source<U>::parent_offset(),
+          decay_source<U>::key_offset());
+        tables[it->first] = t;
+      }
+    };
+
+  private:
+    // CSR map from each parent to the runs of consecutive rows
+    // [starts[k], starts[k] + counts[k]) it occupies in the dataset, built
+    // from the parent column alone the first time the dataset is opened.
+    struct row_index {
+      std::vector<int> parents;
+      std::vector<size_t> offsets;
+      std::vector<hsize_t> starts;
+      std::vector<hsize_t> counts;
+
+      bool empty() const {return offsets.empty();};
+
+      std::pair<size_t, size_t> runs(int parent) const {
+        std::vector<int>::const_iterator it = std::lower_bound(
+          parents.begin(), parents.end(), parent);
+        if (it == parents.end() || *it != parent)
+          return std::make_pair(0, 0);
+        size_t k = it - parents.begin();
+        return std::make_pair(offsets[k], offsets[k+1]);
+      };
+
+      void build(hid_t data_set, const char* parent_name) {
+        hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(int));
+        H5Tinsert(desc, parent_name, 0, H5T_NATIVE_INT);
+        hid_t space = H5Dget_space(data_set);
+        hssize_t n = H5Sget_simple_extent_npoints(space);
+        H5Sclose(space);
+        std::vector<int> column(n);
+        if (n > 0)
+          H5Dread(data_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT, &column[0]);
+        H5Tclose(desc);
+
+        std::vector<std::pair<int, std::pair<hsize_t, hsize_t> > > rs;
+        for (hssize_t i = 0; i < n; ) {
+          hssize_t j = i + 1;
+          while (j < n && column[j] == column[i])
+            ++j;
+          rs.push_back(std::make_pair(column[i], std::make_pair(i, j - i)));
+          i = j;
+        }
+        std::sort(rs.begin(), rs.end());
+        offsets.push_back(0);
+        for (size_t k = 0; k < rs.size(); ++k) {
+          if (parents.empty() || parents.back() != rs[k].first) {
+            if (!parents.empty())
+              offsets.push_back(starts.size());
+            parents.push_back(rs[k].first);
+          }
+          starts.push_back(rs[k].second.first);
+          counts.push_back(rs[k].second.second);
+        }
+        if (!parents.empty())
+          offsets.push_back(starts.size());
+      };
+    };
+
+    std::mutex mtx;
+    row_index index;
+    std::map<int, pyne::decay_table<U>*> tables;
+};
+
+template<typename U> static decay_parent_store<U>& _parent_store() {
+  static decay_parent_store<U> store;
+  return store;
+}
+
+// The table used to answer a query about a single parent.  This is the full
+// table once it is loaded (or can be bound to a snapshot).  Before that,
+// parents are read on their own until selective_load_limit of them have
+// been, after which the full table is loaded instead.
+template<typename U> static const pyne::decay_table<U>& _selective_table(
+int parent, pyne::decay_table<U>& full) {
+  if (!_data_once<U>().loaded() && !snapshot.is_open()) {
+    decay_parent_store<U>& store = _parent_store<U>();
+    const pyne::decay_table<U>* t = store.find(parent);
+    if (t != NULL)
+      return *t;
+    if (store.size() < pyne::selective_load_limit) {
+      store.load(std::vector<int>(1, parent));
+      return *store.find(parent);
+    }
+  }
+  _ensure_data<U>();
+  return full;
+}
+
+template<typename U> static const pyne::decay_table<U>& _parent_table(
+int /*parent*/, pyne::decay_table<U>& full) {
+  _ensure_data<U>();
+  return full;
+}
+
+static const pyne::decay_table<pyne::decay>& _parent_table(int parent,
+pyne::decay_table<pyne::decay>& full) {
+  return _selective_table(parent, full);
+}
+
+static const pyne::decay_table<pyne::gamma>& _parent_table(int parent,
+pyne::decay_table<pyne::gamma>& full) {
+  return _selective_table(parent, full);
+}
+
+static const pyne::decay_table<pyne::alpha>& _parent_table(int parent,
+pyne::decay_table<pyne::alpha>& full) {
+  return _selective_table(parent, full);
+}
+
+static const pyne::decay_table<pyne::beta>& _parent_table(int parent,
+pyne::decay_table<pyne::beta>& full) {
+  return _selective_table(parent, full);
+}
+
+static const pyne::decay_table<pyne::ecbp>& _parent_table(int parent,
+pyne::decay_table<pyne::ecbp>& full) {
+  return _selective_table(parent, full);
+}
+
+template<typename U> static void _load_parents(const std::vector<int>& parents)
+{
+  if (_data_once<U>().loaded() || snapshot.is_open())
+    return;
+  // past the limit, leave it to the first query to load the full table
+  decay_parent_store<U>& store = _parent_store<U>();
+  if (store.size() + parents.size() <= pyne::selective_load_limit)
+    store.load(parents);
+}
+
+void pyne::load_decay_parents(const std::vector<int>& parents) {
+  _load_parents<decay>(parents);
+  _load_parents<gamma>(parents);
+  _load_parents<alpha>(parents);
+  _load_parents<beta>(parents);
+  _load_parents<ecbp>(parents);
 }
 
 template<typename T, typename U> std::vector<T> pyne::data_access(
-double energy_min, double energy_max, size_t valoffset, std::map<std::pair<int,
-double>, U>  &data) {
-  typename std::map<std::pair<int, double>, U, swapmapcompare>::iterator
-    nuc_iter, nuc_end, it;
-  std::map<std::pair<int, double>, U, swapmapcompare> dc(data.begin(),
-    data.end());
-  std::vector<T> result;
+double energy_min, double energy_max, size_t valoffset,
+decay_table<U> &data) {
+  // fill up the table with values from the nuc_data.h5, if it is not loaded.
+  _ensure_data<U>();
   if (energy_max < energy_min){
     double temp = energy_max;
     energy_max = energy_min;
     energy_min = temp;
   }
-  nuc_iter = dc.lower_bound(std::make_pair(0, energy_min));
-  nuc_end = dc.upper_bound(std::make_pair(9999999999, energy_max));
-  T *ret;
-  // First check if we already have the nuc in the map
-  for (it = nuc_iter; it!= nuc_end; ++it){
-    ret = (T *)((char *)&(it->second) + valoffset);
-    result.push_back(*ret);
-  }
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (data.empty())
-  {
-    _load_data<U>();
-    return data_access<T, U>(energy_min, energy_max, valoffset, data);
-  }
+  data_span<size_t> rows = data.key_range(energy_min, energy_max);
+  const T* col = data.template column<T>(valoffset);
+  std::vector<T> result(rows.size());
+  for (size_t i = 0; i < rows.size(); ++i)
+    result[i] = col[rows[i]];
   return result;
 }
 
-template<typename T, typename U> std::vector<T> pyne::data_access(int parent,
-double min, double max, size_t valoffset,
-std::map<std::pair<int, double>, U>  &data) {
-  typename std::map<std::pair<int, double>, U>::iterator nuc_iter, nuc_end, it;
-  std::vector<T> result;
-  nuc_iter = data.lower_bound(std::make_pair(parent,min));
-  nuc_end = data.upper_bound(std::make_pair(parent,max));
-  T *ret;
-  // First check if we already have the nuc in the map
-  for (it = nuc_iter; it!= nuc_end; ++it){
-    ret = (T *)((char *)&(it->second) + valoffset);
-    result.push_back(*ret);
-  }
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (data.empty())
-  {
-    _load_data<U>();
-    return data_access<T, U>(parent, min, max, valoffset, data);
-  }
-  return result;
+template<typename T, typename U> pyne::data_span<T> pyne::data_access(
+int parent, size_t valoffset, decay_table<U> &data) {
+  return _parent_table(parent, data).template column<T>(parent, valoffset);
 }
 
 template<typename T, typename U> T pyne::data_access(std::pair<int, int>
-from_to, size_t valoffset, std::map<std::pair<int, int>, U> &data) {
-  typename std::map<std::pair<int, int>, U>::iterator nuc_iter, nuc_end;
-
-  nuc_iter = data.find(from_to);
-  nuc_end = data.end();
-  T *ret;
-  // First check if we already have the nuc in the map
-  if (nuc_iter != nuc_end){
-    ret = (T *)((char *)&(nuc_iter->second) + valoffset);
-    return *ret;
-  }
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (data.empty())
-  {
-    _load_data<U>();
-    return data_access<T, U>(from_to, valoffset, data);
-  }
+from_to, size_t valoffset, decay_table<U> &data) {
+  const decay_table<U>& table = _parent_table(from_to.first, data);
+  size_t row = table.find(from_to.first, from_to.second);
   // This is okay for now because we only return ints and doubles
-  return 0;
-}
-
-template<typename T, typename U> std::vector<T> pyne::data_access(int parent,
-size_t valoffset, std::map<std::pair<int, int>, U> &data){
-  typename std::map<std::pair<int, int>, U>::iterator nuc_iter, nuc_end, it;
-  std::vector<T> result;
-  nuc_iter = data.lower_bound(std::make_pair(parent,0));
-  nuc_end = data.upper_bound(std::make_pair(parent,9999999999));
-  T *ret;
-  // First check if we already have the nuc in the map
-  for (it = nuc_iter; it!= nuc_end; ++it){
-    ret = (T *)((char *)&(it->second) + valoffset);
-    result.push_back(*ret);
-  }
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (data.empty())
-  {
-    _load_data<U>();
-    return data_access<T, U>(parent, valoffset, data);
-  }
+  if (row == decay_table<U>::npos)
+    return 0;
+  return table.template column<T>(valoffset)[row];
+}
+
+// Pairs up two columns of a parent's rows with a single index lookup.
+template<typename T, typename U> static std::vector<std::pair<T, T> >
+  data_access_pairs(int parent, size_t first, size_t second,
+                    pyne::decay_table<U> &data) {
+  const pyne::decay_table<U>& table = _parent_table(parent, data);
+  std::pair<size_t, size_t> rows = table.rows(parent);
+  const T* a = table.template column<T>(first);
+  const T* b = table.template column<T>(second);
+  std::vector<std::pair<T, T> > result;
+  result.reserve(rows.second - rows.first);
+  for (size_t i = rows.first; i < rows.second; ++i)
+    result.push_back(std::make_pair(a[i], b[i]));
   return result;
 }
 
-template<typename T, typename U> std::vector<T> pyne::data_access(int parent,
-size_t valoffset, std::map<std::pair<int, unsigned int>, U> &data){
-  typename std::map<std::pair<int, unsigned int>, U>::iterator nuc_iter,
-   nuc_end, it;
-  std::vector<T> result;
-  nuc_iter = data.lower_bound(std::make_pair(parent,0));
-  nuc_end = data.upper_bound(std::make_pair(parent,UINT_MAX));
-  T *ret;
-  // First check if we already have the nuc in the map
-  for (it = nuc_iter; it!= nuc_end; ++it){
-    ret = (T *)((char *)&(it->second) + valoffset);
-    result.push_back(*ret);
-  }
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (data.empty())
-  {
-    _load_data<U>();
-    return data_access<T, U>(parent, valoffset, data);
-  }
+// Pairs up two columns of the rows whose key lies in [emin, emax].
+template<typename T, typename U> static std::vector<std::pair<T, T> >
+  data_access_pairs(double energy_min, double energy_max, size_t first,
+                    size_t second, pyne::decay_table<U> &data) {
+  _ensure_data<U>();
+  if (energy_max < energy_min)
+    std::swap(energy_min, energy_max);
+  pyne::data_span<size_t> rows = data.key_range(energy_min, energy_max);
+  const T* a = data.template column<T>(first);
+  const T* b = data.template column<T>(second);
+  std::vector<std::pair<T, T> > result;
+  result.reserve(rows.size());
+  for (size_t i = 0; i < rows.size(); ++i)
+    result.push_back(std::make_pair(a[rows[i]], b[rows[i]]));
   return result;
 }
 
 template<typename U> double pyne::data_access(int nuc,
 size_t valoffset, std::map<int, U> &data){
-  typename std::map<int, U>::iterator nuc_iter,
-   nuc_end;
-  nuc_iter = data.find(nuc);
-  nuc_end = data.end();
-  // First check if we already have the nuc in the map
-  if (nuc_iter != nuc_end){
-    return *(double *)((char *)&(nuc_iter->second) + valoffset);
-  }
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if (data.empty())
-  {
-    _load_data<U>();
-    return data_access<U>(nuc, valoffset, data);
+  // fill up the map with values from the nuc_data.h5, if it is not loaded.
+  _ensure_data<U>();
+  typename std::map<int, U>::const_iterator nuc_iter = data.find(nuc);
+  if (nuc_iter != data.end()){
+    return *(const double *)((const char *)&(nuc_iter->second) + valoffset);
   }
   throw pyne::nucname::NotANuclide(nuc, "");
 }
@@ -1229,10 +1868,18 @@ template<> void pyne::_load_data<pyne::atomic>() {
   // Loads the atomic table into memory
   herr_t status;
 
+  data_span<atomic> snap_rows = _snapshot_array<atomic>("atomic.rows");
+  if (!snap_rows.empty()) {
+    for (size_t i = 0; i < snap_rows.size(); ++i)
+      atomic_data_map[snap_rows[i].z] = snap_rows[i];
+    return;
+  }
+
   //Check to see if the file is in HDF5 format.
   if (!pyne::file_exists(pyne::NUC_DATA_PATH))
     throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
@@ -1308,6 +1955,7 @@ template<> void pyne::_load_data<pyne::atomic>() {
   // close the nuc_data library, before doing anything stupid
   status = H5Dclose(atomic_set);
   status = H5Fclose(nuc_data_h5);
+  h5_lock.unlock();
 
   for (int i = 0; i < atomic_length; ++i) {
       atomic_data_map[atomic_array[i].z] = atomic_array[i];
@@ -1361,9 +2009,8 @@ std::vector<std::pair<double, double> >
 // Load level data
 //
 
-std::map<std::pair<int,double>, pyne::level_data> pyne::level_data_lvl_map;
-std::map<std::pair<int,unsigned int>,
-  pyne::level_data> pyne::level_data_rx_map;
+pyne::decay_table<pyne::level_data> pyne::level_data_lvl_map;
+pyne::decay_table<pyne::level_data> pyne::level_data_rx_map;
 
 
 template<> void pyne::_load_data<pyne::level_data>()
@@ -1372,10 +2019,17 @@ template<> void pyne::_load_data<pyne::level_data>()
   // Loads the level table into memory
   herr_t status;
 
+  if (level_data_lvl_map.bind("levels", snapshot)) {
+    if (!level_data_rx_map.bind("level_rxs", snapshot))
+      throw InvalidDataSnapshot("snapshot holds levels without level_rxs");
+    return;
+  }
+
   //Check to see if the file is in HDF5 format.
   if (!pyne::file_exists(pyne::NUC_DATA_PATH))
     throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
@@ -1413,16 +2067,23 @@ template<> void pyne::_load_data<pyne::level_data>()
   status = H5Dclose(level_set);
   status = H5Fclose(nuc_data_h5);
 
+  std::vector<level_data> lvl_rows, rx_rows;
   for (int i = 0; i < level_length; ++i) {
     if (level_array[i].rx_id == 0)
-      level_data_lvl_map[std::make_pair(level_array[i].nuc_id,
-                                        level_array[i].level)] = level_array[i];
+      lvl_rows.push_back(level_array[i]);
     else
-      level_data_rx_map[std::make_pair(level_array[i].nuc_id,
-                                       level_array[i].rx_id)] = level_array[i];
+      rx_rows.push_back(level_array[i]);
   }
-
   delete[] level_array;
+
+  level_data_lvl_map.assign<double>(lvl_rows.empty() ? NULL : &lvl_rows[0],
+    lvl_rows.size(), desc, offsetof(level_data, nuc_id),
+    offsetof(level_data, level));
+  level_data_rx_map.assign<unsigned int>(rx_rows.empty() ? NULL : &rx_rows[0],
+    rx_rows.size(), desc, offsetof(level_data, nuc_id),
+    offsetof(level_data, rx_id));
+  H5Tclose(desc);
+  h5_lock.unlock();
 }
 
 //
@@ -1430,25 +2091,25 @@ template<> void pyne::_load_data<pyne::level_data>()
 //
 int pyne::id_from_level(int nuc, double level, std::string special) {
   int nostate = (nuc / 10000) * 10000;
-  if (level_data_lvl_map.empty()) {
-    _load_data<level_data>();
-  }
-
-  std::map<std::pair<int, double>, level_data>::iterator nuc_lower, nuc_upper;
-
-  nuc_lower = level_data_lvl_map.lower_bound(std::make_pair(nostate, 0.0));
-  nuc_upper = level_data_lvl_map.upper_bound(std::make_pair(nostate+9999,
-                                             DBL_MAX));
+  _ensure_data<level_data>();
+
+  std::pair<size_t, size_t> rows = level_data_lvl_map.rows(nostate,
+                                                          nostate+9999);
+  const int* nuc_ids = level_data_lvl_map.column<int>(offsetof(level_data,
+                                                               nuc_id));
+  const double* levels = level_data_lvl_map.column<double>(offsetof(
+    level_data, level));
+  const char* specials = level_data_lvl_map.column<char>(offsetof(level_data,
+                                                                  special));
   double minv = DBL_MAX;
   //by default return input nuc_id with level stripped
   int ret_id = nuc;
-  for (std::map<std::pair<int, double>, level_data>::iterator it=nuc_lower;
-       it!=nuc_upper; ++it) {
-    if ((std::abs(level - it->second.level) < minv) &&
-    ((char)it->second.special == special.c_str()[0]) &&
-    !isnan(it->second.level)) {
-      minv = std::abs(level - it->second.level);
-      ret_id = it->second.nuc_id;
+  for (size_t i = rows.first; i < rows.second; ++i) {
+    if ((std::abs(level - levels[i]) < minv) &&
+    (specials[i] == special.c_str()[0]) &&
+    !isnan(levels[i])) {
+      minv = std::abs(level - levels[i]);
+      ret_id = nuc_ids[i];
     }
   }
   // This value was chosen so important transitions in U-235 are not missed
@@ -1468,19 +2129,17 @@ int pyne::id_from_level(int nuc, double level){
 int pyne::metastable_id(int nuc, int m) {
   int nostate = (nuc / 10000) * 10000;
   if (m==0) return nostate;
-  if (level_data_lvl_map.empty()) {
-    _load_data<level_data>();
-  }
-
-  std::map<std::pair<int, double>, level_data>::iterator nuc_lower, nuc_upper;
-
-  nuc_lower = level_data_lvl_map.lower_bound(std::make_pair(nostate, 0.0));
-  nuc_upper = level_data_lvl_map.upper_bound(std::make_pair(nostate+9999,
-                                                            DBL_MAX));
-  for (std::map<std::pair<int, double>, level_data>::iterator it=nuc_lower;
-  it!=nuc_upper; ++it) {
-    if (it->second.metastable == m)
-        return it->second.nuc_id;
+  _ensure_data<level_data>();
+
+  std::pair<size_t, size_t> rows = level_data_lvl_map.rows(nostate,
+                                                          nostate+9999);
+  const int* nuc_ids = level_data_lvl_map.column<int>(offsetof(level_data,
+                                                               nuc_id));
+  const int* metastables = level_data_lvl_map.column<int>(offsetof(
+    level_data, metastable));
+  for (size_t i = rows.first; i < rows.second; ++i) {
+    if (metastables[i] == m)
+        return nuc_ids[i];
   }
 
   return -1;
@@ -1497,12 +2156,11 @@ int pyne::metastable_id(int nuc) {
 
 std::set<int> pyne::decay_children(int nuc) {
   // make sure spontaneous fission data is loaded
-  if (wimsdfpy_data.empty())
-    _load_wimsdfpy();
+  _ensure_wimsdfpy();
 
-  std::vector<unsigned int> part = data_access<unsigned int, level_data>(nuc,
+  data_span<unsigned int> part = data_access<unsigned int, level_data>(nuc,
     offsetof(level_data, rx_id), level_data_rx_map);
-  std::vector<unsigned int>::iterator it = part.begin();
+  const unsigned int* it = part.begin();
   std::set<int> result;
   for (; it != part.end(); ++it) {
     switch (*it) {
@@ -1516,10 +2174,12 @@ std::set<int> pyne::decay_children(int nuc) {
       {
         // spontaneous fission, rx == 'sf', 36565
         // beta- & spontaneous fission, rx == 'b-sf', 1794828612
-        std::map<std::pair<int, int>, double>::iterator sf = wimsdfpy_data.begin();
-        for (; sf != wimsdfpy_data.end(); ++sf)
-          if (sf->first.first == nuc)
-            result.insert(sf->first.second);
+        // the map is ordered by parent, so nuc's products are contiguous
+        std::map<std::pair<int, int>, double>::const_iterator sf =
+          wimsdfpy_data.lower_bound(std::make_pair(nuc,
+            std::numeric_limits<int>::min()));
+        for (; sf != wimsdfpy_data.end() && sf->first.first == nuc; ++sf)
+          result.insert(sf->first.second);
         break;
       }
       default: {
@@ -1546,8 +2206,8 @@ std::set<int> pyne::decay_children(std::string nuc)
 
 double pyne::state_energy(int nuc)
 {
-  std::vector<double> result = data_access<double, level_data>(nuc, 0.0,
-  DBL_MAX, offsetof(level_data, level), level_data_lvl_map);
+  data_span<double> result = data_access<double, level_data>(nuc,
+    offsetof(level_data, level), level_data_lvl_map);
   if (result.size() == 1)
     return result[0]/1000.0;
   return 0.0;
@@ -1571,8 +2231,8 @@ double pyne::state_energy(std::string nuc)
 
 double pyne::decay_const(int nuc)
 {
-    std::vector<double> result = data_access<double, level_data>(nuc, 0.0,
-      DBL_MAX, offsetof(level_data, half_life), level_data_lvl_map);
+    data_span<double> result = data_access<double, level_data>(nuc,
+      offsetof(level_data, half_life), level_data_lvl_map);
     if (result.size() == 1) {
         return log(2.0)/result[0];
     }
@@ -1592,12 +2252,21 @@ double pyne::decay_const(std::string nuc) {
 }
 
 
+std::vector<double> pyne::decay_const(const NuclideIndex& index) {
+  std::vector<double> result (index.size(), 0.0);
+  for (int i = 0; i < index.size(); ++i)
+    if (index.nuc(i) >= 0)
+      result[i] = decay_const(index.nuc(i));
+  return result;
+}
+
+
 //
 // Half-life data
 //
 double pyne::half_life(int nuc) {
-    std::vector<double> result = data_access<double, level_data>(nuc, 0.0,
-    DBL_MAX, offsetof(level_data, half_life), level_data_lvl_map);
+    data_span<double> result = data_access<double, level_data>(nuc,
+      offsetof(level_data, half_life), level_data_lvl_map);
     if (result.size() == 1) {
         return result[0];
     }
@@ -1623,19 +2292,18 @@ double pyne::branch_ratio(std::pair<int, int> from_to) {
   using std::vector;
   using pyne::nucname::groundstate;
   // make sure spontaneous fission data is loaded
-  if (wimsdfpy_data.empty())
-    _load_wimsdfpy();
+  _ensure_wimsdfpy();
 
-  vector<unsigned int> part1 = \
+  data_span<unsigned int> part1 = \
     data_access<unsigned int, level_data>(from_to.first, offsetof(level_data, rx_id),
                                           level_data_rx_map);
-  vector<double> part2 = \
+  data_span<double> part2 = \
     data_access<double, level_data>(from_to.first, offsetof(level_data, branch_ratio),
                                     level_data_rx_map);
   double result = 0.0;
   if ((from_to.first == from_to.second) && (decay_const(from_to.first) == 0.0))
     return 1.0;
-  for (vector<unsigned int>::size_type i = 0; i < part1.size(); ++i) {
+  for (size_t i = 0; i < part1.size(); ++i) {
     if ((part1[i] == 36125) &&
         (groundstate(from_to.first) == groundstate(from_to.second)) &&
         (from_to.second % 10000 == 0)) {
@@ -1645,7 +2313,10 @@ double pyne::branch_ratio(std::pair<int, int> from_to) {
     } else if (part1[i] == 36565 || part1[i] == 1794828612) {
       // spontaneous fission, rx == 'sf', 36565
       // beta- & spontaneous fission, rx == 'b-sf', 1794828612
-      result += part2[i] * 0.01 * wimsdfpy_data[from_to];
+      std::map<std::pair<int, int>, double>::const_iterator sf =
+        wimsdfpy_data.find(from_to);
+      if (sf != wimsdfpy_data.end())
+        result += part2[i] * 0.01 * sf->second;
     } else if ((part1[i] != 0) && (groundstate(rxname::child(from_to.first,
                                    part1[i], "decay")) == from_to.second)) {
       result += part2[i] * 0.01;
@@ -1669,77 +2340,46 @@ double pyne::branch_ratio(std::string from_nuc, std::string to_nuc) {
                                           nucname::id(to_nuc)));
 }
 
-std::map<std::pair<int, int>, pyne::decay> pyne::decay_data = \
-  std::map<std::pair<int, int>, pyne::decay>();
+pyne::decay_table<pyne::decay> pyne::decay_data;
+
+hid_t decay_source<pyne::decay>::desc() {
+  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(pyne::decay));
+  H5Tinsert(desc, "parent", HOFFSET(pyne::decay, parent),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "child", HOFFSET(pyne::decay, child),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "decay", HOFFSET(pyne::decay, decay),
+            H5T_NATIVE_UINT);
+  H5Tinsert(desc, "half_life", HOFFSET(pyne::decay, half_life),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "half_life_error", HOFFSET(pyne::decay,
+            half_life_error), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "branch_ratio", HOFFSET(pyne::decay, branch_ratio),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "branch_ratio_error", HOFFSET(pyne::decay, branch_ratio_error),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "photon_branch_ratio", HOFFSET(pyne::decay,
+            photon_branch_ratio), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "photon_branch_ratio_err", HOFFSET(pyne::decay,
+            photon_branch_ratio_error), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "beta_branch_ratio", HOFFSET(pyne::decay,
+            beta_branch_ratio), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "beta_branch_ratio_err", HOFFSET(pyne::decay,
+            beta_branch_ratio_error), H5T_NATIVE_DOUBLE);
+  return desc;
+}
 
 template<> void pyne::_load_data<pyne::decay>() {
-
   // Loads the decay table into memory
-  herr_t status;
-
-  //Check to see if the file is in HDF5 format.
-  if (!pyne::file_exists(pyne::NUC_DATA_PATH))
-    throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
-
-  bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
-  if (!ish5)
-    throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
-
-  // Get the HDF5 compound type (table) description
-  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(decay));
-  status = H5Tinsert(desc, "parent", HOFFSET(decay, parent),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "child", HOFFSET(decay, child),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "decay", HOFFSET(decay, decay),
-                     H5T_NATIVE_UINT);
-  status = H5Tinsert(desc, "half_life", HOFFSET(decay, half_life),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "half_life_error", HOFFSET(decay,
-                     half_life_error), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "branch_ratio", HOFFSET(decay, branch_ratio),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "branch_ratio_error", HOFFSET(decay, branch_ratio_error),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "photon_branch_ratio", HOFFSET(decay,
-                     photon_branch_ratio), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "photon_branch_ratio_err", HOFFSET(decay,
-                     photon_branch_ratio_error), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "beta_branch_ratio", HOFFSET(decay,
-                     beta_branch_ratio), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "beta_branch_ratio_err", HOFFSET(decay,
-                     beta_branch_ratio_error), H5T_NATIVE_DOUBLE);
-
-  // Open the HDF5 file
-  hid_t nuc_data_h5 = H5Fopen(pyne::NUC_DATA_PATH.c_str(), H5F_ACC_RDONLY,
-                              H5P_DEFAULT);
-
-  // Open the data set
-  hid_t decay_set = H5Dopen2(nuc_data_h5, "/decay/decays", H5P_DEFAULT);
-  hid_t decay_space = H5Dget_space(decay_set);
-  int decay_length = H5Sget_simple_extent_npoints(decay_space);
-
-  // Read in the data
-  decay * decay_array = new decay[decay_length];
-  status = H5Dread(decay_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                   decay_array);
-
-  // close the nuc_data library, before doing anything stupid
-  status = H5Dclose(decay_set);
-  status = H5Fclose(nuc_data_h5);
-
-  for (int i = 0; i < decay_length; ++i) {
-    decay_data[std::make_pair(decay_array[i].parent, decay_array[i].child)] = \
-      decay_array[i];
-  }
-  delete[] decay_array;
+  if (decay_data.bind("decays", snapshot))
+    return;
+  _read_decay_table(decay_data);
 }
 
 
 std::vector<int> pyne::decay_data_children(int parent) {
-  std::vector<int> result = data_access<int, decay>(parent,
-    offsetof(decay, child), decay_data);
-  return result;
+  return data_access<int, decay>(parent, offsetof(decay, child),
+    decay_data).to_vector();
 }
 
 std::pair<double, double> pyne::decay_half_life(std::pair<int, int> from_to){
@@ -1749,15 +2389,8 @@ std::pair<double, double> pyne::decay_half_life(std::pair<int, int> from_to){
 }
 
 std::vector<std::pair<double, double> >pyne::decay_half_lifes(int parent) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, decay>(parent,
-    offsetof(decay, half_life), decay_data);
-  std::vector<double> part2 = data_access<double, decay>(parent,
+  return data_access_pairs<double, decay>(parent, offsetof(decay, half_life),
     offsetof(decay, half_life_error), decay_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
 }
 
 std::pair<double, double> pyne::decay_branch_ratio(std::pair<int, int> from_to) {
@@ -1768,7 +2401,7 @@ std::pair<double, double> pyne::decay_branch_ratio(std::pair<int, int> from_to)
 
 std::vector<double> pyne::decay_branch_ratios(int parent) {
   return data_access<double, decay>(parent, offsetof(decay,
-    branch_ratio), decay_data);
+    branch_ratio), decay_data).to_vector();
 }
 
 std::pair<double, double> pyne::decay_photon_branch_ratio(std::pair<int,int>
@@ -1781,15 +2414,9 @@ from_to) {
 
 std::vector<std::pair<double, double> >pyne::decay_photon_branch_ratios(
 int parent) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, decay>(parent,
-    offsetof(decay, photon_branch_ratio), decay_data);
-  std::vector<double> part2 = data_access<double, decay>(parent,
+  return data_access_pairs<double, decay>(parent,
+    offsetof(decay, photon_branch_ratio),
     offsetof(decay, photon_branch_ratio_error), decay_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
 }
 
 std::pair<double, double> pyne::decay_beta_branch_ratio(std::pair<int,int>
@@ -1802,206 +2429,110 @@ from_to) {
 
 std::vector<std::pair<double, double> >pyne::decay_beta_branch_ratios(
 int parent) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, decay>(parent,
-    offsetof(decay, beta_branch_ratio), decay_data);
-  std::vector<double> part2 = data_access<double, decay>(parent,
+  return data_access_pairs<double, decay>(parent,
+    offsetof(decay, beta_branch_ratio),
     offsetof(decay, beta_branch_ratio_error), decay_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
 }
 
-std::map<std::pair<int, double>, pyne::gamma> pyne::gamma_data;
+pyne::decay_table<pyne::gamma> pyne::gamma_data;
+
+hid_t decay_source<pyne::gamma>::desc() {
+  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(pyne::gamma));
+  H5Tinsert(desc, "from_nuc", HOFFSET(pyne::gamma, from_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "to_nuc", HOFFSET(pyne::gamma, to_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "parent_nuc", HOFFSET(pyne::gamma, parent_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "child_nuc", HOFFSET(pyne::gamma, child_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "energy", HOFFSET(pyne::gamma, energy),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "energy_err", HOFFSET(pyne::gamma, energy_err),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "photon_intensity", HOFFSET(pyne::gamma,
+            photon_intensity), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "photon_intensity_err", HOFFSET(pyne::gamma,
+            photon_intensity_err), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "conv_intensity", HOFFSET(pyne::gamma,
+            conv_intensity), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "conv_intensity_err", HOFFSET(pyne::gamma,
+            conv_intensity_err), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "total_intensity", HOFFSET(pyne::gamma,
+            total_intensity), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "total_intensity_err", HOFFSET(pyne::gamma,
+            total_intensity_err), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "k_conv_e", HOFFSET(pyne::gamma, k_conv_e),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "l_conv_e", HOFFSET(pyne::gamma, l_conv_e),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "m_conv_e", HOFFSET(pyne::gamma, m_conv_e),
+            H5T_NATIVE_DOUBLE);
+  return desc;
+}
 
 template<> void pyne::_load_data<pyne::gamma>() {
-
   // Loads the gamma table into memory
-  herr_t status;
-
-  //Check to see if the file is in HDF5 format.
-  if (!pyne::file_exists(pyne::NUC_DATA_PATH))
-    throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
-
-  bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
-  if (!ish5)
-    throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
-
-  // Get the HDF5 compound type (table) description
-  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(gamma));
-  status = H5Tinsert(desc, "from_nuc", HOFFSET(gamma, from_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "to_nuc", HOFFSET(gamma, to_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "parent_nuc", HOFFSET(gamma, parent_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "child_nuc", HOFFSET(gamma, child_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "energy", HOFFSET(gamma, energy),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "energy_err", HOFFSET(gamma, energy_err),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "photon_intensity", HOFFSET(gamma,
-                     photon_intensity), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "photon_intensity_err", HOFFSET(gamma,
-                     photon_intensity_err), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "conv_intensity", HOFFSET(gamma,
-                     conv_intensity), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "conv_intensity_err", HOFFSET(gamma,
-                     conv_intensity_err), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "total_intensity", HOFFSET(gamma,
-                     total_intensity), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "total_intensity_err", HOFFSET(gamma,
-                     total_intensity_err), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "k_conv_e", HOFFSET(gamma, k_conv_e),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "l_conv_e", HOFFSET(gamma, l_conv_e),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "m_conv_e", HOFFSET(gamma, m_conv_e),
-                     H5T_NATIVE_DOUBLE);
-
-
-  // Open the HDF5 file
-  hid_t nuc_data_h5 = H5Fopen(pyne::NUC_DATA_PATH.c_str(), H5F_ACC_RDONLY,
-                              H5P_DEFAULT);
-
-  // Open the data set
-  hid_t gamma_set = H5Dopen2(nuc_data_h5, "/decay/gammas", H5P_DEFAULT);
-  hid_t gamma_space = H5Dget_space(gamma_set);
-  int gamma_length = H5Sget_simple_extent_npoints(gamma_space);
-
-  // Read in the data
-  gamma * gamma_array = new gamma[gamma_length];
-  status = H5Dread(gamma_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                   gamma_array);
-
-  // close the nuc_data library, before doing anything stupid
-  status = H5Dclose(gamma_set);
-  status = H5Fclose(nuc_data_h5);
-
-  for (int i = 0; i < gamma_length; ++i) {
-    if ((gamma_array[i].parent_nuc != 0) && !isnan(gamma_array[i].energy))
-      gamma_data[std::make_pair(gamma_array[i].parent_nuc,
-        gamma_array[i].energy)] = gamma_array[i];
-  }
-  delete[] gamma_array;
+  if (gamma_data.bind("gammas", snapshot))
+    return;
+  _read_decay_table(gamma_data);
 }
 
 std::vector<std::pair<double, double> > pyne::gamma_energy(int parent) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, energy), gamma_data);
-  std::vector<double> part2 = data_access<double, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, energy_err), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
+  return data_access_pairs<double, gamma>(parent, offsetof(gamma, energy),
+    offsetof(gamma, energy_err), gamma_data);
 }
 
 std::vector<std::pair<double, double> > pyne::gamma_energy(double energy,
 double error) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, gamma>(energy+error,
-    energy-error, offsetof(gamma, energy), gamma_data);
-  std::vector<double> part2 = data_access<double, gamma>(energy+error,
-    energy-error, offsetof(gamma, energy_err), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
+  return data_access_pairs<double, gamma>(energy+error, energy-error,
+    offsetof(gamma, energy), offsetof(gamma, energy_err), gamma_data);
 }
 
 std::vector<std::pair<double, double> > pyne::gamma_photon_intensity(
 int parent) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, photon_intensity), gamma_data);
-  std::vector<double> part2 = data_access<double, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, photon_intensity_err), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
+  return data_access_pairs<double, gamma>(parent,
+    offsetof(gamma, photon_intensity), offsetof(gamma, photon_intensity_err),
+    gamma_data);
 }
 
 std::vector<std::pair<double, double> > pyne::gamma_photon_intensity(
 double energy, double error) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, gamma>(energy+error,
-    energy-error, offsetof(gamma, photon_intensity), gamma_data);
-  std::vector<double> part2 = data_access<double, gamma>(energy+error,
-    energy-error, offsetof(gamma, photon_intensity_err), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
+  return data_access_pairs<double, gamma>(energy+error, energy-error,
+    offsetof(gamma, photon_intensity), offsetof(gamma, photon_intensity_err),
+    gamma_data);
 }
 
 std::vector<std::pair<double, double> > pyne::gamma_conversion_intensity(
 int parent) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, conv_intensity), gamma_data);
-  std::vector<double> part2 = data_access<double, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, conv_intensity_err), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
+  return data_access_pairs<double, gamma>(parent,
+    offsetof(gamma, conv_intensity), offsetof(gamma, conv_intensity_err),
+    gamma_data);
 }
 
 std::vector<std::pair<double, double> > pyne::gamma_total_intensity(
 int parent) {
-  std::vector<std::pair<double, double> > result;
-  std::vector<double> part1 = data_access<double, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, total_intensity), gamma_data);
-  std::vector<double> part2 = data_access<double, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, total_intensity_err), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
+  return data_access_pairs<double, gamma>(parent,
+    offsetof(gamma, total_intensity), offsetof(gamma, total_intensity_err),
+    gamma_data);
 }
 
 std::vector<std::pair<int, int> > pyne::gamma_from_to(int parent) {
-  std::vector<std::pair<int, int> > result;
-  std::vector<int> part1 = data_access<int, gamma>(parent, 0.0, DBL_MAX,
-    offsetof(gamma, from_nuc), gamma_data);
-  std::vector<int> part2 = data_access<int, gamma>(parent, 0.0, DBL_MAX,
+  return data_access_pairs<int, gamma>(parent, offsetof(gamma, from_nuc),
     offsetof(gamma, to_nuc), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
 }
 
 std::vector<std::pair<int, int> > pyne::gamma_from_to(double energy,
 double error) {
-  std::vector<std::pair<int, int> > result;
-  std::vector<int> part1 = data_access<int, gamma>(energy+error,
-    energy-error, offsetof(gamma, from_nuc), gamma_data);
-  std::vector<int> part2 = data_access<int, gamma>(energy+error,
-    energy-error, offsetof(gamma, to_nuc), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
+  return data_access_pairs<int, gamma>(energy+error, energy-error,
+    offsetof(gamma, from_nuc), offsetof(gamma, to_nuc), gamma_data);
 }
 
 
 std::vector<std::pair<int, int> > pyne::gamma_parent_child(double energy,
 double error) {
-  std::vector<std::pair<int, int> > result;
-  std::vector<int> part1 = data_access<int, gamma>(energy+error,
-    energy-error, offsetof(gamma, parent_nuc), gamma_data);
-  std::vector<int> part2 = data_access<int, gamma>(energy+error,
-    energy-error, offsetof(gamma, child_nuc), gamma_data);
-  for(int i = 0; i < part1.size(); ++i){
-    result.push_back(std::make_pair(part1[i],part2[i]));
-  }
-  return result;
+  return data_access_pairs<int, gamma>(energy+error, energy-error,
+    offsetof(gamma, parent_nuc), offsetof(gamma, child_nuc), gamma_data);
 }
 
 std::vector<int> pyne::gamma_parent(double energy, double error) {
@@ -2015,19 +2546,19 @@ std::vector<int> pyne::gamma_child(double energy, double error) {
 }
 
 std::vector<int> pyne::gamma_child(int parent) {
-  return data_access<int, gamma>(parent, 0.0, DBL_MAX,
-  offsetof(gamma, child_nuc), gamma_data);
+  return data_access<int, gamma>(parent, offsetof(gamma, child_nuc),
+    gamma_data).to_vector();
 }
 
 std::vector<std::pair<double, double> > pyne::gamma_xrays(int parent) {
   std::vector<std::pair<double, double> > result;
   std::vector<std::pair<double, double> > temp;
-  std::vector<double> k_list = data_access<double, gamma>(parent, 0.0, DBL_MAX,
+  data_span<double> k_list = data_access<double, gamma>(parent,
     offsetof(gamma, k_conv_e), gamma_data);
-  std::vector<double> l_list = data_access<double, gamma>(parent, 0.0, DBL_MAX,
+  data_span<double> l_list = data_access<double, gamma>(parent,
     offsetof(gamma, l_conv_e), gamma_data);
-  std::vector<int> children = data_access<int, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, from_nuc), gamma_data);
+  data_span<int> children = data_access<int, gamma>(parent,
+    offsetof(gamma, from_nuc), gamma_data);
   std::vector<int> decay_children = decay_data_children(parent);
   std::vector<std::pair<double, double> > decay_br =
     decay_photon_branch_ratios(parent);
@@ -2058,66 +2589,35 @@ std::vector<std::pair<double, double> > pyne::gamma_xrays(int parent) {
   return result;
 }
 
-std::map<std::pair<int, double>, pyne::alpha> pyne::alpha_data;
+pyne::decay_table<pyne::alpha> pyne::alpha_data;
 
-template<> void pyne::_load_data<pyne::alpha>() {
+hid_t decay_source<pyne::alpha>::desc() {
+  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(pyne::alpha));
+  H5Tinsert(desc, "from_nuc", HOFFSET(pyne::alpha, from_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "to_nuc", HOFFSET(pyne::alpha, to_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "energy", HOFFSET(pyne::alpha, energy),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "intensity", HOFFSET(pyne::alpha, intensity),
+            H5T_NATIVE_DOUBLE);
+  return desc;
+}
 
+template<> void pyne::_load_data<pyne::alpha>() {
   // Loads the alpha table into memory
-  herr_t status;
-
-  //Check to see if the file is in HDF5 format.
-  if (!pyne::file_exists(pyne::NUC_DATA_PATH))
-    throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
-
-  bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
-  if (!ish5)
-    throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
-
-  // Get the HDF5 compound type (table) description
-  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(alpha));
-  status = H5Tinsert(desc, "from_nuc", HOFFSET(alpha, from_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "to_nuc", HOFFSET(alpha, to_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "energy", HOFFSET(alpha, energy),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "intensity", HOFFSET(alpha, intensity),
-                     H5T_NATIVE_DOUBLE);
-
-
-  // Open the HDF5 file
-  hid_t nuc_data_h5 = H5Fopen(pyne::NUC_DATA_PATH.c_str(), H5F_ACC_RDONLY,
-                              H5P_DEFAULT);
-
-  // Open the data set
-  hid_t alpha_set = H5Dopen2(nuc_data_h5, "/decay/alphas", H5P_DEFAULT);
-  hid_t alpha_space = H5Dget_space(alpha_set);
-  int alpha_length = H5Sget_simple_extent_npoints(alpha_space);
-
-  // Read in the data
-  alpha * alpha_array = new alpha[alpha_length];
-  status = H5Dread(alpha_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT,
-                   alpha_array);
-
-  // close the nuc_data library, before doing anything stupid
-  status = H5Dclose(alpha_set);
-  status = H5Fclose(nuc_data_h5);
-
-  for (int i = 0; i < alpha_length; ++i) {
-    if ((alpha_array[i].from_nuc != 0) && !isnan(alpha_array[i].energy))
-      alpha_data[std::make_pair(alpha_array[i].from_nuc, alpha_array[i].energy)]
-        = alpha_array[i];
-  }
-  delete[] alpha_array;
+  if (alpha_data.bind("alphas", snapshot))
+    return;
+  _read_decay_table(alpha_data);
 }
 
 std::vector<double > pyne::alpha_energy(int parent){
-  return data_access<double, alpha>(parent, 0.0, DBL_MAX,
-                     offsetof(alpha,energy), alpha_data);
+  return data_access<double, alpha>(parent,
+                     offsetof(alpha,energy), alpha_data).to_vector();
 }
 std::vector<double> pyne::alpha_intensity(int parent){
-  return data_access<double, alpha>(parent, 0.0, DBL_MAX,
-                     offsetof(alpha,intensity), alpha_data);
+  return data_access<double, alpha>(parent,
+                     offsetof(alpha,intensity), alpha_data).to_vector();
 }
 
 std::vector<int> pyne::alpha_parent(double energy, double error) {
@@ -2131,77 +2631,47 @@ std::vector<int> pyne::alpha_child(double energy, double error) {
 }
 
 std::vector<int> pyne::alpha_child(int parent){
-  return data_access<int, alpha>(parent, 0.0, DBL_MAX,
-                     offsetof(alpha, to_nuc), alpha_data);
+  return data_access<int, alpha>(parent,
+                     offsetof(alpha, to_nuc), alpha_data).to_vector();
 }
 
-std::map<std::pair<int, double>, pyne::beta> pyne::beta_data;
+pyne::decay_table<pyne::beta> pyne::beta_data;
 
-template<> void pyne::_load_data<pyne::beta>() {
+hid_t decay_source<pyne::beta>::desc() {
+  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(pyne::beta));
+  H5Tinsert(desc, "endpoint_energy", HOFFSET(pyne::beta,
+            endpoint_energy), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "avg_energy", HOFFSET(pyne::beta, avg_energy),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "intensity", HOFFSET(pyne::beta, intensity),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "from_nuc", HOFFSET(pyne::beta, from_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "to_nuc", HOFFSET(pyne::beta, to_nuc),
+            H5T_NATIVE_INT);
+  return desc;
+}
 
+template<> void pyne::_load_data<pyne::beta>() {
   // Loads the beta table into memory
-  herr_t status;
-
-  //Check to see if the file is in HDF5 format.
-  if (!pyne::file_exists(pyne::NUC_DATA_PATH))
-    throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
-
-  bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
-  if (!ish5)
-    throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
-
-  // Get the HDF5 compound type (table) description
-  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(beta));
-  status = H5Tinsert(desc, "endpoint_energy", HOFFSET(beta,
-                     endpoint_energy), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "avg_energy", HOFFSET(beta, avg_energy),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "intensity", HOFFSET(beta, intensity),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "from_nuc", HOFFSET(beta, from_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "to_nuc", HOFFSET(beta, to_nuc),
-                     H5T_NATIVE_INT);
-
-
-  // Open the HDF5 file
-  hid_t nuc_data_h5 = H5Fopen(pyne::NUC_DATA_PATH.c_str(), H5F_ACC_RDONLY,
-                              H5P_DEFAULT);
-
-  // Open the data set
-  hid_t beta_set = H5Dopen2(nuc_data_h5, "/decay/betas", H5P_DEFAULT);
-  hid_t beta_space = H5Dget_space(beta_set);
-  int beta_length = H5Sget_simple_extent_npoints(beta_space);
-
-  // Read in the data
-  beta * beta_array = new beta[beta_length];
-  status = H5Dread(beta_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT, beta_array);
-
-  // close the nuc_data library, before doing anything stupid
-  status = H5Dclose(beta_set);
-  status = H5Fclose(nuc_data_h5);
-
-  for (int i = 0; i < beta_length; ++i) {
-    if ((beta_array[i].from_nuc != 0) && !isnan(beta_array[i].avg_energy))
-      beta_data[std::make_pair(beta_array[i].from_nuc, beta_array[i].avg_energy)]
-        = beta_array[i];
-  }
-  delete[] beta_array;
+  if (beta_data.bind("betas", snapshot))
+    return;
+  _read_decay_table(beta_data);
 }
 
 std::vector<double > pyne::beta_endpoint_energy(int parent){
-  return data_access<double, beta>(parent, 0.0, DBL_MAX,
-                     offsetof(beta, endpoint_energy), beta_data);
+  return data_access<double, beta>(parent,
+                     offsetof(beta, endpoint_energy), beta_data).to_vector();
 }
 
 std::vector<double > pyne::beta_average_energy(int parent){
-  return data_access<double, beta>(parent, 0.0, DBL_MAX,
-                     offsetof(beta, avg_energy), beta_data);
+  return data_access<double, beta>(parent,
+                     offsetof(beta, avg_energy), beta_data).to_vector();
 }
 
 std::vector<double> pyne::beta_intensity(int parent){
-  return data_access<double, beta>(parent, 0.0, DBL_MAX,
-                     offsetof(beta, intensity), beta_data);
+  return data_access<double, beta>(parent,
+                     offsetof(beta, intensity), beta_data).to_vector();
 }
 
 std::vector<int> pyne::beta_parent(double energy, double error) {
@@ -2215,90 +2685,61 @@ std::vector<int> pyne::beta_child(double energy, double error) {
 }
 
 std::vector<int> pyne::beta_child(int parent){
-  return data_access<int, beta>(parent, 0.0, DBL_MAX,
-                     offsetof(beta, to_nuc),beta_data);
+  return data_access<int, beta>(parent,
+                     offsetof(beta, to_nuc), beta_data).to_vector();
+}
+
+
+pyne::decay_table<pyne::ecbp> pyne::ecbp_data;
+
+hid_t decay_source<pyne::ecbp>::desc() {
+  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(pyne::ecbp));
+  H5Tinsert(desc, "from_nuc", HOFFSET(pyne::ecbp, from_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "to_nuc", HOFFSET(pyne::ecbp, to_nuc),
+            H5T_NATIVE_INT);
+  H5Tinsert(desc, "endpoint_energy", HOFFSET(pyne::ecbp,
+            endpoint_energy),H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "avg_energy", HOFFSET(pyne::ecbp, avg_energy),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "beta_plus_intensity", HOFFSET(pyne::ecbp,
+            beta_plus_intensity), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "ec_intensity", HOFFSET(pyne::ecbp, ec_intensity),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "k_conv_e", HOFFSET(pyne::ecbp, k_conv_e),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "l_conv_e", HOFFSET(pyne::ecbp, l_conv_e),
+            H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "m_conv_e", HOFFSET(pyne::ecbp, m_conv_e),
+            H5T_NATIVE_DOUBLE);
+  return desc;
 }
 
-
-std::map<std::pair<int, double>, pyne::ecbp> pyne::ecbp_data;
-
 template<> void pyne::_load_data<pyne::ecbp>() {
-
   // Loads the ecbp table into memory
-  herr_t status;
-
-  //Check to see if the file is in HDF5 format.
-  if (!pyne::file_exists(pyne::NUC_DATA_PATH))
-    throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
-
-  bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
-  if (!ish5)
-    throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
-
-  // Get the HDF5 compound type (table) description
-  hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(ecbp));
-  status = H5Tinsert(desc, "from_nuc", HOFFSET(ecbp, from_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "to_nuc", HOFFSET(ecbp, to_nuc),
-                     H5T_NATIVE_INT);
-  status = H5Tinsert(desc, "endpoint_energy", HOFFSET(ecbp,
-                     endpoint_energy),H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "avg_energy", HOFFSET(ecbp, avg_energy),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "beta_plus_intensity", HOFFSET(ecbp,
-                     beta_plus_intensity), H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "ec_intensity", HOFFSET(ecbp, ec_intensity),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "k_conv_e", HOFFSET(ecbp, k_conv_e),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "l_conv_e", HOFFSET(ecbp, l_conv_e),
-                     H5T_NATIVE_DOUBLE);
-  status = H5Tinsert(desc, "m_conv_e", HOFFSET(ecbp, m_conv_e),
-                     H5T_NATIVE_DOUBLE);
-
-  // Open the HDF5 file
-  hid_t nuc_data_h5 = H5Fopen(pyne::NUC_DATA_PATH.c_str(), H5F_ACC_RDONLY,
-                              H5P_DEFAULT);
-
-  // Open the data set
-  hid_t ecbp_set = H5Dopen2(nuc_data_h5, "/decay/ecbp", H5P_DEFAULT);
-  hid_t ecbp_space = H5Dget_space(ecbp_set);
-  int ecbp_length = H5Sget_simple_extent_npoints(ecbp_space);
-
-  // Read in the data
-  ecbp * ecbp_array = new ecbp[ecbp_length];
-  status = H5Dread(ecbp_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT, ecbp_array);
-
-  // close the nuc_data library, before doing anything stupid
-  status = H5Dclose(ecbp_set);
-  status = H5Fclose(nuc_data_h5);
-
-  for (int i = 0; i < ecbp_length; ++i) {
-    if ((ecbp_array[i].from_nuc != 0) && !isnan(ecbp_array[i].avg_energy))
-      ecbp_data[std::make_pair(ecbp_array[i].from_nuc, ecbp_array[i].avg_energy)]
-        = ecbp_array[i];
-  }
-  delete[] ecbp_array;
+  if (ecbp_data.bind("ecbps", snapshot))
+    return;
+  _read_decay_table(ecbp_data);
 }
 
 std::vector<double > pyne::ecbp_endpoint_energy(int parent){
-  return data_access<double, ecbp>(parent, 0.0, DBL_MAX,
-                     offsetof(ecbp,endpoint_energy), ecbp_data);
+  return data_access<double, ecbp>(parent,
+                     offsetof(ecbp,endpoint_energy), ecbp_data).to_vector();
 }
 
 std::vector<double > pyne::ecbp_average_energy(int parent){
-  return data_access<double, ecbp>(parent, 0.0, DBL_MAX,
-                     offsetof(ecbp, avg_energy), ecbp_data);
+  return data_access<double, ecbp>(parent,
+                     offsetof(ecbp, avg_energy), ecbp_data).to_vector();
 }
 
 std::vector<double> pyne::ec_intensity(int parent){
-  return data_access<double, ecbp>(parent, 0.0, DBL_MAX,
-                     offsetof(ecbp, ec_intensity), ecbp_data);
+  return data_access<double, ecbp>(parent,
+                     offsetof(ecbp, ec_intensity), ecbp_data).to_vector();
 }
 
 std::vector<double> pyne::bp_intensity(int parent){
-  return data_access<double, ecbp>(parent, 0.0, DBL_MAX,
-                     offsetof(ecbp, beta_plus_intensity), ecbp_data);
+  return data_access<double, ecbp>(parent,
+                     offsetof(ecbp, beta_plus_intensity), ecbp_data).to_vector();
 }
 
 std::vector<int> pyne::ecbp_parent(double energy, double error) {
@@ -2312,18 +2753,18 @@ std::vector<int> pyne::ecbp_child(double energy, double error) {
 }
 
 std::vector<int> pyne::ecbp_child(int parent){
-  return data_access<int, ecbp>(parent, 0.0, DBL_MAX,
-                     offsetof(ecbp, to_nuc), ecbp_data);
+  return data_access<int, ecbp>(parent,
+                     offsetof(ecbp, to_nuc), ecbp_data).to_vector();
 }
 
 std::vector<std::pair<double, double> > pyne::ecbp_xrays(int parent) {
   std::vector<std::pair<double, double> > result;
   std::vector<std::pair<double, double> > temp;
-  std::vector<double> k_list = data_access<double, ecbp>(parent, 0.0, DBL_MAX,
+  data_span<double> k_list = data_access<double, ecbp>(parent,
     offsetof(ecbp, k_conv_e), ecbp_data);
-  std::vector<double> l_list = data_access<double, ecbp>(parent, 0.0, DBL_MAX,
+  data_span<double> l_list = data_access<double, ecbp>(parent,
     offsetof(ecbp, l_conv_e), ecbp_data);
-  std::vector<int> children = data_access<int, ecbp>(parent, 0.0, DBL_MAX,
+  data_span<int> children = data_access<int, ecbp>(parent,
     offsetof(ecbp, to_nuc), ecbp_data);
   std::vector<int> decay_children = decay_data_children(parent);
   std::vector<std::pair<double, double> > decay_br =
@@ -2424,11 +2865,11 @@ std::vector<std::pair<double, double> > pyne::xrays(int parent) {
   double decay_c = decay_const(parent);
   std::vector<std::pair<double, double> > result;
   std::vector<std::pair<double, double> > temp;
-  std::vector<double> k_list = data_access<double, ecbp>(parent, 0.0, DBL_MAX,
+  data_span<double> k_list = data_access<double, ecbp>(parent,
     offsetof(ecbp, k_conv_e), ecbp_data);
-  std::vector<double> l_list = data_access<double, ecbp>(parent, 0.0, DBL_MAX,
+  data_span<double> l_list = data_access<double, ecbp>(parent,
     offsetof(ecbp, l_conv_e), ecbp_data);
-  std::vector<int> children = data_access<int, ecbp>(parent, 0.0, DBL_MAX,
+  data_span<int> children = data_access<int, ecbp>(parent,
                      offsetof(ecbp, to_nuc), ecbp_data);
   std::vector<int> decay_children = decay_data_children(parent);
   std::vector<std::pair<double, double> > decay_br =
@@ -2457,12 +2898,12 @@ std::vector<std::pair<double, double> > pyne::xrays(int parent) {
       }
     }
   }
-  std::vector<double> gk_list = data_access<double, gamma>(parent, 0.0, DBL_MAX,
+  data_span<double> gk_list = data_access<double, gamma>(parent,
     offsetof(gamma, k_conv_e), gamma_data);
-  std::vector<double> gl_list = data_access<double, gamma>(parent, 0.0, DBL_MAX,
+  data_span<double> gl_list = data_access<double, gamma>(parent,
     offsetof(gamma, l_conv_e), gamma_data);
-  std::vector<int> gchildren = data_access<int, gamma>(parent, 0.0,
-    DBL_MAX, offsetof(gamma, from_nuc), gamma_data);
+  data_span<int> gchildren = data_access<int, gamma>(parent,
+    offsetof(gamma, from_nuc), gamma_data);
   std::vector<std::pair<double, double> > decay_nrbr =
     decay_photon_branch_ratios(parent);
   for(int i = 0; i < gk_list.size(); ++i){
@@ -2519,34 +2960,33 @@ typedef struct simple_xs {
 
 std::map<std::string, std::map<int, std::map<int, double> > > pyne::simple_xs_map;
 
-// loads the simple cross section data for the specified energy band from
-// the nuc_data.h5 file into memory.
-static void _load_simple_xs_map(std::string energy) {
+// names of the simple_xs groups, in simple_xs_group order
+static const char* simple_xs_group_names[pyne::SIMPLE_XS_NGROUPS] = {
+  "thermal", "thermal_maxwell_ave", "resonance_integral", "fourteen_MeV",
+  "fission_spectrum_ave"};
+
+// Dense copy of the simple_xs tables.  Row i of each group holds the cross
+// sections of nucs[i], with one column per reaction in rxs order.
+static struct {
+  std::vector<int> nucs;
+  std::vector<unsigned int> rxs;
+  std::vector<size_t> rx_offsets;  // offset of each rxs member in simple_xs
+  std::vector<double> xs[pyne::SIMPLE_XS_NGROUPS];
+  std::vector<char> has_nuc[pyne::SIMPLE_XS_NGROUPS];
+} dense_simple_xs;
+
+// reads the simple cross section table for the specified energy band from
+// the nuc_data.h5 file.
+static std::vector<simple_xs> _read_simple_xs(std::string energy) {
   //Check to see if the file is in HDF5 format.
   if (!pyne::file_exists(pyne::NUC_DATA_PATH))
     throw pyne::FileNotFound(pyne::NUC_DATA_PATH);
 
+  std::unique_lock<std::mutex> h5_lock (h5_mutex);
   bool ish5 = H5Fis_hdf5(pyne::NUC_DATA_PATH.c_str());
   if (!ish5)
     throw h5wrap::FileNotHDF5(pyne::NUC_DATA_PATH);
 
-  using pyne::rxname::id;
-  std::map<unsigned int, size_t> rxns;
-  rxns[id("tot")] = offsetof(simple_xs, sigma_t);
-  rxns[id("scat")] = offsetof(simple_xs, sigma_s);
-  rxns[id("elas")] = offsetof(simple_xs, sigma_e);
-  rxns[id("inel")] = offsetof(simple_xs, sigma_i);
-  rxns[id("abs")] = offsetof(simple_xs, sigma_a);
-  rxns[id("gamma")] = offsetof(simple_xs, sigma_gamma);
-  rxns[id("fiss")] = offsetof(simple_xs, sigma_f);
-  rxns[id("alpha")] = offsetof(simple_xs, sigma_alpha);
-  rxns[id("proton")] = offsetof(simple_xs, sigma_proton);
-  rxns[id("deut")] = offsetof(simple_xs, sigma_deut);
-  rxns[id("trit")] = offsetof(simple_xs, sigma_trit);
-  rxns[id("z_2n")] = offsetof(simple_xs, sigma_2n);
-  rxns[id("z_3n")] = offsetof(simple_xs, sigma_3n);
-  rxns[id("z_4n")] = offsetof(simple_xs, sigma_4n);
-
   // Get the HDF5 compound type (table) description
   hid_t desc = H5Tcreate(H5T_COMPOUND, sizeof(simple_xs));
   H5Tinsert(desc, "nuc",   HOFFSET(simple_xs, nuc),   H5T_NATIVE_INT);
@@ -2577,48 +3017,156 @@ static void _load_simple_xs_map(std::string energy) {
   int n = H5Sget_simple_extent_npoints(simple_xs_space);
 
   // Read in the data
-  simple_xs* array = new simple_xs[n];
-  H5Dread(simple_xs_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT, array);
+  std::vector<simple_xs> rows(n);
+  if (n > 0)
+    H5Dread(simple_xs_set, desc, H5S_ALL, H5S_ALL, H5P_DEFAULT, &rows[0]);
 
   // close the nuc_data library, before doing anything stupid
+  H5Sclose(simple_xs_space);
   H5Dclose(simple_xs_set);
   H5Fclose(nuc_data_h5);
+  H5Tclose(desc);
+  h5_lock.unlock();
+  return rows;
+}
 
-  // Ok now that we have the array of stucts, put it in the map
-  for(int i = 0; i < n; i++) {
-    std::map<unsigned int, size_t>::iterator it;
-    for (it = rxns.begin(); it != rxns.end(); ++it) {
-      double xs = *(double*)((char*)&array[i] + it->second);
-      pyne::simple_xs_map[energy][array[i].nuc][it->first] = xs;
+// loads the simple cross section data for every energy band into the dense
+// table and simple_xs_map.
+static void _load_simple_xs() {
+  using pyne::rxname::id;
+  std::map<unsigned int, size_t> rxns;
+  rxns[id("tot")] = offsetof(simple_xs, sigma_t);
+  rxns[id("scat")] = offsetof(simple_xs, sigma_s);
+  rxns[id("elas")] = offsetof(simple_xs, sigma_e);
+  rxns[id("inel")] = offsetof(simple_xs, sigma_i);
+  rxns[id("abs")] = offsetof(simple_xs, sigma_a);
+  rxns[id("gamma")] = offsetof(simple_xs, sigma_gamma);
+  rxns[id("fiss")] = offsetof(simple_xs, sigma_f);
+  rxns[id("alpha")] = offsetof(simple_xs, sigma_alpha);
+  rxns[id("proton")] = offsetof(simple_xs, sigma_proton);
+  rxns[id("deut")] = offsetof(simple_xs, sigma_deut);
+  rxns[id("trit")] = offsetof(simple_xs, sigma_trit);
+  rxns[id("z_2n")] = offsetof(simple_xs, sigma_2n);
+  rxns[id("z_3n")] = offsetof(simple_xs, sigma_3n);
+  rxns[id("z_4n")] = offsetof(simple_xs, sigma_4n);
+
+  std::vector<simple_xs> rows[pyne::SIMPLE_XS_NGROUPS];
+  std::vector<int> nucs;
+  for (int g = 0; g < pyne::SIMPLE_XS_NGROUPS; ++g) {
+    rows[g] = _read_simple_xs(simple_xs_group_names[g]);
+    for (size_t i = 0; i < rows[g].size(); ++i)
+      nucs.push_back(rows[g][i].nuc);
+  }
+  std::sort(nucs.begin(), nucs.end());
+  nucs.erase(std::unique(nucs.begin(), nucs.end()), nucs.end());
+
+  dense_simple_xs.nucs = nucs;
+  dense_simple_xs.rxs.clear();
+  dense_simple_xs.rx_offsets.clear();
+  std::map<unsigned int, size_t>::iterator it;
+  for (it = rxns.begin(); it != rxns.end(); ++it) {
+    dense_simple_xs.rxs.push_back(it->first);
+    dense_simple_xs.rx_offsets.push_back(it->second);
+  }
+  size_t nrx = rxns.size();
+  for (int g = 0; g < pyne::SIMPLE_XS_NGROUPS; ++g) {
+    std::vector<double>& xs = dense_simple_xs.xs[g];
+    std::vector<char>& has_nuc = dense_simple_xs.has_nuc[g];
+    xs.assign(nucs.size() * nrx, std::numeric_limits<double>::quiet_NaN());
+    has_nuc.assign(nucs.size(), 0);
+    std::map<int, std::map<int, double> >& group =
+      pyne::simple_xs_map[simple_xs_group_names[g]];
+    for (size_t i = 0; i < rows[g].size(); ++i) {
+      const simple_xs& row = rows[g][i];
+      size_t r = std::lower_bound(nucs.begin(), nucs.end(), row.nuc) -
+                 nucs.begin();
+      has_nuc[r] = 1;
+      for (size_t j = 0; j < nrx; ++j) {
+        double x = *(const double*) ((const char*) &row +
+                                     dense_simple_xs.rx_offsets[j]);
+        xs[r*nrx + j] = x;
+        group[row.nuc][dense_simple_xs.rxs[j]] = x;
+      }
     }
   }
-  delete[] array;
 }
 
-double pyne::simple_xs(int nuc, int rx_id, std::string energy) {
-  std::set<std::string> energies;
-  energies.insert("thermal");
-  energies.insert("thermal_maxwell_ave");
-  energies.insert("resonance_integral");
-  energies.insert("fourteen_MeV");
-  energies.insert("fission_spectrum_ave");
+static pyne::data_once simple_xs_once;
 
-  if (energies.count(energy) == 0) {
-    throw InvalidSimpleXS("Energy '" + energy +
-        "' is not a valid simple_xs group");
-  } else if (simple_xs_map.count(energy) == 0) {
-    _load_simple_xs_map(energy);
-  }
+// loads every simple cross section energy band exactly once, so that
+// concurrent lookups never see the tables being modified.
+static void _ensure_simple_xs_map() {
+  simple_xs_once.call(_load_simple_xs);
+}
+
+pyne::simple_xs_group pyne::simple_xs_group_id(std::string energy) {
+  for (int g = 0; g < SIMPLE_XS_NGROUPS; ++g)
+    if (energy == simple_xs_group_names[g])
+      return static_cast<simple_xs_group>(g);
+  throw InvalidSimpleXS("Energy '" + energy +
+      "' is not a valid simple_xs group");
+}
+
+// column of rx in the dense simple_xs table
+static size_t _simple_xs_column(int rx_id) {
+  const std::vector<unsigned int>& rxs = dense_simple_xs.rxs;
+  for (size_t j = 0; j < rxs.size(); ++j)
+    if (rxs[j] == (unsigned int) rx_id)
+      return j;
+  throw pyne::InvalidSimpleXS(pyne::rxname::name(rx_id) +
+      " is not a valid simple_xs reaction");
+}
+
+static void _check_simple_xs_group(pyne::simple_xs_group group) {
+  if (group < 0 || group >= pyne::SIMPLE_XS_NGROUPS)
+    throw pyne::InvalidSimpleXS("not a valid simple_xs group");
+}
 
-  if (simple_xs_map[energy].count(nuc) == 0) {
+double pyne::simple_xs(int nuc, int rx_id, simple_xs_group group) {
+  _check_simple_xs_group(group);
+  _ensure_simple_xs_map();
+  const std::vector<int>& nucs = dense_simple_xs.nucs;
+  std::vector<int>::const_iterator it = std::lower_bound(nucs.begin(),
+    nucs.end(), nuc);
+  size_t r = it - nucs.begin();
+  if (it == nucs.end() || *it != nuc || !dense_simple_xs.has_nuc[group][r]) {
     throw InvalidSimpleXS(rxname::name(rx_id) +
         " is not a valid simple_xs nuclide");
-  } else if (simple_xs_map[energy][nuc].count(rx_id) == 0) {
-    throw InvalidSimpleXS(rxname::name(rx_id) +
-        " is not a valid simple_xs reaction");
   }
+  size_t j = _simple_xs_column(rx_id);
+  return dense_simple_xs.xs[group][r*dense_simple_xs.rxs.size() + j];
+}
+
+void pyne::simple_xs(const int* nucs, size_t n, int rx_id,
+simple_xs_group group, double* out) {
+  _check_simple_xs_group(group);
+  _ensure_simple_xs_map();
+  size_t j = _simple_xs_column(rx_id);
+  size_t nrx = dense_simple_xs.rxs.size();
+  const std::vector<int>& table_nucs = dense_simple_xs.nucs;
+  const std::vector<char>& has_nuc = dense_simple_xs.has_nuc[group];
+  const double* xs = dense_simple_xs.xs[group].empty() ? NULL :
+                     &dense_simple_xs.xs[group][0];
+  const int* first = table_nucs.empty() ? NULL : &table_nucs[0];
+  const int* last = first + table_nucs.size();
+  const int* lo = first;
+  for (size_t i = 0; i < n; ++i) {
+    // materials are usually sorted, so search forward from the last hit
+    // before falling back to the whole table
+    if (lo == last || *lo > nucs[i])
+      lo = first;
+    const int* it = std::lower_bound(lo, last, nucs[i]);
+    if (it != last && *it == nucs[i] && has_nuc[it - first]) {
+      out[i] = xs[(it - first)*nrx + j];
+      lo = it;
+    } else {
+      out[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+}
 
-  return simple_xs_map[energy][nuc][rx_id];
+double pyne::simple_xs(int nuc, int rx_id, std::string energy) {
+  return pyne::simple_xs(nuc, rx_id, simple_xs_group_id(energy));
 }
 
 double pyne::simple_xs(int nuc, std::string rx, std::string energy) {
@@ -2630,3 +3178,248 @@ double pyne::simple_xs(std::string nuc, int rx, std::string energy) {
 double pyne::simple_xs(std::string nuc, std::string rx, std::string energy) {
   return pyne::simple_xs(nucname::id(nuc), rxname::id(rx), energy);
 }
+
+
+//
+// Snapshot writer
+//
+
+void pyne::write_data_snapshot(std::string path) {
+  _ensure_atomic_mass_map();
+  _ensure_q_val_map();
+  _ensure_data<atomic>();
+  _ensure_data<level_data>();
+  _ensure_data<decay>();
+  _ensure_data<gamma>();
+  _ensure_data<alpha>();
+  _ensure_data<beta>();
+  _ensure_data<ecbp>();
+
+  std::vector<int> am_nucs, q_nucs;
+  std::vector<double> am_mass, am_abund, q_vals, q_gfs;
+  for (std::map<int, double>::const_iterator it = atomic_mass_map.begin();
+       it != atomic_mass_map.end(); ++it) {
+    std::map<int, double>::const_iterator ab = natural_abund_map.find(
+      it->first);
+    am_nucs.push_back(it->first);
+    am_mass.push_back(it->second);
+    am_abund.push_back(ab == natural_abund_map.end() ? 0.0 : ab->second);
+  }
+  for (std::map<int, double>::const_iterator it = q_val_map.begin();
+       it != q_val_map.end(); ++it) {
+    std::map<int, double>::const_iterator gf = gamma_frac_map.find(it->first);
+    q_nucs.push_back(it->first);
+    q_vals.push_back(it->second);
+    q_gfs.push_back(gf == gamma_frac_map.end() ? 0.0 : gf->second);
+  }
+  std::vector<atomic> atomic_rows;
+  for (std::map<int, atomic>::const_iterator it = atomic_data_map.begin();
+       it != atomic_data_map.end(); ++it)
+    atomic_rows.push_back(it->second);
+
+  std::vector<data_block> blocks;
+  data_block b;
+  b.name = "atomic_mass.nuc";
+  b.data = (const char*) am_nucs.data();
+  b.size = am_nucs.size() * sizeof(int);
+  blocks.push_back(b);
+  b.name = "atomic_mass.mass";
+  b.data = (const char*) am_mass.data();
+  b.size = am_mass.size() * sizeof(double);
+  blocks.push_back(b);
+  b.name = "atomic_mass.abund";
+  b.data = (const char*) am_abund.data();
+  b.size = am_abund.size() * sizeof(double);
+  blocks.push_back(b);
+  b.name = "q_values.nuc";
+  b.data = (const char*) q_nucs.data();
+  b.size = q_nucs.size() * sizeof(int);
+  blocks.push_back(b);
+  b.name = "q_values.q_val";
+  b.data = (const char*) q_vals.data();
+  b.size = q_vals.size() * sizeof(double);
+  blocks.push_back(b);
+  b.name = "q_values.gamma_frac";
+  b.data = (const char*) q_gfs.data();
+  b.size = q_gfs.size() * sizeof(double);
+  blocks.push_back(b);
+  b.name = "atomic.rows";
+  b.data = (const char*) atomic_rows.data();
+  b.size = atomic_rows.size() * sizeof(atomic);
+  blocks.push_back(b);
+  level_data_lvl_map.snapshot_blocks("levels", blocks);
+  level_data_rx_map.snapshot_blocks("level_rxs", blocks);
+  decay_data.snapshot_blocks("decays", blocks);
+  gamma_data.snapshot_blocks("gammas", blocks);
+  alpha_data.snapshot_blocks("alphas", blocks);
+  beta_data.snapshot_blocks("betas", blocks);
+  ecbp_data.snapshot_blocks("ecbps", blocks);
+  data_snapshot::write(path, blocks, nuc_data_stamp(NUC_DATA_PATH));
+}
+
+
+//
+// Preloading
+//
+
+// approximate heap memory of a std::map: one tree node per entry
+template<typename K, typename V> static size_t _map_bytes(
+const std::map<K, V>& m) {
+  return m.size() * (sizeof(typename std::map<K, V>::value_type) +
+                     4 * sizeof(void*));
+}
+
+static size_t _simple_xs_bytes() {
+  size_t bytes = _map_bytes(pyne::simple_xs_map);
+  std::map<std::string, std::map<int, std::map<int, double> > >::const_iterator
+    e = pyne::simple_xs_map.begin();
+  for (; e != pyne::simple_xs_map.end(); ++e) {
+    bytes += _map_bytes(e->second);
+    std::map<int, std::map<int, double> >::const_iterator n = e->second.begin();
+    for (; n != e->second.end(); ++n)
+      bytes += _map_bytes(n->second);
+  }
+  bytes += dense_simple_xs.nucs.capacity() * sizeof(int) +
+           dense_simple_xs.rxs.capacity() * sizeof(unsigned int) +
+           dense_simple_xs.rx_offsets.capacity() * sizeof(size_t);
+  for (int g = 0; g < pyne::SIMPLE_XS_NGROUPS; ++g)
+    bytes += dense_simple_xs.xs[g].capacity() * sizeof(double) +
+             dense_simple_xs.has_nuc[g].capacity();
+  return bytes;
+}
+
+// A table that preload_data() knows how to load and measure.
+struct data_table_entry {
+  const char* name;
+  void (*ensure)();
+  bool (*loaded)();
+  size_t (*bytes)();
+};
+
+static const data_table_entry data_tables[] = {
+  {"atomic_mass", []() {_ensure_atomic_mass_source();},
+   []() {return atomic_mass_once.loaded();},
+   []() {return _map_bytes(pyne::atomic_mass_map) +
+                _map_bytes(pyne::natural_abund_map);}},
+  {"q_val", []() {_ensure_q_val_map();},
+   []() {return q_val_once.loaded();},
+   []() {return _map_bytes(pyne::q_val_map) +
+                _map_bytes(pyne::gamma_frac_map);}},
+  {"dose_epa", []() {dose_source_map(0);},
+   []() {return dose_once[0].loaded();},
+   []() {return _map_bytes(pyne::epa_dose_map);}},
+  {"dose_doe", []() {dose_source_map(1);},
+   []() {return dose_once[1].loaded();},
+   []() {return _map_bytes(pyne::doe_dose_map);}},
+  {"dose_genii", []() {dose_source_map(2);},
+   []() {return dose_once[2].loaded();},
+   []() {return _map_bytes(pyne::genii_dose_map);}},
+  {"scattering_lengths", []() {_ensure_scattering_lengths();},
+   []() {return scattering_lengths_once.loaded();},
+   []() {return _map_bytes(pyne::b_coherent_map) +
+                _map_bytes(pyne::b_incoherent_map) + _map_bytes(pyne::b_map);}},
+  {"wimsd_fpy", []() {_ensure_wimsdfpy();},
+   []() {return wimsdfpy_once.loaded();},
+   []() {return _map_bytes(pyne::wimsdfpy_data);}},
+  {"nds_fpy", []() {_ensure_ndsfpy();},
+   []() {return ndsfpy_once.loaded();},
+   []() {return _map_bytes(pyne::ndsfpy_data);}},
+  {"atomic", []() {_ensure_data<pyne::atomic>();},
+   []() {return _data_once<pyne::atomic>().loaded();},
+   []() {return _map_bytes(pyne::atomic_data_map);}},
+  {"levels", []() {_ensure_data<pyne::level_data>();},
+   []() {return _data_once<pyne::level_data>().loaded();},
+   []() {return pyne::level_data_lvl_map.memory_usage() +
+                pyne::level_data_rx_map.memory_usage();}},
+  {"decay", []() {_ensure_data<pyne::decay>();},
+   []() {return _data_once<pyne::decay>().loaded();},
+   []() {return pyne::decay_data.memory_usage();}},
+  {"gammas", []() {_ensure_data<pyne::gamma>();},
+   []() {return _data_once<pyne::gamma>().loaded();},
+   []() {return pyne::gamma_data.memory_usage();}},
+  {"alphas", []() {_ensure_data<pyne::alpha>();},
+   []() {return _data_once<pyne::alpha>().loaded();},
+   []() {return pyne::alpha_data.memory_usage();}},
+  {"betas", []() {_ensure_data<pyne::beta>();},
+   []() {return _data_once<pyne::beta>().loaded();},
+   []() {return pyne::beta_data.memory_usage();}},
+  {"ecbp", []() {_ensure_data<pyne::ecbp>();},
+   []() {return _data_once<pyne::ecbp>().loaded();},
+   []() {return pyne::ecbp_data.memory_usage();}},
+  {"simple_xs", []() {_ensure_simple_xs_map();},
+   []() {return simple_xs_once.loaded();},
+   []() {return _simple_xs_bytes();}},
+};
+
+static const size_t n_data_tables = sizeof(data_tables) /
+                                    sizeof(data_tables[0]);
+
+// time spent by the last preload of each table [s]
+static std::mutex load_seconds_mutex;
+static double load_seconds[n_data_tables] = {};
+
+static size_t _data_table(std::string name) {
+  for (size_t t = 0; t < n_data_tables; ++t)
+    if (name == data_tables[t].name)
+      return t;
+  throw pyne::ValueError("'" + name + "' is not a nuclear data table");
+}
+
+static pyne::data_load_stats _data_load_stats(size_t t) {
+  pyne::data_load_stats stats;
+  stats.table = data_tables[t].name;
+  stats.loaded = data_tables[t].loaded();
+  stats.bytes = stats.loaded ? data_tables[t].bytes() : 0;
+  std::lock_guard<std::mutex> lock(load_seconds_mutex);
+  stats.seconds = load_seconds[t];
+  return stats;
+}
+
+static void _record_load_seconds(size_t t,
+std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+  std::lock_guard<std::mutex> lock(load_seconds_mutex);
+  load_seconds[t] = dt.count();
+}
+
+std::vector<std::string> pyne::data_table_names() {
+  std::vector<std::string> names;
+  for (size_t t = 0; t < n_data_tables; ++t)
+    names.push_back(data_tables[t].name);
+  return names;
+}
+
+std::vector<pyne::data_load_stats> pyne::preload_data(
+const std::vector<std::string>& tables, int nthreads) {
+  std::vector<size_t> ids;
+  for (size_t i = 0; i < tables.size(); ++i)
+    ids.push_back(_data_table(tables[i]));
+
+  // the tables still to load, each taken by whichever thread is free
+  std::vector<size_t> todo;
+  for (size_t i = 0; i < ids.size(); ++i)
+    if (!data_tables[ids[i]].loaded() &&
+        std::find(todo.begin(), todo.end(), ids[i]) == todo.end())
+      todo.push_back(ids[i]);
+  pyne::run_tasks(todo.size(), nthreads, [&](size_t i, int) {
+    size_t t = todo[i];
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    try {
+      data_tables[t].ensure();
+    } catch (...) {
+      _record_load_seconds(t, start);
+      throw;
+    }
+    _record_load_seconds(t, start);
+  });
+
+  std::vector<data_load_stats> stats;
+  for (size_t i = 0; i < ids.size(); ++i)
+    stats.push_back(_data_load_stats(ids[i]));
+  return stats;
+}
+
+pyne::data_load_stats pyne::data_load_info(std::string table) {
+  return _data_load_stats(_data_table(table));
+}
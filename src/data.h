@@ -7,13 +7,19 @@
 #define PYNE_TEWK4A7VOFFLHDDXD5ZZ7KPXEQ
 #include <iostream>
 #include <string>
+#include <sstream>
 #include <utility>
 #include <map>
 #include <set>
+#include <vector>
+#include <algorithm>
 #include <limits>
 #include <exception>
+#include <atomic>
+#include <mutex>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <float.h>
 #include <math.h>
 
@@ -26,6 +32,7 @@
 #include "utils.h"
 #include "nucname.h"
 #include "rxname.h"
+#include "nuclide_index.h"
 #endif
 
 namespace pyne
@@ -48,6 +55,33 @@ namespace pyne
   /// Mapping from nodes in nuc_data.h5 to hashes of nodes
   extern std::map<std::string, std::string> data_checksums;
 
+  /// \brief Guards the one-time load of a nuclear data table.
+  ///
+  /// Works like std::call_once: the first caller runs the loader while any
+  /// concurrent callers block until it has finished.  Once loaded, a table
+  /// is never modified again, so lookups into it are safe from many threads.
+  /// If the loader throws, the table stays unloaded and the next call retries.
+  class data_once {
+    public:
+      constexpr data_once() : done(false) {};
+      template<typename F> void call(F loader) {
+        if (done.load(std::memory_order_acquire))
+          return;
+        std::lock_guard<std::mutex> lock(mtx);
+        if (done.load(std::memory_order_relaxed))
+          return;
+        loader();
+        done.store(true, std::memory_order_release);
+      };
+      /// true once the loader has completed successfully.
+      bool loaded() const {return done.load(std::memory_order_acquire);};
+    private:
+      data_once(const data_once&);
+      data_once& operator=(const data_once&);
+      std::atomic<bool> done;
+      std::mutex mtx;
+  };
+
   /// \name Atomic Mass Data
   /// \{
 
@@ -66,8 +100,13 @@ namespace pyne
   std::map<std::string, std::string> get_data_checksums();
 
   /// Loads the atomic mass and natural abundance data from the nuc_data.h5 file
-  /// into memory.
+  /// into memory.  Without nuc_data.h5 the maps are left alone and lookups
+  /// use the built-in tables of atomic_data.h instead.
   void _load_atomic_mass_map();
+  /// Fills atomic_mass_map and natural_abund_map exactly once, from
+  /// nuc_data.h5 or else from the built-in tables.  Safe to call
+  /// concurrently; afterwards both maps are read-only.
+  void _ensure_atomic_mass_map();
 
   /// \brief Returns the atomic mass of a nuclide \a nuc.
   ///
@@ -80,6 +119,8 @@ namespace pyne
   double atomic_mass(char * nuc);
   /// Returns the atomic mass of a nuclide \a nuc.
   double atomic_mass(std::string nuc);
+  /// Returns the atomic masses of the nuclides of \a index, in index order.
+  std::vector<double> atomic_mass(const NuclideIndex& index);
   /// \}
 
 
@@ -303,6 +344,31 @@ namespace pyne
   /// Returns the fission product yield for a parent/child nuclide pair
   double fpyield(std::string from_nuc, std::string to_nuc, int source, bool get_error);
 
+  /// \brief Fission product yields of one data source as a sparse matrix.
+  ///
+  /// Rows are fissioning nuclides and columns are products, in compressed
+  /// sparse row (CSR) form: the products of parents[i] are
+  /// children[indptr[i]] to children[indptr[i+1] - 1], sorted, with their
+  /// yields in values.  The transpose is kept alongside as an index from
+  /// each product to its parents, with entry_of[k] giving the position in
+  /// values of the k-th (product, parent) pair.  Zero yields are left out.
+  typedef struct fpyield_csr {
+    std::vector<int> parents;          ///< fissioning nuclides in id form
+    std::vector<size_t> indptr;        ///< row offsets, parents.size() + 1
+    std::vector<int> children;         ///< product of each entry in id form
+    std::vector<double> values;        ///< yield of each entry [fraction]
+    std::vector<int> products;         ///< every product in id form, sorted
+    std::vector<size_t> product_indptr;  ///< offsets, products.size() + 1
+    std::vector<int> product_parents;  ///< parent of each (product, parent)
+    std::vector<size_t> entry_of;      ///< its entry in children and values
+  } fpyield_csr;
+
+  /// Returns the whole fission product yield table of \a source, as for
+  /// fpyield(), as a sparse matrix.  With \a get_error the NDS values are
+  /// the yield errors; WIMSD has none and ignores it.  The matrix is built
+  /// once and shared.  Sources other than 0 to 3 throw pyne::ValueError.
+  const fpyield_csr& fpyield_matrix(int source, bool get_error=false);
+
   /// \}
 
 
@@ -311,37 +377,509 @@ namespace pyne
 
   /// Data access functions
 
-  /// simple class to swap the order in which a pair is compared
-  class swapmapcompare{
+  /// A read-only, zero-copy view of a contiguous run of values in a single
+  /// column of a decay_table.  Views are invalidated when the table is
+  /// reloaded.
+  template<typename T> class data_span {
     public:
-        /// This operator compares the second item in a pair first
-        bool operator()(const std::pair<int, double>& lhs,
-                        const std::pair<int, double>& rhs) const;
+      data_span() : ptr_(NULL), size_(0) {};
+      data_span(const T* ptr, size_t size) : ptr_(ptr), size_(size) {};
+      const T* begin() const {return ptr_;};
+      const T* end() const {return ptr_ + size_;};
+      const T* data() const {return ptr_;};
+      size_t size() const {return size_;};
+      bool empty() const {return size_ == 0;};
+      const T& operator[](size_t i) const {return ptr_[i];};
+      /// copies the view into a new vector
+      std::vector<T> to_vector() const {return std::vector<T>(begin(), end());};
+    private:
+      const T* ptr_;
+      size_t size_;
   };
 
-  /// Access data in a std::map<std::pair<int, double> for a range of
-  /// values of the second member of the pair. Returns a vector of all
-  /// values at valoffset of class U of type T f
+  /// Custom exception for an unreadable or inconsistent nuc_data snapshot.
+  class InvalidDataSnapshot : public std::exception {
+   public:
+    InvalidDataSnapshot () {};
+    ~InvalidDataSnapshot () throw () {};
+    /// Exception thrown if a snapshot file is corrupt or incompatible
+    InvalidDataSnapshot(std::string msg) : msg_(msg) {};
+    /// Exception returns the string passed when thrown.
+    virtual const char* what() const throw() {
+      return msg_.c_str();
+    };
+
+   private:
+    std::string msg_;
+  };
+
+  /// A named, contiguous block of memory stored in a nuc_data snapshot.
+  struct data_block {
+    std::string name;  ///< unique block name, e.g. "gammas.offsets"
+    const char* data;  ///< start of the block
+    size_t size;       ///< size of the block [bytes]
+  };
+
+  /// Identifies the nuc_data.h5 a snapshot was written from by its size and
+  /// modification time, so that snapshots of an older file can be rejected.
+  struct data_source_stamp {
+    unsigned long long size;  ///< file size [bytes], 0 if there was no file
+    long long mtime;          ///< modification time [s since the epoch]
+  };
+  /// Returns the stamp of the file at \a path, all zeros if it does not exist.
+  data_source_stamp nuc_data_stamp(std::string path);
+
+  /// \brief Read-only view of a flat binary snapshot of nuc_data.h5 tables.
+  ///
+  /// The file is a fixed header, a directory of named blocks and the block
+  /// payloads, each aligned to 16 bytes.  On POSIX systems the file is
+  /// memory-mapped so processes on a node share its pages; elsewhere it is
+  /// read into memory.  See write_data_snapshot() and load_data_snapshot().
+  class data_snapshot {
+    public:
+      data_snapshot() : addr(NULL), length(0), mapped(false) {};
+      ~data_snapshot() {close();};
+
+      /// Maps the snapshot at \a path, checking its magic number, version
+      /// and layout.  When \a verify is true the payload checksum is checked
+      /// as well, which touches every page of the file.
+      void open(std::string path, bool verify=true);
+      void close();
+      bool is_open() const {return addr != NULL;};
+      /// Returns the block \a name, or an empty span if there is none.
+      data_span<char> block(std::string name) const;
+      /// Stamp of the nuc_data.h5 the open snapshot was written from.
+      data_source_stamp source() const;
+      /// Writes \a blocks to \a path in the snapshot format, recording
+      /// \a source as the file they were read from.
+      static void write(std::string path, const std::vector<data_block>& blocks,
+                        const data_source_stamp& source);
+
+    private:
+      data_snapshot(const data_snapshot&);
+      data_snapshot& operator=(const data_snapshot&);
+      char* addr;
+      size_t length;
+      bool mapped;
+      std::map<std::string, data_span<char> > blocks;
+  };
+
+  /// Writes the atomic mass, Q value, atomic and decay tables, loaded from
+  /// nuc_data.h5, to a snapshot file at \a path.
+  void write_data_snapshot(std::string path);
+  /// Makes the snapshot at \a path the source for every table it holds.
+  /// Tables are then bound to the mapped file without parsing or copying.
+  /// Must be called before those tables are first accessed; tables that are
+  /// already loaded keep their current contents.  When \a verify is false
+  /// the payload checksum is skipped so that pages are only touched on use.
+  /// A snapshot written from a nuc_data.h5 whose size or modification time
+  /// differs from the one at NUC_DATA_PATH is rejected as stale.
+  void load_data_snapshot(std::string path, bool verify=true);
+  /// True if a snapshot is loaded.
+  bool data_snapshot_loaded();
+
+  /// \brief Columnar (structure-of-arrays) storage for a decay data table.
+  ///
+  /// Each member of the row struct U is stored in its own contiguous array,
+  /// laid out from the HDF5 compound type that describes the table.  Rows are
+  /// sorted by parent and then by a secondary key, and a CSR style offset
+  /// index maps each parent to the contiguous row range [offsets[k],
+  /// offsets[k+1]).  Columns are addressed by the offsetof() the member in U.
+  /// The arrays are either owned by the table or borrowed from a mapped
+  /// data_snapshot.
+  template<typename U> class decay_table {
+    public:
+      static const size_t npos = static_cast<size_t>(-1);
+
+      decay_table() : nrows(0), nkeys(0), key_col(0) {};
+
+      /// (offset, width) of each member of a row, in member order.
+      typedef std::vector<std::pair<size_t, size_t> > layout_type;
+      /// The member layout of the compound type \a desc.
+      static layout_type layout(hid_t desc);
+
+      /// Builds the table from \a n unsorted rows.  Column widths are taken
+      /// from the members of the compound type \a desc.  Rows are ordered by
+      /// the int at \a parent_offset, then by the K at \a key_offset.  When
+      /// two rows share a (parent, key) pair the last one wins.
+      template<typename K> void assign(const U* rows, size_t n, hid_t desc,
+                                       size_t parent_offset, size_t key_offset) {
+        assign<K>(rows, n, layout(desc), parent_offset, key_offset);
+      };
+      /// As above, with the columns given by \a members.  Makes no HDF5
+      /// calls.
+      template<typename K> void assign(const U* rows, size_t n,
+                                       const layout_type& members,
+                                       size_t parent_offset, size_t key_offset);
+      /// Appends the table's arrays to \a out as blocks named "prefix.*".
+      void snapshot_blocks(std::string prefix,
+                           std::vector<data_block>& out) const;
+      /// Points the table at the "prefix.*" blocks of \a snap without
+      /// copying.  Returns false if the snapshot does not hold this table.
+      bool bind(std::string prefix, const data_snapshot& snap);
+
+      bool empty() const {return nrows == 0;};
+      size_t size() const {return nrows;};
+      void clear();
+      /// Heap memory owned by the table [bytes]; zero when it is bound to a
+      /// snapshot.
+      size_t memory_usage() const;
+
+      /// Sorted unique parents in the table.
+      data_span<int> parents() const {return parent_ids_;};
+      /// Row range [first, second) holding \a parent; empty if not present.
+      std::pair<size_t, size_t> rows(int parent) const;
+      /// Row range [first, second) holding all parents in [pmin, pmax].
+      std::pair<size_t, size_t> rows(int pmin, int pmax) const;
+      /// Row of the (parent, key) pair, or npos if it is not present.
+      template<typename K> size_t find(int parent, K key) const;
+      /// Row indices ordered by key and then by parent, whose key lies in
+      /// [kmin, kmax].
+      data_span<size_t> key_range(double kmin, double kmax) const;
+
+      /// Pointer to the start of the column at \a valoffset.
+      template<typename T> const T* column(size_t valoffset) const;
+      /// View of the column at \a valoffset for a single parent.
+      template<typename T> data_span<T> column(int parent,
+                                               size_t valoffset) const;
+
+    private:
+      void own_index();
+
+      size_t nrows;
+      size_t nkeys;
+      size_t key_col;
+      data_span<int> parent_ids_;
+      data_span<size_t> offsets_;
+      data_span<size_t> by_key_;
+      data_span<double> keys_;  // keys in by_key order, for range searches
+      data_span<size_t> meta_;  // nrows, nkeys, key_col, ncols, col layout
+      std::vector<size_t> col_index;  // member offset -> index into cols
+      std::vector<size_t> col_offset;  // member offset of each column
+      std::vector<size_t> col_width;  // width of each column [bytes]
+      std::vector<const char*> cols;
+      // storage used when the table is built rather than bound
+      std::vector<int> parent_store;
+      std::vector<size_t> offset_store;
+      std::vector<size_t> by_key_store;
+      std::vector<double> key_store;
+      std::vector<size_t> meta_store;
+      std::vector<std::vector<char> > col_store;
+  };
+
+  template<typename U> const size_t decay_table<U>::npos;
+
+  template<typename U> void decay_table<U>::clear() {
+    nrows = 0;
+    nkeys = 0;
+    parent_ids_ = data_span<int>();
+    offsets_ = data_span<size_t>();
+    by_key_ = data_span<size_t>();
+    keys_ = data_span<double>();
+    meta_ = data_span<size_t>();
+    col_index.clear();
+    col_offset.clear();
+    col_width.clear();
+    cols.clear();
+    parent_store.clear();
+    offset_store.clear();
+    by_key_store.clear();
+    key_store.clear();
+    meta_store.clear();
+    col_store.clear();
+  }
+
+  template<typename U> void decay_table<U>::own_index() {
+    parent_ids_ = data_span<int>(parent_store.empty() ? NULL :
+      &parent_store[0], parent_store.size());
+    offsets_ = data_span<size_t>(&offset_store[0], offset_store.size());
+    by_key_ = data_span<size_t>(by_key_store.empty() ? NULL :
+      &by_key_store[0], by_key_store.size());
+    keys_ = data_span<double>(key_store.empty() ? NULL : &key_store[0],
+      key_store.size());
+    nkeys = key_store.size();
+    cols.clear();
+    meta_store.clear();
+    meta_store.push_back(nrows);
+    meta_store.push_back(nkeys);
+    meta_store.push_back(key_col);
+    meta_store.push_back(col_store.size());
+    for (size_t c = 0; c < col_store.size(); ++c) {
+      cols.push_back(col_store[c].empty() ? NULL : &col_store[c][0]);
+      meta_store.push_back(col_offset[c]);
+      meta_store.push_back(col_width[c]);
+    }
+    meta_ = data_span<size_t>(&meta_store[0], meta_store.size());
+  }
+
+  /// Orders (parent, key) pairs with NaN keys placed after all other keys.
+  template<typename K> struct decay_table_less {
+    bool operator()(const std::pair<std::pair<int, K>, size_t>& lhs,
+                    const std::pair<std::pair<int, K>, size_t>& rhs) const {
+      if (lhs.first.first != rhs.first.first)
+        return lhs.first.first < rhs.first.first;
+      K a = lhs.first.second, b = rhs.first.second;
+      if (a != a || b != b)  // NaN check that also compiles for integers
+        return (a == a) && (b != b);
+      return a < b;
+    }
+  };
+
+  template<typename U> size_t decay_table<U>::memory_usage() const {
+    size_t bytes = parent_store.capacity() * sizeof(int) +
+      (offset_store.capacity() + by_key_store.capacity() +
+       meta_store.capacity()) * sizeof(size_t) +
+      key_store.capacity() * sizeof(double) +
+      (col_index.capacity() + col_offset.capacity() + col_width.capacity()) *
+       sizeof(size_t) + cols.capacity() * sizeof(const char*);
+    for (size_t c = 0; c < col_store.size(); ++c)
+      bytes += col_store[c].capacity();
+    return bytes;
+  }
+
+  template<typename U> typename decay_table<U>::layout_type
+  decay_table<U>::layout(hid_t desc) {
+    layout_type members;
+    int nmembers = H5Tget_nmembers(desc);
+    for (int m = 0; m < nmembers; ++m) {
+      hid_t mtype = H5Tget_member_type(desc, m);
+      members.push_back(std::make_pair(H5Tget_member_offset(desc, m),
+                                       H5Tget_size(mtype)));
+      H5Tclose(mtype);
+    }
+    return members;
+  }
+
+  template<typename U> template<typename K> void decay_table<U>::assign(
+  const U* rows, size_t n, const layout_type& members, size_t parent_offset,
+  size_t key_offset) {
+    clear();
+    // order the rows by (parent, key), keeping the last of any duplicates
+    std::vector<std::pair<std::pair<int, K>, size_t> > sorted(n);
+    for (size_t i = 0; i < n; ++i) {
+      const char* row = (const char*) &rows[i];
+      sorted[i] = std::make_pair(std::make_pair(*(const int*) (row +
+        parent_offset), *(const K*) (row + key_offset)), i);
+    }
+    decay_table_less<K> less;
+    std::stable_sort(sorted.begin(), sorted.end(), less);
+    std::vector<size_t> order;
+    order.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      if (i + 1 < n && !less(sorted[i], sorted[i + 1]))
+        continue;
+      order.push_back(sorted[i].second);
+      if (parent_store.empty() || parent_store.back() != sorted[i].first.first) {
+        parent_store.push_back(sorted[i].first.first);
+        offset_store.push_back(order.size() - 1);
+      }
+    }
+    nrows = order.size();
+    offset_store.push_back(nrows);
+
+    // scatter the rows into one array per compound member
+    col_index.assign(sizeof(U), npos);
+    for (size_t m = 0; m < members.size(); ++m) {
+      size_t off = members[m].first, width = members[m].second;
+      col_index[off] = col_store.size();
+      col_offset.push_back(off);
+      col_width.push_back(width);
+      col_store.push_back(std::vector<char>(nrows * width));
+      std::vector<char>& col = col_store.back();
+      for (size_t i = 0; i < nrows; ++i)
+        memcpy(&col[i*width], (const char*) &rows[order[i]] + off, width);
+    }
+    key_col = key_offset;
+    own_index();
+
+    // secondary ordering by (key, parent) for range queries, NaN keys omitted
+    std::vector<std::pair<std::pair<double, int>, size_t> > kp;
+    kp.reserve(nrows);
+    const K* kcol = column<K>(key_offset);
+    const int* pcol = column<int>(parent_offset);
+    for (size_t i = 0; i < nrows; ++i)
+      if (kcol[i] == kcol[i])
+        kp.push_back(std::make_pair(std::make_pair((double) kcol[i], pcol[i]),
+                                    i));
+    std::sort(kp.begin(), kp.end());
+    by_key_store.resize(kp.size());
+    key_store.resize(kp.size());
+    for (size_t i = 0; i < kp.size(); ++i) {
+      key_store[i] = kp[i].first.first;
+      by_key_store[i] = kp[i].second;
+    }
+    own_index();
+  }
+
+  template<typename U> void decay_table<U>::snapshot_blocks(std::string prefix,
+  std::vector<data_block>& out) const {
+    data_block b;
+    b.name = prefix + ".meta";
+    b.data = (const char*) meta_.data();
+    b.size = meta_.size() * sizeof(size_t);
+    out.push_back(b);
+    b.name = prefix + ".parents";
+    b.data = (const char*) parent_ids_.data();
+    b.size = parent_ids_.size() * sizeof(int);
+    out.push_back(b);
+    b.name = prefix + ".offsets";
+    b.data = (const char*) offsets_.data();
+    b.size = offsets_.size() * sizeof(size_t);
+    out.push_back(b);
+    b.name = prefix + ".by_key";
+    b.data = (const char*) by_key_.data();
+    b.size = by_key_.size() * sizeof(size_t);
+    out.push_back(b);
+    b.name = prefix + ".keys";
+    b.data = (const char*) keys_.data();
+    b.size = keys_.size() * sizeof(double);
+    out.push_back(b);
+    for (size_t c = 0; c < cols.size(); ++c) {
+      std::ostringstream name;
+      name << prefix << ".col" << c;
+      b.name = name.str();
+      b.data = cols[c];
+      b.size = nrows * col_width[c];
+      out.push_back(b);
+    }
+  }
+
+  template<typename U> bool decay_table<U>::bind(std::string prefix,
+  const data_snapshot& snap) {
+    data_span<char> meta = snap.block(prefix + ".meta");
+    if (meta.empty())
+      return false;
+    // meta layout: nrows, nkeys, key_col, ncols, then (offset, width) pairs
+    const size_t* m = (const size_t*) meta.data();
+    size_t nmeta = meta.size() / sizeof(size_t);
+    if (nmeta < 4 || nmeta != 4 + 2*m[3] || m[2] >= sizeof(U))
+      throw InvalidDataSnapshot("malformed meta data for table " + prefix);
+    clear();
+    nrows = m[0];
+    nkeys = m[1];
+    key_col = m[2];
+    meta_ = data_span<size_t>(m, nmeta);
+
+    data_span<char> b = snap.block(prefix + ".parents");
+    parent_ids_ = data_span<int>((const int*) b.data(), b.size() / sizeof(int));
+    b = snap.block(prefix + ".offsets");
+    offsets_ = data_span<size_t>((const size_t*) b.data(),
+                                 b.size() / sizeof(size_t));
+    b = snap.block(prefix + ".by_key");
+    by_key_ = data_span<size_t>((const size_t*) b.data(),
+                                b.size() / sizeof(size_t));
+    b = snap.block(prefix + ".keys");
+    keys_ = data_span<double>((const double*) b.data(),
+                              b.size() / sizeof(double));
+    if (offsets_.size() != parent_ids_.size() + 1 || by_key_.size() != nkeys ||
+        keys_.size() != nkeys || offsets_[parent_ids_.size()] != nrows)
+      throw InvalidDataSnapshot("inconsistent index for table " + prefix);
+
+    col_index.assign(sizeof(U), npos);
+    for (size_t c = 0; c < m[3]; ++c) {
+      size_t off = m[4 + 2*c], width = m[5 + 2*c];
+      std::ostringstream name;
+      name << prefix << ".col" << c;
+      b = snap.block(name.str());
+      if (off >= sizeof(U) || b.size() != nrows * width)
+        throw InvalidDataSnapshot("column size mismatch in " + name.str());
+      col_index[off] = c;
+      col_offset.push_back(off);
+      col_width.push_back(width);
+      cols.push_back(b.data());
+    }
+    return true;
+  }
+
+  template<typename U> std::pair<size_t, size_t> decay_table<U>::rows(
+  int parent) const {
+    const int* it = std::lower_bound(parent_ids_.begin(), parent_ids_.end(),
+                                     parent);
+    if (it == parent_ids_.end() || *it != parent)
+      return std::make_pair(0, 0);
+    size_t k = it - parent_ids_.begin();
+    return std::make_pair(offsets_[k], offsets_[k+1]);
+  }
+
+  template<typename U> std::pair<size_t, size_t> decay_table<U>::rows(
+  int pmin, int pmax) const {
+    size_t lo = std::lower_bound(parent_ids_.begin(), parent_ids_.end(), pmin)
+                - parent_ids_.begin();
+    size_t hi = std::upper_bound(parent_ids_.begin(), parent_ids_.end(), pmax)
+                - parent_ids_.begin();
+    if (hi <= lo)
+      return std::make_pair(0, 0);
+    return std::make_pair(offsets_[lo], offsets_[hi]);
+  }
+
+  template<typename U> template<typename K> size_t decay_table<U>::find(
+  int parent, K key) const {
+    std::pair<size_t, size_t> r = rows(parent);
+    if (r.first == r.second)
+      return npos;
+    const K* kcol = column<K>(key_col);
+    const K* it = std::lower_bound(kcol + r.first, kcol + r.second, key);
+    if (it == kcol + r.second || *it != key)
+      return npos;
+    return it - kcol;
+  }
+
+  template<typename U> data_span<size_t> decay_table<U>::key_range(double kmin,
+  double kmax) const {
+    size_t lo = std::lower_bound(keys_.begin(), keys_.end(), kmin)
+                - keys_.begin();
+    size_t hi = std::upper_bound(keys_.begin(), keys_.end(), kmax)
+                - keys_.begin();
+    if (hi <= lo)
+      return data_span<size_t>();
+    return data_span<size_t>(by_key_.data() + lo, hi - lo);
+  }
+
+  template<typename U> template<typename T> const T* decay_table<U>::column(
+  size_t valoffset) const {
+    if (valoffset >= col_index.size() || col_index[valoffset] == npos)
+      throw pyne::ValueError("no column at this offset in the decay table");
+    return (const T*) cols[col_index[valoffset]];
+  }
+
+  template<typename U> template<typename T> data_span<T> decay_table<U>::column(
+  int parent, size_t valoffset) const {
+    std::pair<size_t, size_t> r = rows(parent);
+    if (r.first == r.second)
+      return data_span<T>();
+    return data_span<T>(column<T>(valoffset) + r.first, r.second - r.first);
+  }
+
+  /// Access data in a decay_table for a range of values of the secondary
+  /// key (usually energy). Returns a vector of all values at valoffset
+  /// of class U of type T.
   template<typename T, typename U> std::vector<T> data_access(double emin,
-    double emax, size_t valoffset, std::map<std::pair<int, double>, U>  &data);
-  /// Access data in a std::map<std::pair<int, double> for a given
-  /// value of the first member of the pair. Returns a vector of all
-  /// values at valoffset of class U of type T
-  template<typename T, typename U> std::vector<T> data_access(int parent,
-    double min, double max, size_t valoffset,
-    std::map<std::pair<int, double>, U>  &data);
-  /// Access data in a std::map<std::pair<int, int> for a given
-  /// matching pair. Returns the value at valoffset of
-  /// class U of type T
+    double emax, size_t valoffset, decay_table<U> &data);
+  /// Access data in a decay_table for a given parent. Returns a view of
+  /// all values at valoffset of class U of type T.
+  template<typename T, typename U> data_span<T> data_access(int parent,
+    size_t valoffset, decay_table<U> &data);
+  /// Access data in a decay_table for a given (parent, key) pair. Returns
+  /// the value at valoffset of class U of type T, or zero if the pair is
+  /// not present.
   template<typename T, typename U> T data_access(std::pair<int, int> from_to,
-    size_t valoffset, std::map<std::pair<int, int>, U> &data);
-  /// Access data in a std::map<std::pair<int, int> for a given
-  /// value of the first member of the pair. Returns an array of the values
-  /// at valoffset of class U of type T
-  template<typename T, typename U> std::vector<T> data_access(int parent,
-    size_t valoffset, std::map<std::pair<int, int>, U> &data);
-  template<typename T, typename U> std::vector<T> data_access(int parent,
-    size_t valoffset, std::map<std::pair<int, unsigned int>, U> &data);
+    size_t valoffset, decay_table<U> &data);
+
+  /// \brief Number of parents read on their own before a decay table is
+  /// loaded in full.
+  ///
+  /// Until a decay, gamma, alpha, beta or ecbp table is needed as a whole
+  /// (e.g. for an energy range search), queries about a single parent read
+  /// just that parent's rows from nuc_data.h5 with a hyperslab selection.
+  /// Once more than this many parents have been read, the full table is
+  /// loaded instead.  Set to zero to always load full tables.
+  extern size_t selective_load_limit;
+  /// Reads the rows for \a parents from each of the decay, gamma, alpha,
+  /// beta and ecbp tables with one hyperslab read per table, so that later
+  /// queries about them do not touch the file.  Does nothing for tables
+  /// that are already loaded in full or when this would exceed
+  /// selective_load_limit; those tables are loaded in full on first use.
+  void load_decay_parents(const std::vector<int>& parents);
 
   /// Access data in a std::map<int, data> format for a given first member
   /// of the pair. Returns the value at valoffset of the matching datapoint.
@@ -400,10 +938,12 @@ namespace pyne
     char special; ///< special high-spin state [character]
   } level_data;
 
-  /// Mapping from nuclides in id form to a struct containing data associated
-  /// with that level.
-  extern std::map<std::pair<int,double>, level_data> level_data_lvl_map;
-  extern std::map<std::pair<int,unsigned int>, level_data> level_data_rx_map;
+  /// Level data for nuclides in id form, sorted by nuclide and then by level
+  /// energy.  Only holds the basic level entries (rx_id == 0).
+  extern decay_table<level_data> level_data_lvl_map;
+  /// Level data for nuclides in id form, sorted by nuclide and then by the
+  /// rx id of the decay reaction.
+  extern decay_table<level_data> level_data_rx_map;
 
   template<> void _load_data<level_data>();
 
@@ -443,6 +983,8 @@ namespace pyne
   double decay_const(char * nuc);
   /// Returns the decay constant for a nuclide \a nuc.
   double decay_const(std::string nuc);
+  /// Returns the decay constants of the nuclides of \a index, in index order.
+  std::vector<double> decay_const(const NuclideIndex& index);
 
   /// \brief Returns the branch ratio for a parent/child nuclide pair.
   ///
@@ -501,8 +1043,9 @@ namespace pyne
   /// Loads the decay data from the nuc_data.h5 file into memory.
   template<> void _load_data<decay>();
   /// Mapping from a pair of nuclides in id form to a struct containing data
-  /// associated with the decay from the first to the second
-  extern std::map<std::pair<int, int>, decay> decay_data;
+  /// associated with the decay from the first to the second, sorted by parent
+  /// and then by child
+  extern decay_table<decay> decay_data;
 
   //
   //
@@ -539,7 +1082,8 @@ namespace pyne
   /// Loads the gamma ray data from the nuc_data.h5 file into memory.
   template<> void _load_data<gamma>();
 
-  extern std::map<std::pair<int, double>, gamma> gamma_data;
+  /// Columnar gamma data, sorted by parent and then by energy
+  extern decay_table<gamma> gamma_data;
 
   //returns a list of gamma decay energies from input parent nuclide
   std::vector<std::pair<double, double> > gamma_energy(int parent);
@@ -586,8 +1130,8 @@ namespace pyne
   /// Loads the alpha decay data from the nuc_data.h5 file into memory.
   template<> void _load_data<alpha>();
 
-  /// A vector of structs containing alpha data for access in memory
-  extern std::map<std::pair<int, double>, alpha> alpha_data;
+  /// Columnar alpha data, sorted by parent and then by energy
+  extern decay_table<alpha> alpha_data;
 
   //returns a list of alpha decay energies from input parent nuclide
   std::vector<double > alpha_energy(int parent);
@@ -612,8 +1156,8 @@ namespace pyne
   /// Loads the beta decay data from the nuc_data.h5 file into memory.
   template<> void _load_data<beta>();
 
-  /// A vector of structs containing beta data for access in memory
-  extern std::map<std::pair<int, double>, beta> beta_data;
+  /// Columnar beta data, sorted by parent and then by average energy
+  extern decay_table<beta> beta_data;
   //returns a list of beta decay endpoint energies from input parent nuclide
   std::vector<double > beta_endpoint_energy(int parent);
   //returns a list of beta decay average energies from input parent nuclide
@@ -640,8 +1184,8 @@ namespace pyne
     double m_conv_e; ///< m conversion electron fraction
   } ecbp;
 
-  /// A vector of structs containing ecbp data for access in memory
-  extern std::map<std::pair<int, double>, ecbp> ecbp_data;
+  /// Columnar ecbp data, sorted by parent and then by average energy
+  extern decay_table<ecbp> ecbp_data;
 
   /// Loads the electron capture and beta plus decay data from the
   /// nuc_data.h5 file into memory.
@@ -675,6 +1219,32 @@ namespace pyne
   extern std::map<std::string, std::map<int, std::map<int, double> > >
       simple_xs_map;
 
+  /// Energy groups of the simple_xs data.
+  enum simple_xs_group {
+    SIMPLE_XS_THERMAL,               ///< "thermal"
+    SIMPLE_XS_THERMAL_MAXWELL_AVE,   ///< "thermal_maxwell_ave"
+    SIMPLE_XS_RESONANCE_INTEGRAL,    ///< "resonance_integral"
+    SIMPLE_XS_FOURTEEN_MEV,          ///< "fourteen_MeV"
+    SIMPLE_XS_FISSION_SPECTRUM_AVE,  ///< "fission_spectrum_ave"
+    SIMPLE_XS_NGROUPS                ///< number of groups
+  };
+
+  /// returns the simple_xs_group named \a energy, throwing InvalidSimpleXS
+  /// if there is none.
+  simple_xs_group simple_xs_group_id(std::string energy);
+
+  /// returns the microscopic cross section in barns for the specified
+  /// nuclide, reaction, and energy group.
+  double simple_xs(int nuc, int rx, simple_xs_group group);
+  /// \brief Looks up the cross sections in barns of \a n nuclides at once.
+  ///
+  /// Writes the cross section of reaction \a rx in \a group for each of
+  /// \a nucs into \a out.  Nuclides without data in the group get NaN; an
+  /// invalid reaction or group throws InvalidSimpleXS.  Lookups are fastest
+  /// when \a nucs is sorted, as it is for a Material's composition.
+  void simple_xs(const int* nucs, size_t n, int rx, simple_xs_group group,
+                 double* out);
+
   /// returns the microscopic cross section in barns for the specified
   /// nuclide, reaction, and energy group.  energy must be one of: "thermal",
   /// "thermal_maxwell_ave", "resonance_integral", "fourteen_MeV",
@@ -712,6 +1282,35 @@ namespace pyne
     std::string msg_;
   };
 
+
+  /// \name Preloading
+  /// \{
+
+  /// Load time and memory of one nuclear data table, see preload_data().
+  struct data_load_stats {
+    std::string table;  ///< table name, one of data_table_names()
+    bool loaded;        ///< true if the table is in memory
+    double seconds;     ///< wall time preload_data() spent loading it [s]
+    size_t bytes;       ///< approximate heap memory held by the table [bytes]
+  };
+
+  /// Names of the tables that preload_data() accepts.
+  std::vector<std::string> data_table_names();
+  /// Loads \a tables up front rather than on first access.  The tables are
+  /// loaded concurrently on up to \a nthreads threads, one per table and at
+  /// most the hardware concurrency by default; reads from nuc_data.h5 are
+  /// serialized but overlap the building of the other tables' maps and
+  /// indexes.  Tables that are already loaded are skipped.  Returns the stats
+  /// of each table in the order given.  Unknown names throw pyne::ValueError;
+  /// if a table fails to load the first error is rethrown once all threads
+  /// are done.
+  std::vector<data_load_stats> preload_data(
+    const std::vector<std::string>& tables, int nthreads=0);
+  /// The stats of \a table: whether it is loaded, its current memory and the
+  /// time the last preload_data() call spent on it.
+  data_load_stats data_load_info(std::string table);
+  /// \}
+
 } // namespace pyne
 
 #endif
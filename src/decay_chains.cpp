@@ -0,0 +1,108 @@
+// Implements the evaluation of tabulated decay chains.
+#include <cmath>
+
+#ifndef PYNE_IS_AMALGAMATED
+#include "decay_chains.h"
+#endif
+
+
+void pyne::decayers::bateman(const DecayChains& chains, const double* x,
+                             double t, double* out, double* work) {
+  const double tpow[2] = {1.0, t};
+  double* b = work;
+  b[0] = 1.0;
+  for (int p = 0; p < chains.n; ++p) {
+    const double xp = x[p];
+    if (xp == 0.0)
+      continue;
+
+    // the exponentials of this parent's chains
+    const int e0 = chains.exp_ptr[p];
+    const int ne = chains.exp_ptr[p+1] - e0;
+    const double* a = chains.exp_a + e0;
+    for (int e = 0; e < ne; ++e)
+      b[e+1] = std::exp2(a[e] * t);
+
+    // scatter every term into its child
+    const int q1 = chains.term_ptr[p+1];
+    for (int q = chains.term_ptr[p]; q < q1; ++q)
+      out[chains.term_child[q]] += xp * chains.term_k[q] *
+                                   tpow[chains.term_tpow[q]] *
+                                   b[chains.term_exp[q]];
+  }
+}
+
+
+void pyne::decayers::bateman(const DecayChains& chains, const double* x,
+                             const double* times, int ntimes, double* out,
+                             double* work) {
+  const int n = chains.n;
+  double* b = work;
+  for (int j = 0; j < ntimes; ++j)
+    b[j] = 1.0;
+  for (int p = 0; p < n; ++p) {
+    const double xp = x[p];
+    if (xp == 0.0)
+      continue;
+
+    // the exponentials of this parent's chains at every time, row e+1 of b
+    const int e0 = chains.exp_ptr[p];
+    const int ne = chains.exp_ptr[p+1] - e0;
+    for (int e = 0; e < ne; ++e) {
+      const double a = chains.exp_a[e0 + e];
+      double* be = b + (e + 1) * ntimes;
+      for (int j = 0; j < ntimes; ++j)
+        be[j] = std::exp2(a * times[j]);
+    }
+
+    // scatter every term into its child at every time
+    const int q1 = chains.term_ptr[p+1];
+    for (int q = chains.term_ptr[p]; q < q1; ++q) {
+      const double c = xp * chains.term_k[q];
+      const double* bq = b + chains.term_exp[q] * ntimes;
+      double* o = out + chains.term_child[q];
+      if (chains.term_tpow[q] == 0)
+        for (int j = 0; j < ntimes; ++j)
+          o[j*n] += c * bq[j];
+      else
+        for (int j = 0; j < ntimes; ++j)
+          o[j*n] += c * times[j] * bq[j];
+    }
+  }
+}
+
+
+std::map<int, double> pyne::decayers::bateman(
+    const DecayChains& chains, const NuclideIndex& index,
+    const std::map<int, double>& comp, double t) {
+  std::map<int, double> outcomp;
+  std::vector<double> x (chains.n, 0.0);
+  std::map<int, double>::const_iterator it = comp.begin();
+  for (; it != comp.end(); ++it) {
+    int i = index.index(it->first);
+    if (i < 0)
+      outcomp.insert(*it);
+    else
+      x[i] += it->second;
+  }
+
+  std::vector<double> out (chains.n, 0.0);
+  std::vector<double> work (chains.max_exps + 1);
+  bateman(chains, x.data(), t, out.data(), work.data());
+  for (int i = 0; i < chains.n; ++i)
+    if (out[i] > 0.0)
+      outcomp[index.nuc(i)] = out[i];
+  return outcomp;
+}
+
+
+std::vector<double> pyne::decayers::bateman(
+    const DecayChains& chains, const NuclideIndex& index,
+    const std::map<int, double>& comp, const std::vector<double>& times) {
+  std::vector<double> x = index.to_dense(comp);
+  const int ntimes = times.size();
+  std::vector<double> out (ntimes * chains.n, 0.0);
+  std::vector<double> work ((chains.max_exps + 1) * ntimes);
+  bateman(chains, x.data(), times.data(), ntimes, out.data(), work.data());
+  return out;
+}
@@ -0,0 +1,78 @@
+/// \file decay_chains.h
+/// \brief Evaluates the Bateman solutions that decaygen.py tabulates.
+///
+/// decaygen.py solves the decay chains of every nuclide once, ahead of
+/// time, and writes the coefficients and decay constants of the solutions
+/// into the flat arrays of a DecayChains.  The functions here evaluate
+/// those tables for any time, so the generated decay.cpp holds only data
+/// and the arithmetic is compiled with full optimization.
+
+#ifndef PYNE_ZSZUU6KRHRO7SC5ZLBAZ6SKZVA
+#define PYNE_ZSZUU6KRHRO7SC5ZLBAZ6SKZVA
+#include <map>
+#include <vector>
+
+#ifndef PYNE_IS_AMALGAMATED
+#include "nuclide_index.h"
+#endif
+
+namespace pyne {
+namespace decayers {
+
+  /// \brief Tabulated Bateman solutions for the decay of a set of nuclides.
+  ///
+  /// After a time t, a unit amount of parent p has left
+  ///
+  ///   sum_q k[q] t^tpow[q] b[exp[q]]
+  ///
+  /// of child[q], summed over the terms q of p that have that child.  b[0]
+  /// is 1 and b[e] = 2^(a[e-1] t) for the exponents e = 1, 2, ... of p, so
+  /// the exponentials shared by a parent's chains are computed only once.
+  /// Parents and children are positions in \a nucs.
+  struct DecayChains {
+    int n;                       ///< number of nuclides
+    const int* nucs;             ///< nuclides, in state id form
+    const int* exp_ptr;          ///< exponents of p are exp_ptr[p]..exp_ptr[p+1]
+    const double* exp_a;         ///< base-2 exponent per unit time [1/s]
+    const int* term_ptr;         ///< terms of p are term_ptr[p]..term_ptr[p+1]
+    const int* term_child;       ///< child of each term
+    const int* term_exp;         ///< exponent of each term, 0 for a constant
+    const unsigned char* term_tpow;  ///< power of t of each term, 0 or 1
+    const double* term_k;        ///< coefficient of each term
+    int max_exps;                ///< most exponents of any one parent
+  };
+
+  /// Adds the decay of \a x over time \a t to \a out.  Both are dense over
+  /// chains.nucs, and \a work holds chains.max_exps + 1 doubles.
+  /// \param t The decay time [s]
+  void bateman(const DecayChains& chains, const double* x, double t,
+               double* out, double* work);
+
+  /// Adds the decay of \a x to each of \a ntimes times to \a out, whose
+  /// row j, out[j*chains.n] to out[(j+1)*chains.n], is the decay to times[j].
+  /// The exponentials of a parent are evaluated for all times in one
+  /// contiguous loop before its terms are scattered.  \a work holds
+  /// (chains.max_exps + 1) * ntimes doubles.
+  /// \param times The decay times [s]
+  void bateman(const DecayChains& chains, const double* x, const double* times,
+               int ntimes, double* out, double* work);
+
+  /// Decays the composition \a comp for time \a t [s].  Nuclides that are
+  /// not in \a index, which must be built over chains.nucs in id form, are
+  /// passed through unchanged.
+  std::map<int, double> bateman(const DecayChains& chains,
+                                const NuclideIndex& index,
+                                const std::map<int, double>& comp, double t);
+
+  /// Decays the composition \a comp to each of \a times [s].  Returns the
+  /// dense times.size() x chains.n matrix of bateman() above, row-major.
+  /// Nuclides that are not in \a index are dropped.
+  std::vector<double> bateman(const DecayChains& chains,
+                              const NuclideIndex& index,
+                              const std::map<int, double>& comp,
+                              const std::vector<double>& times);
+
+}  // namespace decayers
+}  // namespace pyne
+
+#endif  // PYNE_ZSZUU6KRHRO7SC5ZLBAZ6SKZVA
@@ -1,6 +1,8 @@
 #! /usr/bin/env python
-"""This file generates a static C++ decayer function for use with PyNE.
-It is suppossed to be fast.
+"""This file generates the static C++ decay chain tables for use with PyNE.
+The Bateman solution of every chain is worked out here, once, and written out
+as flat arrays of coefficients and decay constants that decay_chains.cpp
+evaluates.  It is suppossed to be fast.
 """
 import os
 import io
@@ -51,14 +53,44 @@ HEADER = ENV.from_string("""
 // {{ args }}
 
 #include <map>
+#include <vector>
+
+#ifndef PYNE_IS_AMALGAMATED
+#include "nuclide_index.h"
+#include "decay_chains.h"
+#endif
 
 namespace pyne {
 namespace decayers {
 
 extern const int all_nucs[{{ nucs|length }}];
 
+/// The nuclides of all_nucs in id form, as a dense index.
+const NuclideIndex& all_nucs_index();
+
+/// The decay chains of all_nucs, for bateman().
+const DecayChains& all_chains();
+
+/// Decays the atom fractions \a x for time \a t [s] into \a out.  Both
+/// are dense in all_nucs order, and nothing is allocated.
+void decay(const double* x, double t, double* out);
+
+/// Decays the atom fractions \a x to each of the \a ntimes \a times [s].
+/// Row j of \a out, all_nucs long, is set to the result at times[j].
+/// Nothing is allocated.
+void decay(const double* x, const double* times, int ntimes, double* out);
+
+/// Decays the composition \a comp for time \a t [s].  Nuclides that are
+/// not in all_nucs are passed through unchanged.
 std::map<int, double> decay(std::map<int, double> comp, double t);
 
+/// Decays \a comp to each of \a times [s] in one pass over the chains.
+/// Returns the atom fractions as a dense times.size() x all_nucs matrix,
+/// row-major with nuclides in all_nucs order.  Nuclides that are not in
+/// all_nucs are dropped.
+std::vector<double> decay(const std::map<int, double>& comp,
+                          const std::vector<double>& times);
+
 }  // namespace decayers
 }  // namespace pyne
 
@@ -73,80 +105,75 @@ SOURCE = ENV.from_string("""
 // This file was generated with the following command:
 // {{ args }}
 
-#include <cmath>
-#include "decay.h"
+#include <algorithm>
 
 #ifdef PYNE_IS_AMALGAMATED
 #include "pyne.h"
 #else
+#include "decay.h"
 #include "nucname.h"
 #endif
 
 namespace pyne {
 namespace decayers {
 
-{{ funcs }}
-
-std::map<int, double> decay(std::map<int, double> comp, double t) {
-  // setup
-  using std::map;
-  int nuc;
-  int i = 0;
-  double out [{{ nucs|length }}] = {};  // init to zero
-  map<int, double> outcomp;
-
-  // body
-  map<int, double>::const_iterator it = comp.begin();
-  for (; it != comp.end(); ++it) {
-    switch (nucname::znum(it->first)) {
-      {{ cases|indent(6) }}
-      default:
-        outcomp.insert(*it);
-        break;
-    }
-  }
-
-  // cleanup
-  for (i = 0; i < {{ nucs|length }}; ++i)
-    if (out[i] > 0.0)
-      outcomp[nucname::state_id_to_id(all_nucs[i])] = out[i];
-  return outcomp;
-}
-
 const int all_nucs [{{ nucs|length }}] = {
 {{ nucs | join(", ") | wordwrap(width=78, break_long_words=False) | indent(2, True) }}
 };
 
-}  // namespace decayers
-}  // namespace pyne
+namespace {
+// Bateman solutions of the decay chains of all_nucs, see decay_chains.h.
+{{ tables }}
+}  // namespace
 
-#endif  // PYNE_DECAY_IS_DUMMY
-""".strip())
+const DecayChains& all_chains() {
+  static const DecayChains chains = {
+    {{ nucs|length }}, all_nucs, exp_ptr, exp_a, term_ptr, term_child,
+    term_exp, term_tpow, term_k, {{ max_exps }}};
+  return chains;
+}
+
+void decay(const double* x, double t, double* out) {
+  double work [{{ max_exps + 1 }}];
+  std::fill(out, out + {{ nucs|length }}, 0.0);
+  bateman(all_chains(), x, t, out, work);
+}
+
+void decay(const double* x, const double* times, int ntimes, double* out) {
+  // in blocks of eight times, so that the work space fits on the stack
+  double work [{{ 8 * (max_exps + 1) }}];
+  std::fill(out, out + (size_t) ntimes * {{ nucs|length }}, 0.0);
+  for (int j = 0; j < ntimes; j += 8)
+    bateman(all_chains(), x, times + j, std::min(8, ntimes - j),
+            out + (size_t) j * {{ nucs|length }}, work);
+}
 
+std::map<int, double> decay(std::map<int, double> comp, double t) {
+  return bateman(all_chains(), all_nucs_index(), comp, t);
+}
 
-ELEM_FUNC = ENV.from_string("""
-void decay_{{ elem|lower }}(double t, std::map<int, double>::const_iterator &it, std::map<int, double> &outcomp, double (&out)[{{ nucs|length }}]) {
-  //using std::exp2;
-  switch (nucname::id_to_state_id(it->first)) {
-    {{ cases|indent(4) }}
-    } default: {
-      outcomp.insert(*it);
-      break;
-    }
-  }
+std::vector<double> decay(const std::map<int, double>& comp,
+                          const std::vector<double>& times) {
+  return bateman(all_chains(), all_nucs_index(), comp, times);
 }
-""".strip())
 
+static NuclideIndex build_all_nucs_index() {
+  std::vector<int> nucs ({{ nucs|length }});
+  for (int i = 0; i < {{ nucs|length }}; ++i)
+    nucs[i] = nucname::state_id_to_id(all_nucs[i]);
+  return NuclideIndex(nucs);
+}
 
-# Some strings that need not be redefined
-BREAK = '  break;'
-CHAIN_STMT = '  out[{0}] += {1};'
-CHAIN_EXPR = '(it->second) * ({0})'
-EXP_EXPR = 'exp2({a:.17e}*t)'
-KEXP_EXPR = '{k:.17e}*' + EXP_EXPR
-B_STMT = 'double b{b} = {exp};'
-B_EXPR = 'b{b}'
-KB_EXPR = '{k:.17e}*' + B_EXPR
+const NuclideIndex& all_nucs_index() {
+  static const NuclideIndex index = build_all_nucs_index();
+  return index;
+}
+
+}  // namespace decayers
+}  // namespace pyne
+
+#endif  // PYNE_DECAY_IS_DUMMY
+""".strip())
 
 
 def genfiles(nucs, short=1e-16, small=1e-16, sf=False, dummy=False, debug=False):
@@ -156,8 +183,8 @@ def genfiles(nucs, short=1e-16, small=1e-16, sf=False, dummy=False, debug=False)
         dummy_ifdef=('ifdef' if dummy else 'ifndef'),
         args=' '.join(sys.argv)
         )
-    ctx.cases = gencases(nucs, debug=debug)
-    ctx.funcs = genelemfuncs(nucs, short=short, small=small, sf=sf, debug=debug)
+    ctx.tables, ctx.max_exps = gentables(nucs, short=short, small=small, sf=sf,
+                                         debug=debug)
     hdr = HEADER.render(ctx.__dict__)
     src = SOURCE.render(ctx.__dict__)
     return hdr, src
@@ -329,119 +356,101 @@ def k_a_from_hl(chain, short=1e-16, small=1e-16):
     return k[mask], a[mask], t_term[mask]
 
 
-def kbexpr(k, b):
-    if k == 1.0:
-        return B_EXPR.format(b=b)
-    else:
-        return KB_EXPR.format(k=k, b=b)
-
-
-def ensure_cse(a_i, b, cse):
-    bkey = EXP_EXPR.format(a=a_i)
-    if bkey not in cse:
-        b += 1
-        cse[bkey] = b
-    return b
-
-def b_from_a(cse, a_i):
-    bkey = EXP_EXPR.format(a=a_i)
-    return cse[bkey]
-
-
-def chainexpr(chain, cse, b, bt, short=1e-16, small=1e-16):
+def chainterms(chain, cse, bt, short=1e-16, small=1e-16):
+    """Returns the terms (k, exponent, power of t) of the amount of the last
+    nuclide of chain left by a unit of the first.  Exponents are numbered
+    from 1 in cse, which is shared by all chains of the parent, and 0 marks
+    a constant term.  bt is the amount that constant terms have already
+    sent to stable nuclides, which is capped at one."""
     child = chain[-1]
     if len(chain) == 1:
         a_i = -1.0 / half_life(child, False)
-        b = ensure_cse(a_i, b, cse)
-        terms = B_EXPR.format(b=b_from_a(cse, a_i))
-    else:
-        k, a, t_term = k_a_from_hl(chain, short=short, small=small)
-        if k is None:
-            return None, b, bt
-        terms = []
-        for k_i, a_i, t_term_i in zip(k, a, t_term):
-            if k_i == 1.0 and a_i == 0.0:
-                term = str(1.0 - bt)  # a slight optimization
-                bt = 1
-            elif a_i == 0.0:
-                if not np.isnan(k_i):
-                    if bt < 1:
-                        if k_i + bt < 1:
-                            term = '{0:.17e}'.format(k_i)  # another slight optimization
-                            bt += k_i
-                        else:
-                            term = '{0:.17e}'.format(1.0 - bt)
-                            bt = 1.0
-                    else:
-                        term = '0'
-                else:
-                    term = '0'
+        cse.setdefault(a_i, len(cse) + 1)
+        return [(1.0, cse[a_i], 0)], bt
+    k, a, t_term = k_a_from_hl(chain, short=short, small=small)
+    if k is None:
+        return None, bt
+    terms = []
+    for k_i, a_i, t_term_i in zip(k, a, t_term):
+        if k_i == 1.0 and a_i == 0.0:
+            term = (1.0 - bt, 0)  # a slight optimization
+            bt = 1
+        elif a_i == 0.0:
+            if np.isnan(k_i) or bt >= 1:
+                continue
+            if k_i + bt < 1:
+                term = (k_i, 0)  # another slight optimization
+                bt += k_i
             else:
-                b = ensure_cse(a_i, b, cse)
-                term = kbexpr(k_i, b_from_a(cse, a_i))
-            # multiply by t if needed
-            if t_term_i:
-                term += '*t'
-            terms.append(term)
-        terms = ' + '.join(terms)
-    return CHAIN_EXPR.format(terms), b, bt
-
-
-def gencase(nuc, idx, b, short=1e-16, small=1e-16, sf=False, debug=False):
-    case = ['}} case {0}: {{'.format(nuc)]
+                term = (1.0 - bt, 0)
+                bt = 1.0
+        else:
+            cse.setdefault(a_i, len(cse) + 1)
+            term = (k_i, cse[a_i])
+        terms.append(term + (1 if t_term_i else 0,))
+    return terms, bt
+
+
+def genparent(nuc, idx, short=1e-16, small=1e-16, sf=False, debug=False):
+    """Returns the exponents of the decay of nuc, and its terms as
+    (child, k, exponent, power of t)."""
     dc = decay_const(nuc, False)
     if dc == 0.0:
         # stable nuclide
-        case.append(CHAIN_STMT.format(idx[nuc], 'it->second'))
-    else:
-        chains = genchains([(nuc,)], sf=sf)
-        print('{} has {} chains'.format(nucname.name(nuc), len(set(chains))))
-        cse = {}  # common sub-expression exponents to elimnate
-        bt = 0
-        for c in chains:
-            if c[-1] not in idx:
-                continue
-            cexpr, b, bt = chainexpr(c, cse, b, bt, short=short, small=small)
-            if cexpr is None:
-                continue
-            if debug:
-                case.append('  // ' + ' -> '.join(map(nucname.name, c)))
-            case.append(CHAIN_STMT.format(idx[c[-1]], cexpr))
-        bstmts = ['  ' + B_STMT.format(exp=exp, b=bval) for exp, bval in \
-                  sorted(cse.items(), key=lambda x: x[1])]
-        case = case[:1] + bstmts + case[1:]
-    case.append(BREAK)
-    return case, b
-
-
-def elems(nucs):
-    return sorted(set(map(nucname.znum, nucs)))
-
-
-def gencases(nucs, debug=False):
-    switches = []
-    for i in elems(nucs):
-        c = ['case {0}:'.format(i),
-             '  decay_{0}(t, it, outcomp, out);'.format(nucname.name(i).lower()),
-             '  break;']
-        switches.append('\n'.join(c))
-    return '\n'.join(switches)
-
-
-def genelemfuncs(nucs, short=1e-16, small=1e-16, sf=False, debug=False,):
+        return [], [(idx[nuc], 1.0, 0, 0)]
+    chains = genchains([(nuc,)], sf=sf)
+    print('{} has {} chains'.format(nucname.name(nuc), len(set(chains))))
+    cse = {}  # common sub-expression exponents to elimnate
+    bt = 0
+    terms = []
+    for c in chains:
+        if c[-1] not in idx:
+            continue
+        cterms, bt = chainterms(c, cse, bt, short=short, small=small)
+        if cterms is None:
+            continue
+        if debug:
+            print('  ' + ' -> '.join(map(nucname.name, c)))
+        terms += [(idx[c[-1]],) + term for term in cterms]
+    exps = [a for a, e in sorted(cse.items(), key=lambda x: x[1])]
+    return exps, terms
+
+
+def genarray(ctype, name, values, fmt='{0}', perline=8):
+    """A constant C++ array, padded so that it is never empty."""
+    values = [fmt.format(v) for v in values] or [fmt.format(0)]
+    lines = [', '.join(values[i:i+perline])
+             for i in range(0, len(values), perline)]
+    return 'const {0} {1} [{2}] = {{\n  {3}}};\n'.format(
+        ctype, name, len(values), ',\n  '.join(lines))
+
+
+def gentables(nucs, short=1e-16, small=1e-16, sf=False, debug=False):
+    """Returns the source of the chain tables of nucs, and the most
+    exponents of any one nuclide."""
     idx = dict(zip(nucs, range(len(nucs))))
-    cases = {i: [-1, []] for i in elems(nucs)}
+    exp_ptr, exp_a = [0], []
+    term_ptr, child, expn, tpow, k = [0], [], [], [], []
     for nuc in nucs:
-        z = nucname.znum(nuc)
-        case, cases[z][0] = gencase(nuc, idx, cases[z][0], short=short, sf=sf,
-                                    debug=debug, small=small)
-        cases[z][1] += case
-    funcs = []
-    for i, (b, kases) in cases.items():
-        kases[0] = kases[0][2:]
-        ctx = dict(nucs=nucs, elem=nucname.name(i), cases='\n'.join(kases))
-        funcs.append(ELEM_FUNC.render(ctx))
-    return "\n\n".join(funcs)
+        exps, terms = genparent(nuc, idx, short=short, small=small, sf=sf,
+                                debug=debug)
+        exp_a += exps
+        exp_ptr.append(len(exp_a))
+        for c, k_i, e, p in terms:
+            child.append(c)
+            k.append(k_i)
+            expn.append(e)
+            tpow.append(p)
+        term_ptr.append(len(child))
+    max_exps = max(b - a for a, b in zip(exp_ptr[:-1], exp_ptr[1:]))
+    tables = [genarray('int', 'exp_ptr', exp_ptr),
+              genarray('double', 'exp_a', exp_a, '{0:.17e}', 4),
+              genarray('int', 'term_ptr', term_ptr),
+              genarray('int', 'term_child', child),
+              genarray('int', 'term_exp', expn, perline=16),
+              genarray('unsigned char', 'term_tpow', tpow, perline=16),
+              genarray('double', 'term_k', k, '{0:.17e}', 4)]
+    return '\n'.join(tables), max_exps
 
 
 def load_default_nucs():
@@ -7,6 +7,7 @@
 #include <iomanip>  // std::setprecision
 #include <math.h>   // modf
 #include <stdexcept>
+#include <algorithm>
 
 #ifndef PYNE_IS_AMALGAMATED
 #include "transmuters.h"
@@ -1561,9 +1562,8 @@ pyne::Material pyne::Material::expand_elements(std::set<int> exception_ids) {
   // a sorted manner in C++.
   int n, nabund, znuc, zabund;
   comp_map newcomp;
-  std::map<int, double>::iterator abund_itr, abund_end;
-  if (pyne::natural_abund_map.empty())
-    pyne::_load_atomic_mass_map();
+  std::map<int, double>::const_iterator abund_itr, abund_end;
+  pyne::_ensure_atomic_mass_map();
   abund_itr = pyne::natural_abund_map.begin();
   abund_end = pyne::natural_abund_map.end();
   zabund = nucname::znum((*abund_itr).first);
@@ -1941,15 +1941,73 @@ std::map<int, double> pyne::Material::to_atom_dens() {
 }
 
 
+/*--- Dense Composition Functions ---*/
+namespace {
+void check_dense_size(const pyne::NuclideIndex& index,
+                      const std::vector<double>& x) {
+  if ((int) x.size() != index.size())
+    throw pyne::ValueError("Dense composition has " + pyne::to_str((int) x.size()) +
+                           " entries but the index has " +
+                           pyne::to_str(index.size()) + ".");
+}
+}  // namespace
+
+
+std::vector<double> pyne::Material::to_dense(const NuclideIndex& index) {
+  return index.to_dense(comp);
+}
+
+
+void pyne::Material::from_dense(const NuclideIndex& index,
+                                const std::vector<double>& x) {
+  check_dense_size(index, x);
+  comp = index.to_map(x.data());
+  norm_comp();
+}
+
+
+std::vector<double> pyne::Material::to_atom_frac(const NuclideIndex& index) {
+  double mat_mw = molecular_mass();
+  std::vector<double> af = index.to_dense(comp);
+  std::vector<double> aw = pyne::atomic_mass(index);
+  for (int i = 0; i < index.size(); ++i)
+    if (af[i] != 0.0)
+      af[i] *= mat_mw / aw[i];
+  return af;
+}
+
+
+void pyne::Material::from_atom_frac(const NuclideIndex& index,
+                                    const std::vector<double>& x) {
+  check_dense_size(index, x);
+  comp.clear();
+  atoms_per_molecule = 0.0;
+  std::vector<double> aw = pyne::atomic_mass(index);
+  for (int i = 0; i < index.size(); ++i) {
+    if (x[i] <= 0.0 || index.nuc(i) < 0)
+      continue;
+    comp[index.nuc(i)] = x[i] * aw[i];
+    atoms_per_molecule += x[i];
+  }
+  norm_comp();
+}
+
+
 std::vector<std::pair<double, double> > pyne::Material::gammas() {
   std::vector<std::pair<double, double> > result;
   std::map<int, double> atom_fracs = this->to_atom_frac();
-  int state_id;
+  std::vector<int> state_ids;
   for (comp_iter ci = comp.begin(); ci != comp.end(); ci++) {
     if (ci->first % 10000 > 0)
-        state_id = nucname::id_to_state_id(ci->first);
+        state_ids.push_back(nucname::id_to_state_id(ci->first));
     else
-        state_id = ci->first;
+        state_ids.push_back(ci->first);
+  }
+  // fetch the decay data for just these nuclides in one pass
+  pyne::load_decay_parents(state_ids);
+  int n = 0;
+  for (comp_iter ci = comp.begin(); ci != comp.end(); ci++, n++) {
+    int state_id = state_ids[n];
 
     std::vector<std::pair<double, double> > raw_gammas = pyne::gammas(state_id);
     for (int i = 0; i < raw_gammas.size(); ++i) {
@@ -1964,12 +2022,18 @@ std::vector<std::pair<double, double> > pyne::Material::gammas() {
 std::vector<std::pair<double, double> > pyne::Material::xrays() {
   std::vector<std::pair<double, double> > result;
   std::map<int, double> atom_fracs = this->to_atom_frac();
-  int state_id;
+  std::vector<int> state_ids;
   for (comp_iter ci = comp.begin(); ci != comp.end(); ci++) {
     if (ci->first % 10000 > 0)
-        state_id = nucname::id_to_state_id(ci->first);
+        state_ids.push_back(nucname::id_to_state_id(ci->first));
     else
-        state_id = ci->first;
+        state_ids.push_back(ci->first);
+  }
+  // fetch the decay data for just these nuclides in one pass
+  pyne::load_decay_parents(state_ids);
+  int n = 0;
+  for (comp_iter ci = comp.begin(); ci != comp.end(); ci++, n++) {
+    int state_id = state_ids[n];
 
     std::vector<std::pair<double, double> > raw_xrays = pyne::xrays(state_id);
     for (int i = 0; i < raw_xrays.size(); ++i) {
@@ -2010,21 +2074,203 @@ std::vector<std::pair<double, double> > pyne::Material::normalize_radioactivity(
 
 
 #ifdef PYNE_DECAY
+namespace {
+  // Atomic masses of the nuclides of the decay chains.
+  const std::vector<double>& decay_atomic_mass() {
+    static const std::vector<double> aw =
+      pyne::atomic_mass(pyne::decayers::all_nucs_index());
+    return aw;
+  }
+
+  // Decays mat to each of the ntimes times into rtn[0] to rtn[ntimes-1],
+  // going through the dense decay with x and y as scratch space, all_nucs
+  // and ntimes * all_nucs long.  This only reads mat and the atomic masses,
+  // so materials may be decayed from several threads once
+  // decay_atomic_mass() has been loaded.
+  void decay_material(const pyne::Material& mat, const double* times,
+                      int ntimes, double* x, double* y, pyne::Material* rtn) {
+    const pyne::NuclideIndex& index = pyne::decayers::all_nucs_index();
+    const std::vector<double>& aw = decay_atomic_mass();
+    const int n = index.size();
+
+    // as to_atom_frac(), but dense and per unit molecular mass, which the
+    // decay is linear in.  Nuclides that have no decay chains are kept
+    // aside to pass straight through.
+    pyne::comp_map untracked;
+    double inverseA = 0.0;
+    double untrackedA = 0.0;
+    std::fill(x, x + n, 0.0);
+    for (pyne::comp_map::const_iterator ci = mat.comp.begin();
+         ci != mat.comp.end(); ci++) {
+      int i = index.index(ci->first);
+      if (0 <= i) {
+        x[i] = ci->second / aw[i];
+        inverseA += x[i];
+      } else {
+        double xi = ci->second / pyne::atomic_mass(ci->first);
+        inverseA += xi;
+        untrackedA += xi;
+        untracked.insert(untracked.end(), *ci);
+      }
+    }
+    const double apm = 0.0 <= mat.atoms_per_molecule ?
+                       mat.atoms_per_molecule : 1.0;
+    const double mw = inverseA == 0.0 ? 0.0 : apm / inverseA;
+    for (pyne::comp_iter ci = untracked.begin(); ci != untracked.end(); ci++)
+      ci->second *= mw;
+
+    // decay, and then as from_atom_frac()
+    pyne::decayers::decay(x, times, ntimes, y);
+    for (int j = 0; j < ntimes; ++j) {
+      pyne::Material& r = rtn[j];
+      const double* yj = y + (size_t) j * n;
+      r.comp = untracked;
+      r.atoms_per_molecule = untrackedA * mw;
+      for (int i = 0; i < n; ++i) {
+        if (yj[i] <= 0.0)
+          continue;
+        r.comp[index.nuc(i)] = yj[i] * mw * aw[i];
+        r.atoms_per_molecule += yj[i] * mw;
+      }
+      r.norm_comp();
+      r.mass = mat.mass * r.molecular_mass() / mw;
+    }
+  }
+
+  // Decays every material of mats to the ntimes times on nthreads threads,
+  // into rtn[m*ntimes] to rtn[(m+1)*ntimes - 1] for material m.
+  void decay_many(const std::vector<pyne::Material>& mats,
+                  const double* times, int ntimes, int nthreads,
+                  pyne::Material* rtn) {
+    const size_t n = pyne::decayers::all_nucs_index().size();
+    decay_atomic_mass();  // loaded here, before the threads read it
+
+    // each material is taken by whichever thread is free, and every thread
+    // decays through its own scratch space
+    nthreads = pyne::task_threads(nthreads, mats.size());
+    std::vector<double> work (nthreads * (n + ntimes * n));
+    pyne::run_tasks(mats.size(), nthreads, [&](size_t m, int w) {
+      double* x = work.data() + w * (n + ntimes * n);
+      decay_material(mats[m], times, ntimes, x, x + n, rtn + m * ntimes);
+    });
+  }
+}  // namespace
+
+
 pyne::Material pyne::Material::decay(double t) {
+  const int n = pyne::decayers::all_nucs_index().size();
+  std::vector<double> work (2 * n);
   Material rtn;
-  comp_map out = pyne::decayers::decay(to_atom_frac(), t);
-  rtn.from_atom_frac(out);
-  rtn.mass = mass * rtn.molecular_mass() / molecular_mass();
+  decay_material(*this, &t, 1, work.data(), work.data() + n, &rtn);
+  return rtn;
+}
+
+
+std::vector<pyne::Material> pyne::Material::decay(
+    const std::vector<double>& times) {
+  const int n = pyne::decayers::all_nucs_index().size();
+  std::vector<double> work (n + times.size() * n);
+  std::vector<Material> rtn (times.size());
+  decay_material(*this, times.data(), times.size(), work.data(),
+                 work.data() + n, rtn.data());
+  return rtn;
+}
+
+
+std::vector<pyne::Material> pyne::decay_many(const std::vector<Material>& mats,
+                                             double t, int nthreads) {
+  std::vector<Material> rtn (mats.size());
+  ::decay_many(mats, &t, 1, nthreads, rtn.data());
+  return rtn;
+}
+
+
+std::vector<pyne::Material> pyne::decay_many(const std::vector<Material>& mats,
+                                             const std::vector<double>& times,
+                                             int nthreads) {
+  std::vector<Material> rtn (mats.size() * times.size());
+  ::decay_many(mats, times.data(), times.size(), nthreads, rtn.data());
   return rtn;
 }
 #endif //  PYNE_DECAY
 
 
+namespace {
+  // Atomic masses of the nuclides of the CRAM transmutation matrix.
+  const std::vector<double>& cram_atomic_mass() {
+    static const std::vector<double> aw =
+      pyne::atomic_mass(pyne::transmuters::cram_index());
+    return aw;
+  }
+}  // namespace
+
+
+bool pyne::Material::cram_cache_valid() {
+  if (cram_af_.empty() || comp.size() != cram_ncomp_ ||
+      atoms_per_molecule != cram_apm_)
+    return false;
+  const NuclideIndex& index = pyne::transmuters::cram_index();
+  for (comp_iter ci = comp.begin(); ci != comp.end(); ci++) {
+    int i = index.index(ci->first);
+    if (i < 0 || cram_comp_[i] != ci->second)
+      return false;
+  }
+  return true;
+}
+
+
+void pyne::Material::fill_cram_cache() {
+  const NuclideIndex& index = pyne::transmuters::cram_index();
+  const std::vector<double>& aw = cram_atomic_mass();
+  cram_comp_ = index.to_dense(comp);
+  cram_ncomp_ = comp.size();
+  cram_apm_ = atoms_per_molecule;
+  cram_mw_ = molecular_mass();
+  cram_af_.resize(index.size());
+  for (int i = 0; i < index.size(); ++i)
+    cram_af_[i] = cram_comp_[i] == 0.0 ? 0.0 : cram_comp_[i] * cram_mw_ / aw[i];
+}
+
+
 pyne::Material pyne::Material::cram(std::vector<double> A,
                                     const int order) {
+  if (!cram_cache_valid())
+    fill_cram_cache();
+  const NuclideIndex& index = pyne::transmuters::cram_index();
+  const std::vector<double>& aw = cram_atomic_mass();
+  const int n = index.size();
+
+  // transmute the cached atom fractions straight into the result's cache
   Material rtn;
-  rtn.from_atom_frac(pyne::transmuters::cram(A, to_atom_frac(), order));
-  rtn.mass = mass * rtn.molecular_mass() / molecular_mass();
+  std::vector<double>& x = rtn.cram_af_;
+  x = cram_af_;
+  rtn.cram_comp_.resize(n);
+  pyne::transmuters::cram_inplace(A, x.data(), order, rtn.cram_comp_.data());
+
+  // as from_atom_frac(), with comp built in index order
+  rtn.atoms_per_molecule = 0.0;
+  for (int i = 0; i < n; ++i) {
+    if (x[i] <= 0.0) {
+      x[i] = 0.0;
+      continue;
+    }
+    rtn.comp.insert(rtn.comp.end(), comp_map::value_type(index.nuc(i),
+                                                         x[i] * aw[i]));
+    rtn.atoms_per_molecule += x[i];
+  }
+  rtn.norm_comp();
+
+  double inverseA = 0.0;
+  std::fill(rtn.cram_comp_.begin(), rtn.cram_comp_.end(), 0.0);
+  for (comp_iter ci = rtn.comp.begin(); ci != rtn.comp.end(); ci++) {
+    int i = index.index(ci->first);
+    rtn.cram_comp_[i] = ci->second;
+    inverseA += ci->second / aw[i];
+  }
+  rtn.cram_ncomp_ = rtn.comp.size();
+  rtn.cram_apm_ = rtn.atoms_per_molecule;
+  rtn.cram_mw_ = inverseA == 0.0 ? 0.0 : rtn.atoms_per_molecule / inverseA;
+  rtn.mass = mass * rtn.cram_mw_ / cram_mw_;
   return rtn;
 }
 
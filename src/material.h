@@ -28,6 +28,7 @@
 #include "h5wrap.h"
 #include "utils.h"
 #include "nucname.h"
+#include "nuclide_index.h"
 #include "data.h"
 #include "decay.h"
 #endif
@@ -40,7 +41,12 @@ namespace pyne
 
   #ifdef PYNE_IS_AMALGAMATED
   namespace decayers {
+    extern void decay(const double*, double, double*);
+    extern void decay(const double*, const double*, int, double*);
     extern comp_map decay(comp_map, double);
+    extern std::vector<double> decay(const comp_map&,
+                                     const std::vector<double>&);
+    extern const NuclideIndex& all_nucs_index();
   }  // namespace decayers
   #endif
 
@@ -424,6 +430,19 @@ namespace pyne
     /// This calculation is based off of the material's density.
     std::map<int, double> to_atom_dens();
 
+    // Dense composition functions
+    /// Returns the mass weights of this material in the order of \a index.
+    /// Nuclides that are not in the index are dropped.
+    std::vector<double> to_dense(const NuclideIndex& index);
+    /// Sets the composition of this material from the mass weights \a x,
+    /// given in the order of \a index, and normalizes it.
+    void from_dense(const NuclideIndex& index, const std::vector<double>& x);
+    /// Returns the atom fractions of this material in the order of \a index.
+    std::vector<double> to_atom_frac(const NuclideIndex& index);
+    /// Sets the composition and atoms_per_molecule of this material from the
+    /// atom fractions \a x, given in the order of \a index.
+    void from_atom_frac(const NuclideIndex& index, const std::vector<double>& x);
+
     // Radioactive Material functions
     /// Returns a list of gamma-rays energies in keV and intensities in
     /// decays/s/atom material unnormalized
@@ -442,9 +461,14 @@ namespace pyne
 #ifdef PYNE_DECAY
     /// Decays this material for a given amount of time in seconds
     Material decay(double t);
+    /// Decays this material to each of the given times in seconds, with
+    /// one pass over the decay chains for all of them.
+    std::vector<Material> decay(const std::vector<double>& times);
 #endif // PYNE_DECAY
 
-    /// Transmutes the material via the CRAM method.
+    /// Transmutes the material via the CRAM method.  The atom fractions in
+    /// cram_index() order are cached on both this material and the result,
+    /// so that chained steps skip the conversions from and to comp.
     /// \param A The transmutation matrix [unitless]
     /// \param order The CRAM approximation order (default 14).
     /// \return A new material which has been transmuted.
@@ -459,8 +483,38 @@ namespace pyne
     Material operator* (double);
     /// Divides a material's mass.
     Material operator/ (double);
+
+  private:
+    // Dense atom fractions in cram_index() order, for cram().  They are only
+    // used while comp and atoms_per_molecule are still exactly what they
+    // were computed from, since both may be changed from outside.
+    bool cram_cache_valid();
+    void fill_cram_cache();
+    std::vector<double> cram_comp_;  // comp in cram_index() order
+    size_t cram_ncomp_ = 0;          // comp.size()
+    double cram_apm_ = 0.0;          // atoms_per_molecule
+    double cram_mw_ = 0.0;           // molecular_mass()
+    std::vector<double> cram_af_;    // atom fractions
   };
 
+#ifdef PYNE_DECAY
+  /// Decays each of \a mats for time \a t in seconds, as Material::decay().
+  /// The materials are converted to dense atom fractions and decayed in
+  /// parallel, each thread reusing one scratch space for all of its
+  /// materials.
+  /// \param nthreads The number of threads, or 0 for one per core.
+  /// \return The decayed materials, in the order of \a mats.
+  std::vector<Material> decay_many(const std::vector<Material>& mats,
+                                   double t, int nthreads=0);
+  /// Decays each of \a mats to each of \a times in seconds, with one pass
+  /// over the decay chains per material.
+  /// \return The decayed materials, material-major: material m at times[j]
+  ///         is at [m*times.size() + j].
+  std::vector<Material> decay_many(const std::vector<Material>& mats,
+                                   const std::vector<double>& times,
+                                   int nthreads=0);
+#endif // PYNE_DECAY
+
   /// Converts a Material to a string stream representation for canonical writing.
   /// This operator is also defined on inheritors of std::ostream
   std::ostream& operator<< (std::ostream& os, Material mat);
@@ -0,0 +1,89 @@
+// Implements the dense nuclide index.
+#ifndef PYNE_IS_AMALGAMATED
+#include "nuclide_index.h"
+#endif
+
+
+pyne::NuclideIndex::NuclideIndex() : nstates_(0) {}
+
+pyne::NuclideIndex::NuclideIndex(const std::vector<int>& nucs)
+    : nucs_(nucs), nstates_(0) {
+  build();
+}
+
+pyne::NuclideIndex::NuclideIndex(const int* nucs, int n)
+    : nucs_(nucs, nucs + n), nstates_(0) {
+  build();
+}
+
+void pyne::NuclideIndex::build() {
+  // find the extent of the table: the largest Z and state, and the range of
+  // A values for each Z
+  int zmax = -1;
+  for (size_t i = 0; i < nucs_.size(); ++i) {
+    if (nucs_[i] < 0)
+      continue;
+    zmax = std::max(zmax, nucs_[i] / 10000000);
+    nstates_ = std::max(nstates_, nucs_[i] % 10000 + 1);
+  }
+  std::vector<int> amax(zmax + 1, -1);
+  z_amin_.assign(zmax + 1, 1000);
+  for (size_t i = 0; i < nucs_.size(); ++i) {
+    if (nucs_[i] < 0)
+      continue;
+    int z = nucs_[i] / 10000000;
+    int a = (nucs_[i] / 10000) % 1000;
+    z_amin_[z] = std::min(z_amin_[z], a);
+    amax[z] = std::max(amax[z], a);
+  }
+  z_offset_.assign(zmax + 1, 0);
+  z_na_.assign(zmax + 1, 0);
+  int nslots = 0;
+  for (int z = 0; z <= zmax; ++z) {
+    z_offset_[z] = nslots;
+    z_na_[z] = amax[z] < 0 ? 0 : amax[z] - z_amin_[z] + 1;
+    nslots += z_na_[z] * nstates_;
+  }
+
+  slots_.assign(nslots, -1);
+  for (size_t i = 0; i < nucs_.size(); ++i) {
+    if (nucs_[i] < 0)
+      continue;
+    int z = nucs_[i] / 10000000;
+    int a = (nucs_[i] / 10000) % 1000;
+    int s = nucs_[i] % 10000;
+    int& slot = slots_[z_offset_[z] + (a - z_amin_[z])*nstates_ + s];
+    if (slot >= 0)
+      throw pyne::ValueError("nuclide " + pyne::to_str(nucs_[i]) +
+                             " appears more than once in the index");
+    slot = (int) i;
+  }
+}
+
+std::vector<int> pyne::NuclideIndex::map_to(const NuclideIndex& other) const {
+  std::vector<int> m (nucs_.size());
+  for (size_t i = 0; i < nucs_.size(); ++i)
+    m[i] = other.index(nucs_[i]);
+  return m;
+}
+
+std::vector<double> pyne::NuclideIndex::to_dense(
+    const std::map<int, double>& comp) const {
+  std::vector<double> x (nucs_.size(), 0.0);
+  std::map<int, double>::const_iterator it;
+  for (it = comp.begin(); it != comp.end(); ++it) {
+    int i = index(it->first);
+    if (i >= 0)
+      x[i] = it->second;
+  }
+  return x;
+}
+
+std::map<int, double> pyne::NuclideIndex::to_map(const double* x,
+                                                 bool keep_zeros) const {
+  std::map<int, double> comp;
+  for (size_t i = 0; i < nucs_.size(); ++i)
+    if ((keep_zeros || x[i] > 0.0) && nucs_[i] >= 0)
+      comp[nucs_[i]] = x[i];
+  return comp;
+}
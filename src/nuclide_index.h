@@ -0,0 +1,88 @@
+/// \file nuclide_index.h
+/// \brief Dense numbering of a set of nuclides.
+///
+/// A NuclideIndex assigns each nuclide of a fixed list a position in
+/// 0..N-1, so that compositions and per-nuclide data can be stored in plain
+/// arrays and passed between the data, decay, CRAM and Material code
+/// without going through std::map.
+
+#ifndef PYNE_EIFEZKFVCMKJOYA7WE4WOE75KM
+#define PYNE_EIFEZKFVCMKJOYA7WE4WOE75KM
+#include <map>
+#include <algorithm>
+#include <vector>
+
+#ifndef PYNE_IS_AMALGAMATED
+#include "utils.h"
+#endif
+
+namespace pyne
+{
+  /// \brief Maps nuclides in id form to a dense 0..N-1 index and back.
+  ///
+  /// Lookups go through a direct table over (Z, A, state): one array of
+  /// per-Z offsets and one flat array covering, for each Z, only the mass
+  /// numbers present in the index.  Both directions are O(1) and the
+  /// tables stay small because states above the largest one in the index
+  /// are never allocated.  An index is immutable once built.
+  class NuclideIndex
+  {
+  public:
+    NuclideIndex();  ///< empty index
+    /// Builds an index over \a nucs in id form, keeping their order.
+    /// Negative entries keep their position but cannot be looked up;
+    /// duplicates throw pyne::ValueError.
+    NuclideIndex(const std::vector<int>& nucs);
+    /// Builds an index over the \a n nuclides in id form at \a nucs.
+    NuclideIndex(const int* nucs, int n);
+
+    /// Number of nuclides in the index.
+    int size() const {return (int) nucs_.size();};
+    /// Nuclides in index order.
+    const std::vector<int>& nucs() const {return nucs_;};
+    /// Nuclide in id form at position \a i.
+    int nuc(int i) const {return nucs_[i];};
+
+    /// Position of \a nuc in id form, or -1 if it is not in the index.
+    int index(int nuc) const {
+      if (nuc < 0)
+        return -1;
+      int z = nuc / 10000000;
+      int a = (nuc / 10000) % 1000;
+      int s = nuc % 10000;
+      if (z >= (int) z_amin_.size() || s >= nstates_)
+        return -1;
+      int da = a - z_amin_[z];
+      if (da < 0 || da >= z_na_[z])
+        return -1;
+      return slots_[z_offset_[z] + da*nstates_ + s];
+    };
+    /// true if \a nuc is in the index.
+    bool contains(int nuc) const {return index(nuc) >= 0;};
+
+    /// For each nuclide in this index, its position in \a other, or -1.
+    /// Moving a vector x from this index to \a other is then
+    /// y[map[i]] = x[i] for every i with map[i] >= 0.
+    std::vector<int> map_to(const NuclideIndex& other) const;
+
+    /// Scatters the values of \a comp into a vector in index order.
+    /// Nuclides that are not in the index are dropped.
+    std::vector<double> to_dense(const std::map<int, double>& comp) const;
+    /// Gathers the \a size() values at \a x into a map, skipping entries
+    /// that are not greater than zero unless \a keep_zeros is true.
+    std::map<int, double> to_map(const double* x, bool keep_zeros=false) const;
+
+  private:
+    void build();
+
+    std::vector<int> nucs_;
+    int nstates_;                 // largest state in the index plus one
+    std::vector<int> z_offset_;   // start of each Z's block in slots_
+    std::vector<int> z_amin_;     // smallest A present for each Z
+    std::vector<int> z_na_;       // number of A values covered for each Z
+    std::vector<int> slots_;      // dense position, or -1
+  };
+
+}  // namespace pyne
+
+#endif  // PYNE_EIFEZKFVCMKJOYA7WE4WOE75KM
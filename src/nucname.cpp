@@ -3,317 +3,509 @@
 // name is for letters  as well (U-235).
 // MCNP is for numerals without the meta-stable flag (92235), as used in MCNP.
 
+#include <mutex>
+
 #ifndef PYNE_IS_AMALGAMATED
 #include "nucname.h"
 #include "state_map.cpp"
 #endif
 
 
+/*** Element symbol and FLUKA name tables ***/
+
+namespace {
+  // Symbol of each element, indexed by Z number.
+  constexpr const char * zz_symbol_table[119] = {
+    NULL, "H", "He", "Li", "Be", "B", "C", "N", "O", "F", "Ne", "Na", "Mg",
+    "Al", "Si", "P", "S", "Cl", "Ar", "K", "Ca", "Sc", "Ti", "V", "Cr", "Mn",
+    "Fe", "Co", "Ni", "Cu", "Zn", "Ga", "Ge", "As", "Se", "Br", "Kr", "Rb",
+    "Sr", "Y", "Zr", "Nb", "Mo", "Tc", "Ru", "Rh", "Pd", "Ag", "Cd", "In",
+    "Sn", "Sb", "Te", "I", "Xe", "Cs", "Ba", "La", "Ce", "Pr", "Nd", "Pm",
+    "Sm", "Eu", "Gd", "Tb", "Dy", "Ho", "Er", "Tm", "Yb", "Lu", "Hf", "Ta",
+    "W", "Re", "Os", "Ir", "Pt", "Au", "Hg", "Tl", "Pb", "Bi", "Po", "At",
+    "Rn", "Fr", "Ra", "Ac", "Th", "Pa", "U", "Np", "Pu", "Am", "Cm", "Bk",
+    "Cf", "Es", "Fm", "Md", "No", "Lr", "Rf", "Db", "Sg", "Bh", "Hs", "Mt",
+    "Ds", "Rg", "Cn", "Nh", "Fl", "Mc", "Lv", "Ts", "Og"};
+
+  // Z number of each element symbol, indexed by the symbol's first letter
+  // and by its second letter, or 26 for one letter symbols.  Entries without
+  // an element are 0.  This is a perfect hash of zz_symbol_table.
+  constexpr unsigned char symbol_zz_table[26][27] = {
+    /* A */ {0, 0, 89, 0, 0, 0, 47, 0, 0, 0, 0, 13, 95, 0, 0, 0, 0, 18, 33,
+           85, 79, 0, 0, 0, 0, 0, 0},
+    /* B */ {56, 0, 0, 0, 4, 0, 0, 107, 83, 0, 97, 0, 0, 0, 0, 0, 0, 35, 0, 0,
+           0, 0, 0, 0, 0, 0, 5},
+    /* C */ {20, 0, 0, 48, 58, 98, 0, 0, 0, 0, 0, 17, 96, 112, 27, 0, 0, 24,
+           55, 0, 29, 0, 0, 0, 0, 0, 6},
+    /* D */ {0, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0,
+           0, 0, 0, 0, 66, 0, 0},
+    /* E */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 99, 0, 63,
+           0, 0, 0, 0, 0, 0},
+    /* F */ {0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 114, 100, 0, 0, 0, 0, 87, 0, 0,
+           0, 0, 0, 0, 0, 0, 9},
+    /* G */ {31, 0, 0, 64, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 0, 0},
+    /* H */ {0, 0, 0, 0, 2, 72, 80, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0, 108, 0,
+           0, 0, 0, 0, 0, 0, 1},
+    /* I */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 77, 0, 0, 0,
+           0, 0, 0, 0, 0, 53},
+    /* J */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 0},
+    /* K */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0,
+           0, 0, 0, 0, 0, 19},
+    /* L */ {57, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0,
+           71, 116, 0, 0, 0, 0, 0},
+    /* M */ {0, 0, 115, 101, 0, 0, 12, 0, 0, 0, 0, 0, 0, 25, 42, 0, 0, 0, 0,
+           109, 0, 0, 0, 0, 0, 0, 0},
+    /* N */ {11, 41, 0, 60, 10, 0, 0, 113, 28, 0, 0, 0, 0, 0, 102, 93, 0, 0,
+           0, 0, 0, 0, 0, 0, 0, 0, 7},
+    /* O */ {0, 0, 0, 0, 0, 0, 118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0,
+           0, 0, 0, 0, 0, 8},
+    /* P */ {91, 82, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 84, 0, 0, 59, 0,
+           78, 94, 0, 0, 0, 0, 0, 15},
+    /* Q */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 0},
+    /* R */ {88, 37, 0, 0, 75, 104, 111, 45, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0,
+           0, 44, 0, 0, 0, 0, 0, 0},
+    /* S */ {0, 51, 21, 0, 34, 0, 106, 0, 14, 0, 0, 0, 62, 50, 0, 0, 0, 38, 0,
+           0, 0, 0, 0, 0, 0, 0, 16},
+    /* T */ {73, 65, 43, 0, 52, 0, 0, 90, 22, 0, 0, 81, 69, 0, 0, 0, 0, 0,
+           117, 0, 0, 0, 0, 0, 0, 0, 0},
+    /* U */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 92},
+    /* V */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 23},
+    /* W */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 74},
+    /* X */ {0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 0, 0},
+    /* Y */ {0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+           0, 0, 0, 0, 0, 39},
+    /* Z */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 40, 0, 0, 0,
+           0, 0, 0, 0, 0, 0}};
+
+  struct fluka_entry {
+    const char * name;
+    int id;
+  };
+
+  // FLUKA names and the nuclides they stand for, sorted by name.
+  constexpr fluka_entry fluka_by_name[142] = {
+    {"124-XE", 541240000},          // fluka "124-XE"
+    {"126-XE", 541260000},          // fluka "126-XE"
+    {"128-XE", 541280000},          // fluka "128-XE"
+    {"129-I", 531290000},           // fluka "129-I"
+    {"130-XE", 541300000},          // fluka "130-XE"
+    {"131-XE", 541310000},          // fluka "131-XE"
+    {"132-XE", 541320000},          // fluka "132-XE"
+    {"134-XE", 541340000},          // fluka "134-XE"
+    {"135-CS", 551350000},          // fluka "135-CS"
+    {"135-XE", 541350000},          // fluka "135-XE"
+    {"136-XE", 541360000},          // fluka "136-XE"
+    {"137-CS", 551370000},          // fluka "137-CS"
+    {"230-TH", 902300000},          // fluka "230-TH"
+    {"232-TH", 902320000},          // fluka "232-TH"
+    {"233-U", 922330000},           // fluka "233-U"
+    {"234-U", 922340000},           // fluka "234-U"
+    {"235-U", 922350000},           // fluka "235-U"
+    {"238-U", 922380000},           // fluka "238-U"
+    {"239-PU", 940000000},          // "239-PU"
+    {"241-AM", 950000000},          // "241-AM"
+    {"90-SR", 380900000},           // fluka "90-SR"
+    {"99-TC", 430000000},           // "99-TC"
+    {"ACTINIUM", 890000000},        // no fluka
+    {"ALUMINUM", 130000000},
+    {"ANTIMONY", 510000000},
+    {"ARGON", 180000000},
+    {"ARSENIC", 330000000},
+    {"ASTATINE", 850000000},        // no fluka
+    {"BARIUM", 560000000},
+    {"BERKELIU", 970000000},        // No fluka
+    {"BERYLLIU", 40000000},
+    {"BISMUTH", 830000000},
+    {"BOHRIUM", 1070000000},        // No fluka
+    {"BORON", 50000000},
+    {"BORON-10", 50100000},
+    {"BORON-11", 50110000},
+    {"BROMINE", 350000000},
+    {"CADMIUM", 480000000},
+    {"CALCIUM", 200000000},
+    {"CALIFORN", 980000000},        // no fluka
+    {"CARBON", 60000000},
+    {"CERIUM", 580000000},
+    {"CESIUM", 550000000},
+    {"CHLORINE", 170000000},
+    {"CHROMIUM", 240000000},
+    {"COBALT", 270000000},
+    {"COPERNIC", 1120000000},       // no fluka
+    {"COPPER", 290000000},
+    {"CURIUM", 960000000},          // no fluka
+    {"DARMSTAD", 1100000000},       // no fluka
+    {"DEUTERIU", 10020000},
+    {"DUBNIUM", 1050000000},        // no fluka
+    {"DYSPROSI", 660000000},        // no fluka
+    {"EINSTEIN", 990000000},        // no fluka
+    {"ERBIUM", 680000000},          // no fluka
+    {"EUROPIUM", 630000000},
+    {"FERMIUM", 1000000000},        // no fluka
+    {"FLUORINE", 90000000},
+    {"FRANCIUM", 870000000},        // no fluka
+    {"GADOLINI", 640000000},
+    {"GALLIUM", 310000000},
+    {"GERMANIU", 320000000},
+    {"GOLD", 790000000},
+    {"HAFNIUM", 720000000},
+    {"HASSIUM", 1080000000},
+    {"HELIUM", 20000000},
+    {"HELIUM-3", 20030000},
+    {"HELIUM-4", 20040000},
+    {"HOLMIUM", 670000000},         // no fluka
+    {"HYDROG-1", 10010000},
+    {"HYDROGEN", 10000000},
+    {"INDIUM", 490000000},
+    {"IODINE", 530000000},
+    {"IRIDIUM", 770000000},
+    {"IRON", 260000000},
+    {"KRYPTON", 360000000},
+    {"LANTHANU", 570000000},
+    {"LAWRENCI", 1030000000},       // no fluka
+    {"LEAD", 820000000},
+    {"LITHIU-6", 30060000},
+    {"LITHIU-7", 30070000},
+    {"LITHIUM", 30000000},
+    {"LUTETIUM", 710000000},        // no fluka
+    {"MAGNESIU", 120000000},
+    {"MANGANES", 250000000},
+    {"MEITNERI", 1090000000},       // no fluka
+    {"MENDELEV", 1010000000},       // no fluka
+    {"MERCURY", 800000000},
+    {"MOLYBDEN", 420000000},
+    {"NEODYMIU", 600000000},
+    {"NEON", 100000000},
+    {"NEPTUNIU", 930000000},        // no fluka
+    {"NICKEL", 280000000},
+    {"NIOBIUM", 410000000},
+    {"NITROGEN", 70000000},
+    {"NOBELIUM", 1020000000},       // no fluka
+    {"OSMIUM", 760000000},          // no fluka
+    {"OXYGEN", 80000000},
+    {"PALLADIU", 460000000},        // no fluka
+    {"PHOSPHO", 150000000},
+    {"PLATINUM", 780000000},
+    {"POLONIUM", 840000000},        // no fluka
+    {"POTASSIU", 190000000},
+    {"PRASEODY", 590000000},        // no fluka
+    {"PROMETHI", 610000000},        // no fluka
+    {"PROTACTI", 910000000},        // no fluka
+    {"RADIUM", 880000000},          // No fluka
+    {"RADON", 860000000},           // no fluka
+    {"RHENIUM", 750000000},
+    {"RHODIUM", 450000000},         // no fluka
+    {"ROENTGEN", 1110000000},
+    {"RUBIDIUM", 370000000},        // No fluka
+    {"RUTHENIU", 440000000},        // No fluka
+    {"RUTHERFO", 1040000000},
+    {"SAMARIUM", 620000000},
+    {"SCANDIUM", 210000000},
+    {"SEABORGI", 1060000000},       // no fluka
+    {"SELENIUM", 340000000},        // no fluka
+    {"SILICON", 140000000},
+    {"SILVER", 470000000},
+    {"SODIUM", 110000000},
+    {"STRONTIU", 380000000},
+    {"SULFUR", 160000000},
+    {"TANTALUM", 730000000},
+    {"TELLURIU", 520000000},        // no fluka
+    {"TERBIUM", 650000000},
+    {"THALLIUM", 810000000},        // no fluka
+    {"THORIUM", 900000000},         // no fluka
+    {"THULIUM", 690000000},         // no fluka
+    {"TIN", 500000000},
+    {"TITANIUM", 220000000},
+    {"TRITIUM", 10040000},
+    {"TUNGSTEN", 740000000},
+    {"UNUNHEXI", 1160000000},       // no fluka:  UNUNHEXIUM , "Livermorium"
+    {"UNUNQUAD", 1140000000},       // no fluka:  UNUNQUADIUM,  "Flerovium"
+    {"URANIUM", 920000000},
+    {"VANADIUM", 230000000},
+    {"XENON", 540000000},
+    {"YTTERBIU", 700000000},        // no fluka
+    {"YTTRIUM", 390000000},
+    {"ZINC", 300000000},
+    {"ZIRCONIU", 400000000}};
+
+  // The same entries sorted by nuclide.
+  constexpr fluka_entry fluka_by_id[142] = {
+    {"HYDROGEN", 10000000},
+    {"HYDROG-1", 10010000},
+    {"DEUTERIU", 10020000},
+    {"TRITIUM", 10040000},
+    {"HELIUM", 20000000},
+    {"HELIUM-3", 20030000},
+    {"HELIUM-4", 20040000},
+    {"LITHIUM", 30000000},
+    {"LITHIU-6", 30060000},
+    {"LITHIU-7", 30070000},
+    {"BERYLLIU", 40000000},
+    {"BORON", 50000000},
+    {"BORON-10", 50100000},
+    {"BORON-11", 50110000},
+    {"CARBON", 60000000},
+    {"NITROGEN", 70000000},
+    {"OXYGEN", 80000000},
+    {"FLUORINE", 90000000},
+    {"NEON", 100000000},
+    {"SODIUM", 110000000},
+    {"MAGNESIU", 120000000},
+    {"ALUMINUM", 130000000},
+    {"SILICON", 140000000},
+    {"PHOSPHO", 150000000},
+    {"SULFUR", 160000000},
+    {"CHLORINE", 170000000},
+    {"ARGON", 180000000},
+    {"POTASSIU", 190000000},
+    {"CALCIUM", 200000000},
+    {"SCANDIUM", 210000000},
+    {"TITANIUM", 220000000},
+    {"VANADIUM", 230000000},
+    {"CHROMIUM", 240000000},
+    {"MANGANES", 250000000},
+    {"IRON", 260000000},
+    {"COBALT", 270000000},
+    {"NICKEL", 280000000},
+    {"COPPER", 290000000},
+    {"ZINC", 300000000},
+    {"GALLIUM", 310000000},
+    {"GERMANIU", 320000000},
+    {"ARSENIC", 330000000},
+    {"SELENIUM", 340000000},
+    {"BROMINE", 350000000},
+    {"KRYPTON", 360000000},
+    {"RUBIDIUM", 370000000},
+    {"STRONTIU", 380000000},
+    {"90-SR", 380900000},
+    {"YTTRIUM", 390000000},
+    {"ZIRCONIU", 400000000},
+    {"NIOBIUM", 410000000},
+    {"MOLYBDEN", 420000000},
+    {"99-TC", 430000000},
+    {"RUTHENIU", 440000000},
+    {"RHODIUM", 450000000},
+    {"PALLADIU", 460000000},
+    {"SILVER", 470000000},
+    {"CADMIUM", 480000000},
+    {"INDIUM", 490000000},
+    {"TIN", 500000000},
+    {"ANTIMONY", 510000000},
+    {"TELLURIU", 520000000},
+    {"IODINE", 530000000},
+    {"129-I", 531290000},
+    {"XENON", 540000000},
+    {"124-XE", 541240000},
+    {"126-XE", 541260000},
+    {"128-XE", 541280000},
+    {"130-XE", 541300000},
+    {"131-XE", 541310000},
+    {"132-XE", 541320000},
+    {"134-XE", 541340000},
+    {"135-XE", 541350000},
+    {"136-XE", 541360000},
+    {"CESIUM", 550000000},
+    {"135-CS", 551350000},
+    {"137-CS", 551370000},
+    {"BARIUM", 560000000},
+    {"LANTHANU", 570000000},
+    {"CERIUM", 580000000},
+    {"PRASEODY", 590000000},
+    {"NEODYMIU", 600000000},
+    {"PROMETHI", 610000000},
+    {"SAMARIUM", 620000000},
+    {"EUROPIUM", 630000000},
+    {"GADOLINI", 640000000},
+    {"TERBIUM", 650000000},
+    {"DYSPROSI", 660000000},
+    {"HOLMIUM", 670000000},
+    {"ERBIUM", 680000000},
+    {"THULIUM", 690000000},
+    {"YTTERBIU", 700000000},
+    {"LUTETIUM", 710000000},
+    {"HAFNIUM", 720000000},
+    {"TANTALUM", 730000000},
+    {"TUNGSTEN", 740000000},
+    {"RHENIUM", 750000000},
+    {"OSMIUM", 760000000},
+    {"IRIDIUM", 770000000},
+    {"PLATINUM", 780000000},
+    {"GOLD", 790000000},
+    {"MERCURY", 800000000},
+    {"THALLIUM", 810000000},
+    {"LEAD", 820000000},
+    {"BISMUTH", 830000000},
+    {"POLONIUM", 840000000},
+    {"ASTATINE", 850000000},
+    {"RADON", 860000000},
+    {"FRANCIUM", 870000000},
+    {"RADIUM", 880000000},
+    {"ACTINIUM", 890000000},
+    {"THORIUM", 900000000},
+    {"230-TH", 902300000},
+    {"232-TH", 902320000},
+    {"PROTACTI", 910000000},
+    {"URANIUM", 920000000},
+    {"233-U", 922330000},
+    {"234-U", 922340000},
+    {"235-U", 922350000},
+    {"238-U", 922380000},
+    {"NEPTUNIU", 930000000},
+    {"239-PU", 940000000},
+    {"241-AM", 950000000},
+    {"CURIUM", 960000000},
+    {"BERKELIU", 970000000},
+    {"CALIFORN", 980000000},
+    {"EINSTEIN", 990000000},
+    {"FERMIUM", 1000000000},
+    {"MENDELEV", 1010000000},
+    {"NOBELIUM", 1020000000},
+    {"LAWRENCI", 1030000000},
+    {"RUTHERFO", 1040000000},
+    {"DUBNIUM", 1050000000},
+    {"SEABORGI", 1060000000},
+    {"BOHRIUM", 1070000000},
+    {"HASSIUM", 1080000000},
+    {"MEITNERI", 1090000000},
+    {"DARMSTAD", 1100000000},
+    {"ROENTGEN", 1110000000},
+    {"COPERNIC", 1120000000},
+    {"UNUNQUAD", 1140000000},
+    {"UNUNHEXI", 1160000000}};
+
+  bool fluka_name_less(const fluka_entry& e, const std::string& name) {
+    return name.compare(e.name) > 0;
+  }
+
+  bool fluka_id_less(const fluka_entry& e, int nuc) {
+    return e.id < nuc;
+  }
+}
+
+int pyne::nucname::symbol_zz(const char * name, size_t len) {
+  if (len == 0 || len > 2 || name[0] < 'A' || 'Z' < name[0])
+    return -1;
+  int second = 26;
+  if (len == 2) {
+    if (name[1] < 'a' || 'z' < name[1])
+      return -1;
+    second = name[1] - 'a';
+  }
+  int zz = symbol_zz_table[name[0] - 'A'][second];
+  return zz == 0 ? -1 : zz;
+}
+
+int pyne::nucname::symbol_zz(const std::string& name) {
+  return symbol_zz(name.c_str(), name.length());
+}
+
+const char * pyne::nucname::zz_symbol(int zz) {
+  if (zz < 1 || 118 < zz)
+    return NULL;
+  return zz_symbol_table[zz];
+}
+
+int pyne::nucname::fluka_name_id(const std::string& name) {
+  const fluka_entry * end = fluka_by_name + 142;
+  const fluka_entry * e = std::lower_bound(fluka_by_name, end, name,
+                                           fluka_name_less);
+  if (e == end || name != e->name)
+    return -1;
+  return e->id;
+}
+
+const char * pyne::nucname::id_fluka_name(int nuc) {
+  const fluka_entry * end = fluka_by_id + 142;
+  const fluka_entry * e = std::lower_bound(fluka_by_id, end, nuc,
+                                           fluka_id_less);
+  if (e == end || e->id != nuc)
+    return NULL;
+  return e->name;
+}
+
+
 /*** Constructs the LL to zz Dictionary ***/
 pyne::nucname::name_zz_t pyne::nucname::get_name_zz() {
-  pyne::nucname::name_zz_t lzd;
-
-  lzd["Be"] = 04;
-  lzd["Ba"] = 56;
-  lzd["Bh"] = 107;
-  lzd["Bi"] = 83;
-  lzd["Bk"] = 97;
-  lzd["Br"] = 35;
-  lzd["Ru"] = 44;
-  lzd["Re"] = 75;
-  lzd["Rf"] = 104;
-  lzd["Rg"] = 111;
-  lzd["Ra"] = 88;
-  lzd["Rb"] = 37;
-  lzd["Rn"] = 86;
-  lzd["Rh"] = 45;
-  lzd["Tm"] = 69;
-  lzd["H"] = 01;
-  lzd["P"] = 15;
-  lzd["Ge"] = 32;
-  lzd["Gd"] = 64;
-  lzd["Ga"] = 31;
-  lzd["Os"] = 76;
-  lzd["Hs"] = 108;
-  lzd["Zn"] = 30;
-  lzd["Ho"] = 67;
-  lzd["Hf"] = 72;
-  lzd["Hg"] = 80;
-  lzd["He"] = 02;
-  lzd["Pr"] = 59;
-  lzd["Pt"] = 78;
-  lzd["Pu"] = 94;
-  lzd["Pb"] = 82;
-  lzd["Pa"] = 91;
-  lzd["Pd"] = 46;
-  lzd["Po"] = 84;
-  lzd["Pm"] = 61;
-  lzd["C"] = 6;
-  lzd["K"] = 19;
-  lzd["O"] = 8;
-  lzd["S"] = 16;
-  lzd["W"] = 74;
-  lzd["Eu"] = 63;
-  lzd["Es"] = 99;
-  lzd["Er"] = 68;
-  lzd["Md"] = 101;
-  lzd["Mg"] = 12;
-  lzd["Mo"] = 42;
-  lzd["Mn"] = 25;
-  lzd["Mt"] = 109;
-  lzd["U"] = 92;
-  lzd["Fr"] = 87;
-  lzd["Fe"] = 26;
-  lzd["Fm"] = 100;
-  lzd["Ni"] = 28;
-  lzd["No"] = 102;
-  lzd["Na"] = 11;
-  lzd["Nb"] = 41;
-  lzd["Nd"] = 60;
-  lzd["Ne"] = 10;
-  lzd["Zr"] = 40;
-  lzd["Np"] = 93;
-  lzd["B"] = 05;
-  lzd["Co"] = 27;
-  lzd["Cm"] = 96;
-  lzd["F"] = 9;
-  lzd["Ca"] = 20;
-  lzd["Cf"] = 98;
-  lzd["Ce"] = 58;
-  lzd["Cd"] = 48;
-  lzd["V"] = 23;
-  lzd["Cs"] = 55;
-  lzd["Cr"] = 24;
-  lzd["Cu"] = 29;
-  lzd["Sr"] = 38;
-  lzd["Kr"] = 36;
-  lzd["Si"] = 14;
-  lzd["Sn"] = 50;
-  lzd["Sm"] = 62;
-  lzd["Sc"] = 21;
-  lzd["Sb"] = 51;
-  lzd["Sg"] = 106;
-  lzd["Se"] = 34;
-  lzd["Yb"] = 70;
-  lzd["Db"] = 105;
-  lzd["Dy"] = 66;
-  lzd["Ds"] = 110;
-  lzd["La"] = 57;
-  lzd["Cl"] = 17;
-  lzd["Li"] = 03;
-  lzd["Tl"] = 81;
-  lzd["Lu"] = 71;
-  lzd["Lr"] = 103;
-  lzd["Th"] = 90;
-  lzd["Ti"] = 22;
-  lzd["Te"] = 52;
-  lzd["Tb"] = 65;
-  lzd["Tc"] = 43;
-  lzd["Ta"] = 73;
-  lzd["Ac"] = 89;
-  lzd["Ag"] = 47;
-  lzd["I"] = 53;
-  lzd["Ir"] = 77;
-  lzd["Am"] = 95;
-  lzd["Al"] = 13;
-  lzd["As"] = 33;
-  lzd["Ar"] = 18;
-  lzd["Au"] = 79;
-  lzd["At"] = 85;
-  lzd["In"] = 49;
-  lzd["Y"] = 39;
-  lzd["N"] = 07;
-  lzd["Xe"] = 54;
-  lzd["Cn"] = 112;
-  lzd["Fl"] = 114;
-  lzd["Lv"] = 116;
-  lzd["Nh"] = 113;
-  lzd["Mc"] = 115;
-  lzd["Ts"] = 117;
-  lzd["Og"] = 118;
-
+  name_zz_t lzd;
+  for (int zz = 1; zz <= 118; zz++)
+    lzd[zz_symbol_table[zz]] = zz;
   return lzd;
 }
-pyne::nucname::name_zz_t pyne::nucname::name_zz = pyne::nucname::get_name_zz();
 
 
 /*** Constructs zz to LL dictionary **/
 pyne::nucname::zzname_t pyne::nucname::get_zz_name()
 {
   zzname_t zld;
-  for (name_zz_iter i = name_zz.begin(); i != name_zz.end(); i++)
-  {
-    zld[i->second] = i->first;
-  }
+  for (int zz = 1; zz <= 118; zz++)
+    zld[zz] = zz_symbol_table[zz];
   return zld;
 }
-pyne::nucname::zzname_t pyne::nucname::zz_name = pyne::nucname::get_zz_name();
-
 
 
 /*** Constructs the fluka to zz Dictionary ***/
 pyne::nucname::name_zz_t pyne::nucname::get_fluka_zz() {
-  pyne::nucname::name_zz_t fzd;
-
-  fzd["BERYLLIU"] = 40000000;
-  fzd["BARIUM"]   = 560000000;
-  fzd["BOHRIUM"]  = 1070000000;   // No fluka
-  fzd["BISMUTH"]  = 830000000;
-  fzd["BERKELIU"] = 970000000;    // No fluka
-  fzd["BROMINE"]  = 350000000;
-  fzd["RUTHENIU"] = 440000000;    // No fluka
-  fzd["RHENIUM"]  = 750000000;
-  fzd["RUTHERFO"] = 1040000000;
-  fzd["ROENTGEN"] = 1110000000;
-  fzd["RADIUM"]   = 880000000;    // No fluka
-  fzd["RUBIDIUM"] = 370000000;    // No fluka
-  fzd["RADON"]    = 860000000;    // no fluka
-  fzd["RHODIUM"]  = 450000000;    // no fluka
-  fzd["THULIUM"]  = 690000000;    // no fluka
-  fzd["HYDROGEN"] = 10000000;
-  fzd["PHOSPHO"]  = 150000000;
-  fzd["GERMANIU"] = 320000000;
-  fzd["GADOLINI"] = 640000000;
-  fzd["GALLIUM"]  = 310000000;
-  fzd["OSMIUM"]   = 760000000;    // no fluka
-  fzd["HASSIUM"]  = 1080000000;
-  fzd["ZINC"]     = 300000000;
-  fzd["HOLMIUM"]  = 670000000;    // no fluka
-  fzd["HAFNIUM"]  = 720000000;
-  fzd["MERCURY"]  = 800000000;
-  fzd["HELIUM"]   = 20000000;
-  fzd["PRASEODY"] = 590000000;   // no fluka
-  fzd["PLATINUM"] = 780000000;
-  fzd["239-PU"]   = 940000000;   // "239-PU"
-  fzd["LEAD"]     = 820000000;
-  fzd["PROTACTI"] = 910000000;   // no fluka
-  fzd["PALLADIU"] = 460000000;   // no fluka
-  fzd["POLONIUM"] = 840000000;   // no fluka
-  fzd["PROMETHI"] = 610000000;   // no fluka
-  fzd["CARBON"]   = 60000000;
-  fzd["POTASSIU"] = 190000000;
-  fzd["OXYGEN"]   = 80000000;
-  fzd["SULFUR"]   = 160000000;
-  fzd["TUNGSTEN"] = 740000000;
-  fzd["EUROPIUM"] = 630000000;
-  fzd["EINSTEIN"] = 990000000;   // no fluka
-  fzd["ERBIUM"]   = 680000000;   // no fluka
-  fzd["MENDELEV"] = 1010000000;  // no fluka
-  fzd["MAGNESIU"] = 120000000;
-  fzd["MOLYBDEN"] = 420000000;
-  fzd["MANGANES"] = 250000000;
-  fzd["MEITNERI"] = 1090000000;  // no fluka
-  fzd["URANIUM"]  = 920000000;
-  fzd["FRANCIUM"] = 870000000;   // no fluka
-  fzd["IRON"]     = 260000000;
-  fzd["FERMIUM"]  = 1000000000;  // no fluka
-  fzd["NICKEL"]   = 280000000;
-  fzd["NITROGEN"] = 70000000;
-  fzd["NOBELIUM"] = 1020000000;  // no fluka
-  fzd["SODIUM"]   = 110000000;
-  fzd["NIOBIUM"]  = 410000000;
-  fzd["NEODYMIU"] = 600000000;
-  fzd["NEON"]     = 100000000;
-  fzd["ZIRCONIU"] = 400000000;
-  fzd["NEPTUNIU"] = 930000000;   // no fluka
-  fzd["BORON"]    = 50000000;
-  fzd["COBALT"]   = 270000000;
-  fzd["CURIUM"]   = 960000000;   // no fluka
-  fzd["FLUORINE"] = 90000000;
-  fzd["CALCIUM"]  = 200000000;
-  fzd["CALIFORN"] = 980000000;   // no fluka
-  fzd["CERIUM"]   = 580000000;
-  fzd["CADMIUM"]  = 480000000;
-  fzd["VANADIUM"] = 230000000;
-  fzd["CESIUM"]   = 550000000;
-  fzd["CHROMIUM"] = 240000000;
-  fzd["COPPER"]   = 290000000;
-  fzd["STRONTIU"] = 380000000;
-  fzd["KRYPTON"]  = 360000000;
-  fzd["SILICON"]  = 140000000;
-  fzd["TIN"]      = 500000000;
-  fzd["SAMARIUM"] = 620000000;
-  fzd["SCANDIUM"] = 210000000;
-  fzd["ANTIMONY"] = 510000000;
-  fzd["SEABORGI"] = 1060000000;  // no fluka
-  fzd["SELENIUM"] = 340000000;   // no fluka
-  fzd["YTTERBIU"] = 700000000;   // no fluka
-  fzd["DUBNIUM"]  = 1050000000;  // no fluka
-  fzd["DYSPROSI"] = 660000000;   // no fluka
-  fzd["DARMSTAD"] = 1100000000;  // no fluka
-  fzd["LANTHANU"] = 570000000;
-  fzd["CHLORINE"] = 170000000;
-  fzd["LITHIUM"]  = 030000000;
-  fzd["THALLIUM"] = 810000000;   // no fluka
-  fzd["LUTETIUM"] = 710000000;   // no fluka
-  fzd["LAWRENCI"] = 1030000000;  // no fluka
-  fzd["THORIUM"]  = 900000000;   // no fluka
-  fzd["TITANIUM"] = 220000000;
-  fzd["TELLURIU"] = 520000000;   // no fluka
-  fzd["TERBIUM"]  = 650000000;
-  fzd["99-TC"]    = 430000000;   // "99-TC"
-  fzd["TANTALUM"] = 730000000;
-  fzd["ACTINIUM"] = 890000000;   // no fluka
-  fzd["SILVER"]   = 470000000;
-  fzd["IODINE"]   = 530000000;
-  fzd["IRIDIUM"]  = 770000000;
-  fzd["241-AM"]   = 950000000;   // "241-AM"
-  fzd["ALUMINUM"] = 130000000;
-  fzd["ARSENIC"]  = 330000000;
-  fzd["ARGON"]    = 180000000;
-  fzd["GOLD"]     = 790000000;
-  fzd["ASTATINE"] = 850000000;   // no fluka
-  fzd["INDIUM"]   = 490000000;
-  fzd["YTTRIUM"]  = 390000000;
-  fzd["XENON"]    = 540000000;
-  fzd["COPERNIC"] = 1120000000;  // no fluka
-  fzd["UNUNQUAD"] = 1140000000;  // no fluka:  UNUNQUADIUM,  "Flerovium"
-  fzd["UNUNHEXI"] = 1160000000;  // no fluka:  UNUNHEXIUM , "Livermorium"
-  fzd["HYDROG-1"] = 10010000;
-  fzd["DEUTERIU"] = 10020000;
-  fzd["TRITIUM"]  = 10040000;
-  fzd["HELIUM-3"] = 20030000;
-  fzd["HELIUM-4"] = 20040000;
-  fzd["LITHIU-6"] = 30060000;
-  fzd["LITHIU-7"] = 30070000;
-  fzd["BORON-10"] = 50100000;
-  fzd["BORON-11"] = 50110000;
-  fzd["90-SR"]    = 380900000;   // fluka "90-SR"
-  fzd["129-I"]    = 531290000;   // fluka "129-I"
-  fzd["124-XE"]   = 541240000;   // fluka "124-XE"
-  fzd["126-XE"]   = 541260000;   // fluka "126-XE"
-  fzd["128-XE"]   = 541280000;   // fluka "128-XE"
-  fzd["130-XE"]   = 541300000;   // fluka "130-XE"
-  fzd["131-XE"]   = 541310000;   // fluka "131-XE"
-  fzd["132-XE"]   = 541320000;   // fluka "132-XE"
-  fzd["134-XE"]   = 541340000;   // fluka "134-XE"
-  fzd["135-XE"]   = 541350000;   // fluka "135-XE"
-  fzd["136-XE"]   = 541360000;   // fluka "136-XE"
-  fzd["135-CS"]   = 551350000;   // fluka "135-CS"
-  fzd["137-CS"]   = 551370000;   // fluka "137-CS"
-  fzd["230-TH"]   = 902300000;   // fluka "230-TH"
-  fzd["232-TH"]   = 902320000;   // fluka "232-TH"
-  fzd["233-U"]    = 922330000;   // fluka "233-U"
-  fzd["234-U"]    = 922340000;   // fluka "234-U"
-  fzd["235-U"]    = 922350000;   // fluka "235-U"
-  fzd["238-U"]    = 922380000;   // fluka "238-U"
-
+  name_zz_t fzd;
+  for (size_t i = 0; i < 142; i++)
+    fzd[fluka_by_name[i].name] = fluka_by_name[i].id;
   return fzd;
 }
-pyne::nucname::name_zz_t pyne::nucname::fluka_zz = pyne::nucname::get_fluka_zz();
 
 
 /*** Constructs zz to fluka dictionary **/
 pyne::nucname::zzname_t pyne::nucname::get_zz_fluka()
 {
   zzname_t zfd;
-  for (name_zz_iter i = fluka_zz.begin(); i != fluka_zz.end(); i++)
-  {
-    zfd[i->second] = i->first;
-  }
+  for (size_t i = 0; i < 142; i++)
+    zfd[fluka_by_id[i].id] = fluka_by_id[i].name;
   return zfd;
 }
-pyne::nucname::zzname_t pyne::nucname::zz_fluka = pyne::nucname::get_zz_fluka();
+
+
+pyne::nucname::name_zz_t pyne::nucname::name_zz;
+pyne::nucname::zzname_t pyne::nucname::zz_name;
+pyne::nucname::name_zz_t pyne::nucname::fluka_zz;
+pyne::nucname::zzname_t pyne::nucname::zz_fluka;
+
+namespace {
+  std::once_flag maps_filled;
+}  // namespace
+
+void * pyne::nucname::_fill_maps() {
+  std::call_once(maps_filled, [] {
+    name_zz = get_name_zz();
+    zz_name = get_zz_name();
+    fluka_zz = get_fluka_zz();
+    zz_fluka = get_zz_fluka();
+  });
+  return NULL;
+}
+
+const pyne::nucname::name_zz_t& pyne::nucname::name_zz_map() {
+  _fill_maps();
+  return name_zz;
+}
+
+const pyne::nucname::zzname_t& pyne::nucname::zz_name_map() {
+  _fill_maps();
+  return zz_name;
+}
+
+const pyne::nucname::name_zz_t& pyne::nucname::fluka_zz_map() {
+  _fill_maps();
+  return fluka_zz;
+}
+
+const pyne::nucname::zzname_t& pyne::nucname::zz_fluka_map() {
+  _fill_maps();
+  return zz_fluka;
+}
 
 
 
@@ -325,7 +517,7 @@ pyne::nucname::zz_group pyne::nucname::name_to_zz_group(pyne::nucname::name_grou
 {
   zz_group zg;
   for (name_group_iter i = eg.begin(); i != eg.end(); i++)
-    zg.insert(name_zz[*i]);
+    zg.insert(symbol_zz(*i));
   return zg;
 }
 
@@ -441,10 +633,10 @@ int pyne::nucname::id(int nuc) {
      warning("You have indicated a metastable state of " + pyne::to_str(ssss) + ". Metastable state above 5, possibly unphysical. ");
     }
     return nuc;
-  } else if (aaassss == 0 && 0 < zz_name.count(zzz)) {
+  } else if (aaassss == 0 && zz_symbol(zzz) != NULL) {
     // Natural elemental nuclide:  ie for Uranium = 920000000
     return nuc;
-  } else if (nuc < 1000 && 0 < zz_name.count(nuc))
+  } else if (nuc < 1000 && zz_symbol(nuc) != NULL)
     //  Gave Z-number
     return nuc * 10000000;
 
@@ -460,7 +652,7 @@ int pyne::nucname::id(int nuc) {
       warning("You have indicated a metastable state of " + pyne::to_str(ssss) + ". Metastable state above 5, possibly unphysical. ");
     }
     return (zzz*10000000) + (aaa*10000) + (nuc%10);
-  } else if (aaa <= zzz && zzz <= aaa * 7 && 0 < zz_name.count(aaa)) {
+  } else if (aaa <= zzz && zzz <= aaa * 7 && zz_symbol(aaa) != NULL) {
     // Cinder-form (aaazzzm), ie 2350920
     if (5 < ssss){
     // Unphysical metastable state warning
@@ -468,8 +660,8 @@ int pyne::nucname::id(int nuc) {
     }
     return (aaa*10000000) + (zzz*10000) + (nuc%10);
   }
-  //else if (aaassss == 0 && 0 == zz_name.count(nuc/1000) && 0 < zz_name.count(zzz))
-  else if (aaassss == 0 && 0 < zz_name.count(zzz)) {
+  //else if (aaassss == 0 && zz_symbol(nuc/1000) == NULL && zz_symbol(zzz) != NULL)
+  else if (aaassss == 0 && zz_symbol(zzz) != NULL) {
     // zzaaam form natural nuclide
     return zzz * 10000000;
   }
@@ -499,7 +691,7 @@ int pyne::nucname::id(int nuc) {
         nuc -= 999999;
       return nuc;
     }
-  } else if (aaa == 0 && 0 < zz_name.count(zzz)) {
+  } else if (aaa == 0 && zz_symbol(zzz) != NULL) {
     // MCNP form natural nuclide
     return zzz * 10000000;
   }
@@ -507,17 +699,99 @@ int pyne::nucname::id(int nuc) {
   // Not a normal nuclide, might be a
   // Natural elemental nuclide.
   // ie 92 for Uranium = 920000
-  if (0 < zz_name.count(nuc))
+  if (zz_symbol(nuc) != NULL)
     return nuc * 10000000;
   throw IndeterminateNuclideForm(nuc, "");
 }
 
 int pyne::nucname::id(const char * nuc) {
-  std::string newnuc (nuc);
-  return id(newnuc);
+  return id(nuc, strlen(nuc));
 }
 
 int pyne::nucname::id(std::string nuc) {
+  return id(nuc.c_str(), nuc.length());
+}
+
+namespace {
+  // Looks up the symbol made of the \a n uppercase letters at \a l.
+  inline int symbol_z(const char* l, int n) {
+    int zz = 0;
+    if (n == 1)
+      zz = symbol_zz_table[l[0] - 'A'][26];
+    else if (n == 2)
+      zz = symbol_zz_table[l[0] - 'A'][l[1] - 'A'];
+    return zz == 0 ? -1 : zz;
+  }
+}
+
+int pyne::nucname::id(const char * nuc, size_t len) {
+  // A single pass over the characters, skipping dashes.  Inputs this loop
+  // does not fully understand (ZZ-LL-AAAM form, unknown symbols, stray
+  // characters, numbers too long to convert safely) are handed to the
+  // general parser so that they resolve, or fail, exactly as before.
+  int ndash = 0;
+  int nchar = 0;
+  int ndigit = 0;
+  int nletter = 0;
+  int anum = 0;
+  char letters[3];
+  char first = 0;
+  char last = 0;
+  for (size_t i = 0; i < len; i++) {
+    char c = nuc[i];
+    if (c == '-') {
+      ndash++;
+      continue;
+    }
+    if ('a' <= c && c <= 'z')
+      c -= 'a' - 'A';
+    if ('0' <= c && c <= '9') {
+      if (ndigit < 9)
+        anum = 10*anum + (c - '0');
+      ndigit++;
+    } else if ('A' <= c && c <= 'Z') {
+      if (nletter < 3)
+        letters[nletter] = c;
+      nletter++;
+    } else {
+      return _id_general(std::string(nuc, len));
+    }
+    if (nchar == 0)
+      first = c;
+    last = c;
+    nchar++;
+  }
+  if (nchar == 0 || ndigit > 9 || (ndash >= 2 && len >= 5))
+    return _id_general(std::string(nuc, len));
+
+  bool last_digit = '0' <= last && last <= '9';
+  int z;
+  if ('0' <= first && first <= '9') {
+    if (last_digit) {
+      // integer form living in a string
+      if (nletter == 0)
+        return id(anum);
+    } else if (ndigit <= 4) {
+      // NIST form, 242Am
+      z = symbol_z(letters, nletter);
+      if (z >= 0)
+        return 10000000*z + 10000*anum;
+    }
+  } else if (ndigit == 0) {
+    // natural element, U
+    z = symbol_z(letters, nletter);
+    if (z >= 0)
+      return 10000000*z;
+  } else if (ndigit <= 4 && (last_digit || last == 'M')) {
+    // name form, U235 or Am242M; the trailing M is not part of the symbol
+    z = symbol_z(letters, last_digit ? nletter : nletter - 1);
+    if (z >= 0)
+      return 10000000*z + 10000*anum + (last_digit ? 0 : 1);
+  }
+  return _id_general(std::string(nuc, len));
+}
+
+int pyne::nucname::_id_general(std::string nuc) {
   size_t npos = std::string::npos;
   if (nuc.empty())
     throw NotANuclide(nuc, "<empty>");
@@ -562,8 +836,8 @@ int pyne::nucname::id(std::string nuc) {
       // Add the Z-number
       elem_name = pyne::remove_characters(nucstr, pyne::digits);
       elem_name = pyne::capitalize(elem_name);
-      if (0 < name_zz.count(elem_name))
-        newnuc = (10000000 * name_zz[elem_name]) + newnuc;
+      if (0 < symbol_zz(elem_name))
+        newnuc = (10000000 * symbol_zz(elem_name)) + newnuc;
       else
         throw NotANuclide(nucstr, newnuc);
     }
@@ -574,8 +848,8 @@ int pyne::nucname::id(std::string nuc) {
     // natural element form, a la 'U' -> 920000000
     if (anum_str.empty()) {
       elem_name = pyne::capitalize(nucstr);
-      if (0 < name_zz.count(elem_name))
-        return 10000000 * name_zz[elem_name];
+      if (0 < symbol_zz(elem_name))
+        return 10000000 * symbol_zz(elem_name);
     }
 
     int anum = pyne::to_int(anum_str);
@@ -596,8 +870,8 @@ int pyne::nucname::id(std::string nuc) {
     // Add the Z-number
     elem_name = pyne::remove_characters(nucstr.substr(0, nuclen-1), pyne::digits);
     elem_name = pyne::capitalize(elem_name);
-    if (0 < name_zz.count(elem_name))
-      newnuc = (10000000 * name_zz[elem_name]) + newnuc;
+    if (0 < symbol_zz(elem_name))
+      newnuc = (10000000 * symbol_zz(elem_name)) + newnuc;
     else
       throw NotANuclide(nucstr, newnuc);
   } else {
@@ -658,11 +932,11 @@ std::string pyne::nucname::name(int nuc) {
   int aaa = aaassss / 10000;
 
   // Make sure the LL value is correct
-  if (0 == zz_name.count(zzz))
+  if (zz_symbol(zzz) == NULL)
     throw NotANuclide(nuc, nucid);
 
   // Add LL
-  newnuc += zz_name[zzz];
+  newnuc += zz_symbol(zzz);
 
   // Add A-number
   if (0 < aaa)
@@ -820,13 +1094,13 @@ std::string pyne::nucname::zzllaaam(int nuc) {
   int aaa = aaassss / 10000;
 
   // Make sure the LL value is correct
-  if (0 == zz_name.count(zzz))
+  if (zz_symbol(zzz) == NULL)
     throw NotANuclide(nuc, nucid);
   //Adding ZZ
   newnuc += pyne::to_str(zzz);
   newnuc += "-";
   // Add LL
-  newnuc += zz_name[zzz];
+  newnuc += zz_symbol(zzz);
   // Add required dash
   newnuc += "-";
   // Add AAA
@@ -878,8 +1152,8 @@ int pyne::nucname::zzllaaam_to_id(std::string nuc) {
   // natural element form, a la 'U' -> 920000000
   if (anum_str.empty() || pyne::contains_substring(nucstr, "NAT")) {
     elem_name = pyne::capitalize(pyne::remove_substring(nucstr, "NAT"));
-    if (0 < name_zz.count(elem_name))
-      return 10000000 * name_zz[elem_name];
+    if (0 < symbol_zz(elem_name))
+      return 10000000 * symbol_zz(elem_name);
   }
   int anum = pyne::to_int(anum_str);
 
@@ -895,8 +1169,8 @@ int pyne::nucname::zzllaaam_to_id(std::string nuc) {
   // Add the Z-number
   elem_name = pyne::remove_characters(nucstr.substr(0, nuclen-1), pyne::digits);
   elem_name = pyne::capitalize(elem_name);
-  if (0 < name_zz.count(elem_name))
-    nucid = (10000000 * name_zz[elem_name]) + nucid;
+  if (0 < symbol_zz(elem_name))
+    nucid = (10000000 * symbol_zz(elem_name)) + nucid;
   else
     throw NotANuclide(nucstr, nucid);
   return nucid;
@@ -1013,19 +1287,18 @@ int pyne::nucname::openmc_to_id(const char * nuc) {
 
 int pyne::nucname::openmc_to_id(std::string nuc) {
   std::string nucname;
-  name_zz_t zznames = get_name_zz();
 
   // first two characters
   std::string::iterator aaa_start;
   int zzz = 0;
-  if (zznames.count(nuc.substr(0,2)) == 1) {
+  if (2 <= nuc.length() && 0 < symbol_zz(nuc.c_str(), 2)) {
     aaa_start = nuc.begin() + 2;
-    zzz = zznames[nuc.substr(0,2)];
+    zzz = symbol_zz(nuc.c_str(), 2);
   }
   // then try only the first
-  else if (zznames.count(nuc.substr(0,1)) == 1) {
+  else if (1 <= nuc.length() && 0 < symbol_zz(nuc.c_str(), 1)) {
     aaa_start = nuc.begin() + 1;
-    zzz = zznames[nuc.substr(0,1)];
+    zzz = symbol_zz(nuc.c_str(), 1);
   } else {
     throw NotANuclide(nuc, "Not in the OpenMC format");
   }
@@ -1051,11 +1324,11 @@ int pyne::nucname::openmc_to_id(std::string nuc) {
 /*** fluka functions ***/
 /**********************/
 std::string pyne::nucname::fluka(int nuc) {
-  int x = id(nuc);
-  if (zz_fluka.count(x) == 0) {
+  const char * name = id_fluka_name(id(nuc));
+  if (name == NULL) {
     throw NotANuclide(nuc, "fluka name could not be found");
   }
-  return zz_fluka[x];
+  return name;
 }
 
 
@@ -1063,10 +1336,11 @@ std::string pyne::nucname::fluka(int nuc) {
 // FLUKA name -> id
 //
 int pyne::nucname::fluka_to_id(std::string name) {
-  if (fluka_zz.count(name) == 0) {
+  int nuc = fluka_name_id(name);
+  if (nuc < 0) {
     throw NotANuclide(-1, "No nuclide: fluka name could not be found");
   }
-  return fluka_zz[name];
+  return nuc;
 }
 
 int pyne::nucname::fluka_to_id(char * name) {
@@ -1087,12 +1361,12 @@ std::string pyne::nucname::serpent(int nuc) {
   int aaa = aaassss / 10000;
 
   // Make sure the LL value is correct
-  if (0 == zz_name.count(zzz))
+  if (zz_symbol(zzz) == NULL)
     throw NotANuclide(nuc, nucid);
 
   // Add LL
-  std::string llupper = pyne::to_upper(zz_name[zzz]);
-  std::string lllower = pyne::to_lower(zz_name[zzz]);
+  std::string llupper = pyne::to_upper(zz_symbol(zzz));
+  std::string lllower = pyne::to_lower(zz_symbol(zzz));
   newnuc += llupper[0];
   for (int l = 1; l < lllower.size(); l++)
     newnuc += lllower[l];
@@ -1155,8 +1429,8 @@ int pyne::nucname::serpent_to_id(std::string nuc) {
   // natural element form, a la 'U' -> 920000000
   if (anum_str.empty() || pyne::contains_substring(nucstr, "NAT")) {
     elem_name = pyne::capitalize(pyne::remove_substring(nucstr, "NAT"));
-    if (0 < name_zz.count(elem_name))
-      return 10000000 * name_zz[elem_name];
+    if (0 < symbol_zz(elem_name))
+      return 10000000 * symbol_zz(elem_name);
   }
   int anum = pyne::to_int(anum_str);
 
@@ -1172,8 +1446,8 @@ int pyne::nucname::serpent_to_id(std::string nuc) {
   // Add the Z-number
   elem_name = pyne::remove_characters(nucstr.substr(0, nuclen-1), pyne::digits);
   elem_name = pyne::capitalize(elem_name);
-  if (0 < name_zz.count(elem_name))
-    nucid = (10000000 * name_zz[elem_name]) + nucid;
+  if (0 < symbol_zz(elem_name))
+    nucid = (10000000 * symbol_zz(elem_name)) + nucid;
   else
     throw NotANuclide(nucstr, nucid);
   return nucid;
@@ -1193,7 +1467,7 @@ std::string pyne::nucname::nist(int nuc) {
   int aaa = aaassss / 10000;
 
   // Make sure the LL value is correct
-  if (0 == zz_name.count(zzz))
+  if (zz_symbol(zzz) == NULL)
     throw NotANuclide(nuc, nucid);
 
   // Add A-number
@@ -1201,8 +1475,8 @@ std::string pyne::nucname::nist(int nuc) {
     newnuc += pyne::to_str(aaa);
 
   // Add name
-  std::string name_upper = pyne::to_upper(zz_name[zzz]);
-  std::string name_lower = pyne::to_lower(zz_name[zzz]);
+  std::string name_upper = pyne::to_upper(zz_symbol(zzz));
+  std::string name_lower = pyne::to_lower(zz_symbol(zzz));
   newnuc += name_upper[0];
   for (int l = 1; l < name_lower.size(); l++)
     newnuc += name_lower[l];
@@ -1254,16 +1528,16 @@ int pyne::nucname::nist_to_id(std::string nuc) {
   // natural element form, a la 'U' -> 920000000
   if (anum_str.empty()) {
     elem_name = pyne::capitalize(nuc);
-    if (0 < name_zz.count(elem_name))
-      return 10000000 * name_zz[elem_name];
+    if (0 < symbol_zz(elem_name))
+      return 10000000 * symbol_zz(elem_name);
   }
   nucid = pyne::to_int(anum_str) * 10000;
 
   // Add the Z-number
   elem_name = pyne::remove_characters(nuc, pyne::digits);
   elem_name = pyne::capitalize(elem_name);
-  if (0 < name_zz.count(elem_name))
-    nucid = (10000000 * name_zz[elem_name]) + nucid;
+  if (0 < symbol_zz(elem_name))
+    nucid = (10000000 * symbol_zz(elem_name)) + nucid;
   else
     throw NotANuclide(nuc, nucid);
   return nucid;
@@ -1336,11 +1610,11 @@ std::string pyne::nucname::alara(int nuc) {
   int aaa = aaassss / 10000;
 
   // Make sure the LL value is correct
-  if (0 == zz_name.count(zzz))
+  if (zz_symbol(zzz) == NULL)
     throw NotANuclide(nuc, nucid);
 
   // Add LL, in lower case
-  ll += zz_name[zzz];
+  ll += zz_symbol(zzz);
 
   for(int i = 0; ll[i] != '\0'; i++)
     ll[i] = tolower(ll[i]);
@@ -1396,16 +1670,16 @@ int pyne::nucname::alara_to_id(std::string nuc) {
   // natural element form, a la 'U' -> 920000000
   if (anum_str.empty()) {
     elem_name = pyne::capitalize(nuc);
-    if (0 < name_zz.count(elem_name))
-      return 10000000 * name_zz[elem_name];
+    if (0 < symbol_zz(elem_name))
+      return 10000000 * symbol_zz(elem_name);
   }
   nucid = pyne::to_int(anum_str) * 10000;
 
   // Add the Z-number
   elem_name = pyne::remove_characters(nuc, pyne::digits);
   elem_name = pyne::capitalize(elem_name);
-  if (0 < name_zz.count(elem_name))
-    nucid = (10000000 * name_zz[elem_name]) + nucid;
+  if (0 < symbol_zz(elem_name))
+    nucid = (10000000 * symbol_zz(elem_name)) + nucid;
   else
     throw NotANuclide(nuc, nucid);
   return nucid;
@@ -1458,52 +1732,45 @@ int pyne::nucname::sza_to_id(std::string nuc) {
 }
 
 
+namespace {
+  std::once_flag state_map_loaded;
+}  // namespace
+
 void pyne::nucname::_load_state_map(){
+  std::call_once(state_map_loaded, [] {
     for (int i = 0; i < TOTAL_STATE_MAPS; ++i) {
        state_id_map[map_nuc_ids[i]] = map_metastable[i];
     }
+  });
+}
+
+const std::map<int, int>& pyne::nucname::loaded_state_id_map() {
+  _load_state_map();
+  return state_id_map;
 }
 
 int pyne::nucname::state_id_to_id(int state) {
   int zzzaaa = (state / 10000) * 10000;
   int state_number = state % 10000;
   if (state_number == 0) return state;
-  std::map<int, int>::iterator nuc_iter, nuc_end;
 
-  nuc_iter = state_id_map.find(state);
-  nuc_end = state_id_map.end();
-  if (nuc_iter != nuc_end){
-    int m = (*nuc_iter).second;
-    return zzzaaa + m;
-  }
-
-  if (state_id_map.empty())  {
-    _load_state_map();
-    return state_id_to_id(state);
-  }
-  return -1;
+  const int * end = map_nuc_ids + TOTAL_STATE_MAPS;
+  const int * it = std::lower_bound(map_nuc_ids, end, state);
+  if (it == end || *it != state)
+    return -1;
+  return zzzaaa + map_metastable[it - map_nuc_ids];
 }
 
 
 int pyne::nucname::id_to_state_id(int nuc_id) {
-  int zzzaaa = (nuc_id / 10000) * 10000;
   int state = nuc_id % 10000;
   if (state == 0) return nuc_id;
-  std::map<int, int>::iterator nuc_iter, nuc_end, it;
-
-  nuc_iter = state_id_map.lower_bound(zzzaaa);
-  nuc_end = state_id_map.upper_bound(zzzaaa + 9999);
-  for (it = nuc_iter; it!= nuc_end; ++it){
-    if (state == it->second) {
-      return it->first;
-    }
-  }
 
-  if (state_id_map.empty())  {
-    _load_state_map();
-    return id_to_state_id(nuc_id);
-  }
-  return -1;
+  const int * end = map_metastable_ids + TOTAL_METASTABLE_MAPS;
+  const int * it = std::lower_bound(map_metastable_ids, end, nuc_id);
+  if (it == end || *it != nuc_id)
+    return -1;
+  return map_state_ids[it - map_metastable_ids];
 }
 
 
@@ -1534,3 +1801,78 @@ int pyne::nucname::ensdf_to_id(std::string nuc) {
 
 }
 
+
+/*********************************/
+/*** bulk conversion functions ***/
+/*********************************/
+
+namespace {
+  // Applies the single nuclide conversion F to each of the n entries of in,
+  // reusing the previous result while the input repeats.
+  template <typename I, typename O, O (*F)(I)>
+  void convert_array(const I * in, size_t n, O * out) {
+    for (size_t i = 0; i < n; i++) {
+      if (i > 0 && in[i] == in[i-1])
+        out[i] = out[i-1];
+      else
+        out[i] = F(in[i]);
+    }
+  }
+}
+
+void pyne::nucname::id_array(const int * in, size_t n, int * out) {
+  convert_array<int, int, id>(in, n, out);
+}
+
+void pyne::nucname::id_array(const std::string * in, size_t n, int * out) {
+  for (size_t i = 0; i < n; i++) {
+    if (i > 0 && in[i] == in[i-1])
+      out[i] = out[i-1];
+    else
+      out[i] = id(in[i].c_str(), in[i].length());
+  }
+}
+
+void pyne::nucname::name_array(const int * in, size_t n, std::string * out) {
+  convert_array<int, std::string, name>(in, n, out);
+}
+
+void pyne::nucname::zzaaam_array(const int * in, size_t n, int * out) {
+  convert_array<int, int, zzaaam>(in, n, out);
+}
+
+void pyne::nucname::zzzaaa_array(const int * in, size_t n, int * out) {
+  convert_array<int, int, zzzaaa>(in, n, out);
+}
+
+void pyne::nucname::mcnp_array(const int * in, size_t n, int * out) {
+  convert_array<int, int, mcnp>(in, n, out);
+}
+
+void pyne::nucname::cinder_array(const int * in, size_t n, int * out) {
+  convert_array<int, int, cinder>(in, n, out);
+}
+
+void pyne::nucname::state_id_to_id_array(const int * in, size_t n,
+                                         int * out) {
+  convert_array<int, int, state_id_to_id>(in, n, out);
+}
+
+void pyne::nucname::id_to_state_id_array(const int * in, size_t n,
+                                         int * out) {
+  convert_array<int, int, id_to_state_id>(in, n, out);
+}
+
+void pyne::nucname::serpent_array(const int * in, size_t n,
+                                  std::string * out) {
+  convert_array<int, std::string, serpent>(in, n, out);
+}
+
+void pyne::nucname::openmc_array(const int * in, size_t n,
+                                 std::string * out) {
+  convert_array<int, std::string, openmc>(in, n, out);
+}
+
+void pyne::nucname::fluka_array(const int * in, size_t n, std::string * out) {
+  convert_array<int, std::string, fluka>(in, n, out);
+}
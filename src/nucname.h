@@ -25,17 +25,50 @@ namespace nucname
   typedef std::map<name_t, zz_t> name_zz_t; ///< name and Z num map type
   typedef name_zz_t::iterator name_zz_iter; ///< name and Z num iter type
   name_zz_t get_name_zz();  ///< Creates standard name to Z number mapping.
-  extern name_zz_t name_zz; ///< name to Z num map
+  extern name_zz_t name_zz; ///< name to Z num map, see name_zz_map()
 
   typedef std::map<zz_t, name_t> zzname_t;  ///< Z num to name map type
   typedef zzname_t::iterator zzname_iter;   ///< Z num to name iter type
   zzname_t get_zz_name();   ///< Creates standard Z number to name mapping.
-  extern zzname_t zz_name;  ///< Z num to name map
+  extern zzname_t zz_name;  ///< Z num to name map, see zz_name_map()
 
   name_zz_t get_fluka_zz();  ///< Creates standard fluka-name to nucid mapping.
-  extern name_zz_t fluka_zz; ///< fluka-name to nucid map
+  extern name_zz_t fluka_zz; ///< fluka-name to nucid map, see fluka_zz_map()
   zzname_t get_zz_fluka();   ///< Creates standard nucid to fluka-name mapping.
-  extern zzname_t zz_fluka;  ///< nucid to fluka-name map
+  extern zzname_t zz_fluka;  ///< nucid to fluka-name map, see zz_fluka_map()
+
+  /// Fills the four maps above, which are empty until then.  The conversion
+  /// functions work from the tables below and do not need them.  Only the
+  /// first call does any work, so it is safe to call from several threads
+  /// or more than once.
+  void * _fill_maps();
+
+  /// \name Filled Map Accessors
+  /// \{
+  /// Return the maps above after filling them with #_fill_maps().  Code that
+  /// reads the maps should go through these rather than the variables.
+  const name_zz_t& name_zz_map();
+  const zzname_t& zz_name_map();
+  const name_zz_t& fluka_zz_map();
+  const zzname_t& zz_fluka_map();
+  /// \}
+
+  /// \name Element Symbol and FLUKA Name Tables
+  /// \{
+  /// Lookups in the compile-time tables that the maps above are built from.
+  /// They need no initialization, never allocate and are safe to call from
+  /// any thread, so the conversion functions use these rather than the maps.
+  /// Z number of the element symbol \a name, as in "U" or "Am", or -1.
+  int symbol_zz(const char * name, size_t len);
+  int symbol_zz(const std::string& name);
+  /// Symbol of the element with Z number \a zz, or NULL if there is none.
+  const char * zz_symbol(int zz);
+  /// Nuclide in id form named by the FLUKA name \a name, or -1.
+  int fluka_name_id(const std::string& name);
+  /// FLUKA name of the nuclide \a nuc in id form, or NULL if it has none.
+  const char * id_fluka_name(int nuc);
+  /// \}
+
   /******************************************/
   /*** Define useful elemental group sets ***/
   /******************************************/
@@ -267,6 +300,14 @@ namespace nucname
   int id(int nuc);
   int id(const char * nuc);
   int id(std::string nuc);
+  /// Parses the \a len characters at \a nuc, which need not be null
+  /// terminated.  The common string forms are resolved in a single pass
+  /// without allocating; everything else goes through _id_general().
+  int id(const char * nuc, size_t len);
+  /// The general string form resolution behind id().  It gives the same
+  /// result as id() for every input but builds several temporary strings,
+  /// so it is only used directly for testing.
+  int _id_general(std::string nuc);
   /// \}
 
   /// \name Name Form Functions
@@ -603,15 +644,49 @@ namespace nucname
   inline int groundstate(const char * nuc) {return groundstate(std::string(nuc));}
   /// \}
 
+  /// \name Bulk Conversion Functions
+  /// \{
+  /// These convert \a n nuclides at once, writing the i-th result to
+  /// \a out[i].  Each behaves as the matching single nuclide function
+  /// applied to every entry, including the exceptions thrown for invalid
+  /// nuclides (in which case \a out is only partly written), but stays in
+  /// native code for the whole array.  Runs of the same input, as found in
+  /// per-voxel composition tables, are only converted once.
+  /// \param in the input nuclides
+  /// \param n number of nuclides
+  /// \param out the converted nuclides, with room for \a n entries
+  void id_array(const int * in, size_t n, int * out);
+  void id_array(const std::string * in, size_t n, int * out);
+  void name_array(const int * in, size_t n, std::string * out);
+  void zzaaam_array(const int * in, size_t n, int * out);
+  void zzzaaa_array(const int * in, size_t n, int * out);
+  void mcnp_array(const int * in, size_t n, int * out);
+  void cinder_array(const int * in, size_t n, int * out);
+  void state_id_to_id_array(const int * in, size_t n, int * out);
+  void id_to_state_id_array(const int * in, size_t n, int * out);
+  void serpent_array(const int * in, size_t n, std::string * out);
+  void openmc_array(const int * in, size_t n, std::string * out);
+  void fluka_array(const int * in, size_t n, std::string * out);
+  /// \}
+
   /// \name State Map functions
   /// \{
   /// These convert from/to decay state ids (used in decay data)
   /// to metastable ids (the PyNE default). If the cooresponding value cannot
-  /// be found, -1 is returned.
-  void _load_state_map();
+  /// be found, -1 is returned.  Both directions are binary searches in
+  /// sorted compile-time tables and are safe to call from any thread.
   int state_id_to_id(int state);
   int id_to_state_id(int nuc_id);
+  /// Fills state_id_map from the tables.  The conversion functions do not
+  /// use the map; it is only kept for callers that iterate over it.  Only
+  /// the first call does any work, so it is safe to call from several
+  /// threads or more than once.
+  void _load_state_map();
+  /// State id to metastable level map, empty until #_load_state_map() has
+  /// been called; see loaded_state_id_map().
   extern std::map<int, int> state_id_map;
+  /// Returns state_id_map after filling it with #_load_state_map().
+  const std::map<int, int>& loaded_state_id_map();
   /// \}
 
   /// \name ENSDF Form Functions
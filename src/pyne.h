@@ -19,6 +19,7 @@ extern "C" {
 #include "h5wrap.h"
 #include "material.h"
 #include "nucname.h"
+#include "nuclide_index.h"
 #include "rxname.h"
 #include "tally.h"
 #include "utils.h"
@@ -1,8 +1,9 @@
 #ifndef PYNE_IS_AMALGAMATED
 #include "rxname.h"
+#include "rxname_hash.cpp"
 #endif
 
-std::string pyne::rxname::_names[NUM_RX_NAMES] = {
+constexpr const char * pyne::rxname::_names[NUM_RX_NAMES] = {
   "total",
   "scattering",
   "elastic",
@@ -578,25 +579,12 @@ std::string pyne::rxname::_names[NUM_RX_NAMES] = {
   "ec_3p",
   "bminus_sf"
   };
-std::set<std::string> pyne::rxname::names(pyne::rxname::_names,
-                                          pyne::rxname::_names+NUM_RX_NAMES);
 
-
-std::map<std::string, unsigned int> pyne::rxname::altnames;
-std::map<unsigned int, std::string> pyne::rxname::id_name;
-std::map<std::string, unsigned int> pyne::rxname::name_id;
-std::map<unsigned int, unsigned int> pyne::rxname::id_mt;
-std::map<unsigned int, unsigned int> pyne::rxname::mt_id;
-std::map<unsigned int, std::string> pyne::rxname::labels;
-std::map<unsigned int, std::string> pyne::rxname::docs;
-std::map<std::pair<std::string, int>, unsigned int> pyne::rxname::offset_id;
-std::map<std::pair<std::string, unsigned int>, int> pyne::rxname::id_offset;
-
-void * pyne::rxname::_fill_maps() {
-  using std::make_pair;
-  std::string rx;
-  unsigned int rxid;
-  unsigned int _mts [NUM_RX_NAMES] = {
+namespace pyne {
+namespace rxname {
+namespace {
+  // MT number of each reaction, or 0 if it has none.
+  constexpr unsigned int _mts [NUM_RX_NAMES] = {
     1,
     0,
     2,
@@ -1172,7 +1160,7 @@ void * pyne::rxname::_fill_maps() {
     0,
     0
   };
-  std::string _labels[NUM_RX_NAMES] = {
+  constexpr const char * _labels[NUM_RX_NAMES] = {
     "(z,total)",
     "(z,scattering)",
     "(z,elastic)",
@@ -1748,7 +1736,7 @@ void * pyne::rxname::_fill_maps() {
     "(z,ec3p)",
     "(z,b-sf)"
   };
-  std::string _docs[NUM_RX_NAMES] = {
+  constexpr const char * _docs[NUM_RX_NAMES] = {
     "(n,total) Neutron total",
     "Total scattering",
     "(z,z0) Elastic scattering",
@@ -2325,249 +2313,488 @@ void * pyne::rxname::_fill_maps() {
     "(z,b-sf)"
   };
 
-  // fill the maps
-  for (int i = 0; i < NUM_RX_NAMES; i++) {
-    rx = _names[i];
-    rxid = pyne::rxname::hash(rx);
-    id_name[rxid] = rx;
-    name_id[rx] = rxid;
-    if (0 < _mts[i]) {
-      id_mt[rxid] = _mts[i];
-      mt_id[_mts[i]] = rxid;
+  // An alternative name and the reaction name it stands for.
+  struct altname {
+    const char * name;
+    const char * rx;
+  };
+
+  constexpr altname _altnames[] = {
+    {"tot", "total"},
+    {"s", "scattering"},
+    {"scat", "scattering"},
+    {"e", "elastic"},
+    {"elas", "elastic"},
+    {"i", "n"},
+    {"inel", "n"},
+    {"inelastic", "n"},
+    {"abs", "absorption"},
+    {"fis", "fission"},
+    {"fiss", "fission"},
+    {"alpha", "a"},
+    {"deut", "d"},
+    {"deuteron", "d"},
+    {"deuterium", "d"},
+    {"trit", "t"},
+    {"triton", "t"},
+    {"tritium", "t"},
+    {"proton", "p"},
+    {"h", "He3"},  // 'h' stands for helion
+    {"he3", "He3"},
+    {"HE3", "He3"},
+    {"3HE", "He3"},
+    {"3He", "He3"},
+    {"3he", "He3"},
+    {"he-3", "He3"},
+    {"HE-3", "He3"},
+    {"*", "excited"},
+    {"2n", "z_2n"},
+    {"2p", "z_2p"},
+    {"3h", "t"},
+    {"g", "it"},
+    {"b-", "bminus"},
+    {"b+", "bplus"},
+    {"b-n", "bminus_n"},
+    {"b-a", "bminus_a"},
+    {"b+a", "bplus_a"},
+    {"ec+b+", "ec_bplus"},
+    {"b+p", "bplus_p"},
+    {"b-2n", "bminus_2n"},
+    {"b-3n", "bminus_3n"},
+    {"b-4n", "bminus_4n"},
+    {"b+2p", "bplus_2p"},
+    {"ec2p", "ec_2p"},
+    {"ec3p", "ec_3p"},
+    {"2b-", "decay_2bminus"},
+    {"b-p", "bminus_p"},
+    {"14c", "decay_14c"},
+    {"b+3p", "bplus_3p"},
+    {"2b+", "decay_2bplus"},
+    {"2ec", "decay_2ec"},
+    {"b-sf", "bminus_sf"}
+  };
+
+  // An incident particle flag, the nuclide id offset and the reaction name.
+  struct rx_offset {
+    const char * z;
+    int offset;
+    const char * rx;
+  };
+
+  // The nuclide difference mappings, offset_id.  These may be ambiguous, so
+  // where several reactions share an offset the last one listed wins, and
+  // _child_offsets below take precedence for child() and parent().
+  // The following should be sorted by (dz, da, ds).
+  constexpr rx_offset _offsets[] = {
+    // neutrons:
+    {"n", offset(-4, -8), "n2a"},
+    {"n", offset(-4, -7), "z_2a"},
+    {"n", offset(-2, -5), "z_2na"},
+    {"n", offset(-2, -4), "na"},
+    {"n", offset(-2, -4, 1), "na_1"},
+    {"n", offset(-2, -4, 2), "na_2"},
+    {"n", offset(-2, -3), "a"},
+    {"n", offset(-2, -3, 1), "a_1"},
+    {"n", offset(-2, -3, 2), "a_2"},
+    {"n", offset(-2, -2), "He3"},
+    {"n", offset(-2, -2, 1), "He3_1"},
+    {"n", offset(-2, -2, 2), "He3_2"},
+    {"n", offset(-2, -1), "z_2p"},
+    {"n", offset(-2, -1, 1), "z_2p_1"},
+    {"n", offset(-2, -1, 2), "z_2p_2"},
+    {"n", offset(-1, -3), "nt"},
+    {"n", offset(-1, -3, 1), "nt_1"},
+    {"n", offset(-1, -3, 2), "nt_2"},
+    {"n", offset(-1, -2), "t"},
+    {"n", offset(-1, -2, 1), "t_1"},
+    {"n", offset(-1, -2, 2), "t_2"},
+    {"n", offset(-1, -1), "d"},
+    {"n", offset(-1, -1, 1), "d_1"},
+    {"n", offset(-1, -1, 2), "d_2"},
+    {"n", offset(-1, 0), "p"},
+    {"n", offset(-1, 0, 1), "p_1"},
+    {"n", offset(-1, 0, 2), "p_2"},
+    {"n", offset(0, -3), "z_4n"},
+    {"n", offset(0, -3, 1), "z_4n_1"},
+    {"n", offset(0, -2), "z_3n"},
+    {"n", offset(0, -2, 1), "z_3n_1"},
+    {"n", offset(0, -2, 2), "z_3n_2"},
+    {"n", offset(0, -1), "z_2n"},
+    {"n", offset(0, -1, 1), "z_2n_1"},
+    {"n", offset(0, -1, 2), "z_2n_2"},
+    {"n", offset(0, 0), "scattering"},
+    {"n", offset(0, 0, 1), "n_1"},
+    {"n", offset(0, 0, 2), "n_2"},
+    {"n", offset(0, 1), "absorption"},
+    {"n", offset(0, 1, 1), "gamma_1"},
+    {"n", offset(0, 1, 2), "gamma_2"},
+    // proton:
+    {"p", offset(0, 0), "scattering"},
+    {"p", offset(1, 1), "absorption"},
+    {"p", offset(1, 0), "n"},
+    {"p", offset(1, -1), "z_2n"},
+    {"p", offset(1, -2), "z_3n"},
+    {"p", offset(1, -3), "z_4n"},
+    {"p", offset(-1, -1), "z_2p"},
+    {"p", offset(0, -1), "d"},
+    {"p", offset(0, -2), "t"},
+    {"p", offset(-1, -2), "He3"},
+    {"p", offset(-1, -3), "a"},
+    // deuterium:
+    {"d", offset(0, 0), "scattering"},
+    {"d", offset(1, 2), "absorption"},
+    {"d", offset(1, 1), "n"},
+    {"d", offset(1, 0), "z_2n"},
+    {"d", offset(1, -1), "z_3n"},
+    {"d", offset(1, -2), "z_4n"},
+    {"d", offset(0, 1), "p"},
+    {"d", offset(-1, 0), "z_2p"},
+    {"d", offset(0, -1), "t"},
+    {"d", offset(-1, -1), "He3"},
+    {"d", offset(-1, -2), "a"},
+    // tritium:
+    {"t", offset(0, 0), "scattering"},
+    {"t", offset(1, 3), "absorption"},
+    {"t", offset(1, 2), "n"},
+    {"t", offset(1, 1), "z_2n"},
+    {"t", offset(1, 0), "z_3n"},
+    {"t", offset(1, -1), "z_4n"},
+    {"t", offset(0, 2), "p"},
+    {"t", offset(-1, 1), "z_2p"},
+    {"t", offset(0, 1), "d"},
+    {"t", offset(-1, 0), "He3"},
+    {"t", offset(-1, -1), "a"},
+    // He3:
+    {"He3", offset(0, 0), "scattering"},
+    {"He3", offset(2, 3), "absorption"},
+    {"He3", offset(2, 2), "n"},
+    {"He3", offset(2, 1), "z_2n"},
+    {"He3", offset(2, 0), "z_3n"},
+    {"He3", offset(2, -1), "z_4n"},
+    {"He3", offset(1, 2), "p"},
+    {"He3", offset(0, 1), "z_2p"},
+    {"He3", offset(1, 1), "d"},
+    {"He3", offset(1, 0), "t"},
+    {"He3", offset(0, -1), "a"},
+    // alpha:
+    {"a", offset(0, 0), "scattering"},
+    {"a", offset(2, 4), "absorption"},
+    {"a", offset(2, 3), "n"},
+    {"a", offset(2, 2), "z_2n"},
+    {"a", offset(2, 1), "z_3n"},
+    {"a", offset(2, 0), "z_4n"},
+    {"a", offset(1, 3), "p"},
+    {"a", offset(0, 2), "z_2p"},
+    {"a", offset(1, 2), "d"},
+    {"a", offset(1, 1), "t"},
+    {"a", offset(0, 1), "He3"},
+    // gamma:
+    {"gamma", offset(0, -1), "n"},
+    {"gamma", offset(0, -2), "z_2n"},
+    {"gamma", offset(0, -3), "z_3n"},
+    {"gamma", offset(0, -4), "z_4n"},
+    {"gamma", offset(-1, -1), "p"},
+    {"gamma", offset(-2, -2), "z_2p"},
+    {"gamma", offset(-1, -2), "d"},
+    {"gamma", offset(-1, -3), "t"},
+    {"gamma", offset(-2, -3), "He3"},
+    {"gamma", offset(-2, -4), "a"},
+    // decay:
+    {"decay", offset(0, -1), "n"},
+    {"decay", offset(0, -2), "z_2n"},
+    {"decay", offset(0, -3), "z_3n"},
+    {"decay", offset(0, -4), "z_4n"},
+    {"decay", offset(-1, -1), "p"},
+    {"decay", offset(-2, -2), "z_2p"},
+    {"decay", offset(-1, -2), "d"},
+    {"decay", offset(-1, -3), "t"},
+    {"decay", offset(-2, -3), "He3"},
+    {"decay", offset(-2, -4), "a"},
+    {"decay", offset(1, 0), "bminus"},
+    {"decay", offset(-1, 0), "bplus"},
+    {"decay", offset(1, -1), "bminus_n"},
+    {"decay", offset(-1, -4), "bminus_a"},
+    {"decay", offset(0, 0), "it"},
+    {"decay", offset(-3, -4), "bplus_a"},
+    {"decay", offset(-2, -1), "bplus_p"},
+    {"decay", offset(1, -2), "bminus_2n"},
+    {"decay", offset(1, -3), "bminus_3n"},
+    {"decay", offset(1, -4), "bminus_4n"},
+    {"decay", offset(-3, -2), "bplus_2p"},
+    {"decay", offset(-4, -3), "bplus_3p"},
+    {"decay", offset(2, 0), "decay_2bminus"},
+    {"decay", offset(-2, 0), "decay_2bplus"},
+    {"decay", offset(-6, -14), "decay_14c"}
+  };
+
+  // Pre-loaded child offsets for reactions that are not, or not uniquely,
+  // the reaction of their offset above.
+  constexpr rx_offset _child_offsets[] = {
+    // neutrons:
+    {"n", offset(-2, -3), "nHe3"},
+    {"n", offset(-2, -3, 2), "nHe3_1"},
+    {"n", offset(-2, -3, 2), "nHe3_2"},
+    {"n", offset(-1, -3), "z_3np"},
+    {"n", offset(-1, -2), "nd"},
+    {"n", offset(-1, -2, 1), "nd_1"},
+    {"n", offset(-1, -2, 2), "nd_2"},
+    {"n", offset(-1, -1), "np"},
+    {"n", offset(-1, -1, 1), "np_1"},
+    {"n", offset(-1, -1, 2), "np_2"},
+    {"n", offset(0, 0), "n"},
+    {"n", offset(0, 1), "gamma"},
+    // decay:
+    {"decay", offset(0, -1), "bminus_p"},
+    {"decay", offset(-3, -2), "ec_2p"},
+    {"decay", offset(-4, -3), "ec_3p"},
+    {"decay", offset(-1, 0), "ec"},
+    {"decay", offset(-1, 0), "ec_bplus"},
+    {"decay", offset(-2, -1), "ecp"},
+    {"decay", offset(-3, -4), "eca"},
+    {"decay", offset(-2, 0), "decay_2ec"}
+  };
+  // Compile time twin of hash(const char *).
+  constexpr unsigned int _chash(const char * s, unsigned int h=32) {
+    return *s == 0 ? h : _chash(s + 1, ((h << 5) + h) ^ (unsigned int) *s);
+  }
+
+  constexpr bool _cstreq(const char * a, const char * b) {
+    return *a == *b && (*a == 0 || _cstreq(a + 1, b + 1));
+  }
+
+  constexpr unsigned int _slot_of(unsigned int h) {
+    return _hash_slot(h, _hash_seeds[_hash_bucket(h)]);
+  }
+
+  // The checks below are split in halves so that the recursion depth stays
+  // well within what C++11 compilers allow.
+  constexpr bool _names_hashed(int lo, int hi) {
+    return hi - lo == 1 ?
+      _chash(_names[lo]) == _ids[lo] && _hash_slots[_slot_of(_ids[lo])] == lo &&
+      (_mts[lo] == 0 || (_mts[lo] <= RX_MAX_MT && _mt_entries[_mts[lo]] == lo)) :
+      _names_hashed(lo, (lo + hi) / 2) && _names_hashed((lo + hi) / 2, hi);
+  }
+
+  constexpr bool _altnames_hashed(int lo, int hi) {
+    return hi - lo == 1 ?
+      _hash_slots[_slot_of(_chash(_altnames[lo].name))] == NUM_RX_NAMES + lo &&
+      _cstreq(_names[_altname_entries[lo]], _altnames[lo].rx) :
+      _altnames_hashed(lo, (lo + hi) / 2) && _altnames_hashed((lo + hi) / 2, hi);
+  }
+
+  static_assert(sizeof(_altnames) / sizeof(altname) == NUM_RX_ALTNAMES,
+                "rxname_hash.cpp is out of date, rerun rxnamegen.py");
+  static_assert(_names_hashed(0, NUM_RX_NAMES),
+                "reaction names do not match rxname_hash.cpp, rerun rxnamegen.py");
+  static_assert(_altnames_hashed(0, NUM_RX_ALTNAMES),
+                "alternate names do not match rxname_hash.cpp, rerun rxnamegen.py");
+
+  // Entry of _names for the reaction or alternative name in the first
+  // len characters at s, or -1.
+  int _name_entry(const char * s, size_t len) {
+    unsigned int h = hash(s);
+    int i = _hash_slots[_slot_of(h)];
+    if (i < 0)
+      return -1;
+    const char * key = i < NUM_RX_NAMES ? _names[i] : _altnames[i - NUM_RX_NAMES].name;
+    if (strlen(key) != len || memcmp(key, s, len) != 0)
+      return -1;
+    return i < NUM_RX_NAMES ? i : _altname_entries[i - NUM_RX_NAMES];
+  }
+
+  // Entry of _names for the reaction id x, or -1.
+  int _id_entry(unsigned int x) {
+    int i = _hash_slots[_slot_of(x)];
+    return 0 <= i && i < NUM_RX_NAMES && _ids[i] == x ? i : -1;
+  }
+
+  // Entry of _names for the MT number x, or -1.
+  int _mt_entry(unsigned int x) {
+    return x <= RX_MAX_MT ? _mt_entries[x] : -1;
+  }
+
+  // Entry of _names for an id or MT number.
+  int _int_entry(unsigned int n) {
+    int i = _id_entry(n);
+    if (i < 0)
+      i = _mt_entry(n);
+    if (i < 0)
+      throw NotAReaction(n, "???");
+    return i;
+  }
+
+  // Entry of _names for a name, alternative name or integer in string form.
+  int _str_entry(const char * s, size_t len) {
+    int i = _name_entry(s, len);
+    if (0 <= i)
+      return i;
+    // see if id in string form
+    size_t j = 0;
+    int found = 0;
+    while(0 <= found && j < len) {
+      found = pyne::digits.find(s[j]);
+      j++;
     }
-    labels[rxid] = _labels[i];
-    docs[rxid] = _docs[i];
+    if (0<=found)
+      return _int_entry(atoi(s));
+    // dead...
+    throw NotAReaction(std::string(s, len), "???");
+  }
+
+  // Index of the incident particle flag z in _particles, or -1.
+  int _particle(const std::string& z) {
+    for (int i = 0; i < NUM_RX_PARTICLES; i++)
+      if (z == _particles[i])
+        return i;
+    return -1;
   }
 
-  // set alternative names
-  altnames["tot"] = name_id["total"];
-  altnames["s"] = name_id["scattering"];
-  altnames["scat"] = name_id["scattering"];
-  altnames["e"] = name_id["elastic"];
-  altnames["elas"] = name_id["elastic"];
-  altnames["i"] = name_id["n"];
-  altnames["inel"] = name_id["n"];
-  altnames["inelastic"] = name_id["n"];
-  altnames["abs"] = name_id["absorption"];
-  altnames["fis"] = name_id["fission"];
-  altnames["fiss"] = name_id["fission"];
-  altnames["alpha"] = name_id["a"];
-  altnames["deut"] = name_id["d"];
-  altnames["deuteron"] = name_id["d"];
-  altnames["deuterium"] = name_id["d"];
-  altnames["trit"] = name_id["t"];
-  altnames["triton"] = name_id["t"];
-  altnames["tritium"] = name_id["t"];
-  altnames["proton"] = name_id["p"];
-  altnames["h"] = name_id["He3"];  // 'h' stands for helion
-  altnames["he3"] = name_id["He3"];
-  altnames["HE3"] = name_id["He3"];
-  altnames["3HE"] = name_id["He3"];
-  altnames["3He"] = name_id["He3"];
-  altnames["3he"] = name_id["He3"];
-  altnames["he-3"] = name_id["He3"];
-  altnames["HE-3"] = name_id["He3"];
-  altnames["*"] = name_id["excited"];
-  altnames["2n"] = name_id["z_2n"];
-  altnames["2p"] = name_id["z_2p"];
-  altnames["3h"] = name_id["t"];
-  altnames["g"] = name_id["it"];
-  altnames["b-"] = name_id["bminus"];
-  altnames["b+"] = name_id["bplus"];
-  altnames["b-n"] = name_id["bminus_n"];
-  altnames["b-a"] = name_id["bminus_a"];
-  altnames["b+a"] = name_id["bplus_a"];
-  altnames["ec+b+"] = name_id["ec_bplus"];
-  altnames["b+p"] = name_id["bplus_p"];
-  altnames["b-2n"] = name_id["bminus_2n"];
-  altnames["b-3n"] = name_id["bminus_3n"];
-  altnames["b-4n"] = name_id["bminus_4n"];
-  altnames["b+2p"] = name_id["bplus_2p"];
-  altnames["ec2p"] = name_id["ec_2p"];
-  altnames["ec3p"] = name_id["ec_3p"];
-  altnames["2b-"] = name_id["decay_2bminus"];
-  altnames["b-p"] = name_id["bminus_p"];
-  altnames["14c"] = name_id["decay_14c"];
-  altnames["b+3p"] = name_id["bplus_3p"];
-  altnames["2b+"] = name_id["decay_2bplus"];
-  altnames["2ec"] = name_id["decay_2ec"];
-  altnames["b-sf"] = name_id["bminus_sf"];
-
-
-  // set the nuclide difference mappings, offset_id
-  // offset_id[incident particle type "n", "p", ...][delta Z num][delta A num][rxid]
-  // offset_id mapping may be ambiquious so they must come before the id_offsets!
-  // the following should be sorted by (dz, da, ds)
-  // neutrons:
-  offset_id[make_pair("n", offset(-4, -8))] = name_id["n2a"];
-  offset_id[make_pair("n", offset(-4, -7))] = name_id["z_2a"];
-  offset_id[make_pair("n", offset(-2, -5))] = name_id["z_2na"];
-  offset_id[make_pair("n", offset(-2, -4))] = name_id["na"];
-  offset_id[make_pair("n", offset(-2, -4, 1))] = name_id["na_1"];
-  offset_id[make_pair("n", offset(-2, -4, 2))] = name_id["na_2"];
-  offset_id[make_pair("n", offset(-2, -3))] = name_id["a"];
-  offset_id[make_pair("n", offset(-2, -3, 1))] = name_id["a_1"];
-  offset_id[make_pair("n", offset(-2, -3, 2))] = name_id["a_2"];
-  offset_id[make_pair("n", offset(-2, -2))] = name_id["He3"];
-  offset_id[make_pair("n", offset(-2, -2, 1))] = name_id["He3_1"];
-  offset_id[make_pair("n", offset(-2, -2, 2))] = name_id["He3_2"];
-  offset_id[make_pair("n", offset(-2, -1))] = name_id["z_2p"];
-  offset_id[make_pair("n", offset(-2, -1, 1))] = name_id["z_2p_1"];
-  offset_id[make_pair("n", offset(-2, -1, 2))] = name_id["z_2p_2"];
-  offset_id[make_pair("n", offset(-1, -3))] = name_id["nt"];
-  offset_id[make_pair("n", offset(-1, -3, 1))] = name_id["nt_1"];
-  offset_id[make_pair("n", offset(-1, -3, 2))] = name_id["nt_2"];
-  offset_id[make_pair("n", offset(-1, -2))] = name_id["t"];
-  offset_id[make_pair("n", offset(-1, -2, 1))] = name_id["t_1"];
-  offset_id[make_pair("n", offset(-1, -2, 2))] = name_id["t_2"];
-  offset_id[make_pair("n", offset(-1, -1))] = name_id["d"];
-  offset_id[make_pair("n", offset(-1, -1, 1))] = name_id["d_1"];
-  offset_id[make_pair("n", offset(-1, -1, 2))] = name_id["d_2"];
-  offset_id[make_pair("n", offset(-1, 0))] = name_id["p"];
-  offset_id[make_pair("n", offset(-1, 0, 1))] = name_id["p_1"];
-  offset_id[make_pair("n", offset(-1, 0, 2))] = name_id["p_2"];
-  offset_id[make_pair("n", offset(0, -3))] = name_id["z_4n"];
-  offset_id[make_pair("n", offset(0, -3, 1))] = name_id["z_4n_1"];
-  offset_id[make_pair("n", offset(0, -2))] = name_id["z_3n"];
-  offset_id[make_pair("n", offset(0, -2, 1))] = name_id["z_3n_1"];
-  offset_id[make_pair("n", offset(0, -2, 2))] = name_id["z_3n_2"];
-  offset_id[make_pair("n", offset(0, -1))] = name_id["z_2n"];
-  offset_id[make_pair("n", offset(0, -1, 1))] = name_id["z_2n_1"];
-  offset_id[make_pair("n", offset(0, -1, 2))] = name_id["z_2n_2"];
-  offset_id[make_pair("n", offset(0, 0))] = name_id["scattering"];
-  offset_id[make_pair("n", offset(0, 0, 1))] = name_id["n_1"];
-  offset_id[make_pair("n", offset(0, 0, 2))] = name_id["n_2"];
-  offset_id[make_pair("n", offset(0, 1))] = name_id["absorption"];
-  offset_id[make_pair("n", offset(0, 1, 1))] = name_id["gamma_1"];
-  offset_id[make_pair("n", offset(0, 1, 2))] = name_id["gamma_2"];
-  // proton:
-  offset_id[make_pair("p", offset(0, 0))] = name_id["scattering"];
-  offset_id[make_pair("p", offset(1, 1))] = name_id["absorption"];
-  offset_id[make_pair("p", offset(1, 0))] = name_id["n"];
-  offset_id[make_pair("p", offset(1, -1))] = name_id["z_2n"];
-  offset_id[make_pair("p", offset(1, -2))] = name_id["z_3n"];
-  offset_id[make_pair("p", offset(1, -3))] = name_id["z_4n"];
-  offset_id[make_pair("p", offset(-1, -1))] = name_id["z_2p"];
-  offset_id[make_pair("p", offset(0, -1))] = name_id["d"];
-  offset_id[make_pair("p", offset(0, -2))] = name_id["t"];
-  offset_id[make_pair("p", offset(-1, -2))] = name_id["He3"];
-  offset_id[make_pair("p", offset(-1, -3))] = name_id["a"];
-  // deuterium:
-  offset_id[make_pair("d", offset(0, 0))] = name_id["scattering"];
-  offset_id[make_pair("d", offset(1, 2))] = name_id["absorption"];
-  offset_id[make_pair("d", offset(1, 1))] = name_id["n"];
-  offset_id[make_pair("d", offset(1, 0))] = name_id["z_2n"];
-  offset_id[make_pair("d", offset(1, -1))] = name_id["z_3n"];
-  offset_id[make_pair("d", offset(1, -2))] = name_id["z_4n"];
-  offset_id[make_pair("d", offset(0, 1))] = name_id["p"];
-  offset_id[make_pair("d", offset(-1, 0))] = name_id["z_2p"];
-  offset_id[make_pair("d", offset(0, -1))] = name_id["t"];
-  offset_id[make_pair("d", offset(-1, -1))] = name_id["He3"];
-  offset_id[make_pair("d", offset(-1, -2))] = name_id["a"];
-  // tritium:
-  offset_id[make_pair("t", offset(0, 0))] = name_id["scattering"];
-  offset_id[make_pair("t", offset(1, 3))] = name_id["absorption"];
-  offset_id[make_pair("t", offset(1, 2))] = name_id["n"];
-  offset_id[make_pair("t", offset(1, 1))] = name_id["z_2n"];
-  offset_id[make_pair("t", offset(1, 0))] = name_id["z_3n"];
-  offset_id[make_pair("t", offset(1, -1))] = name_id["z_4n"];
-  offset_id[make_pair("t", offset(0, 2))] = name_id["p"];
-  offset_id[make_pair("t", offset(-1, 1))] = name_id["z_2p"];
-  offset_id[make_pair("t", offset(0, 1))] = name_id["d"];
-  offset_id[make_pair("t", offset(-1, 0))] = name_id["He3"];
-  offset_id[make_pair("t", offset(-1, -1))] = name_id["a"];
-  // He3:
-  offset_id[make_pair("He3", offset(0, 0))] = name_id["scattering"];
-  offset_id[make_pair("He3", offset(2, 3))] = name_id["absorption"];
-  offset_id[make_pair("He3", offset(2, 2))] = name_id["n"];
-  offset_id[make_pair("He3", offset(2, 1))] = name_id["z_2n"];
-  offset_id[make_pair("He3", offset(2, 0))] = name_id["z_3n"];
-  offset_id[make_pair("He3", offset(2, -1))] = name_id["z_4n"];
-  offset_id[make_pair("He3", offset(1, 2))] = name_id["p"];
-  offset_id[make_pair("He3", offset(0, 1))] = name_id["z_2p"];
-  offset_id[make_pair("He3", offset(1, 1))] = name_id["d"];
-  offset_id[make_pair("He3", offset(1, 0))] = name_id["t"];
-  offset_id[make_pair("He3", offset(0, -1))] = name_id["a"];
-  // alpha:
-  offset_id[make_pair("a", offset(0, 0))] = name_id["scattering"];
-  offset_id[make_pair("a", offset(2, 4))] = name_id["absorption"];
-  offset_id[make_pair("a", offset(2, 3))] = name_id["n"];
-  offset_id[make_pair("a", offset(2, 2))] = name_id["z_2n"];
-  offset_id[make_pair("a", offset(2, 1))] = name_id["z_3n"];
-  offset_id[make_pair("a", offset(2, 0))] = name_id["z_4n"];
-  offset_id[make_pair("a", offset(1, 3))] = name_id["p"];
-  offset_id[make_pair("a", offset(0, 2))] = name_id["z_2p"];
-  offset_id[make_pair("a", offset(1, 2))] = name_id["d"];
-  offset_id[make_pair("a", offset(1, 1))] = name_id["t"];
-  offset_id[make_pair("a", offset(0, 1))] = name_id["He3"];
-  // gamma:
-  offset_id[make_pair("gamma", offset(0, -1))] = name_id["n"];
-  offset_id[make_pair("gamma", offset(0, -2))] = name_id["z_2n"];
-  offset_id[make_pair("gamma", offset(0, -3))] = name_id["z_3n"];
-  offset_id[make_pair("gamma", offset(0, -4))] = name_id["z_4n"];
-  offset_id[make_pair("gamma", offset(-1, -1))] = name_id["p"];
-  offset_id[make_pair("gamma", offset(-2, -2))] = name_id["z_2p"];
-  offset_id[make_pair("gamma", offset(-1, -2))] = name_id["d"];
-  offset_id[make_pair("gamma", offset(-1, -3))] = name_id["t"];
-  offset_id[make_pair("gamma", offset(-2, -3))] = name_id["He3"];
-  offset_id[make_pair("gamma", offset(-2, -4))] = name_id["a"];
-  // decay:
-  offset_id[make_pair("decay", offset(0, -1))] = name_id["n"];
-  offset_id[make_pair("decay", offset(0, -2))] = name_id["z_2n"];
-  offset_id[make_pair("decay", offset(0, -3))] = name_id["z_3n"];
-  offset_id[make_pair("decay", offset(0, -4))] = name_id["z_4n"];
-  offset_id[make_pair("decay", offset(-1, -1))] = name_id["p"];
-  offset_id[make_pair("decay", offset(-2, -2))] = name_id["z_2p"];
-  offset_id[make_pair("decay", offset(-1, -2))] = name_id["d"];
-  offset_id[make_pair("decay", offset(-1, -3))] = name_id["t"];
-  offset_id[make_pair("decay", offset(-2, -3))] = name_id["He3"];
-  offset_id[make_pair("decay", offset(-2, -4))] = name_id["a"];
-  offset_id[make_pair("decay", offset(1, 0))] = name_id["bminus"];
-  offset_id[make_pair("decay", offset(-1, 0))] = name_id["bplus"];
-  offset_id[make_pair("decay", offset(1, -1))] = name_id["bminus_n"];
-  offset_id[make_pair("decay", offset(-1, -4))] = name_id["bminus_a"];
-  offset_id[make_pair("decay", offset(0, 0))] = name_id["it"];
-  offset_id[make_pair("decay", offset(-3, -4))] = name_id["bplus_a"];
-  offset_id[make_pair("decay", offset(-2, -1))] = name_id["bplus_p"];
-  offset_id[make_pair("decay", offset(1, -2))] = name_id["bminus_2n"];
-  offset_id[make_pair("decay", offset(1, -3))] = name_id["bminus_3n"];
-  offset_id[make_pair("decay", offset(1, -4))] = name_id["bminus_4n"];
-  offset_id[make_pair("decay", offset(-3, -2))] = name_id["bplus_2p"];
-  offset_id[make_pair("decay", offset(-4, -3))] = name_id["bplus_3p"];
-  offset_id[make_pair("decay", offset(2, 0))] = name_id["decay_2bminus"];
-  offset_id[make_pair("decay", offset(-2, 0))] = name_id["decay_2bplus"];
-  offset_id[make_pair("decay", offset(-6, -14))] = name_id["decay_14c"];
-
-  // pre-loaded child offsets
-  std::map<std::pair<std::string, int>, unsigned int>::iterator ioffid;
-  for (ioffid = offset_id.begin(); ioffid != offset_id.end(); ioffid++) {
-    id_offset[make_pair(ioffid->first.first, ioffid->second)] = ioffid->first.second;
+  bool _by_offset(const _offset_entry& a, const _offset_entry& b) {
+    return a.particle < b.particle || (a.particle == b.particle && a.offset < b.offset);
   }
-  // neutrons:
-  id_offset[make_pair("n", name_id["nHe3"])] = offset(-2, -3);
-  id_offset[make_pair("n", name_id["nHe3_1"])] = offset(-2, -3, 2);
-  id_offset[make_pair("n", name_id["nHe3_2"])] = offset(-2, -3, 2);
-  id_offset[make_pair("n", name_id["z_3np"])] = offset(-1, -3);
-  id_offset[make_pair("n", name_id["nd"])] = offset(-1, -2);
-  id_offset[make_pair("n", name_id["nd_1"])] = offset(-1, -2, 1);
-  id_offset[make_pair("n", name_id["nd_2"])] = offset(-1, -2, 2);
-  id_offset[make_pair("n", name_id["np"])] = offset(-1, -1);
-  id_offset[make_pair("n", name_id["np_1"])] = offset(-1, -1, 1);
-  id_offset[make_pair("n", name_id["np_2"])] = offset(-1, -1, 2);
-  id_offset[make_pair("n", name_id["n"])] = offset(0, 0);
-  id_offset[make_pair("n", name_id["gamma"])] = offset(0, 1);
-  // decay:
-  id_offset[make_pair("decay", name_id["bminus_p"])] = offset(0, -1);
-  id_offset[make_pair("decay", name_id["ec_2p"])] = offset(-3, -2);
-  id_offset[make_pair("decay", name_id["ec_3p"])] = offset(-4, -3);
-  id_offset[make_pair("decay", name_id["ec"])] = offset(-1, 0);
-  id_offset[make_pair("decay", name_id["ec_bplus"])] = offset(-1, 0);
-  id_offset[make_pair("decay", name_id["ecp"])] = offset(-2, -1);
-  id_offset[make_pair("decay", name_id["eca"])] = offset(-3, -4);
-  id_offset[make_pair("decay", name_id["decay_2ec"])] = offset(-2, 0);
+
+  bool _by_rx(const _offset_entry& a, const _offset_entry& b) {
+    return a.particle < b.particle || (a.particle == b.particle && a.rx < b.rx);
+  }
+
+  // Entry of _names for the reaction of particle z taking from_nuc to to_nuc.
+  int _offset_entry_of(int from_nuc, int to_nuc, const std::string& z) {
+    // This assumes nuclides are in id form
+    int p = _particle(z);
+    if (0 <= p) {
+      _offset_entry key = {(unsigned char) p, to_nuc - from_nuc, 0};
+      const _offset_entry * end = _offset_rxs + sizeof(_offset_rxs) / sizeof(_offset_entry);
+      const _offset_entry * it = std::lower_bound(_offset_rxs, end, key, _by_offset);
+      if (it != end && it->particle == p && it->offset == key.offset)
+        return it->rx;
+    }
+    throw IndeterminateReactionForm("z=" + z + ", " + pyne::to_str(from_nuc) + \
+                                    ", " + pyne::to_str(to_nuc), "???");
+  }
+
+  static_assert(PARTICLE_NTYPES == NUM_RX_PARTICLES &&
+                _cstreq(_particles[PARTICLE_N], "n") &&
+                _cstreq(_particles[PARTICLE_P], "p") &&
+                _cstreq(_particles[PARTICLE_D], "d") &&
+                _cstreq(_particles[PARTICLE_T], "t") &&
+                _cstreq(_particles[PARTICLE_HE3], "He3") &&
+                _cstreq(_particles[PARTICLE_A], "a") &&
+                _cstreq(_particles[PARTICLE_GAMMA], "gamma") &&
+                _cstreq(_particles[PARTICLE_DECAY], "decay"),
+                "rxname::particle does not match the particles in rxname_hash.cpp");
+
+  // Nuclide id offset of the reaction rx for the particle p, or for the
+  // particle flag z when p is -1.
+  int _rx_offset_of(unsigned int rx, int p, const std::string& z) {
+    int i = _id_entry(rx);
+    if (0 <= p && 0 <= i) {
+      _offset_entry key = {(unsigned char) p, 0, (short) i};
+      const _offset_entry * end = _rx_offsets + sizeof(_rx_offsets) / sizeof(_offset_entry);
+      const _offset_entry * it = std::lower_bound(_rx_offsets, end, key, _by_rx);
+      if (it != end && it->particle == p && it->rx == i)
+        return it->offset;
+    }
+    throw IndeterminateReactionForm("z=" + z + ", rx=" + pyne::to_str(rx), "???");
+  }
+
+  unsigned int _mt_of(int i) {
+    if (0 == _mts[i])
+      throw NotAReaction();
+    return _mts[i];
+  }
+
+  std::once_flag _maps_filled;
+}  // namespace
+}  // namespace rxname
+}  // namespace pyne
+
+
+std::set<std::string> pyne::rxname::names;
+std::map<std::string, unsigned int> pyne::rxname::altnames;
+std::map<unsigned int, std::string> pyne::rxname::id_name;
+std::map<std::string, unsigned int> pyne::rxname::name_id;
+std::map<unsigned int, unsigned int> pyne::rxname::id_mt;
+std::map<unsigned int, unsigned int> pyne::rxname::mt_id;
+std::map<unsigned int, std::string> pyne::rxname::labels;
+std::map<unsigned int, std::string> pyne::rxname::docs;
+std::map<std::pair<std::string, int>, unsigned int> pyne::rxname::offset_id;
+std::map<std::pair<std::string, unsigned int>, int> pyne::rxname::id_offset;
+
+void * pyne::rxname::_fill_maps() {
+  std::call_once(_maps_filled, [] {
+    using std::make_pair;
+    for (int i = 0; i < NUM_RX_NAMES; i++) {
+      names.insert(_names[i]);
+      id_name[_ids[i]] = _names[i];
+      name_id[_names[i]] = _ids[i];
+      if (0 < _mts[i]) {
+        id_mt[_ids[i]] = _mts[i];
+        mt_id[_mts[i]] = _ids[i];
+      }
+      labels[_ids[i]] = _labels[i];
+      docs[_ids[i]] = _docs[i];
+    }
+    for (int i = 0; i < NUM_RX_ALTNAMES; i++)
+      altnames[_altnames[i].name] = _ids[_altname_entries[i]];
+    for (size_t i = 0; i < sizeof(_offset_rxs) / sizeof(_offset_entry); i++)
+      offset_id[make_pair(std::string(_particles[_offset_rxs[i].particle]),
+                          _offset_rxs[i].offset)] = _ids[_offset_rxs[i].rx];
+    for (size_t i = 0; i < sizeof(_rx_offsets) / sizeof(_offset_entry); i++)
+      id_offset[make_pair(std::string(_particles[_rx_offsets[i].particle]),
+                          _ids[_rx_offsets[i].rx])] = _rx_offsets[i].offset;
+  });
   return NULL;
 }
-void * pyne::rxname::_ = pyne::rxname::_fill_maps();
+
+const std::set<std::string>& pyne::rxname::names_set() {
+  _fill_maps();
+  return names;
+}
+
+const std::map<unsigned int, std::string>& pyne::rxname::id_name_map() {
+  _fill_maps();
+  return id_name;
+}
+
+const std::map<std::string, unsigned int>& pyne::rxname::name_id_map() {
+  _fill_maps();
+  return name_id;
+}
+
+const std::map<std::string, unsigned int>& pyne::rxname::altnames_map() {
+  _fill_maps();
+  return altnames;
+}
+
+const std::map<unsigned int, unsigned int>& pyne::rxname::id_mt_map() {
+  _fill_maps();
+  return id_mt;
+}
+
+const std::map<unsigned int, unsigned int>& pyne::rxname::mt_id_map() {
+  _fill_maps();
+  return mt_id;
+}
+
+const std::map<unsigned int, std::string>& pyne::rxname::labels_map() {
+  _fill_maps();
+  return labels;
+}
+
+const std::map<unsigned int, std::string>& pyne::rxname::docs_map() {
+  _fill_maps();
+  return docs;
+}
+
+const std::map<std::pair<std::string, int>, unsigned int>& pyne::rxname::offset_id_map() {
+  _fill_maps();
+  return offset_id;
+}
+
+const std::map<std::pair<std::string, unsigned int>, int>& pyne::rxname::id_offset_map() {
+  _fill_maps();
+  return id_offset;
+}
 
 
 unsigned int pyne::rxname::hash(std::string s) {
@@ -2591,26 +2818,11 @@ unsigned int pyne::rxname::hash(const char * s) {
 // ************************
 
 std::string pyne::rxname::name(char * s) {
-  return pyne::rxname::name(std::string(s));
+  return _names[_str_entry(s, strlen(s))];
 }
 
 std::string pyne::rxname::name(std::string s) {
-  if (0 < names.count(s))
-    return s;
-  if (0 < altnames.count(s))
-    return id_name[altnames[s]];
-  // see if id in string form
-  int i = 0;
-  int I = s.length();
-  int found = 0;
-  while(0 <= found && i < I) {
-    found = pyne::digits.find(s[i]);
-    i++;
-  }
-  if (0<=found)
-    return pyne::rxname::name(atoi(s.c_str()));
-  // dead...
-  throw NotAReaction(s, "???");
+  return _names[_str_entry(s.c_str(), s.length())];
 }
 
 
@@ -2619,21 +2831,12 @@ std::string pyne::rxname::name(int n) {
 }
 
 std::string pyne::rxname::name(unsigned int n) {
-  if (0 < id_name.count(n))
-    return id_name[n];
-  if (0 < mt_id.count(n))
-    return id_name[mt_id[n]];
-  throw NotAReaction(n, "???");
+  return _names[_int_entry(n)];
 }
 
 
 std::string pyne::rxname::name(int from_nuc, int to_nuc, std::string z) {
-  // This assumes nuclides are in id form
-  std::pair<std::string, int> key = std::make_pair(z, to_nuc - from_nuc);
-  if (0 == offset_id.count(key))
-    throw IndeterminateReactionForm("z=" + z + ", " + pyne::to_str(from_nuc) + \
-                                    ", " + pyne::to_str(to_nuc), "???");
-  return id_name[offset_id[key]];
+  return _names[_offset_entry_of(from_nuc, to_nuc, z)];
 }
 
 std::string pyne::rxname::name(std::string from_nuc, int to_nuc, std::string z) {
@@ -2657,36 +2860,23 @@ std::string pyne::rxname::name(std::string from_nuc, std::string to_nuc, std::st
 // *** id functions *****
 // **********************
 unsigned int pyne::rxname::id(int x) {
-  return name_id[pyne::rxname::name(x)];
+  return _ids[_int_entry((unsigned int) x)];
 }
 
 unsigned int pyne::rxname::id(unsigned int x) {
-  if (0 < id_name.count(x))
-    return x;
-  if (0 < mt_id.count(x))
-    return mt_id[x];
-  return name_id[pyne::rxname::name(x)];
+  return _ids[_int_entry(x)];
 }
 
 unsigned int pyne::rxname::id(const char * x) {
-  return name_id[pyne::rxname::name(x)];
+  return _ids[_str_entry(x, strlen(x))];
 }
 
 unsigned int pyne::rxname::id(std::string x) {
-  if (0 < names.count(x))
-    return name_id[x];
-  if (0 < altnames.count(x))
-    return altnames[x];
-  return name_id[pyne::rxname::name(x)];
+  return _ids[_str_entry(x.c_str(), x.length())];
 }
 
 unsigned int pyne::rxname::id(int from_nuc, int to_nuc, std::string z) {
-  // This assumes nuclides are in id form
-  std::pair<std::string, int> key = std::make_pair(z, to_nuc - from_nuc);
-  if (0 == offset_id.count(key))
-    throw IndeterminateReactionForm("z=" + z + ", " + pyne::to_str(from_nuc) + \
-                                    ", " + pyne::to_str(to_nuc), "???");
-  return offset_id[key];
+  return _ids[_offset_entry_of(from_nuc, to_nuc, z)];
 }
 
 unsigned int pyne::rxname::id(int from_nuc, std::string to_nuc, std::string z) {
@@ -2709,59 +2899,35 @@ unsigned int pyne::rxname::id(std::string from_nuc, std::string to_nuc, std::str
 // *** MT functions *****
 // **********************
 unsigned int pyne::rxname::mt(int x) {
-  unsigned int rxid = pyne::rxname::id(x);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return _mt_of(_id_entry(pyne::rxname::id(x)));
 }
 
 unsigned int pyne::rxname::mt(unsigned int x) {
-  unsigned int rxid = pyne::rxname::id(x);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return _mt_of(_id_entry(pyne::rxname::id(x)));
 }
 
 unsigned int pyne::rxname::mt(char * x) {
-  unsigned int rxid = pyne::rxname::id(x);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return _mt_of(_id_entry(pyne::rxname::id(x)));
 }
 
 unsigned int pyne::rxname::mt(std::string x) {
-  unsigned int rxid = pyne::rxname::id(x);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return _mt_of(_id_entry(pyne::rxname::id(x)));
 }
 
 unsigned int pyne::rxname::mt(int from_nuc, int to_nuc, std::string z) {
-  unsigned int rxid = pyne::rxname::id(from_nuc, to_nuc, z);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return _mt_of(_id_entry(pyne::rxname::id(from_nuc, to_nuc, z)));
 }
 
 unsigned int pyne::rxname::mt(int from_nuc, std::string to_nuc, std::string z) {
-  unsigned int rxid = pyne::rxname::id(from_nuc, to_nuc, z);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return _mt_of(_id_entry(pyne::rxname::id(from_nuc, to_nuc, z)));
 }
 
 unsigned int pyne::rxname::mt(std::string from_nuc, int to_nuc, std::string z) {
-  unsigned int rxid = pyne::rxname::id(from_nuc, to_nuc, z);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return _mt_of(_id_entry(pyne::rxname::id(from_nuc, to_nuc, z)));
 }
 
 unsigned int pyne::rxname::mt(std::string from_nuc, std::string to_nuc, std::string z) {
-  unsigned int rxid = pyne::rxname::id(from_nuc, to_nuc, z);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return _mt_of(_id_entry(pyne::rxname::id(from_nuc, to_nuc, z)));
 }
 
 
@@ -2769,35 +2935,35 @@ unsigned int pyne::rxname::mt(std::string from_nuc, std::string to_nuc, std::str
 // *** label functions ***
 // ***********************
 std::string pyne::rxname::label(int x) {
-  return labels[pyne::rxname::id(x)];
+  return _labels[_id_entry(pyne::rxname::id(x))];
 }
 
 std::string pyne::rxname::label(unsigned int x) {
-  return labels[pyne::rxname::id(x)];
+  return _labels[_id_entry(pyne::rxname::id(x))];
 }
 
 std::string pyne::rxname::label(char * x) {
-  return labels[pyne::rxname::id(x)];
+  return _labels[_id_entry(pyne::rxname::id(x))];
 }
 
 std::string pyne::rxname::label(std::string x) {
-  return labels[pyne::rxname::id(x)];
+  return _labels[_id_entry(pyne::rxname::id(x))];
 }
 
 std::string pyne::rxname::label(int from_nuc, int to_nuc, std::string z) {
-  return labels[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return _labels[_id_entry(pyne::rxname::id(from_nuc, to_nuc, z))];
 }
 
 std::string pyne::rxname::label(int from_nuc, std::string to_nuc, std::string z) {
-  return labels[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return _labels[_id_entry(pyne::rxname::id(from_nuc, to_nuc, z))];
 }
 
 std::string pyne::rxname::label(std::string from_nuc, int to_nuc, std::string z) {
-  return labels[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return _labels[_id_entry(pyne::rxname::id(from_nuc, to_nuc, z))];
 }
 
 std::string pyne::rxname::label(std::string from_nuc, std::string to_nuc, std::string z) {
-  return labels[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return _labels[_id_entry(pyne::rxname::id(from_nuc, to_nuc, z))];
 }
 
 
@@ -2805,35 +2971,35 @@ std::string pyne::rxname::label(std::string from_nuc, std::string to_nuc, std::s
 // *** doc functions ***
 // *********************
 std::string pyne::rxname::doc(int x) {
-  return docs[pyne::rxname::id(x)];
+  return _docs[_id_entry(pyne::rxname::id(x))];
 }
 
 std::string pyne::rxname::doc(unsigned int x) {
-  return docs[pyne::rxname::id(x)];
+  return _docs[_id_entry(pyne::rxname::id(x))];
 }
 
 std::string pyne::rxname::doc(char * x) {
-  return docs[pyne::rxname::id(x)];
+  return _docs[_id_entry(pyne::rxname::id(x))];
 }
 
 std::string pyne::rxname::doc(std::string x) {
-  return docs[pyne::rxname::id(x)];
+  return _docs[_id_entry(pyne::rxname::id(x))];
 }
 
 std::string pyne::rxname::doc(int from_nuc, int to_nuc, std::string z) {
-  return docs[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return _docs[_id_entry(pyne::rxname::id(from_nuc, to_nuc, z))];
 }
 
 std::string pyne::rxname::doc(int from_nuc, std::string to_nuc, std::string z) {
-  return docs[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return _docs[_id_entry(pyne::rxname::id(from_nuc, to_nuc, z))];
 }
 
 std::string pyne::rxname::doc(std::string from_nuc, int to_nuc, std::string z) {
-  return docs[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return _docs[_id_entry(pyne::rxname::id(from_nuc, to_nuc, z))];
 }
 
 std::string pyne::rxname::doc(std::string from_nuc, std::string to_nuc, std::string z) {
-  return docs[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return _docs[_id_entry(pyne::rxname::id(from_nuc, to_nuc, z))];
 }
 
 
@@ -2843,10 +3009,16 @@ std::string pyne::rxname::doc(std::string from_nuc, std::string to_nuc, std::str
 
 int pyne::rxname::child(int nuc, unsigned int rx, std::string z) {
   // This assumes nuclides are in id form
-  std::pair<std::string, unsigned int> key = std::make_pair(z, rx);
-  if (0 == id_offset.count(key))
-    throw IndeterminateReactionForm("z=" + z + ", rx=" + pyne::to_str(rx), "???");
-  int to_nuc = pyne::nucname::groundstate(nuc) + id_offset[key];
+  int to_nuc = pyne::nucname::groundstate(nuc) + _rx_offset_of(rx, _particle(z), z);
+  if (!pyne::nucname::isnuclide(to_nuc))
+    throw pyne::nucname::NotANuclide(nuc, to_nuc);
+  return to_nuc;
+}
+
+int pyne::rxname::child(int nuc, unsigned int rx, particle z) {
+  int p = 0 <= z && z < PARTICLE_NTYPES ? z : -1;
+  int to_nuc = pyne::nucname::groundstate(nuc) + \
+               _rx_offset_of(rx, p, p < 0 ? pyne::to_str(z) : _particles[p]);
   if (!pyne::nucname::isnuclide(to_nuc))
     throw pyne::nucname::NotANuclide(nuc, to_nuc);
   return to_nuc;
@@ -2870,10 +3042,15 @@ int pyne::rxname::child(std::string nuc, std::string rx, std::string z) {
 
 int pyne::rxname::parent(int nuc, unsigned int rx, std::string z) {
   // This assumes nuclides are in id form
-  std::pair<std::string, unsigned int> key = std::make_pair(z, rx);
-  if (0 == id_offset.count(key))
-    throw IndeterminateReactionForm("z=" + z + ", rx=" + pyne::to_str(rx), "???");
-  int from_nuc = nuc - id_offset[key];
+  int from_nuc = nuc - _rx_offset_of(rx, _particle(z), z);
+  if (!pyne::nucname::isnuclide(from_nuc))
+    throw pyne::nucname::NotANuclide(from_nuc, nuc);
+  return from_nuc;
+}
+
+int pyne::rxname::parent(int nuc, unsigned int rx, particle z) {
+  int p = 0 <= z && z < PARTICLE_NTYPES ? z : -1;
+  int from_nuc = nuc - _rx_offset_of(rx, p, p < 0 ? pyne::to_str(z) : _particles[p]);
   if (!pyne::nucname::isnuclide(from_nuc))
     throw pyne::nucname::NotANuclide(from_nuc, nuc);
   return from_nuc;
@@ -2891,3 +3068,45 @@ int pyne::rxname::parent(std::string nuc, std::string rx, std::string z) {
   return parent(pyne::nucname::id(nuc), id(rx), z);
 }
 
+
+// ****************************
+// *** bulk child functions ***
+// ****************************
+
+pyne::rxname::particle pyne::rxname::particle_id(std::string z) {
+  int p = _particle(z);
+  if (p < 0)
+    throw IndeterminateReactionForm("z=" + z, "???");
+  return (particle) p;
+}
+
+pyne::rxname::rx_triplets pyne::rxname::child_triplets(
+    const NuclideIndex& index, const unsigned int* rxs, size_t nrx, particle z) {
+  int p = 0 <= z && z < PARTICLE_NTYPES ? z : -1;
+  std::string zname = p < 0 ? pyne::to_str(z) : _particles[p];
+  std::vector<int> offsets (nrx);
+  for (size_t j = 0; j < nrx; j++)
+    offsets[j] = _rx_offset_of(rxs[j], p, zname);
+
+  rx_triplets t;
+  for (int i = 0; i < index.size(); i++) {
+    int nuc = index.nuc(i);
+    if (nuc < 0)
+      continue;
+    int gs = (nuc / 10000) * 10000;
+    for (size_t j = 0; j < nrx; j++) {
+      int c = index.index(gs + offsets[j]);
+      if (c < 0)
+        continue;
+      t.parents.push_back(i);
+      t.rxs.push_back(rxs[j]);
+      t.children.push_back(c);
+    }
+  }
+  return t;
+}
+
+pyne::rxname::rx_triplets pyne::rxname::child_triplets(
+    const NuclideIndex& index, const std::vector<unsigned int>& rxs, particle z) {
+  return child_triplets(index, rxs.empty() ? NULL : &rxs[0], rxs.size(), z);
+}
@@ -7,13 +7,18 @@
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
 #include <exception>
+#include <algorithm>
+#include <mutex>
+#include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
 
 #ifndef PYNE_IS_AMALGAMATED
 #include "utils.h"
 #include "nucname.h"
+#include "nuclide_index.h"
 #endif
 
 /// Number of reactions supported by default.
@@ -24,7 +29,14 @@ namespace pyne
 //! Converts between naming conventions for reaction channels.
 namespace rxname
 {
-  extern std::string _names[NUM_RX_NAMES];  ///< Raw array of reaction names
+  extern const char * const _names[NUM_RX_NAMES];  ///< Raw array of reaction names
+
+  /// \name Lookup Maps
+  /// \{
+  /// The functions below work from the constant tables in rxname.cpp and do
+  /// not need these maps.  They are kept for code that reads them directly
+  /// and are empty until #_fill_maps() has been called; the accessors in
+  /// Filled Map Accessors below fill them first.
   /// Set of reaction names, must be valid variable names.
   extern std::set<std::string> names;
   /// Mapping from reaction ids to reaction names.
@@ -47,13 +59,48 @@ namespace rxname
   /// Mapping from particle type and reaction ids to offsets.
   /// Particle flags are 'n', 'p', 'd', 't', 'He3', 'a', 'gamma', and 'decay'.
   extern std::map<std::pair<std::string, unsigned int>, int> id_offset;
+  /// \}
 
-  /// A helper function to set the contents of the variables in this library.
+  /// Fills the lookup maps above.  Only the first call does any work, so it is
+  /// safe to call from several threads or more than once.
   void * _fill_maps();
-  extern void * _;  ///< A dummy variable used when calling #_fill_maps().
+
+  /// \name Filled Map Accessors
+  /// \{
+  /// Return the lookup maps above after filling them with #_fill_maps().
+  /// Code that reads the maps should go through these rather than the
+  /// variables.
+  const std::set<std::string>& names_set();
+  const std::map<unsigned int, std::string>& id_name_map();
+  const std::map<std::string, unsigned int>& name_id_map();
+  const std::map<std::string, unsigned int>& altnames_map();
+  const std::map<unsigned int, unsigned int>& id_mt_map();
+  const std::map<unsigned int, unsigned int>& mt_id_map();
+  const std::map<unsigned int, std::string>& labels_map();
+  const std::map<unsigned int, std::string>& docs_map();
+  const std::map<std::pair<std::string, int>, unsigned int>& offset_id_map();
+  const std::map<std::pair<std::string, unsigned int>, int>& id_offset_map();
+  /// \}
 
   /// A helper function to compute nuclide id offsets from z-, a-, and s- deltas
-  inline int offset(int dz, int da, int ds=0) {return dz*10000000 + da*10000 + ds;}
+  constexpr int offset(int dz, int da, int ds=0) {return dz*10000000 + da*10000 + ds;}
+
+  /// Incident particle types, the typed form of the particle flags.
+  enum particle {
+    PARTICLE_N,       ///< "n"
+    PARTICLE_P,       ///< "p"
+    PARTICLE_D,       ///< "d"
+    PARTICLE_T,       ///< "t"
+    PARTICLE_HE3,     ///< "He3"
+    PARTICLE_A,       ///< "a"
+    PARTICLE_GAMMA,   ///< "gamma"
+    PARTICLE_DECAY,   ///< "decay"
+    PARTICLE_NTYPES   ///< number of particle types
+  };
+
+  /// Returns the particle type of the flag \a z, throwing
+  /// IndeterminateReactionForm if there is none.
+  particle particle_id(std::string z);
 
   /// \name Hash Functions
   /// \{
@@ -183,6 +230,7 @@ namespace rxname
   int parent(int nuc, std::string rx, std::string z="n");
   int parent(std::string nuc, unsigned int rx, std::string z="n");
   int parent(std::string nuc, std::string rx, std::string z="n");
+  int parent(int nuc, unsigned int rx, particle z);
   /// \}
 
   /// \name Parent Functions
@@ -198,6 +246,33 @@ namespace rxname
   int child(int nuc, std::string rx, std::string z="n");
   int child(std::string nuc, unsigned int rx, std::string z="n");
   int child(std::string nuc, std::string rx, std::string z="n");
+  int child(int nuc, unsigned int rx, particle z);
+  /// \}
+
+  /// \brief Reaction channels between the nuclides of an index.
+  ///
+  /// Entry i says that reaction rxs[i] takes the nuclide at position
+  /// parents[i] of the index to the one at position children[i].  Entries
+  /// are sorted by parent and then follow the order of the reactions asked
+  /// for.
+  typedef struct rx_triplets {
+    std::vector<int> parents;       ///< positions of the parents in the index
+    std::vector<unsigned int> rxs;  ///< reaction ids
+    std::vector<int> children;      ///< positions of the children in the index
+  } rx_triplets;
+
+  /// \name Bulk Child Functions
+  /// \{
+  /// Finds the children of every nuclide in \a index for each of the \a nrx
+  /// reaction ids at \a rxs in one pass, as the sparsity pattern of a
+  /// transmutation matrix.  Children that are not in the index are left out.
+  /// A reaction that has no offset for particle \a z throws
+  /// IndeterminateReactionForm.
+  rx_triplets child_triplets(const NuclideIndex& index, const unsigned int* rxs,
+                             size_t nrx, particle z=PARTICLE_N);
+  rx_triplets child_triplets(const NuclideIndex& index,
+                             const std::vector<unsigned int>& rxs,
+                             particle z=PARTICLE_N);
   /// \}
 
   /// Custom exception for declaring a value not to be a valid reaction.
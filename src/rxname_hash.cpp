@@ -0,0 +1,428 @@
+/*
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+!!!!!! This file has been autogenerated, modify rxnamegen.py !!!!!!!!!!
+!!!!!!          DO NOT MODIFY THIS FILE BY HAND!!            !!!!!!!!!!
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+*/
+/// \file rxname_hash.cpp
+/// \brief Lookup tables derived from the reaction tables in rxname.cpp.
+#ifndef PYNE_DRWFTLSUQBEP5LE4JZQ7QY3BVI
+#define PYNE_DRWFTLSUQBEP5LE4JZQ7QY3BVI
+
+namespace pyne {
+namespace rxname {
+#define NUM_RX_ALTNAMES 52
+#define NUM_RX_PARTICLES 8
+#define RX_MAX_MT 851
+#define RX_HASH_BUCKET_BITS 7
+#define RX_HASH_SLOT_BITS 10
+
+/// Slot of the reaction or alternate name whose hash is \a h.
+constexpr unsigned int _hash_slot(unsigned int h, unsigned int seed) {
+  return ((h ^ seed) * 0x9E3779B1u) >> (32 - RX_HASH_SLOT_BITS);
+}
+
+/// Bucket, and so seed, of the hash \a h.
+constexpr unsigned int _hash_bucket(unsigned int h) {
+  return (h * 0x85EBCA6Bu) >> (32 - RX_HASH_BUCKET_BITS);
+}
+
+/// Reaction id, the hash of the name, of each entry of _names.
+constexpr unsigned int _ids[NUM_RX_NAMES] = {
+  1313192322u, 2754005670u, 3556114565u, 2730041194u, 1102u,
+  39456052u, 4044931548u, 1322647069u, 40080217u, 697680598u,
+  697680599u, 697680596u, 40080248u, 697714487u, 697714486u,
+  697714485u, 3909112679u, 1560426786u, 3437956488u, 1534549819u,
+  36463u, 39706144u, 39706145u, 39706146u, 1201596u,
+  1322647064u, 1322648089u, 3163131457u, 36478u, 39725745u,
+  39725744u, 39725747u, 1203802u, 1201629u, 697681866u,
+  36458u, 39705253u, 39705252u, 39705255u, 36474u,
+  39721653u, 39721652u, 39721655u, 39666672u, 247330751u,
+  247330750u, 247330749u, 39702232u, 39718633u, 40079903u,
+  697338256u, 697338257u, 4238120298u, 1322647049u, 1322648072u,
+  1201612u, 1203807u, 1202241u, 1202240u, 1202243u,
+  1202242u, 1202245u, 1202244u, 1202247u, 1202246u,
+  1202249u, 1202248u, 39673968u, 39673969u, 39673970u,
+  39673971u, 39673972u, 39673973u, 39673974u, 39673975u,
+  39673976u, 39673977u, 39674003u, 39674002u, 39674001u,
+  39674000u, 39674007u, 39674006u, 39674005u, 39674004u,
+  39674011u, 39674010u, 39674034u, 39674035u, 39674032u,
+  39674033u, 39674038u, 39674039u, 39674036u, 39674037u,
+  39674042u, 39674043u, 39674069u, 2838001037u, 1859435552u,
+  1299806215u, 2444726152u, 2444726153u, 2444726154u, 1104u,
+  1092u, 1108u, 1225374u, 1089u, 40080214u,
+  40080247u, 40080199u, 697666376u, 697666377u, 697666378u,
+  36401u, 1207239u, 1190871u, 36404u, 36388u,
+  36005u, 886604009u, 4058975827u, 3208512282u, 1499423053u,
+  4092219993u, 2066453065u, 4039916163u, 445654364u, 1308389096u,
+  1308389032u, 1308389109u, 1302746793u, 1302746804u, 1304543675u,
+  2240811086u, 952919734u, 1304543654u, 1288426146u, 1288426172u,
+  1302752201u, 4013242370u, 1113u, 2949902819u, 1885723876u,
+  2946786027u, 4024122543u, 3342888245u, 603290173u, 1402880697u,
+  3947027261u, 3947027292u, 4176363142u, 4075153411u, 602788105u,
+  4049202458u, 3947025134u, 1402808925u, 1402880700u, 1402881725u,
+  3322166016u, 3947025151u, 1402808892u, 3345391790u, 3947025131u,
+  3947025147u, 3343033393u, 3343073049u, 3343089640u, 3947027451u,
+  1324687403u, 1402880685u, 1402881708u, 1402808877u, 1402811070u,
+  1402809568u, 1402809569u, 1402809570u, 1402809571u, 1402809572u,
+  1402809573u, 1402809574u, 1402809575u, 1402809576u, 1402809577u,
+  3343042865u, 3343042864u, 3343042867u, 3343042866u, 3343042869u,
+  3343042868u, 3343042871u, 3343042870u, 3343042873u, 3343042872u,
+  3343042834u, 3343042835u, 3343042832u, 3343042833u, 3343042838u,
+  3343042839u, 3343042836u, 3343042837u, 3343042842u, 3343042843u,
+  3343042931u, 3343042930u, 3343042929u, 3343042928u, 3343042935u,
+  3343042934u, 3343042933u, 3343042932u, 3343042939u, 3343042938u,
+  3343042900u, 292194604u, 2602749761u, 2929686502u, 4024122545u,
+  4024122533u, 4024122549u, 1402767231u, 4024122528u, 3947027250u,
+  3947027283u, 3947027235u, 3947025072u, 1402814502u, 1402798134u,
+  3947025077u, 3947025061u, 3947024676u, 4043370667u, 1309825896u,
+  1310763978u, 1182308392u, 3977280353u, 451711281u, 1293730970u,
+  3061099522u, 1690515523u, 1504791020u, 2669049960u, 1734033407u,
+  1316197777u, 3339980022u, 2637498473u, 2638379601u, 2354795884u,
+  1733039548u, 3064829531u, 2662420913u, 2563929586u, 320951906u,
+  83920519u, 1895268442u, 3898946525u, 974572603u, 1304990349u,
+  726388046u, 2152134415u, 650311916u, 2739445167u, 601219438u,
+  1367786793u, 3524528360u, 2595665743u, 935855116u, 2458283469u,
+  362248330u, 1174914891u, 3810071560u, 1037532617u, 3090834094u,
+  4292122989u, 2057215276u, 3904990955u, 1670083242u, 2871372137u,
+  636464424u, 2779431655u, 544523942u, 3455790865u, 2877188562u,
+  7967635u, 4160557140u, 581574421u, 2972118u, 1428718487u,
+  991149144u, 1707133721u, 2131725889u, 609297536u, 2801112432u,
+  595278387u, 2752019954u, 1200095u, 1200094u, 1200093u,
+  1200092u, 1200091u, 1200090u, 1200089u, 1200088u,
+  1200087u, 1200086u, 39603118u, 39603119u, 39603116u,
+  39603117u, 39603114u, 39603115u, 39603112u, 39603113u,
+  39603110u, 39603111u, 39603021u, 39603020u, 39603023u,
+  39603022u, 39603017u, 39603016u, 39603019u, 39603018u,
+  39603013u, 39603012u, 39603052u, 39603053u, 39603054u,
+  39603055u, 39603048u, 39603049u, 39603050u, 39603051u,
+  39603044u, 39603045u, 39602955u, 39602954u, 39602953u,
+  39602952u, 39602959u, 39602958u, 39602957u, 39602956u,
+  39602947u, 2288689427u, 1187787u, 1187786u, 1187785u,
+  1187784u, 1187791u, 1187790u, 1187789u, 1187788u,
+  1187779u, 1187778u, 39196986u, 39196987u, 39196984u,
+  39196985u, 39196990u, 39196991u, 39196988u, 39196989u,
+  39196978u, 39196979u, 39196889u, 39196888u, 39196891u,
+  39196890u, 39196893u, 39196892u, 39196895u, 39196894u,
+  39196881u, 39196880u, 39196920u, 39196921u, 39196922u,
+  39196923u, 39196924u, 39196925u, 39196926u, 39196927u,
+  39196912u, 39196913u, 39197087u, 39197086u, 39197085u,
+  39197084u, 39197083u, 39197082u, 39197081u, 39197080u,
+  39197079u, 1800204551u, 1204187u, 1204186u, 1204185u,
+  1204184u, 1204191u, 1204190u, 1204189u, 1204188u,
+  1204179u, 1204178u, 39738154u, 39738155u, 39738152u,
+  39738153u, 39738158u, 39738159u, 39738156u, 39738157u,
+  39738146u, 39738147u, 39738057u, 39738056u, 39738059u,
+  39738058u, 39738061u, 39738060u, 39738063u, 39738062u,
+  39738049u, 39738048u, 39738088u, 39738089u, 39738090u,
+  39738091u, 39738092u, 39738093u, 39738094u, 39738095u,
+  39738080u, 39738081u, 39738255u, 39738254u, 39738253u,
+  39738252u, 39738251u, 39738250u, 39738249u, 39738248u,
+  39738247u, 2322247959u, 1334429201u, 1334429200u, 1334429203u,
+  1334429202u, 1334429205u, 1334429204u, 1334429207u, 1334429206u,
+  1334429209u, 1334429208u, 1086490656u, 1086490657u, 1086490658u,
+  1086490659u, 1086490660u, 1086490661u, 1086490662u, 1086490663u,
+  1086490664u, 1086490665u, 1086490691u, 1086490690u, 1086490689u,
+  1086490688u, 1086490695u, 1086490694u, 1086490693u, 1086490692u,
+  1086490699u, 1086490698u, 1086490722u, 1086490723u, 1086490720u,
+  1086490721u, 1086490726u, 1086490727u, 1086490724u, 1086490725u,
+  1086490730u, 1086490731u, 1086490757u, 1086490756u, 1086490759u,
+  1086490758u, 1086490753u, 1086490752u, 1086490755u, 1086490754u,
+  1086490765u, 2532074717u, 1184718u, 1184719u, 1184716u,
+  1184717u, 1184714u, 1184715u, 1184712u, 1184713u,
+  1184710u, 1184711u, 39095711u, 39095710u, 39095709u,
+  39095708u, 39095707u, 39095706u, 39095705u, 39095704u,
+  39095703u, 39095702u, 39095676u, 39095677u, 39095678u,
+  39095679u, 39095672u, 39095673u, 39095674u, 39095675u,
+  39095668u, 39095669u, 39095645u, 39095644u, 39095647u,
+  39095646u, 39095641u, 39095640u, 39095643u, 39095642u,
+  39095637u, 39095636u, 39095610u, 39095611u, 39095608u,
+  39095609u, 39095614u, 39095615u, 39095612u, 39095613u,
+  39095602u, 3619292418u, 50137459u, 49749186u, 4130566254u,
+  1296729272u, 35974u, 1355894015u, 1355894000u, 36125u,
+  3388905638u, 3182278881u, 3388905655u, 1794826605u, 1794826380u,
+  1794826539u, 1187126u, 1187111u, 164739045u, 1292747035u,
+  2025579481u, 1355893985u, 1620221635u, 164738820u, 36565u,
+  3314405935u, 1620221105u, 1292747066u, 1794828612u};
+
+/// Seed of each bucket.
+constexpr unsigned int _hash_seeds[1 << RX_HASH_BUCKET_BITS] = {
+  16, 0, 2, 15, 13, 1, 0, 35, 16, 1,
+  3, 77, 70, 3, 24, 6, 74, 0, 0, 3,
+  0, 1, 1, 0, 27, 3, 0, 0, 10, 22,
+  1, 0, 0, 36, 16, 12, 51, 1, 17, 33,
+  10, 0, 0, 0, 25, 51, 15, 27, 23, 48,
+  0, 2, 1, 12, 0, 106, 14, 13, 14, 16,
+  9, 88, 9, 0, 3, 1, 48, 52, 35, 32,
+  3, 8, 20, 0, 10, 0, 17, 9, 23, 25,
+  1, 67, 26, 9, 19, 2, 5, 0, 110, 100,
+  8, 61, 19, 15, 16, 53, 2, 29, 14, 0,
+  44, 4, 0, 22, 39, 1, 27, 86, 131, 34,
+  4, 32, 20, 1, 8, 2, 4, 35, 7, 8,
+  8, 13, 169, 5, 29, 85, 4, 34};
+
+/// Entry in each slot: below NUM_RX_NAMES an entry of _names, then
+/// the alternate names in order, or -1 for an empty slot.
+constexpr short _hash_slots[1 << RX_HASH_SLOT_BITS] = {
+  -1, 475, -1, -1, 330, 539, -1, -1, -1, 432, -1, -1,
+  317, -1, -1, 368, 609, -1, -1, 30, 400, 56, 271, 45,
+  -1, 306, 600, 211, -1, 381, -1, 419, 517, -1, -1, 59,
+  97, 218, 237, 450, 193, 248, -1, -1, 431, 512, -1, -1,
+  326, 590, -1, 375, 603, 67, -1, -1, 115, 43, 472, 41,
+  -1, 394, 356, 614, 384, -1, 120, -1, -1, 260, 175, 123,
+  -1, -1, 132, 549, -1, -1, 624, 429, 309, -1, 301, 57,
+  179, -1, -1, -1, 425, -1, 595, 334, 262, 46, 40, -1,
+  242, -1, 546, -1, -1, 80, 52, -1, 50, 263, 250, -1,
+  163, 134, 0, 202, -1, -1, 272, 470, 116, -1, 327, 195,
+  -1, -1, -1, 90, 625, 31, 402, 131, 410, -1, -1, -1,
+  605, 206, -1, -1, -1, 285, -1, -1, 39, 268, 95, -1,
+  552, 75, -1, -1, 298, 7, 259, -1, -1, 335, 540, 200,
+  587, -1, 551, 610, 210, 48, 562, 291, -1, -1, -1, 72,
+  3, -1, 338, 580, 459, -1, 151, 303, 353, -1, -1, -1,
+  418, 526, 548, -1, 65, 148, 486, 9, 222, 54, 545, -1,
+  -1, 566, 458, -1, -1, 145, -1, 36, -1, -1, -1, -1,
+  -1, 364, 99, 473, -1, -1, -1, 601, 354, 382, -1, -1,
+  321, 29, 150, 144, -1, 481, 514, -1, 388, -1, 249, 343,
+  275, 464, 500, 281, -1, 199, 295, 258, -1, 426, -1, -1,
+  -1, -1, -1, -1, 10, -1, -1, 541, 171, -1, -1, 78,
+  515, -1, 325, -1, 412, 376, -1, -1, 532, -1, 399, -1,
+  555, 504, -1, 574, 332, 355, -1, -1, 70, -1, 521, -1,
+  66, -1, 478, 282, -1, 340, -1, -1, 403, -1, 430, 501,
+  -1, 232, 170, 101, 374, -1, -1, 310, -1, 359, -1, -1,
+  278, -1, -1, -1, -1, -1, 158, -1, 79, 196, -1, 293,
+  61, -1, -1, 154, 575, 209, 440, -1, -1, 436, 588, 441,
+  93, -1, 288, -1, 15, 420, 74, 523, -1, -1, 221, 107,
+  201, 23, 387, 213, -1, 122, -1, 589, 231, -1, -1, -1,
+  -1, 367, -1, 168, 316, 527, 365, 345, -1, -1, -1, -1,
+  329, -1, -1, 385, -1, 92, 124, 217, 20, 128, 484, 161,
+  -1, -1, 597, 565, 251, 118, -1, 498, 227, 594, -1, 192,
+  490, -1, -1, 581, 203, 159, -1, -1, 1, -1, 225, 391,
+  496, -1, 24, -1, 599, 44, 615, 448, -1, -1, 287, -1,
+  137, 106, 535, -1, -1, -1, 82, -1, -1, 296, 348, 488,
+  386, -1, 569, 520, 8, -1, 618, -1, -1, -1, 313, 243,
+  187, 366, -1, 434, 612, 513, -1, 324, 284, -1, 346, -1,
+  311, 525, -1, 162, 169, 413, 505, -1, -1, 568, -1, -1,
+  -1, 474, -1, 109, -1, -1, 176, -1, 156, -1, -1, 189,
+  -1, 280, 553, 557, -1, -1, 320, 182, 495, 379, -1, 68,
+  100, -1, 119, -1, 223, 152, -1, 393, 564, -1, -1, 18,
+  428, 460, 560, 571, 447, -1, 483, 165, 620, 451, 534, 445,
+  339, 606, 469, 2, -1, 300, 350, 220, -1, 604, 424, 518,
+  111, 17, 63, 88, 480, -1, -1, 577, -1, 396, 362, 607,
+  96, 508, 264, 446, -1, 103, 570, -1, 308, -1, 437, 357,
+  -1, 467, -1, -1, 76, 331, 544, 290, 19, 421, -1, 185,
+  -1, 60, 167, -1, 550, -1, 395, 114, 444, 337, -1, 462,
+  -1, -1, 302, 184, 349, -1, 13, 234, 140, 230, 33, -1,
+  -1, 274, -1, -1, -1, 543, -1, 583, 286, 457, 516, -1,
+  455, -1, 592, 383, -1, -1, 47, -1, 172, -1, 219, -1,
+  -1, 246, -1, 351, -1, 380, -1, 83, 208, 238, 456, -1,
+  477, -1, -1, -1, 194, 613, 405, 32, -1, 277, 582, 342,
+  135, 491, -1, -1, -1, 34, -1, 361, -1, 267, 126, 621,
+  -1, -1, 191, 147, -1, 279, 435, 507, 224, 452, -1, 153,
+  558, -1, 133, 622, 443, 257, 53, 89, 506, 228, 304, 49,
+  254, 573, 270, 422, 71, 522, 12, 561, 64, -1, -1, 21,
+  73, 235, -1, 586, -1, 465, 511, -1, 453, 62, 487, 371,
+  -1, -1, 572, -1, 547, 55, 416, 468, -1, -1, 567, 183,
+  -1, -1, -1, 38, 207, -1, 26, -1, 294, -1, 273, -1,
+  530, 442, -1, -1, -1, 556, 591, 299, 28, 180, 494, 233,
+  -1, 314, -1, 16, 138, -1, 414, -1, 22, -1, 616, -1,
+  -1, 261, 433, 510, -1, 449, 319, 415, 244, -1, 389, -1,
+  528, 404, -1, 146, 619, -1, -1, 328, 240, 492, -1, 5,
+  466, 214, -1, 139, -1, 409, 283, 14, 27, 4, 186, -1,
+  -1, -1, 502, 247, -1, 578, 204, 77, 42, 143, 579, -1,
+  -1, 363, -1, -1, -1, -1, 390, -1, -1, 292, 173, 85,
+  229, -1, -1, 323, -1, -1, 373, 253, -1, 533, 584, 341,
+  166, 265, 216, -1, 336, -1, -1, -1, -1, 417, 113, -1,
+  -1, -1, 408, 503, -1, 127, 256, 538, 136, -1, -1, 461,
+  -1, 110, 141, -1, -1, -1, -1, -1, 239, 439, 358, 266,
+  623, 576, -1, 333, 537, 559, 377, -1, 423, -1, 212, -1,
+  58, 411, 160, -1, -1, -1, 215, -1, 344, -1, 86, 370,
+  -1, -1, 181, 493, 563, -1, 69, -1, 438, -1, -1, -1,
+  -1, -1, 392, -1, 554, -1, -1, 174, 84, -1, 37, 322,
+  -1, 94, 372, 11, 142, 531, 125, 398, 130, 87, -1, -1,
+  305, -1, 197, -1, -1, 6, 241, 98, -1, -1, 407, 479,
+  164, -1, 105, 536, -1, 276, -1, 289, 509, 51, 35, -1,
+  102, 155, -1, 307, -1, -1, 360, -1, 117, 476, -1, -1,
+  108, 198, 149, -1, -1, 463, 205, -1, 318, 347, 485, -1,
+  -1, 593, -1, 255, 406, -1, -1, -1, -1, 297, 177, 245,
+  -1, -1, 585, 104, 519, 226, 25, -1, -1, -1, -1, -1,
+  542, -1, -1, -1, 427, 499, -1, 454, 129, -1, 369, -1,
+  315, 529, 190, 401, -1, 81, 471, -1, -1, 596, 352, -1,
+  378, -1, 121, 112, 617, 157, -1, 482, -1, 608, 611, 188,
+  -1, 397, -1, 91, 497, 236, 598, -1, 178, 489, 269, 602,
+  312, 524, 252, -1};
+
+/// Entry of _names that each alternate name stands for.
+constexpr short _altname_entries[NUM_RX_ALTNAMES] = {
+  0, 1, 1, 2, 2, 4, 4, 4, 27, 16, 16, 108,
+  105, 105, 105, 106, 106, 106, 104, 107, 107, 107, 107, 107,
+  107, 107, 107, 548, 8, 111, 106, 554, 549, 550, 552, 553,
+  555, 556, 557, 558, 559, 560, 563, 564, 572, 565, 566, 567,
+  568, 570, 571, 573};
+
+/// Entry of _names for each MT number, or -1.
+constexpr short _mt_entries[RX_MAX_MT + 1] = {
+  -1, 0, 2, 3, 4, 5, -1, -1, -1, -1, 6, 7,
+  -1, -1, -1, -1, 8, 12, 16, 17, 18, 19, 20, 24,
+  25, 26, -1, 27, 28, 33, 34, -1, 35, 39, 43, 47,
+  48, 49, 52, -1, -1, 53, 54, -1, 55, 56, -1, -1,
+  -1, -1, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66,
+  67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+  79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+  91, 92, 93, 94, 95, 96, 97, 98, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 99, 100, 104, 105, 106, 107, 108,
+  109, 110, -1, 111, 115, 116, 117, 118, 119, 120, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, 121, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, 122, 123, 124,
+  125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+  137, 138, 139, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 140,
+  141, 142, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 143, 144, 145, 146, 147, -1, -1, -1, -1, 148, 149,
+  -1, -1, -1, -1, 150, 151, 152, 153, 154, 155, 156, 157,
+  158, 159, -1, 160, 161, 162, 163, -1, 164, 165, 166, 167,
+  168, 169, 170, -1, -1, 171, 172, -1, 173, 174, -1, -1,
+  -1, -1, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+  185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+  197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+  209, 210, 211, 212, 213, 214, 215, 216, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, 217, 218, 219, 220, 221, 222, 223,
+  224, 225, -1, 226, 227, 228, 229, 230, 231, 232, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  233, -1, -1, -1, -1, -1, -1, 234, 235, -1, 236, 237,
+  238, 239, 240, 241, 242, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, 243, 244, 245, -1,
+  246, 247, 248, -1, -1, -1, -1, -1, -1, -1, -1, 249,
+  250, 251, -1, -1, -1, -1, 252, 253, -1, -1, 254, 255,
+  256, -1, -1, -1, -1, 257, 258, 259, 260, 261, 262, 263,
+  264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+  276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+  288, 289, 290, 291, 292, 293, 294, 295, 296, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308,
+  309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320,
+  321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332,
+  333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+  345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356,
+  357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368,
+  369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+  381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+  393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+  405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
+  417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+  429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+  441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
+  453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464,
+  465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476,
+  477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+  489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500,
+  501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512,
+  513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524,
+  525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536,
+  537, 538, 539, 540, 541, 542, 543, 544, 545, 546, -1, 547};
+
+/// Incident particle flags, indexed by rxname::particle.
+constexpr const char * _particles[NUM_RX_PARTICLES] = {
+  "n", "p", "d", "t", "He3", "a", "gamma", "decay"};
+
+/// A reaction channel of an incident particle and the change in
+/// nuclide id it causes.
+struct _offset_entry {
+  unsigned char particle;  ///< index into _particles
+  int offset;              ///< child id minus parent id
+  short rx;                ///< entry of _names
+};
+
+/// Reaction for each particle and offset, sorted by both.
+constexpr _offset_entry _offset_rxs[131] = {
+  {0, -40080000, 33}, {0, -40070000, 109}, {0, -20050000, 25}, {0, -20040000, 20},
+  {0, -20039999, 22}, {0, -20039998, 23}, {0, -20030000, 108}, {0, -20029999, 498},
+  {0, -20029998, 499}, {0, -20020000, 107}, {0, -20019999, 448}, {0, -20019998, 449},
+  {0, -20010000, 111}, {0, -20009999, 113}, {0, -20009998, 114}, {0, -10030000, 39},
+  {0, -10029999, 41}, {0, -10029998, 42}, {0, -10020000, 106}, {0, -10019999, 398},
+  {0, -10019998, 399}, {0, -10010000, 105}, {0, -10009999, 348}, {0, -10009998, 349},
+  {0, -10000000, 104}, {0, -9999999, 298}, {0, -9999998, 299}, {0, -30000, 49},
+  {0, -29999, 51}, {0, -20000, 12}, {0, -19999, 14}, {0, -19998, 15},
+  {0, -10000, 8}, {0, -9999, 10}, {0, -9998, 11}, {0, 0, 1},
+  {0, 1, 58}, {0, 2, 59}, {0, 10000, 27}, {0, 10001, 102},
+  {0, 10002, 103}, {1, -10030000, 108}, {1, -10020000, 107}, {1, -10010000, 111},
+  {1, -20000, 106}, {1, -10000, 105}, {1, 0, 1}, {1, 9970000, 49},
+  {1, 9980000, 12}, {1, 9990000, 8}, {1, 10000000, 4}, {1, 10010000, 27},
+  {2, -10020000, 108}, {2, -10010000, 107}, {2, -10000000, 111}, {2, -10000, 106},
+  {2, 0, 1}, {2, 10000, 104}, {2, 9980000, 49}, {2, 9990000, 12},
+  {2, 10000000, 8}, {2, 10010000, 4}, {2, 10020000, 27}, {3, -10010000, 108},
+  {3, -10000000, 107}, {3, -9990000, 111}, {3, 0, 1}, {3, 10000, 105},
+  {3, 20000, 104}, {3, 9990000, 49}, {3, 10000000, 12}, {3, 10010000, 8},
+  {3, 10020000, 4}, {3, 10030000, 27}, {4, -10000, 108}, {4, 0, 1},
+  {4, 10000, 111}, {4, 10000000, 106}, {4, 10010000, 105}, {4, 10020000, 104},
+  {4, 19990000, 49}, {4, 20000000, 12}, {4, 20010000, 8}, {4, 20020000, 4},
+  {4, 20030000, 27}, {5, 0, 1}, {5, 10000, 107}, {5, 20000, 111},
+  {5, 10010000, 106}, {5, 10020000, 105}, {5, 10030000, 104}, {5, 20000000, 49},
+  {5, 20010000, 12}, {5, 20020000, 8}, {5, 20030000, 4}, {5, 20040000, 27},
+  {6, -20040000, 108}, {6, -20030000, 107}, {6, -20020000, 111}, {6, -10030000, 106},
+  {6, -10020000, 105}, {6, -10010000, 104}, {6, -40000, 49}, {6, -30000, 12},
+  {6, -20000, 8}, {6, -10000, 4}, {7, -60140000, 567}, {7, -40030000, 568},
+  {7, -30040000, 555}, {7, -30020000, 563}, {7, -20040000, 108}, {7, -20030000, 107},
+  {7, -20020000, 111}, {7, -20010000, 557}, {7, -20000000, 570}, {7, -10040000, 553},
+  {7, -10030000, 106}, {7, -10020000, 105}, {7, -10010000, 104}, {7, -10000000, 550},
+  {7, -40000, 49}, {7, -30000, 12}, {7, -20000, 8}, {7, -10000, 4},
+  {7, 0, 554}, {7, 9960000, 560}, {7, 9970000, 559}, {7, 9980000, 558},
+  {7, 9990000, 552}, {7, 10000000, 549}, {7, 20000000, 565}};
+
+/// Offset for each particle and reaction, sorted by both.
+constexpr _offset_entry _rx_offsets[151] = {
+  {0, 0, 1}, {0, 0, 4}, {0, -10000, 8}, {0, -9999, 10},
+  {0, -9998, 11}, {0, -20000, 12}, {0, -19999, 14}, {0, -19998, 15},
+  {0, -20040000, 20}, {0, -20039999, 22}, {0, -20039998, 23}, {0, -20050000, 25},
+  {0, 10000, 27}, {0, -10010000, 28}, {0, -10009999, 30}, {0, -10009998, 31},
+  {0, -40080000, 33}, {0, -10020000, 35}, {0, -10019999, 37}, {0, -10019998, 38},
+  {0, -10030000, 39}, {0, -10029999, 41}, {0, -10029998, 42}, {0, -20030000, 43},
+  {0, -20029998, 45}, {0, -20029998, 46}, {0, -30000, 49}, {0, -29999, 51},
+  {0, -10030000, 54}, {0, 1, 58}, {0, 2, 59}, {0, 10000, 100},
+  {0, 10001, 102}, {0, 10002, 103}, {0, -10000000, 104}, {0, -10010000, 105},
+  {0, -10020000, 106}, {0, -20020000, 107}, {0, -20030000, 108}, {0, -40070000, 109},
+  {0, -20010000, 111}, {0, -20009999, 113}, {0, -20009998, 114}, {0, -9999999, 298},
+  {0, -9999998, 299}, {0, -10009999, 348}, {0, -10009998, 349}, {0, -10019999, 398},
+  {0, -10019998, 399}, {0, -20019999, 448}, {0, -20019998, 449}, {0, -20029999, 498},
+  {0, -20029998, 499}, {1, 0, 1}, {1, 10000000, 4}, {1, 9990000, 8},
+  {1, 9980000, 12}, {1, 10010000, 27}, {1, 9970000, 49}, {1, -10000, 105},
+  {1, -20000, 106}, {1, -10020000, 107}, {1, -10030000, 108}, {1, -10010000, 111},
+  {2, 0, 1}, {2, 10010000, 4}, {2, 10000000, 8}, {2, 9990000, 12},
+  {2, 10020000, 27}, {2, 9980000, 49}, {2, 10000, 104}, {2, -10000, 106},
+  {2, -10010000, 107}, {2, -10020000, 108}, {2, -10000000, 111}, {3, 0, 1},
+  {3, 10020000, 4}, {3, 10010000, 8}, {3, 10000000, 12}, {3, 10030000, 27},
+  {3, 9990000, 49}, {3, 20000, 104}, {3, 10000, 105}, {3, -10000000, 107},
+  {3, -10010000, 108}, {3, -9990000, 111}, {4, 0, 1}, {4, 20020000, 4},
+  {4, 20010000, 8}, {4, 20000000, 12}, {4, 20030000, 27}, {4, 19990000, 49},
+  {4, 10020000, 104}, {4, 10010000, 105}, {4, 10000000, 106}, {4, -10000, 108},
+  {4, 10000, 111}, {5, 0, 1}, {5, 20030000, 4}, {5, 20020000, 8},
+  {5, 20010000, 12}, {5, 20040000, 27}, {5, 20000000, 49}, {5, 10030000, 104},
+  {5, 10020000, 105}, {5, 10010000, 106}, {5, 10000, 107}, {5, 20000, 111},
+  {6, -10000, 4}, {6, -20000, 8}, {6, -30000, 12}, {6, -40000, 49},
+  {6, -10010000, 104}, {6, -10020000, 105}, {6, -10030000, 106}, {6, -20030000, 107},
+  {6, -20040000, 108}, {6, -20020000, 111}, {7, -10000, 4}, {7, -20000, 8},
+  {7, -30000, 12}, {7, -40000, 49}, {7, -10010000, 104}, {7, -10020000, 105},
+  {7, -10030000, 106}, {7, -20030000, 107}, {7, -20040000, 108}, {7, -20020000, 111},
+  {7, 10000000, 549}, {7, -10000000, 550}, {7, -10000000, 551}, {7, 9990000, 552},
+  {7, -10040000, 553}, {7, 0, 554}, {7, -30040000, 555}, {7, -10000000, 556},
+  {7, -20010000, 557}, {7, 9980000, 558}, {7, 9970000, 559}, {7, 9960000, 560},
+  {7, -20010000, 561}, {7, -30040000, 562}, {7, -30020000, 563}, {7, -30020000, 564},
+  {7, 20000000, 565}, {7, -10000, 566}, {7, -60140000, 567}, {7, -40030000, 568},
+  {7, -20000000, 570}, {7, -20000000, 571}, {7, -40030000, 572}};
+
+}  // namespace rxname
+}  // namespace pyne
+
+#endif  // PYNE_DRWFTLSUQBEP5LE4JZQ7QY3BVI
@@ -0,0 +1,226 @@
+#!/usr/bin/env python
+"""Generates rxname_hash.cpp, the lookup tables derived from the reaction
+tables in rxname.cpp.  Rerun this whenever a reaction, MT number, alternate
+name or offset is added to rxname.cpp; the static_asserts in rxname.cpp
+refuse to compile against a stale header.
+
+Name lookups use a hash-and-displace perfect hash over the reaction ids:
+each id picks a bucket, and each bucket has a seed chosen so that all of
+its keys land in distinct, otherwise empty slots.
+"""
+import os
+import re
+
+CURR_DIR = os.path.dirname(os.path.abspath(__file__))
+
+AUTOGEN_WARNING = """/*
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+!!!!!! This file has been autogenerated, modify rxnamegen.py !!!!!!!!!!
+!!!!!!          DO NOT MODIFY THIS FILE BY HAND!!            !!!!!!!!!!
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+*/
+"""
+
+BUCKET_BITS = 7
+SLOT_BITS = 10
+BUCKET_MULT = 0x85EBCA6B
+SLOT_MULT = 0x9E3779B1
+MASK = 0xFFFFFFFF
+
+# incident particle flags, in the order of the rxname::particle enum
+PARTICLES = ['n', 'p', 'd', 't', 'He3', 'a', 'gamma', 'decay']
+
+
+def rxhash(s):
+    """The reaction id of a name, as computed by pyne::rxname::hash()."""
+    h = 32
+    for c in s.encode():
+        h = (((h << 5) + h) ^ c) & MASK
+    return h
+
+
+def bucket(h):
+    return ((h * BUCKET_MULT) & MASK) >> (32 - BUCKET_BITS)
+
+
+def slot(h, seed):
+    return (((h ^ seed) * SLOT_MULT) & MASK) >> (32 - SLOT_BITS)
+
+
+def read_array(src, name):
+    """Returns the body of the array called name in src."""
+    m = re.search(r'\b' + name + r'\s*\[[\w ]*\] = \{', src)
+    end = src.index('};', m.end())
+    return src[m.end():end]
+
+
+def read_tables(filename):
+    with open(filename, 'r') as f:
+        src = f.read()
+    names = re.findall(r'"([^"]*)"', read_array(src, '_names'))
+    mts = [int(x) for x in re.findall(r'\d+', read_array(src, '_mts'))]
+    altnames = re.findall(r'\{"([^"]+)", "([^"]+)"\}',
+                          read_array(src, '_altnames'))
+    offset_re = (r'\{"(\w+)", offset\((-?\d+), (-?\d+)(?:, (-?\d+))?\), '
+                 r'"(\w+)"\}')
+    offsets = re.findall(offset_re, read_array(src, '_offsets'))
+    child_offsets = re.findall(offset_re, read_array(src, '_child_offsets'))
+    return names, mts, altnames, offsets, child_offsets
+
+
+def offset(dz, da, ds):
+    return int(dz) * 10000000 + int(da) * 10000 + int(ds or 0)
+
+
+def perfect_hash(keys):
+    """Finds a seed for each bucket so that every key gets its own slot.
+    Returns the seeds and the slot table, holding the key's position in
+    keys or -1."""
+    buckets = [[] for _ in range(1 << BUCKET_BITS)]
+    for i, h in enumerate(keys):
+        buckets[bucket(h)].append(i)
+    seeds = [0] * (1 << BUCKET_BITS)
+    slots = [-1] * (1 << SLOT_BITS)
+    order = sorted(range(len(buckets)), key=lambda b: -len(buckets[b]))
+    for b in order:
+        if not buckets[b]:
+            continue
+        for seed in range(1 << 24):
+            s = [slot(keys[i], seed) for i in buckets[b]]
+            if len(set(s)) == len(s) and all(slots[x] < 0 for x in s):
+                break
+        else:
+            raise RuntimeError("no seed found for bucket {0}".format(b))
+        seeds[b] = seed
+        for i, x in zip(buckets[b], s):
+            slots[x] = i
+    # collision check: every key must find itself
+    for i, h in enumerate(keys):
+        assert slots[slot(h, seeds[bucket(h)])] == i
+    return seeds, slots
+
+
+def generate_array(ctype, name, size, values, perline=8):
+    lines = []
+    for i in range(0, len(values), perline):
+        lines.append('  ' + ', '.join(str(v) for v in values[i:i+perline]))
+    s = 'constexpr {0} {1}[{2}] = {{\n'.format(ctype, name, size)
+    s += ',\n'.join(lines) + '};\n'
+    return s
+
+
+def generate_header(names, mts, altnames, offsets, child_offsets):
+    ids = [rxhash(n) for n in names]
+    altids = [rxhash(a) for a, _ in altnames]
+    keys = ids + altids
+    if len(set(keys)) != len(keys):
+        raise RuntimeError("reaction names or alternate names share a hash")
+    seeds, slots = perfect_hash(keys)
+
+    entry = dict((n, i) for i, n in enumerate(names))
+    altentries = [entry[rx] for _, rx in altnames]
+    maxmt = max(mts)
+    mtentries = [-1] * (maxmt + 1)
+    for i, mt in enumerate(mts):
+        if 0 < mt:
+            mtentries[mt] = i
+
+    particles = PARTICLES
+    for z, _, _, _, _ in offsets + child_offsets:
+        if z not in particles:
+            raise RuntimeError("unknown particle flag {0!r}".format(z))
+    pindex = dict((z, i) for i, z in enumerate(particles))
+    # later entries win, as they did when these were std::map assignments
+    offset_rx = {}
+    for z, dz, da, ds, rx in offsets:
+        offset_rx[(pindex[z], offset(dz, da, ds))] = entry[rx]
+    rx_offset = {}
+    for (p, off), e in sorted(offset_rx.items(),
+                              key=lambda x: (particles[x[0][0]], x[0][1])):
+        rx_offset[(p, e)] = off
+    for z, dz, da, ds, rx in child_offsets:
+        rx_offset[(pindex[z], entry[rx])] = offset(dz, da, ds)
+
+    s = AUTOGEN_WARNING
+    s += "/// \\file rxname_hash.cpp\n"
+    s += "/// \\brief Lookup tables derived from the reaction tables in rxname.cpp.\n"
+    s += "#ifndef PYNE_DRWFTLSUQBEP5LE4JZQ7QY3BVI\n"
+    s += "#define PYNE_DRWFTLSUQBEP5LE4JZQ7QY3BVI\n"
+    s += "\n"
+    s += "namespace pyne {\n"
+    s += "namespace rxname {\n"
+    s += "#define NUM_RX_ALTNAMES {0}\n".format(len(altnames))
+    s += "#define NUM_RX_PARTICLES {0}\n".format(len(particles))
+    s += "#define RX_MAX_MT {0}\n".format(maxmt)
+    s += "#define RX_HASH_BUCKET_BITS {0}\n".format(BUCKET_BITS)
+    s += "#define RX_HASH_SLOT_BITS {0}\n".format(SLOT_BITS)
+    s += "\n"
+    s += "/// Slot of the reaction or alternate name whose hash is \\a h.\n"
+    s += "constexpr unsigned int _hash_slot(unsigned int h, unsigned int seed) {\n"
+    s += "  return ((h ^ seed) * 0x{0:X}u) >> (32 - RX_HASH_SLOT_BITS);\n".format(SLOT_MULT)
+    s += "}\n"
+    s += "\n"
+    s += "/// Bucket, and so seed, of the hash \\a h.\n"
+    s += "constexpr unsigned int _hash_bucket(unsigned int h) {\n"
+    s += "  return (h * 0x{0:X}u) >> (32 - RX_HASH_BUCKET_BITS);\n".format(BUCKET_MULT)
+    s += "}\n"
+    s += "\n"
+    s += "/// Reaction id, the hash of the name, of each entry of _names.\n"
+    s += generate_array("unsigned int", "_ids", "NUM_RX_NAMES",
+                        ['{0}u'.format(i) for i in ids], 5)
+    s += "\n"
+    s += "/// Seed of each bucket.\n"
+    s += generate_array("unsigned int", "_hash_seeds",
+                        "1 << RX_HASH_BUCKET_BITS", seeds, 10)
+    s += "\n"
+    s += "/// Entry in each slot: below NUM_RX_NAMES an entry of _names, then\n"
+    s += "/// the alternate names in order, or -1 for an empty slot.\n"
+    s += generate_array("short", "_hash_slots", "1 << RX_HASH_SLOT_BITS",
+                        slots, 12)
+    s += "\n"
+    s += "/// Entry of _names that each alternate name stands for.\n"
+    s += generate_array("short", "_altname_entries", "NUM_RX_ALTNAMES",
+                        altentries, 12)
+    s += "\n"
+    s += "/// Entry of _names for each MT number, or -1.\n"
+    s += generate_array("short", "_mt_entries", "RX_MAX_MT + 1", mtentries, 12)
+    s += "\n"
+    s += "/// Incident particle flags, indexed by rxname::particle.\n"
+    s += generate_array("const char *", "_particles", "NUM_RX_PARTICLES",
+                        ['"{0}"'.format(z) for z in particles])
+    s += "\n"
+    s += "/// A reaction channel of an incident particle and the change in\n"
+    s += "/// nuclide id it causes.\n"
+    s += "struct _offset_entry {\n"
+    s += "  unsigned char particle;  ///< index into _particles\n"
+    s += "  int offset;              ///< child id minus parent id\n"
+    s += "  short rx;                ///< entry of _names\n"
+    s += "};\n"
+    s += "\n"
+    s += "/// Reaction for each particle and offset, sorted by both.\n"
+    s += generate_array("_offset_entry", "_offset_rxs", len(offset_rx),
+                        ['{{{0}, {1}, {2}}}'.format(p, off, e) for (p, off), e
+                         in sorted(offset_rx.items())], 4)
+    s += "\n"
+    s += "/// Offset for each particle and reaction, sorted by both.\n"
+    s += generate_array("_offset_entry", "_rx_offsets", len(rx_offset),
+                        ['{{{0}, {1}, {2}}}'.format(p, off, e) for (p, e), off
+                         in sorted(rx_offset.items())], 4)
+    s += "\n"
+    s += "}  // namespace rxname\n"
+    s += "}  // namespace pyne\n"
+    s += "\n"
+    s += "#endif  // PYNE_DRWFTLSUQBEP5LE4JZQ7QY3BVI\n"
+    return s
+
+
+def main():
+    tables = read_tables(os.path.join(CURR_DIR, 'rxname.cpp'))
+    header = generate_header(*tables)
+    filename = os.path.join(CURR_DIR, 'rxname_hash.cpp')
+    with open(filename, 'w') as f:
+        f.write(header)
+
+
+if __name__ == '__main__':
+    main()
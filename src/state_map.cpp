@@ -5,10 +5,12 @@
 namespace pyne {
 namespace nucname {
 #define TOTAL_STATE_MAPS 1016
+#define TOTAL_METASTABLE_MAPS 1009
 std::map<int, int> state_id_map;
-int map_nuc_ids [TOTAL_STATE_MAPS] = {110240001,
+// sorted state ids and their metastable levels
+constexpr int map_nuc_ids [TOTAL_STATE_MAPS] = {90260001,
+110240001,
 130240001,
-90260001,
 130260001,
 130320002,
 170340001,
@@ -18,1012 +20,1011 @@ int map_nuc_ids [TOTAL_STATE_MAPS] = {110240001,
 210420002,
 210430001,
 210440004,
-230440001,
 210450001,
 210460002,
-230460001,
 210500001,
+210560001,
+210560004,
+230440001,
+230460001,
+230600000,
+230600001,
+230640001,
 250500001,
 250520001,
+250580001,
+250600001,
+250620001,
+250640002,
 260520042,
 260530022,
+260610004,
+260650003,
+260670002,
 270530003,
 270540001,
-210560001,
-210560004,
-250580001,
 270580001,
 270580002,
-230600000,
-230600001,
-250600001,
 270600001,
-260610004,
-250620001,
 270620001,
-230640001,
-250640002,
-260650003,
-260670002,
-290670023,
-290680003,
+270700001,
 280690001,
 280690008,
-300690001,
-340690004,
-270700001,
+280710002,
+280760004,
+290670023,
+290680003,
 290700001,
 290700003,
-350700006,
-280710002,
+290750001,
+290750002,
+290760001,
+300690001,
 300710001,
-320710002,
-310720002,
-350720001,
 300730001,
 300730002,
-320730002,
-340730001,
-360730004,
-310740002,
-350740002,
-290750001,
-290750002,
 300750001,
-320750002,
-330750004,
-280760004,
-290760001,
-350760002,
 300770002,
-320770001,
-330770004,
-340770001,
-350770001,
 300780004,
-310780004,
-350780004,
-370780003,
-390780001,
 300790002,
+310720002,
+310740002,
+310780004,
+310800001,
+310840001,
+320710002,
+320730002,
+320750002,
+320770001,
 320790001,
+320810001,
+330750004,
+330770004,
 330790007,
+330820001,
+340690004,
+340730001,
+340770001,
 340790001,
-350790001,
-360790001,
-310800001,
-350800002,
-390800001,
-390800003,
-320810001,
 340810001,
-360810002,
-370810001,
-330820001,
 340820015,
-350820001,
-370820001,
-410820003,
 340830001,
-360830002,
-370830002,
-380830002,
-390830001,
-310840001,
+350700006,
+350720001,
+350740002,
+350760002,
+350770001,
+350780004,
+350790001,
+350800002,
+350820001,
 350840001,
+350880003,
+360730004,
+360790001,
+360810002,
+360830002,
 360840019,
 360840061,
-370840002,
-390840002,
-410840007,
 360850001,
+370780003,
+370810001,
+370820001,
+370830002,
+370840002,
 370850003,
+370860002,
+370900001,
+370970002,
+370980001,
+371000001,
+380830002,
 380850002,
+380860014,
+380870001,
+390780001,
+390800001,
+390800003,
+390830001,
+390840002,
 390850001,
+390860002,
+390870001,
+390890001,
+390900002,
+390910001,
+390930002,
+390960005,
+390970001,
+390970029,
+390980005,
+391000004,
 400850002,
+400870002,
+400890001,
+400900003,
+400910040,
+401080009,
+410820003,
+410840007,
 410850003,
 410850005,
-370860002,
-380860014,
-390860002,
 410860001,
 410860002,
-380870001,
-390870001,
-400870002,
 410870001,
-430870005,
-350880003,
 410880001,
-430880000,
-430880001,
-390890001,
-400890001,
 410890001,
-420890002,
-430890001,
-370900001,
-390900002,
-400900003,
 410900002,
 410900007,
-430900001,
-430900006,
-390910001,
-400910040,
 410910001,
-420910001,
-430910001,
-440910001,
-450910001,
 410920001,
-450920001,
-390930002,
 410930001,
-420930016,
-430930001,
-440930001,
 410940001,
-430940001,
-470940001,
-470940002,
 410950001,
-430950001,
-450950001,
-460950005,
-470950002,
-390960005,
-430960001,
-450960001,
-370970002,
-390970001,
-390970029,
 410970001,
-430970001,
-450970001,
-370980001,
-390980005,
 410980001,
-450980001,
 410990001,
-430990002,
-450990001,
-470990002,
-371000001,
-391000004,
 411000001,
 411000009,
 411000012,
+411020001,
+411040004,
+411060003,
+411080003,
+420890002,
+420910001,
+420930016,
+421110001,
+430870005,
+430880000,
+430880001,
+430890001,
+430900001,
+430900006,
+430910001,
+430930001,
+430940001,
+430950001,
+430960001,
+430970001,
+430990002,
 431000002,
 431000004,
+431020001,
+431070000,
+440910001,
+440930001,
+441030005,
+441170003,
+441190002,
+450910001,
+450920001,
+450950001,
+450960001,
+450970001,
+450980001,
+450990001,
 451000004,
-471000001,
 451010001,
-471010002,
-411020001,
-431020001,
 451020005,
-471020001,
-441030005,
 451030001,
-471030002,
-491030001,
-411040004,
 451040003,
-471040001,
-491040003,
 451050001,
-471050001,
-491050001,
-411060003,
 451060001,
-471060001,
-491060001,
-431070000,
+451080004,
+451100001,
+451140005,
+451160001,
+451200002,
+451220002,
+460950005,
 461070002,
+461090002,
+461110002,
+461130002,
+461150001,
+461210001,
+461240004,
+461260003,
+461260004,
+461260005,
+461280004,
+470940001,
+470940002,
+470950002,
+470990002,
+471000001,
+471010002,
+471020001,
+471030002,
+471040001,
+471050001,
+471060001,
 471070001,
-491070001,
-401080009,
-411080003,
-451080004,
 471080002,
-491080001,
-461090002,
 471090001,
-491090001,
-491090026,
-451100001,
 471100002,
-491100001,
-421110001,
-461110002,
 471110001,
+471130001,
+471150001,
+471160001,
+471160004,
+471170001,
+471180004,
+471190000,
+471190001,
+471200002,
+471220001,
+471220002,
+471240001,
+471240002,
+471240003,
+471250007,
+471250010,
+471260001,
+471260004,
+471290001,
 481110003,
+481130001,
+481150001,
+481170002,
+481190002,
+481210002,
+481230003,
+481250001,
+481270006,
+481290001,
+481290004,
+491030001,
+491040003,
+491050001,
+491060001,
+491070001,
+491080001,
+491090001,
+491090026,
+491100001,
 491110001,
 491120001,
 491120004,
 491120009,
-461130002,
-471130001,
-481130001,
 491130001,
-501130001,
-451140005,
 491140001,
 491140005,
-531140005,
-461150001,
-471150001,
-481150001,
 491150001,
-521150001,
-451160001,
-471160001,
-471160004,
 491160001,
 491160004,
-511160003,
-551160001,
-441170003,
-471170001,
-481170002,
 491170001,
-501170002,
-521170003,
-471180004,
 491180001,
 491180003,
-511180007,
-531180002,
-551180001,
-441190002,
-471190000,
-471190001,
-481190002,
 491190001,
-501190002,
-511190072,
-521190002,
-551190001,
-451200002,
-471200002,
 491200001,
 491200002,
-511200001,
-531200013,
-551200001,
-571200000,
-461210001,
-481210002,
 491210001,
-501210001,
-521210002,
-551210001,
-451220002,
-471220001,
-471220002,
 491220001,
 491220005,
-511220005,
-511220006,
-551220007,
-551220008,
-481230003,
 491230001,
-501230001,
-521230002,
-551230005,
-461240004,
-471240001,
-471240002,
-471240003,
 491240002,
-501240016,
-511240001,
-511240002,
-551240025,
-471250007,
-471250010,
-481250001,
 491250001,
-501250001,
-521250002,
-541250002,
-571250005,
-461260003,
-461260004,
-461260005,
-471260001,
-471260004,
 491260001,
-511260001,
-511260002,
-481270006,
 491270001,
 491270009,
-501270001,
-521270002,
-541270002,
-561270002,
-571270001,
-581270001,
-461280004,
-511280001,
-571280001,
-471290001,
-481290001,
-481290004,
 491290001,
 491290010,
 491290012,
 491290013,
+491300001,
+491300002,
+491300003,
+491310001,
+491310004,
+491330001,
+501130001,
+501170002,
+501190002,
+501210001,
+501230001,
+501240016,
+501250001,
+501270001,
 501290001,
 501290017,
 501290018,
 501290025,
+501300002,
+501310001,
+501320006,
+501360003,
+501380003,
+511160003,
+511180007,
+511190072,
+511200001,
+511220005,
+511220006,
+511240001,
+511240002,
+511260001,
+511260002,
+511280001,
 511290011,
 511290012,
 511290023,
-521290001,
-541290002,
-551290010,
-561290001,
-571290002,
-601290001,
-601290003,
-491300001,
-491300002,
-491300003,
-501300002,
 511300001,
-531300001,
-551300004,
-561300030,
-591300002,
-491310001,
-491310004,
-501310001,
+511320001,
+511340002,
+511400003,
+521150001,
+521170003,
+521190002,
+521210002,
+521230002,
+521250002,
+521270002,
+521290001,
 521310001,
 521310033,
-541310002,
-561310002,
-571310006,
-581310001,
-591310002,
-501320006,
-511320001,
 521320006,
 521320022,
-531320003,
-541320030,
-571320004,
-581320030,
-491330001,
 521330002,
+521340003,
+521350010,
+531140005,
+531180002,
+531200013,
+531300001,
+531320003,
 531330016,
 531330059,
 531330065,
+531340005,
+531360006,
+531380002,
+541250002,
+541270002,
+541290002,
+541310002,
+541320030,
 541330001,
-561330002,
-581330001,
-591330003,
-601330001,
-611330005,
-621330000,
-511340002,
-521340003,
-531340005,
 541340007,
-551340003,
-601340017,
-611340000,
-611340001,
-521350010,
 541350002,
+551160001,
+551180001,
+551190001,
+551200001,
+551210001,
+551220007,
+551220008,
+551230005,
+551240025,
+551290010,
+551300004,
+551340003,
 551350010,
+551360001,
+551380003,
+551440004,
+561270002,
+561290001,
+561300030,
+561310002,
+561330002,
 561350002,
+561360005,
+561370002,
+571200000,
+571250005,
+571270001,
+571280001,
+571290002,
+571310006,
+571320004,
+571360051,
+571390021,
+571460001,
+581270001,
+581310001,
+581320030,
+581330001,
 581350004,
+581370002,
+581380005,
+581390002,
+581510001,
+591300002,
+591310002,
+591330003,
 591350004,
+591380005,
+591400003,
+591400015,
+591420001,
+591420024,
+591440001,
+591480000,
+591480001,
+601290001,
+601290003,
+601330001,
+601340017,
 601350001,
+601370004,
+601390002,
+601390035,
+601400009,
+601410002,
+601420004,
+601540003,
+601580004,
+601600003,
+611330005,
+611340000,
+611340001,
 611350000,
 611350003,
-501360003,
-531360006,
-551360001,
-561360005,
-571360051,
 611360000,
 611360001,
-631360001,
-561370002,
-581370002,
-601370004,
-501380003,
-531380002,
-551380003,
-581380005,
-591380005,
 611380001,
-571390021,
-581390002,
-601390002,
-601390035,
 611390001,
+611400008,
+611420012,
+611480003,
+611520004,
+611520014,
+611540001,
+611560002,
+611580002,
+611610005,
+621330000,
 621390004,
+621410002,
+621430002,
+621430043,
+621510012,
+621530006,
+621590006,
+621640005,
+631360001,
 631390003,
-641390001,
-511400003,
-591400003,
-591400015,
-601400009,
-611400008,
 631400004,
-601410002,
-621410002,
 631410001,
-641410004,
-651410001,
-591420001,
-591420024,
-601420004,
-611420012,
 631420031,
+631500001,
+631510002,
+631520001,
+631520016,
+631540013,
+641390001,
+641410004,
 641420019,
 641420020,
-651420003,
-621430002,
-621430043,
 641430002,
+641450002,
+641530003,
+641530008,
+641550006,
+641570012,
+641590002,
+641660009,
+651410001,
+651420003,
 651430001,
-661430003,
-551440004,
-591440001,
 651440004,
 651440006,
 651440007,
-671440003,
-641450002,
 651450004,
-661450002,
-681450002,
-571460001,
 651460022,
 651460026,
-661460011,
-691460001,
 651470001,
-661470002,
-681470002,
-691470001,
-591480000,
-591480001,
-611480003,
 651480001,
-671480001,
-671480012,
-681480008,
 651490001,
-661490027,
-671490001,
-681490002,
-631500001,
 651500002,
-671500001,
-691500005,
-581510001,
-621510012,
-631510002,
 651510003,
-671510001,
-681510021,
-691510001,
-691510012,
-701510001,
-701510005,
-701510010,
-611520004,
-611520014,
-631520001,
-631520016,
 651520006,
-671520001,
-691520006,
-691520018,
-691520019,
-701520006,
-621530006,
-641530003,
-641530008,
 651530003,
-671530001,
-691530001,
-601540003,
-611540001,
-631540013,
 651540001,
 651540002,
-711540015,
-721540006,
-641550006,
-661550009,
-671550002,
-691550001,
-711550001,
-711550004,
-611560002,
 651560002,
 651560004,
-671560001,
-671560012,
-711560001,
-721560004,
-731560001,
-641570012,
-661570005,
-711570001,
-731570001,
-731570004,
-601580004,
-611580002,
 651580003,
 651580023,
+661430003,
+661450002,
+661460011,
+661470002,
+661490027,
+661550009,
+661570005,
+661590009,
+661650002,
+671440003,
+671480001,
+671480012,
+671490001,
+671500001,
+671510001,
+671520001,
+671530001,
+671550002,
+671560001,
+671560012,
 671580001,
 671580009,
-691580002,
-691580003,
-711580000,
-731580001,
-731580015,
-621590006,
-641590002,
-661590009,
 671590003,
-731590001,
-601600003,
 671600001,
 671600006,
-691600002,
-711600001,
-611610005,
 671610002,
-681610014,
-691610001,
-711610004,
-721610002,
 671620003,
-691620020,
-711620008,
-711620009,
-751620001,
 671630003,
-751630001,
-621640005,
 671640003,
-691640001,
-771640001,
-661650002,
-751650001,
-771650001,
-641660009,
 671660001,
+671680001,
+671700001,
+681450002,
+681470002,
+681480008,
+681490002,
+681510021,
+681610014,
+681670003,
+691460001,
+691470001,
+691500005,
+691510001,
+691510012,
+691520006,
+691520018,
+691520019,
+691530001,
+691550001,
+691580002,
+691580003,
+691600002,
+691610001,
+691620020,
+691640001,
 691660006,
+691720011,
+691770000,
+701510001,
+701510005,
+701510010,
+701520006,
+701690001,
+701750007,
+701760005,
+701770006,
+711540015,
+711550001,
+711550004,
+711560001,
+711570001,
+711580000,
+711600001,
+711610004,
+711620008,
+711620009,
 711660001,
 711660002,
-681670003,
 711670001,
-751670001,
-671680001,
 711680013,
-771680001,
-701690001,
 711690001,
-751690001,
-771690001,
-671700001,
 711700008,
-771700001,
 711710001,
-721710001,
-771710001,
-781710002,
-691720011,
 711720001,
 711720005,
-751720001,
-771720001,
-791720001,
-771730000,
-771730003,
-791730001,
 711740003,
-771740001,
-701750007,
 711750053,
-791750001,
-701760005,
 711760001,
-731760012,
-731760090,
-791760001,
-791760002,
-691770000,
-701770006,
 711770029,
 711770203,
+711780003,
+711790006,
+721540006,
+721560004,
+721610002,
+721710001,
 721770048,
 721770107,
-791770002,
-711780003,
 721780005,
 721780109,
-731780000,
-731780059,
-731780094,
-731780139,
-711790006,
 721790005,
 721790046,
-731790117,
-741790002,
-751790137,
-791790007,
-811790001,
 721800006,
-731800002,
 721810025,
 721810078,
-761810001,
-811810002,
 721820009,
 721820026,
+721830007,
+721840005,
+731560001,
+731570001,
+731570004,
+731580001,
+731580015,
+731590001,
+731760012,
+731760090,
+731780000,
+731780059,
+731780094,
+731780139,
+731790117,
+731800002,
 731820001,
 731820029,
-741820062,
-751820001,
-761820029,
-721830007,
 731830032,
+731890001,
+731900002,
+741790002,
+741820062,
 741830007,
+741850006,
+741900006,
+751620001,
+751630001,
+751650001,
+751670001,
+751690001,
+751720001,
+751790137,
+751820001,
 751830004,
 751830005,
 751830070,
 751830074,
-761830002,
-781830001,
-811830002,
-811830005,
-821830001,
-721840005,
 751840005,
-771840007,
-781840034,
-791840003,
-741850006,
-781850002,
-791850001,
-801850004,
-811850003,
 751860004,
-771860001,
-811860000,
-811860005,
-831860001,
-791870002,
-801870001,
-811870002,
-821870001,
-831870002,
 751880007,
-811880001,
-731890001,
 751890033,
 751890034,
+751900003,
+751920002,
+751920003,
+751940001,
+751940002,
+751940003,
+751960001,
+761810001,
+761820029,
+761830002,
 761890001,
+761900032,
+761910001,
+761920047,
+761920112,
+761950002,
+761950004,
+761970001,
+761980006,
+761980010,
+771640001,
+771650001,
+771680001,
+771690001,
+771700001,
+771710001,
+771720001,
+771730000,
+771730003,
+771740001,
+771840007,
+771860001,
 771890006,
 771890085,
-781890004,
-781890005,
-791890003,
-791890006,
-791890200,
-801890002,
-811890001,
-821890001,
-821890014,
-831890002,
-831890003,
-731900002,
-741900006,
-751900003,
-761900032,
 771900002,
 771900037,
-791900014,
-811900000,
-811900001,
-811900006,
-831900000,
-831900001,
-761910001,
 771910003,
 771910071,
-791910004,
-801910035,
-811910002,
-821910002,
-831910002,
-831910005,
-831910028,
-751920002,
-751920003,
-761920047,
-761920112,
 771920003,
 771920015,
-791920004,
-791920015,
-811920002,
-811920008,
-821920011,
-821920014,
-821920017,
-821920020,
-821920021,
-831920001,
-841920006,
-851920000,
-851920001,
 771930002,
-781930005,
-791930004,
-801930003,
-811930002,
-821930001,
-831930001,
-841930001,
-851930001,
-851930002,
-751940001,
-751940002,
-751940003,
 771940007,
 771940012,
-791940003,
-791940008,
-811940001,
-831940001,
-831940002,
-851940000,
-851940001,
-761950002,
-761950004,
 771950002,
+771960004,
+771970002,
+771980001,
+781710002,
+781830001,
+781840034,
+781850002,
+781890004,
+781890005,
+781930005,
 781950007,
+781970009,
+781990008,
+782020003,
+791720001,
+791730001,
+791750001,
+791760001,
+791760002,
+791770002,
+791790007,
+791840003,
+791850001,
+791870002,
+791890003,
+791890006,
+791890200,
+791900014,
+791910004,
+791920004,
+791920015,
+791930004,
+791940003,
+791940008,
 791950004,
 791950055,
-801950003,
-811950002,
-821950002,
-831950001,
-841950002,
-851950001,
-861950001,
-751960001,
-771960004,
 791960003,
 791960054,
-811960006,
-831960002,
-831960003,
-841960015,
-761970001,
-771970002,
-781970009,
 791970004,
+791980051,
+791990006,
+792000011,
+801850004,
+801870001,
+801890002,
+801910035,
+801930003,
+801950003,
 801970004,
+801990007,
+802010013,
+802050008,
+802080004,
+802100002,
+802100005,
+811790001,
+811810002,
+811830002,
+811830005,
+811850003,
+811860000,
+811860005,
+811870002,
+811880001,
+811890001,
+811900000,
+811900001,
+811900006,
+811910002,
+811920002,
+811920008,
+811930002,
+811940001,
+811950002,
+811960006,
 811970002,
-821970002,
-831970001,
-841970002,
-851970001,
-861970001,
-761980006,
-761980010,
-771980001,
-791980051,
 811980007,
 811980012,
-831980001,
-831980003,
-851980001,
-871980001,
-781990008,
-791990006,
-801990007,
 811990003,
-821990003,
-831990001,
-841990002,
-861990001,
-792000011,
 812000010,
-832000001,
-832000003,
-852000001,
-852000003,
-802010013,
 812010003,
+812040029,
+812060045,
+812070002,
+821830001,
+821870001,
+821890001,
+821890014,
+821910002,
+821920011,
+821920014,
+821920017,
+821920020,
+821920021,
+821930001,
+821950002,
+821970002,
+821990003,
 822010004,
-832010001,
-842010003,
-862010001,
-872010001,
-882010000,
-782020003,
 822020014,
-852020001,
-852020002,
-872020001,
 822030006,
 822030053,
-832030006,
-842030005,
-862030001,
-882030001,
-812040029,
 822040021,
+822050009,
+822070003,
+822110014,
+822140004,
+822160004,
+831860001,
+831870002,
+831890002,
+831890003,
+831900000,
+831900001,
+831910002,
+831910005,
+831910028,
+831920001,
+831930001,
+831940001,
+831940002,
+831950001,
+831960002,
+831960003,
+831970001,
+831980001,
+831980003,
+831990001,
+832000001,
+832000003,
+832010001,
+832030006,
 832040008,
 832040038,
-852040001,
-872040001,
-872040002,
-802050008,
-822050009,
-842050010,
-842050017,
-882050001,
-812060045,
 832060016,
-872060001,
-872060002,
-892060001,
-812070002,
-822070003,
 832070036,
-842070014,
-862070007,
-882070001,
-802080004,
 832080018,
-802100002,
-802100005,
 832100002,
-822110014,
 832110021,
-842110015,
-852110076,
-872110013,
-872110019,
 832120005,
 832120012,
+832150009,
+832170005,
+841920006,
+841930001,
+841950002,
+841960015,
+841970002,
+841990002,
+842010003,
+842030005,
+842050010,
+842050017,
+842070014,
+842110015,
 842120030,
+851920000,
+851920001,
+851930001,
+851930002,
+851940000,
+851940001,
+851950001,
+851970001,
+851980001,
+852000001,
+852000003,
+852020001,
+852020002,
+852040001,
+852110076,
 852120004,
-882130005,
-822140004,
 852140006,
+861950001,
+861970001,
+861990001,
+862010001,
+862030001,
+862070007,
 862140004,
 862140005,
-872140001,
-902140004,
-832150009,
 862150013,
-902150003,
-822160004,
-872160001,
-922160001,
-832170005,
-892170010,
-902170001,
-912170001,
-872180002,
-922180001,
+871980001,
+872010001,
+872020001,
+872040001,
+872040002,
+872060001,
+872060002,
+872110013,
+872110019,
+872140001,
+872160001,
+872180002,
+882010000,
+882030001,
+882050001,
+882070001,
+882130005,
+892060001,
+892170010,
 892220001,
+902140004,
+902150003,
+902170001,
+912170001,
 912340002,
+922160001,
+922180001,
 922350001,
 922350174,
-942350010,
-932360001,
-952360001,
-942370003,
 922380119,
+932360001,
 932380128,
+932400001,
+932420007,
+942350010,
+942370003,
 942380047,
 942380052,
-952380001,
 942390106,
 942390111,
-952390011,
-932400001,
 942400102,
-952400057,
-962400002,
-962400003,
 942410106,
 942410107,
-952410075,
-962410007,
-932420007,
 942420044,
 942420045,
+942440032,
+942450024,
+952360001,
+952380001,
+952390011,
+952400057,
+952410075,
 952420002,
 952420141,
-962420004,
-962420005,
-972420002,
-972420003,
-942440032,
 952440001,
 952440112,
 952440113,
+952450021,
+952460001,
+952460008,
+962400002,
+962400003,
+962410007,
+962420004,
+962420005,
 962440009,
 962440013,
 962440014,
-972440004,
-982440002,
-942450024,
-952450021,
 962450061,
+972420002,
+972420003,
+972440004,
 972450003,
-1012450001,
-952460001,
-952460008,
 972460000,
+972480001,
+982440002,
 982460002,
 992460000,
-1012460000,
-1012460001,
+992500001,
+992540002,
+992560001,
 1002470001,
-1012470001,
-972480001,
 1002480006,
-992500001,
 1002500001,
 1002500002,
+1002530008,
+1002560026,
+1012450001,
+1012460000,
+1012460001,
+1012470001,
+1012540000,
+1012540001,
+1012580001,
 1022500001,
 1022510002,
-1002530008,
 1022530003,
 1022530030,
 1022530031,
 1022530032,
+1022540011,
 1032530000,
 1032530001,
-992540002,
-1012540000,
-1012540001,
-1022540011,
 1032550001,
 1032550027,
-992560001,
-1002560026,
 1042560007,
 1042560009,
 1042560012,
 1042570002,
+1042610001,
 1052570002,
-1012580001,
 1052580001,
-1042610001,
-1072620001,
 1062630003,
 1062650001,
+1072620001,
 1082650001,
 1082670002,
-1102700001,
-1102710001,
 1082770001,
-};
-int map_metastable [TOTAL_STATE_MAPS] = {1,
+1102700001,
+1102710001};
+constexpr int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
@@ -1039,20 +1040,14 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-1,
-1,
-1,
-1,
-1,
+2,
 1,
 1,
 1,
 2,
 1,
 1,
-2,
 1,
-2,
 1,
 1,
 1,
@@ -1076,11 +1071,9 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-1,
-1,
 2,
 1,
-1,
+2,
 1,
 1,
 1,
@@ -1111,7 +1104,6 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1139,12 +1131,7 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
-1,
-1,
-1,
 1,
-2,
 1,
 1,
 1,
@@ -1162,12 +1149,10 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
-3,
 1,
-2,
 1,
 1,
+2,
 1,
 1,
 1,
@@ -1179,12 +1164,14 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
+2,
 1,
 1,
 1,
 2,
-1,
+3,
 1,
 1,
 1,
@@ -1195,10 +1182,7 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 2,
-1,
-1,
-1,
-1,
+3,
 1,
 1,
 1,
@@ -1210,7 +1194,7 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 2,
-3,
+1,
 1,
 2,
 1,
@@ -1221,6 +1205,7 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
 1,
 1,
@@ -1248,7 +1233,6 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1262,12 +1246,12 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 3,
 1,
 1,
+2,
 1,
 1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1276,26 +1260,29 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
 1,
-2,
 1,
 1,
 1,
+2,
 1,
 1,
 1,
+2,
 1,
 1,
+2,
 1,
+2,
+3,
 1,
 2,
 1,
+2,
 1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1303,27 +1290,34 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
 1,
-2,
 1,
 1,
 1,
 1,
 1,
+2,
 1,
 1,
 1,
+2,
+3,
 1,
 1,
+2,
 1,
 1,
 2,
 1,
+1,
 2,
 1,
+1,
 2,
 1,
+1,
 2,
 1,
 1,
@@ -1334,11 +1328,10 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 2,
 3,
-1,
-1,
+4,
 1,
 2,
-1,
+3,
 1,
 2,
 1,
@@ -1348,17 +1341,12 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
-3,
 1,
-2,
 1,
 1,
 2,
-1,
-1,
-1,
-1,
+3,
+4,
 1,
 1,
 1,
@@ -1372,12 +1360,9 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 2,
 1,
 2,
-3,
-4,
 1,
 2,
-3,
-4,
+1,
 1,
 2,
 3,
@@ -1387,10 +1372,6 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
-1,
-2,
-3,
 1,
 1,
 1,
@@ -1400,7 +1381,6 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 2,
 1,
-1,
 2,
 1,
 1,
@@ -1410,16 +1390,15 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
 1,
+2,
+3,
 1,
 1,
 1,
 1,
 1,
 1,
-2,
-3,
 1,
 1,
 1,
@@ -1431,9 +1410,9 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1443,14 +1422,12 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1464,29 +1441,29 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
 1,
 1,
 1,
+2,
 1,
+2,
 1,
 1,
 2,
 1,
+2,
 1,
 1,
 1,
-2,
 1,
 1,
 2,
@@ -1497,24 +1474,25 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
 1,
+2,
 1,
-1,
+2,
 1,
 1,
 1,
 1,
 2,
 1,
+2,
 1,
 1,
 1,
 1,
 1,
 1,
-2,
-2,
 1,
 1,
 2,
@@ -1530,27 +1508,21 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
 1,
 1,
 1,
 2,
 1,
-2,
-3,
 1,
-2,
 1,
 2,
 1,
-1,
-1,
 2,
-3,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1566,28 +1538,21 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
-1,
 1,
 2,
 1,
 2,
 1,
-1,
-1,
 2,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
-2,
 1,
-2,
 1,
-2,
+1,
 1,
 1,
 2,
@@ -1600,8 +1565,10 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 2,
 1,
+2,
 1,
 1,
+2,
 1,
 1,
 1,
@@ -1620,8 +1587,10 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
-1,
+2,
+3,
 1,
 1,
 1,
@@ -1634,6 +1603,8 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
+3,
 1,
 1,
 1,
@@ -1641,11 +1612,11 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1657,47 +1628,36 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
 1,
 1,
 1,
 1,
-2,
-1,
 1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
 2,
 1,
 2,
-3,
-4,
-1,
 1,
 2,
 1,
-1,
-1,
-1,
-1,
-1,
-1,
 2,
 3,
 1,
-1,
-1,
 2,
 1,
-2,
 1,
 1,
 1,
+2,
+1,
+2,
 1,
 1,
 1,
@@ -1723,13 +1683,12 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
-1,
-1,
-1,
 1,
 1,
 1,
+2,
+3,
+4,
 1,
 1,
 1,
@@ -1740,39 +1699,33 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 2,
 1,
 2,
-1,
-2,
 3,
 1,
 1,
 1,
-2,
 1,
-2,
 1,
 1,
 1,
 1,
+2,
 1,
 2,
 1,
 1,
 2,
-3,
 1,
-2,
 1,
 1,
-2,
 1,
 1,
 1,
 1,
 1,
 2,
-3,
 1,
-2,
+1,
+1,
 1,
 2,
 1,
@@ -1782,10 +1735,14 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 2,
 1,
+1,
 2,
-3,
-4,
-5,
+1,
+1,
+1,
+1,
+1,
+1,
 1,
 1,
 1,
@@ -1801,10 +1758,15 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 2,
 1,
+1,
+1,
+1,
+1,
+1,
 2,
 3,
 1,
-2,
+1,
 1,
 2,
 1,
@@ -1817,7 +1779,9 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
+1,
+1,
+1,
 1,
 1,
 1,
@@ -1831,14 +1795,20 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 2,
 1,
 1,
+1,
 2,
 1,
 1,
+2,
+1,
 1,
 1,
 1,
+2,
+3,
 1,
 1,
+2,
 1,
 1,
 1,
@@ -1849,39 +1819,65 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+1,
+1,
+1,
+1,
+1,
+1,
 2,
 1,
+1,
 2,
+3,
+4,
+5,
+1,
 1,
 1,
 1,
 1,
 1,
 1,
+2,
+1,
+1,
+1,
 1,
 1,
 1,
 1,
 1,
 1,
+2,
 1,
 2,
 1,
 2,
+3,
 1,
 1,
 1,
+2,
+1,
 1,
+2,
 1,
 1,
+2,
 1,
 1,
+2,
 1,
 1,
 1,
 2,
 1,
 1,
+1,
+1,
+1,
+1,
 2,
 1,
 1,
@@ -1890,12 +1886,18 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+1,
+1,
+1,
+1,
 2,
 1,
 1,
 2,
 1,
+2,
 1,
+2,
 1,
 2,
 1,
@@ -1904,6 +1906,8 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 2,
 1,
+2,
+1,
 1,
 1,
 1,
@@ -1913,8 +1917,8 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
 1,
+2,
 1,
 1,
 1,
@@ -1923,13 +1927,13 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 2,
 1,
 2,
+1,
 2,
 1,
 1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -1944,6 +1948,8 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
+1,
 1,
 1,
 1,
@@ -1951,14 +1957,17 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
+2,
 1,
 1,
+2,
 1,
 2,
 1,
 1,
-2,
+1,
 1,
 1,
 1,
@@ -1967,24 +1976,22 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 2,
 1,
 2,
+3,
 1,
 1,
 2,
 1,
 2,
 1,
-2,
 1,
 2,
 1,
 2,
+3,
 1,
 1,
 2,
-3,
 1,
-2,
-3,
 1,
 1,
 1,
@@ -1993,7 +2000,6 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-2,
 1,
 1,
 1,
@@ -2003,6 +2009,7 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
+2,
 1,
 1,
 2,
@@ -2019,11 +2026,6 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 2,
 1,
-1,
-2,
-1,
-1,
-1,
 2,
 3,
 1,
@@ -2037,9 +2039,2026 @@ int map_metastable [TOTAL_STATE_MAPS] = {1,
 1,
 1,
 1,
-1,
-1,
-};
+1};
+// sorted metastable nuclides in id form and their state ids
+constexpr int map_metastable_ids [TOTAL_METASTABLE_MAPS] = {90260001,
+110240001,
+130240001,
+130260001,
+130320001,
+170340001,
+170380001,
+190380001,
+190380002,
+210420001,
+210430001,
+210440001,
+210450001,
+210460001,
+210500001,
+210560001,
+210560002,
+230440001,
+230460001,
+230600001,
+230600002,
+230640001,
+250500001,
+250520001,
+250580001,
+250600001,
+250620001,
+250640001,
+260520001,
+260530001,
+260610001,
+260650001,
+260670001,
+270530001,
+270540001,
+270580001,
+270580002,
+270600001,
+270620001,
+270700001,
+280690001,
+280690002,
+280710001,
+280760001,
+290670001,
+290680001,
+290700001,
+290700002,
+290750001,
+290750002,
+290760001,
+300690001,
+300710001,
+300730001,
+300730002,
+300750001,
+300770001,
+300780001,
+300790001,
+310720001,
+310740001,
+310780001,
+310800001,
+310840001,
+320710001,
+320730001,
+320750001,
+320770001,
+320790001,
+320810001,
+330750001,
+330770001,
+330790001,
+330820001,
+340690001,
+340730001,
+340770001,
+340790001,
+340810001,
+340820001,
+340830001,
+350700001,
+350720001,
+350740001,
+350760001,
+350770001,
+350780001,
+350790001,
+350800001,
+350820001,
+350840001,
+350880001,
+360730001,
+360790001,
+360810001,
+360830001,
+360840001,
+360840002,
+360850001,
+370780001,
+370810001,
+370820001,
+370830001,
+370840001,
+370850001,
+370860001,
+370900001,
+370970001,
+370980001,
+371000001,
+380830001,
+380850001,
+380860001,
+380870001,
+390780001,
+390800001,
+390800002,
+390830001,
+390840001,
+390850001,
+390860001,
+390870001,
+390890001,
+390900001,
+390910001,
+390930001,
+390960001,
+390970001,
+390970002,
+390980001,
+391000001,
+400850001,
+400870001,
+400890001,
+400900001,
+400910001,
+401080001,
+410820001,
+410840001,
+410850001,
+410850002,
+410860001,
+410860002,
+410870001,
+410880001,
+410890001,
+410900002,
+410900003,
+410910001,
+410920001,
+410930001,
+410940001,
+410950001,
+410970001,
+410980001,
+410990001,
+411000001,
+411000002,
+411000003,
+411020001,
+411040001,
+411060001,
+411080001,
+420890001,
+420910001,
+420930001,
+421110001,
+430870001,
+430880001,
+430880002,
+430890001,
+430900001,
+430900002,
+430910001,
+430930001,
+430940001,
+430950001,
+430960001,
+430970001,
+430990001,
+431000001,
+431000002,
+431020001,
+431070001,
+440910001,
+440930001,
+441030001,
+441170001,
+441190001,
+450910001,
+450920001,
+450950001,
+450960001,
+450970001,
+450980001,
+450990001,
+451000001,
+451010001,
+451020001,
+451030001,
+451040001,
+451050001,
+451060001,
+451080001,
+451100001,
+451140001,
+451160001,
+451200001,
+451220001,
+460950001,
+461070001,
+461090001,
+461110001,
+461130001,
+461150001,
+461210001,
+461240001,
+461260001,
+461260002,
+461260003,
+461280001,
+470940001,
+470940002,
+470950001,
+470990001,
+471000001,
+471010001,
+471020001,
+471030001,
+471040001,
+471050001,
+471060001,
+471070001,
+471080001,
+471090001,
+471100001,
+471110001,
+471130001,
+471150001,
+471160001,
+471160002,
+471170001,
+471180001,
+471190001,
+471190002,
+471200001,
+471220001,
+471220002,
+471240001,
+471240002,
+471240003,
+471250001,
+471250002,
+471260001,
+471260002,
+471290001,
+481110001,
+481130001,
+481150001,
+481170001,
+481190001,
+481210001,
+481230001,
+481250001,
+481270001,
+481290001,
+481290002,
+491030001,
+491040001,
+491050001,
+491060001,
+491070001,
+491080001,
+491090001,
+491090002,
+491100001,
+491110001,
+491120001,
+491120002,
+491120003,
+491130001,
+491140001,
+491140002,
+491150001,
+491160001,
+491160002,
+491170001,
+491180001,
+491180002,
+491190001,
+491200001,
+491200002,
+491210001,
+491220001,
+491220002,
+491230001,
+491240001,
+491250001,
+491260001,
+491270001,
+491290001,
+491290002,
+491290003,
+491290004,
+491300001,
+491300002,
+491300003,
+491310001,
+491310002,
+491330001,
+501130001,
+501170001,
+501190001,
+501210001,
+501230001,
+501240001,
+501250001,
+501270001,
+501290001,
+501290002,
+501290003,
+501290004,
+501300001,
+501310001,
+501320001,
+501360001,
+501380001,
+511160001,
+511180001,
+511190001,
+511200001,
+511220001,
+511220002,
+511240001,
+511240002,
+511260001,
+511260002,
+511280001,
+511290001,
+511290002,
+511290003,
+511300001,
+511320001,
+511340001,
+511400001,
+521150001,
+521170001,
+521190001,
+521210001,
+521230001,
+521250001,
+521270001,
+521290001,
+521310001,
+521310002,
+521320001,
+521320002,
+521330001,
+521340001,
+521350001,
+531140001,
+531180001,
+531200001,
+531300001,
+531320001,
+531330001,
+531330002,
+531330003,
+531340001,
+531360001,
+531380001,
+541250001,
+541270001,
+541290001,
+541310001,
+541320001,
+541330001,
+541340001,
+541350001,
+551160001,
+551180001,
+551190001,
+551200001,
+551210001,
+551220001,
+551220002,
+551230001,
+551240001,
+551290001,
+551300001,
+551340001,
+551350001,
+551360001,
+551380001,
+551440001,
+561270001,
+561290001,
+561300001,
+561310001,
+561330001,
+561350001,
+561360001,
+561370001,
+571200001,
+571250001,
+571270001,
+571280001,
+571290001,
+571310001,
+571320001,
+571360001,
+571390001,
+571460001,
+581270001,
+581310001,
+581320001,
+581330001,
+581350001,
+581370001,
+581380001,
+581390001,
+581510001,
+591300001,
+591310001,
+591330001,
+591350001,
+591380001,
+591400001,
+591400002,
+591420001,
+591420002,
+591440001,
+591480001,
+591480002,
+601290001,
+601290002,
+601330001,
+601340001,
+601350001,
+601370001,
+601390001,
+601390002,
+601400001,
+601410001,
+601420001,
+601540001,
+601580001,
+601600001,
+611330001,
+611340001,
+611340002,
+611350001,
+611350002,
+611360001,
+611360002,
+611380001,
+611390001,
+611400001,
+611420001,
+611480002,
+611520001,
+611520002,
+611540001,
+611560001,
+611580001,
+611610001,
+621330001,
+621390001,
+621410001,
+621430001,
+621430002,
+621510001,
+621530001,
+621590001,
+621640001,
+631360001,
+631390001,
+631400001,
+631410001,
+631420001,
+631500001,
+631510001,
+631520001,
+631520002,
+631540001,
+641390001,
+641410001,
+641420001,
+641420002,
+641430001,
+641450001,
+641530001,
+641530002,
+641550001,
+641570002,
+641590001,
+641660001,
+651410001,
+651420001,
+651430001,
+651440001,
+651450001,
+651460001,
+651460002,
+651470001,
+651480001,
+651490001,
+651500001,
+651510001,
+651520001,
+651530001,
+651540001,
+651540002,
+651560001,
+651560002,
+651580001,
+651580002,
+661430001,
+661450001,
+661460001,
+661470001,
+661490001,
+661550001,
+661570001,
+661590001,
+661650001,
+671440001,
+671480001,
+671480002,
+671490001,
+671500001,
+671510001,
+671520001,
+671530001,
+671550001,
+671560001,
+671560002,
+671580001,
+671580002,
+671590001,
+671600001,
+671600002,
+671610001,
+671620001,
+671630001,
+671640001,
+671660001,
+671680001,
+671700001,
+681450001,
+681470001,
+681480001,
+681490001,
+681510001,
+681610001,
+681670001,
+691460001,
+691470001,
+691500001,
+691510001,
+691510002,
+691520001,
+691520002,
+691520003,
+691530001,
+691550001,
+691580001,
+691580002,
+691600001,
+691610001,
+691620001,
+691640001,
+691660001,
+691720001,
+691770001,
+701510001,
+701510002,
+701510003,
+701520001,
+701690001,
+701750001,
+701760001,
+701770001,
+711540001,
+711550001,
+711550002,
+711560001,
+711570001,
+711580001,
+711600001,
+711610001,
+711620001,
+711660001,
+711660002,
+711670001,
+711680001,
+711690001,
+711700001,
+711710001,
+711720001,
+711720002,
+711740001,
+711750001,
+711760001,
+711770001,
+711780001,
+711790001,
+721540001,
+721560001,
+721610001,
+721710001,
+721770001,
+721770002,
+721780001,
+721780002,
+721790001,
+721790002,
+721800001,
+721810002,
+721810003,
+721820001,
+721820002,
+721830001,
+721840001,
+731560001,
+731570001,
+731570002,
+731580001,
+731580002,
+731590001,
+731760001,
+731780001,
+731780002,
+731780003,
+731780004,
+731790001,
+731800001,
+731820001,
+731820002,
+731830001,
+731890001,
+731900001,
+741790001,
+741820001,
+741830001,
+741850001,
+741900001,
+751620001,
+751630001,
+751650001,
+751670001,
+751690001,
+751720001,
+751790001,
+751820001,
+751830001,
+751830002,
+751830003,
+751830004,
+751840001,
+751860001,
+751880001,
+751890001,
+751890002,
+751900001,
+751920001,
+751920002,
+751940001,
+751940002,
+751940003,
+751960001,
+761810001,
+761820001,
+761830001,
+761890001,
+761900001,
+761910001,
+761920001,
+761920002,
+761950001,
+761950002,
+761970001,
+761980001,
+761980002,
+771640001,
+771650001,
+771680001,
+771690001,
+771700001,
+771710001,
+771720001,
+771730001,
+771730002,
+771740001,
+771840001,
+771860001,
+771890001,
+771890002,
+771900001,
+771900002,
+771910001,
+771910002,
+771920001,
+771920002,
+771930001,
+771940001,
+771940002,
+771950001,
+771960001,
+771970001,
+771980001,
+781710001,
+781830001,
+781840001,
+781850001,
+781890001,
+781890002,
+781930001,
+781950001,
+781970001,
+781990001,
+782020001,
+791720001,
+791730001,
+791750001,
+791760001,
+791760002,
+791770001,
+791790001,
+791840001,
+791850001,
+791870001,
+791890001,
+791890002,
+791890003,
+791900001,
+791910001,
+791920001,
+791920002,
+791930001,
+791940001,
+791940002,
+791950001,
+791950002,
+791960001,
+791960002,
+791970001,
+791980001,
+791990001,
+792000001,
+801850001,
+801870001,
+801890001,
+801910001,
+801930001,
+801950001,
+801970001,
+801990001,
+802010001,
+802050001,
+802080001,
+802100001,
+802100002,
+811790001,
+811810001,
+811830001,
+811830002,
+811850001,
+811860001,
+811860002,
+811870001,
+811880001,
+811890001,
+811900001,
+811900002,
+811900003,
+811910001,
+811920001,
+811920002,
+811930001,
+811940001,
+811950001,
+811960001,
+811970001,
+811980001,
+811980002,
+811990001,
+812000001,
+812010001,
+812040001,
+812060001,
+812070001,
+821830001,
+821870001,
+821890001,
+821890002,
+821910001,
+821920001,
+821920002,
+821920003,
+821920004,
+821920005,
+821930001,
+821950001,
+821970001,
+821990001,
+822010001,
+822020001,
+822030001,
+822030002,
+822040001,
+822050001,
+822070001,
+822110001,
+822140001,
+822160001,
+831860001,
+831870001,
+831890001,
+831890002,
+831900001,
+831900002,
+831910001,
+831910002,
+831910003,
+831920001,
+831930001,
+831940001,
+831940002,
+831950001,
+831960001,
+831960002,
+831970001,
+831980001,
+831980002,
+831990001,
+832000001,
+832000002,
+832010001,
+832030001,
+832040001,
+832040002,
+832060001,
+832070001,
+832080001,
+832100001,
+832110001,
+832120001,
+832120002,
+832150001,
+832170001,
+841920001,
+841930001,
+841950001,
+841960001,
+841970001,
+841990001,
+842010001,
+842030001,
+842050001,
+842050002,
+842070001,
+842110001,
+842120002,
+851920001,
+851920002,
+851930001,
+851930002,
+851940001,
+851940002,
+851950001,
+851970001,
+851980001,
+852000001,
+852000002,
+852020001,
+852020002,
+852040001,
+852110001,
+852120001,
+852140001,
+861950001,
+861970001,
+861990001,
+862010001,
+862030001,
+862070001,
+862140001,
+862140002,
+862150001,
+871980001,
+872010001,
+872020001,
+872040001,
+872040002,
+872060001,
+872060002,
+872110001,
+872110002,
+872140001,
+872160001,
+872180001,
+882010001,
+882030001,
+882050001,
+882070001,
+882130001,
+892060001,
+892170001,
+892220001,
+902140001,
+902150001,
+902170001,
+912170001,
+912340001,
+922160001,
+922180001,
+922350001,
+922350002,
+922380001,
+932360001,
+932380001,
+932400001,
+932420002,
+942350001,
+942370001,
+942380001,
+942380002,
+942390001,
+942390002,
+942400001,
+942410001,
+942410002,
+942420001,
+942420002,
+942440001,
+942450001,
+952360001,
+952380001,
+952390001,
+952400001,
+952410001,
+952420001,
+952420002,
+952440001,
+952440002,
+952440003,
+952450001,
+952460001,
+952460002,
+962400001,
+962400002,
+962410001,
+962420001,
+962420002,
+962440001,
+962440002,
+962440003,
+962450001,
+972420001,
+972420002,
+972440001,
+972450001,
+972460001,
+972480001,
+982440001,
+982460001,
+992460001,
+992500001,
+992540001,
+992560001,
+1002470001,
+1002480001,
+1002500001,
+1002500002,
+1002530001,
+1002560001,
+1012450001,
+1012460001,
+1012460002,
+1012470001,
+1012540001,
+1012540002,
+1012580001,
+1022500001,
+1022510001,
+1022530001,
+1022530002,
+1022530003,
+1022530004,
+1022540001,
+1032530001,
+1032550001,
+1032550002,
+1042560001,
+1042560002,
+1042560003,
+1042570001,
+1042610001,
+1052570001,
+1052580001,
+1062630001,
+1062650001,
+1072620001,
+1082650001,
+1082670001,
+1082770001,
+1102700001,
+1102710001};
+constexpr int map_state_ids [TOTAL_METASTABLE_MAPS] = {90260001,
+110240001,
+130240001,
+130260001,
+130320002,
+170340001,
+170380001,
+190380001,
+190380015,
+210420002,
+210430001,
+210440004,
+210450001,
+210460002,
+210500001,
+210560001,
+210560004,
+230440001,
+230460001,
+230600000,
+230600001,
+230640001,
+250500001,
+250520001,
+250580001,
+250600001,
+250620001,
+250640002,
+260520042,
+260530022,
+260610004,
+260650003,
+260670002,
+270530003,
+270540001,
+270580001,
+270580002,
+270600001,
+270620001,
+270700001,
+280690001,
+280690008,
+280710002,
+280760004,
+290670023,
+290680003,
+290700001,
+290700003,
+290750001,
+290750002,
+290760001,
+300690001,
+300710001,
+300730001,
+300730002,
+300750001,
+300770002,
+300780004,
+300790002,
+310720002,
+310740002,
+310780004,
+310800001,
+310840001,
+320710002,
+320730002,
+320750002,
+320770001,
+320790001,
+320810001,
+330750004,
+330770004,
+330790007,
+330820001,
+340690004,
+340730001,
+340770001,
+340790001,
+340810001,
+340820015,
+340830001,
+350700006,
+350720001,
+350740002,
+350760002,
+350770001,
+350780004,
+350790001,
+350800002,
+350820001,
+350840001,
+350880003,
+360730004,
+360790001,
+360810002,
+360830002,
+360840019,
+360840061,
+360850001,
+370780003,
+370810001,
+370820001,
+370830002,
+370840002,
+370850003,
+370860002,
+370900001,
+370970002,
+370980001,
+371000001,
+380830002,
+380850002,
+380860014,
+380870001,
+390780001,
+390800001,
+390800003,
+390830001,
+390840002,
+390850001,
+390860002,
+390870001,
+390890001,
+390900002,
+390910001,
+390930002,
+390960005,
+390970001,
+390970029,
+390980005,
+391000004,
+400850002,
+400870002,
+400890001,
+400900003,
+400910040,
+401080009,
+410820003,
+410840007,
+410850003,
+410850005,
+410860001,
+410860002,
+410870001,
+410880001,
+410890001,
+410900002,
+410900007,
+410910001,
+410920001,
+410930001,
+410940001,
+410950001,
+410970001,
+410980001,
+410990001,
+411000001,
+411000009,
+411000012,
+411020001,
+411040004,
+411060003,
+411080003,
+420890002,
+420910001,
+420930016,
+421110001,
+430870005,
+430880000,
+430880001,
+430890001,
+430900001,
+430900006,
+430910001,
+430930001,
+430940001,
+430950001,
+430960001,
+430970001,
+430990002,
+431000002,
+431000004,
+431020001,
+431070000,
+440910001,
+440930001,
+441030005,
+441170003,
+441190002,
+450910001,
+450920001,
+450950001,
+450960001,
+450970001,
+450980001,
+450990001,
+451000004,
+451010001,
+451020005,
+451030001,
+451040003,
+451050001,
+451060001,
+451080004,
+451100001,
+451140005,
+451160001,
+451200002,
+451220002,
+460950005,
+461070002,
+461090002,
+461110002,
+461130002,
+461150001,
+461210001,
+461240004,
+461260003,
+461260004,
+461260005,
+461280004,
+470940001,
+470940002,
+470950002,
+470990002,
+471000001,
+471010002,
+471020001,
+471030002,
+471040001,
+471050001,
+471060001,
+471070001,
+471080002,
+471090001,
+471100002,
+471110001,
+471130001,
+471150001,
+471160001,
+471160004,
+471170001,
+471180004,
+471190000,
+471190001,
+471200002,
+471220001,
+471220002,
+471240001,
+471240002,
+471240003,
+471250007,
+471250010,
+471260001,
+471260004,
+471290001,
+481110003,
+481130001,
+481150001,
+481170002,
+481190002,
+481210002,
+481230003,
+481250001,
+481270006,
+481290001,
+481290004,
+491030001,
+491040003,
+491050001,
+491060001,
+491070001,
+491080001,
+491090001,
+491090026,
+491100001,
+491110001,
+491120001,
+491120004,
+491120009,
+491130001,
+491140001,
+491140005,
+491150001,
+491160001,
+491160004,
+491170001,
+491180001,
+491180003,
+491190001,
+491200001,
+491200002,
+491210001,
+491220001,
+491220005,
+491230001,
+491240002,
+491250001,
+491260001,
+491270001,
+491290001,
+491290010,
+491290012,
+491290013,
+491300001,
+491300002,
+491300003,
+491310001,
+491310004,
+491330001,
+501130001,
+501170002,
+501190002,
+501210001,
+501230001,
+501240016,
+501250001,
+501270001,
+501290001,
+501290017,
+501290018,
+501290025,
+501300002,
+501310001,
+501320006,
+501360003,
+501380003,
+511160003,
+511180007,
+511190072,
+511200001,
+511220005,
+511220006,
+511240001,
+511240002,
+511260001,
+511260002,
+511280001,
+511290011,
+511290012,
+511290023,
+511300001,
+511320001,
+511340002,
+511400003,
+521150001,
+521170003,
+521190002,
+521210002,
+521230002,
+521250002,
+521270002,
+521290001,
+521310001,
+521310033,
+521320006,
+521320022,
+521330002,
+521340003,
+521350010,
+531140005,
+531180002,
+531200013,
+531300001,
+531320003,
+531330016,
+531330059,
+531330065,
+531340005,
+531360006,
+531380002,
+541250002,
+541270002,
+541290002,
+541310002,
+541320030,
+541330001,
+541340007,
+541350002,
+551160001,
+551180001,
+551190001,
+551200001,
+551210001,
+551220007,
+551220008,
+551230005,
+551240025,
+551290010,
+551300004,
+551340003,
+551350010,
+551360001,
+551380003,
+551440004,
+561270002,
+561290001,
+561300030,
+561310002,
+561330002,
+561350002,
+561360005,
+561370002,
+571200000,
+571250005,
+571270001,
+571280001,
+571290002,
+571310006,
+571320004,
+571360051,
+571390021,
+571460001,
+581270001,
+581310001,
+581320030,
+581330001,
+581350004,
+581370002,
+581380005,
+581390002,
+581510001,
+591300002,
+591310002,
+591330003,
+591350004,
+591380005,
+591400003,
+591400015,
+591420001,
+591420024,
+591440001,
+591480000,
+591480001,
+601290001,
+601290003,
+601330001,
+601340017,
+601350001,
+601370004,
+601390002,
+601390035,
+601400009,
+601410002,
+601420004,
+601540003,
+601580004,
+601600003,
+611330005,
+611340001,
+611340000,
+611350000,
+611350003,
+611360000,
+611360001,
+611380001,
+611390001,
+611400008,
+611420012,
+611480003,
+611520004,
+611520014,
+611540001,
+611560002,
+611580002,
+611610005,
+621330000,
+621390004,
+621410002,
+621430002,
+621430043,
+621510012,
+621530006,
+621590006,
+621640005,
+631360001,
+631390003,
+631400004,
+631410001,
+631420031,
+631500001,
+631510002,
+631520001,
+631520016,
+631540013,
+641390001,
+641410004,
+641420019,
+641420020,
+641430002,
+641450002,
+641530003,
+641530008,
+641550006,
+641570012,
+641590002,
+641660009,
+651410001,
+651420003,
+651430001,
+651440004,
+651450004,
+651460022,
+651460026,
+651470001,
+651480001,
+651490001,
+651500002,
+651510003,
+651520006,
+651530003,
+651540001,
+651540002,
+651560002,
+651560004,
+651580003,
+651580023,
+661430003,
+661450002,
+661460011,
+661470002,
+661490027,
+661550009,
+661570005,
+661590009,
+661650002,
+671440003,
+671480001,
+671480012,
+671490001,
+671500001,
+671510001,
+671520001,
+671530001,
+671550002,
+671560001,
+671560012,
+671580001,
+671580009,
+671590003,
+671600001,
+671600006,
+671610002,
+671620003,
+671630003,
+671640003,
+671660001,
+671680001,
+671700001,
+681450002,
+681470002,
+681480008,
+681490002,
+681510021,
+681610014,
+681670003,
+691460001,
+691470001,
+691500005,
+691510001,
+691510012,
+691520006,
+691520018,
+691520019,
+691530001,
+691550001,
+691580002,
+691580003,
+691600002,
+691610001,
+691620020,
+691640001,
+691660006,
+691720011,
+691770000,
+701510001,
+701510005,
+701510010,
+701520006,
+701690001,
+701750007,
+701760005,
+701770006,
+711540015,
+711550001,
+711550004,
+711560001,
+711570001,
+711580000,
+711600001,
+711610004,
+711620008,
+711660001,
+711660002,
+711670001,
+711680013,
+711690001,
+711700008,
+711710001,
+711720001,
+711720005,
+711740003,
+711750053,
+711760001,
+711770029,
+711780003,
+711790006,
+721540006,
+721560004,
+721610002,
+721710001,
+721770048,
+721770107,
+721780005,
+721780109,
+721790005,
+721790046,
+721800006,
+721810025,
+721810078,
+721820009,
+721820026,
+721830007,
+721840005,
+731560001,
+731570001,
+731570004,
+731580001,
+731580015,
+731590001,
+731760012,
+731780000,
+731780059,
+731780094,
+731780139,
+731790117,
+731800002,
+731820001,
+731820029,
+731830032,
+731890001,
+731900002,
+741790002,
+741820062,
+741830007,
+741850006,
+741900006,
+751620001,
+751630001,
+751650001,
+751670001,
+751690001,
+751720001,
+751790137,
+751820001,
+751830004,
+751830005,
+751830070,
+751830074,
+751840005,
+751860004,
+751880007,
+751890033,
+751890034,
+751900003,
+751920002,
+751920003,
+751940001,
+751940002,
+751940003,
+751960001,
+761810001,
+761820029,
+761830002,
+761890001,
+761900032,
+761910001,
+761920047,
+761920112,
+761950002,
+761950004,
+761970001,
+761980006,
+761980010,
+771640001,
+771650001,
+771680001,
+771690001,
+771700001,
+771710001,
+771720001,
+771730000,
+771730003,
+771740001,
+771840007,
+771860001,
+771890006,
+771890085,
+771900002,
+771900037,
+771910003,
+771910071,
+771920003,
+771920015,
+771930002,
+771940007,
+771940012,
+771950002,
+771960004,
+771970002,
+771980001,
+781710002,
+781830001,
+781840034,
+781850002,
+781890004,
+781890005,
+781930005,
+781950007,
+781970009,
+781990008,
+782020003,
+791720001,
+791730001,
+791750001,
+791760001,
+791760002,
+791770002,
+791790007,
+791840003,
+791850001,
+791870002,
+791890003,
+791890006,
+791890200,
+791900014,
+791910004,
+791920004,
+791920015,
+791930004,
+791940003,
+791940008,
+791950004,
+791950055,
+791960003,
+791960054,
+791970004,
+791980051,
+791990006,
+792000011,
+801850004,
+801870001,
+801890002,
+801910035,
+801930003,
+801950003,
+801970004,
+801990007,
+802010013,
+802050008,
+802080004,
+802100002,
+802100005,
+811790001,
+811810002,
+811830002,
+811830005,
+811850003,
+811860000,
+811860005,
+811870002,
+811880001,
+811890001,
+811900000,
+811900001,
+811900006,
+811910002,
+811920002,
+811920008,
+811930002,
+811940001,
+811950002,
+811960006,
+811970002,
+811980007,
+811980012,
+811990003,
+812000010,
+812010003,
+812040029,
+812060045,
+812070002,
+821830001,
+821870001,
+821890001,
+821890014,
+821910002,
+821920011,
+821920014,
+821920017,
+821920020,
+821920021,
+821930001,
+821950002,
+821970002,
+821990003,
+822010004,
+822020014,
+822030006,
+822030053,
+822040021,
+822050009,
+822070003,
+822110014,
+822140004,
+822160004,
+831860001,
+831870002,
+831890002,
+831890003,
+831900000,
+831900001,
+831910002,
+831910005,
+831910028,
+831920001,
+831930001,
+831940001,
+831940002,
+831950001,
+831960002,
+831960003,
+831970001,
+831980001,
+831980003,
+831990001,
+832000001,
+832000003,
+832010001,
+832030006,
+832040008,
+832040038,
+832060016,
+832070036,
+832080018,
+832100002,
+832110021,
+832120005,
+832120012,
+832150009,
+832170005,
+841920006,
+841930001,
+841950002,
+841960015,
+841970002,
+841990002,
+842010003,
+842030005,
+842050010,
+842050017,
+842070014,
+842110015,
+842120030,
+851920000,
+851920001,
+851930001,
+851930002,
+851940000,
+851940001,
+851950001,
+851970001,
+851980001,
+852000001,
+852000003,
+852020001,
+852020002,
+852040001,
+852110076,
+852120004,
+852140006,
+861950001,
+861970001,
+861990001,
+862010001,
+862030001,
+862070007,
+862140004,
+862140005,
+862150013,
+871980001,
+872010001,
+872020001,
+872040001,
+872040002,
+872060001,
+872060002,
+872110013,
+872110019,
+872140001,
+872160001,
+872180002,
+882010000,
+882030001,
+882050001,
+882070001,
+882130005,
+892060001,
+892170010,
+892220001,
+902140004,
+902150003,
+902170001,
+912170001,
+912340002,
+922160001,
+922180001,
+922350001,
+922350174,
+922380119,
+932360001,
+932380128,
+932400001,
+932420007,
+942350010,
+942370003,
+942380047,
+942380052,
+942390106,
+942390111,
+942400102,
+942410106,
+942410107,
+942420044,
+942420045,
+942440032,
+942450024,
+952360001,
+952380001,
+952390011,
+952400057,
+952410075,
+952420002,
+952420141,
+952440001,
+952440112,
+952440113,
+952450021,
+952460001,
+952460008,
+962400002,
+962400003,
+962410007,
+962420004,
+962420005,
+962440009,
+962440013,
+962440014,
+962450061,
+972420002,
+972420003,
+972440004,
+972450003,
+972460000,
+972480001,
+982440002,
+982460002,
+992460000,
+992500001,
+992540002,
+992560001,
+1002470001,
+1002480006,
+1002500001,
+1002500002,
+1002530008,
+1002560026,
+1012450001,
+1012460000,
+1012460001,
+1012470001,
+1012540000,
+1012540001,
+1012580001,
+1022500001,
+1022510002,
+1022530003,
+1022530030,
+1022530031,
+1022530032,
+1022540011,
+1032530000,
+1032550001,
+1032550027,
+1042560007,
+1042560009,
+1042560012,
+1042570002,
+1042610001,
+1052570002,
+1052580001,
+1062630003,
+1062650001,
+1072620001,
+1082650001,
+1082670002,
+1082770001,
+1102700001,
+1102710001};
 }
 }
-#endif
+#endif
\ No newline at end of file
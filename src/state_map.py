@@ -1,45 +1,66 @@
 # -*- coding: utf-8 -*-
 """
-This script generates the state_map.h file from nuc_data.h5
+This script generates the state_map.cpp file from nuc_data.h5
 """
 import tables as tb
 
 from pyne import nuc_data
 
 
+def _write_array(sm, name, size, values):
+    sm.write('constexpr int ' + name + ' [' + size + '] = {')
+    sm.write(',\n'.join(str(v) for v in values))
+    sm.write('};\n')
+
+
+def write_state_id_map(sm, pairs):
+    """Writes the state map source for a sequence of (state id, metastable
+    level) pairs.  Both directions are sorted so that they can be binary
+    searched; where several state ids share a metastable level, the lowest
+    one is used for the reverse direction.
+    """
+    levels = dict(pairs)
+    state_ids = sorted(levels)
+    meta = {}
+    for state_id in state_ids:
+        nuc_id = (state_id // 10000) * 10000 + levels[state_id]
+        meta.setdefault(nuc_id, state_id)
+    nuc_ids = sorted(meta)
+
+    sm.write('//Mapping file for state ids to nuc ids\n')
+    sm.write('//This File was autogenerated!!\n')
+    sm.write('#ifndef PYNE_4HFU6PUEQJB3ZJ4UIFLVU4SPCM\n')
+    sm.write('#define PYNE_4HFU6PUEQJB3ZJ4UIFLVU4SPCM\n')
+    sm.write('namespace pyne {\n')
+    sm.write('namespace nucname {\n')
+    sm.write('#define TOTAL_STATE_MAPS ' + str(len(state_ids)) + '\n')
+    sm.write('#define TOTAL_METASTABLE_MAPS ' + str(len(nuc_ids)) + '\n')
+    sm.write('std::map<int, int> state_id_map;\n')
+    sm.write('// sorted state ids and their metastable levels\n')
+    _write_array(sm, 'map_nuc_ids', 'TOTAL_STATE_MAPS', state_ids)
+    _write_array(sm, 'map_metastable', 'TOTAL_STATE_MAPS',
+                 [levels[s] for s in state_ids])
+    sm.write('// sorted metastable nuclides in id form and their state ids\n')
+    _write_array(sm, 'map_metastable_ids', 'TOTAL_METASTABLE_MAPS', nuc_ids)
+    _write_array(sm, 'map_state_ids', 'TOTAL_METASTABLE_MAPS',
+                 [meta[n] for n in nuc_ids])
+    sm.write('}\n')
+    sm.write('}\n')
+    sm.write("#endif")
+
+
 def generate_state_id_map(nuc_data):
     f = tb.open_file(nuc_data)
+    pairs = []
+    lastnuc = 0
+    for item in f.root.decay.level_list:
+        if item['metastable'] > 0 and item['nuc_id'] != lastnuc:
+            lastnuc = item['nuc_id']
+            pairs.append((int(item['nuc_id']), int(item['metastable'])))
+    f.close()
 
     with open('state_map.cpp','w') as sm:
-        sm.write('//Mapping file for state ids to nuc ids\n')
-        sm.write('//This File was autogenerated!!\n')
-        sm.write('#ifndef PYNE_4HFU6PUEQJB3ZJ4UIFLVU4SPCM\n')
-        sm.write('#define PYNE_4HFU6PUEQJB3ZJ4UIFLVU4SPCM\n')
-        sm.write('namespace pyne {\n')
-        sm.write('namespace nucname {\n')
-        lastnuc = 0
-        count = 0
-        for item in f.root.decay.level_list:
-            if item['metastable'] > 0 and item['nuc_id'] != lastnuc:
-                lastnuc = item['nuc_id']
-                count = count + 1
-        sm.write('#define TOTAL_STATE_MAPS '+ str(count) +'\n')
-        sm.write('std::map<int, int> state_id_map;\n')
-        sm.write('int map_nuc_ids [TOTAL_STATE_MAPS] = {')
-        for item in f.root.decay.level_list:
-            if item['metastable'] > 0 and item['nuc_id'] != lastnuc:
-                lastnuc = item['nuc_id']
-                sm.write(str(item['nuc_id']) + ",\n")
-        sm.write('};\n')
-        sm.write('int map_metastable [TOTAL_STATE_MAPS] = {')
-        for item in f.root.decay.level_list:
-            if item['metastable'] > 0 and item['nuc_id'] != lastnuc:
-                lastnuc = item['nuc_id']
-                sm.write(str(item['metastable']) + ",\n")
-        sm.write('};\n')
-        sm.write('}\n')
-        sm.write('}\n')
-        sm.write("#endif")
+        write_state_id_map(sm, pairs)
 
 if __name__ == "__main__":
     generate_state_id_map(nuc_data)
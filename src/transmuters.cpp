@@ -1,63 +1,763 @@
 extern "C" {
 #include "cram.hpp"
 }
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <set>
+#include <atomic>
+#include <mutex>
 #include "utils.h"
+#include "data.h"
 #include "transmuters.h"
 
 
+const pyne::NuclideIndex& pyne::transmuters::cram_index() {
+  static const NuclideIndex index (pyne_cram_transmute_info.nucids,
+                                   pyne_cram_transmute_info.n);
+  return index;
+}
+
+
 std::map<int, double> pyne::transmuters::cram(std::vector<double>& A,
                                               const std::map<int, double>& n0,
                                               const int order) {
-  using std::map;
-  using std::vector;
-  // Get intial condition vector
-  vector<double> b (pyne_cram_transmute_info.n, 0.0);
-  map<int, double>::const_iterator it;
-  int i = -1;
-  for (it = n0.begin(); it != n0.end(); ++it) {
-    i = pyne_cram_transmute_nucid_to_i(it->first);
-    if (i < 0) {
-      continue;
+  const NuclideIndex& index = cram_index();
+  std::vector<double> x = cram(A, index.to_dense(n0), order);
+  return index.to_map(x.data());
+}
+
+
+std::vector<double> pyne::transmuters::cram(std::vector<double>& A,
+                                            const std::vector<double>& n0,
+                                            const int order) {
+  if ((int) n0.size() != pyne_cram_transmute_info.n)
+    throw pyne::ValueError("The initial composition must have one entry per"
+                           " nuclide of the CRAM transmutation matrix.");
+  std::vector<double> x (n0);
+  cram_inplace(A, x.data(), order);
+  return x;
+}
+
+
+namespace {
+  // true if cram_inplace() has a solver for order
+  bool cram_order_available(int order) {
+    return order == CRAM_ADAPTIVE_ORDER || (6 <= order && order <= 18 &&
+                                            order % 2 == 0);
+  }
+
+  void check_cram_order(int order) {
+    if (!cram_order_available(order))
+      throw pyne::ValueError("Order selected not available for CRAM, please"
+                             " use order 6, 8, 10, 12, 14, 16, or 18, or"
+                             " CRAM_ADAPTIVE_ORDER.");
+  }
+
+  // Sets x to exp(A) b with the CRAM solver of the given order.
+  void expm_multiply(int order, const double* cA, double* b, double* x) {
+    // the generated solvers take A as non-const but only read it
+    double* A = const_cast<double*>(cA);
+    std::fill(x, x + pyne_cram_transmute_info.n, 0.0);
+    switch(order) {
+      case 6:
+        pyne_cram_expm_multiply6(A, b, x);
+        break;
+      case 8:
+        pyne_cram_expm_multiply8(A, b, x);
+        break;
+      case 10:
+        pyne_cram_expm_multiply10(A, b, x);
+        break;
+      case 12:
+        pyne_cram_expm_multiply12(A, b, x);
+        break;
+      case 14:
+        pyne_cram_expm_multiply14(A, b, x);
+        break;
+      case 16:
+        pyne_cram_expm_multiply16(A, b, x);
+        break;
+      case 18:
+        pyne_cram_expm_multiply18(A, b, x);
+        break;
+      default:
+        check_cram_order(order);
+        break;
     }
-    b[i] = it->second;
   }
 
+  // The orders of the solvers, with the error of each on the negative real
+  // axis, which falls as 9.28903^-order (Halphen's constant).
+  const int cram_norders = 7;
+  const int cram_orders [cram_norders] = {6, 8, 10, 12, 14, 16, 18};
+  double cram_order_error(int order) {
+    return std::pow(9.28903, -order);
+  }
+
+  // Totals of the adaptive solves, by the order they ended at.
+  struct adaptive_totals {
+    long calls;
+    long escalations;
+    double seconds;
+  };
+  adaptive_totals adaptive_stats [cram_norders] = {};
+  std::mutex adaptive_stats_mutex;
+
+  // Accuracy that the adaptive solves aim for.
+  std::atomic<double> adaptive_tol (1e-10);
+
+  // sum |x - y| / sum |y|, or infinity if that is not finite
+  double cram_rel_diff(const double* x, const double* y, int n) {
+    double diff = 0.0, size = 0.0;
+    for (int i = 0; i < n; ++i) {
+      diff += std::fabs(x[i] - y[i]);
+      size += std::fabs(y[i]);
+    }
+    double rel = size == 0.0 ? diff : diff / size;
+    return std::isfinite(rel) ? rel : HUGE_VAL;
+  }
+
+  // The adaptive cram_inplace(), with b already holding a copy of n.  Each
+  // result is checked against the one of the order below it: CRAM's error
+  // falls by 9.28903^-2 from one order to the next, so their difference is
+  // almost all error of the lower one, and scaling it by that ratio
+  // estimates the error of the higher.  The first pair is the order that
+  // cram_adaptive_order() maps the tolerance to and the one below, and the
+  // order goes up until the estimate is within the tolerance.
+  void cram_adaptive(const double* A, double* n, double* b) {
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    const int size = pyne_cram_transmute_info.n;
+    const double tol = adaptive_tol;
+    int k = 0;
+    while (cram_orders[k] != pyne::transmuters::cram_adaptive_order(tol))
+      ++k;
+    k = std::max(k, 1);
+    const int k0 = k;
+    std::vector<double> lower (size);
+    expm_multiply(cram_orders[k - 1], A, b, lower.data());
+    for (;; ++k) {
+      expm_multiply(cram_orders[k], A, b, n);
+      double err = cram_rel_diff(lower.data(), n, size) *
+                   cram_order_error(cram_orders[k]) /
+                   cram_order_error(cram_orders[k - 1]);
+      if (err <= tol || k == cram_norders - 1)
+        break;
+      std::copy(n, n + size, lower.begin());
+    }
+    std::chrono::duration<double> dt = std::chrono::steady_clock::now() -
+                                       start;
+    std::lock_guard<std::mutex> lock(adaptive_stats_mutex);
+    adaptive_stats[k].calls++;
+    adaptive_stats[k].escalations += k != k0;
+    adaptive_stats[k].seconds += dt.count();
+  }
+}  // namespace
+
+
+double pyne::transmuters::cram_adaptive_tol() {
+  return adaptive_tol;
+}
+
+
+void pyne::transmuters::set_cram_adaptive_tol(double tol) {
+  if (!(tol > 0.0))
+    throw pyne::ValueError("The CRAM adaptive tolerance must be positive.");
+  adaptive_tol = tol;
+}
+
+
+int pyne::transmuters::cram_adaptive_order(double tol) {
+  for (int k = 0; k < cram_norders - 1; ++k)
+    if (cram_order_error(cram_orders[k]) <= tol)
+      return cram_orders[k];
+  return cram_orders[cram_norders - 1];
+}
+
+
+std::vector<pyne::transmuters::cram_order_stats>
+    pyne::transmuters::cram_adaptive_stats() {
+  std::lock_guard<std::mutex> lock(adaptive_stats_mutex);
+  std::vector<cram_order_stats> stats (cram_norders);
+  for (int k = 0; k < cram_norders; ++k) {
+    stats[k].order = cram_orders[k];
+    stats[k].calls = adaptive_stats[k].calls;
+    stats[k].escalations = adaptive_stats[k].escalations;
+    stats[k].seconds = adaptive_stats[k].seconds;
+  }
+  return stats;
+}
+
+
+void pyne::transmuters::reset_cram_adaptive_stats() {
+  std::lock_guard<std::mutex> lock(adaptive_stats_mutex);
+  std::fill(adaptive_stats, adaptive_stats + cram_norders, adaptive_totals());
+}
+
+
+void pyne::transmuters::cram_inplace(std::vector<double>& A, double* n,
+                                     const int order, double* work) {
+  if ((int) A.size() != pyne_cram_transmute_info.nnz)
+    throw pyne::ValueError("The transmutation matrix must have one entry per"
+                           " nonzero of the CRAM sparsity pattern.");
+  // the solvers accumulate into their output, so they need the initial
+  // condition in a separate buffer
+  std::vector<double> own;
+  if (work == NULL) {
+    own.resize(pyne_cram_transmute_info.n);
+    work = own.data();
+  }
+  double* b = work;
+  std::copy(n, n + pyne_cram_transmute_info.n, b);
+
   // perform decay
-  vector<double> x (pyne_cram_transmute_info.n);
-  switch(order) {
-    case 6:
-      pyne_cram_expm_multiply6(A.data(), b.data(), x.data());
-      break;
-    case 8:
-      pyne_cram_expm_multiply8(A.data(), b.data(), x.data());
-      break;
-    case 10:
-      pyne_cram_expm_multiply10(A.data(), b.data(), x.data());
-      break;
-    case 12:
-      pyne_cram_expm_multiply12(A.data(), b.data(), x.data());
-      break;
+  if (order == CRAM_ADAPTIVE_ORDER)
+    cram_adaptive(A.data(), n, b);
+  else
+    expm_multiply(order, A.data(), b, n);
+}
+
+
+/*** Matrix assembly ***/
+
+namespace {
+  // The entries of the CRAM sparsity pattern, row by row in column order,
+  // with their position in the flat layout.
+  struct ij_pattern {
+    std::vector<int> indptr;
+    std::vector<std::pair<int, int> > entries;  // (column, position)
+  };
+
+  ij_pattern build_ij_pattern() {
+    const int n = pyne_cram_transmute_info.n;
+    const int nnz = pyne_cram_transmute_info.nnz;
+    ij_pattern p;
+    p.indptr.assign(n + 1, 0);
+    for (int k = 0; k < nnz; ++k)
+      p.indptr[pyne_cram_transmute_info.i[k] + 1]++;
+    for (int i = 0; i < n; ++i)
+      p.indptr[i+1] += p.indptr[i];
+    p.entries.resize(nnz);
+    std::vector<int> next (p.indptr.begin(), p.indptr.end() - 1);
+    for (int k = 0; k < nnz; ++k)
+      p.entries[next[pyne_cram_transmute_info.i[k]]++] =
+        std::make_pair(pyne_cram_transmute_info.j[k], k);
+    for (int i = 0; i < n; ++i)
+      std::sort(p.entries.begin() + p.indptr[i],
+                p.entries.begin() + p.indptr[i+1]);
+    return p;
+  }
+
+  // Position of entry (i, j) in the flat layout, or -1.
+  int cram_ij_pos(int i, int j) {
+    static const ij_pattern p = build_ij_pattern();
+    std::vector<std::pair<int, int> >::const_iterator first, last, it;
+    first = p.entries.begin() + p.indptr[i];
+    last = p.entries.begin() + p.indptr[i+1];
+    it = std::lower_bound(first, last, std::make_pair(j, -1));
+    return (it != last && it->first == j) ? it->second : -1;
+  }
+}  // namespace
+
+
+pyne::transmuters::TransmutationBuilder::TransmutationBuilder(
+    const std::vector<int>& parents, const std::vector<int>& children,
+    int ngroups) : ngroups_(ngroups) {
+  if (parents.size() != children.size())
+    throw pyne::ValueError("Each transmutation channel needs a parent and a"
+                           " child.");
+  if (ngroups < 0)
+    throw pyne::ValueError("The number of groups must not be negative.");
+  const NuclideIndex& index = cram_index();
+  diag_.resize(parents.size());
+  gain_.resize(parents.size());
+  for (size_t c = 0; c < parents.size(); ++c) {
+    int p = index.index(parents[c]);
+    if (p < 0)
+      throw pyne::ValueError("Transmutation parent " + pyne::to_str(parents[c])
+                             + " is not in the CRAM transmutation matrix.");
+    int q = index.index(children[c]);
+    if (q == p) {
+      diag_[c] = gain_[c] = -1;
+      continue;
+    }
+    diag_[c] = cram_ij_pos(p, p);
+    gain_[c] = q < 0 ? -1 : cram_ij_pos(q, p);
+    if (diag_[c] < 0 || (0 <= q && gain_[c] < 0))
+      throw pyne::ValueError("The channel " + pyne::to_str(parents[c]) + " -> "
+                             + pyne::to_str(children[c]) + " is not in the"
+                             " CRAM sparsity pattern.");
+  }
+}
+
+pyne::transmuters::TransmutationBuilder::TransmutationBuilder(
+    const rxname::rx_triplets& channels, int ngroups)
+    : TransmutationBuilder(channels.parents, channels.children, ngroups) {}
+
+void pyne::transmuters::TransmutationBuilder::assemble(const double* flux,
+                                                       const double* xs,
+                                                       double t,
+                                                       double* A) const {
+  const int nnz = pyne_cram_transmute_info.nnz;
+  const double* D = pyne_cram_transmute_info.decay_matrix;
+  for (int k = 0; k < nnz; ++k)
+    A[k] = -t * D[k];
+  const double scale = t * pyne::cm2_per_barn;
+  const int nch = nchannels();
+  for (int c = 0; c < nch; ++c) {
+    if (diag_[c] < 0)
+      continue;
+    const double* s = xs + (size_t) c * ngroups_;
+    double r = 0.0;
+    for (int g = 0; g < ngroups_; ++g)
+      r += s[g] * flux[g];
+    r *= scale;
+    A[diag_[c]] -= r;
+    if (0 <= gain_[c])
+      A[gain_[c]] += r;
+  }
+}
+
+std::vector<double> pyne::transmuters::TransmutationBuilder::assemble(
+    const std::vector<double>& flux, const std::vector<double>& xs,
+    double t) const {
+  if ((int) flux.size() != ngroups_ ||
+      xs.size() != (size_t) nchannels() * ngroups_)
+    throw pyne::ValueError("The flux needs one value per group and the cross"
+                           " sections one per group of each channel.");
+  std::vector<double> A (pyne_cram_transmute_info.nnz);
+  assemble(flux.data(), xs.data(), t, A.data());
+  return A;
+}
+
+
+/*** Batched CRAM ***/
+
+namespace {
+  // Poles theta_j and residues alpha_j of the CRAM approximations, one of
+  // each complex conjugate pair, and the limit alpha_0 at infinity:
+  //   exp(A) b ~ alpha_0 b + 2 Re sum_j alpha_j (A - theta_j I)^-1 b
+  const double cram14_theta[7][2] = {
+    {-8.8977731864688888199, 16.630982619902085304},
+    {-3.7032750494234480603, 13.656371871483268171},
+    {-.2087586382501301251, 10.991260561901260913},
+    {3.9933697105785685194, 6.0048316422350373178},
+    {5.0893450605806245066, 3.5888240290270065102},
+    {5.6231425727459771248, 1.1940690463439669766},
+    {2.2697838292311127097, 8.4617379730402214019}};
+  const double cram14_alpha[7][2] = {
+    {-.000071542880635890672853, .00014361043349541300111},
+    {.0094390253107361688779, -.017184791958483017511},
+    {-.37636003878226968717, .33518347029450104214},
+    {-23.498232091082701191, -5.8083591297142074004},
+    {46.933274488831293047, 45.643649768827760791},
+    {-27.875161940145646468, -102.14733999056451434},
+    {4.8071120988325088907, -1.3209793837428723881}};
+  const double cram14_alpha0 = 1.8321743782540412751e-14;
+
+  const double cram16_theta[8][2] = {
+    {-10.843917078696988026, 19.277446167181652284},
+    {-5.2649713434426468895, 16.220221473167927305},
+    {5.9481522689511774808, 3.5874573620183222829},
+    {3.5091036084149180974, 8.4361989858843750826},
+    {6.4161776990994341923, 1.1941223933701386874},
+    {1.4193758971856659786, 10.925363484496722585},
+    {4.9931747377179963991, 5.9968817136039422260},
+    {-1.4139284624888862114, 13.497725698892745389}};
+  const double cram16_alpha[8][2] = {
+    {-.0000005090152186522491565, -.00002422001765285228797},
+    {.00021151742182466030907, .0043892969647380673918},
+    {113.39775178483930527, 101.9472170421585645},
+    {15.059585270023467528, -5.7514052776421819979},
+    {-64.500878025539646595, -224.59440762652096056},
+    {-1.4793007113557999718, 1.7686588323782937906},
+    {-62.518392463207918892, -11.19039109428322848},
+    {.041023136835410021273, -.15743466173455468191}};
+  const double cram16_alpha0 = 2.1248537104952237488e-16;
+
+  // Sparsity pattern of the LU factors of the CRAM transmutation matrix,
+  // factored in matrix order without pivoting, as compressed sparse rows
+  // with sorted columns.
+  struct lu_pattern {
+    std::vector<int> indptr;
+    std::vector<int> indices;
+    std::vector<int> diag;   // position of (i, i)
+    std::vector<int> a_pos;  // position of each entry of the flat matrix
+  };
+
+  lu_pattern build_lu_pattern() {
+    const pyne_cram_transmute_info_t& info = pyne_cram_transmute_info;
+    std::vector<std::set<int> > rows (info.n);
+    for (int i = 0; i < info.n; ++i)
+      rows[i].insert(i);
+    for (int k = 0; k < info.nnz; ++k)
+      rows[info.i[k]].insert(info.j[k]);
+    // row i picks up the upper part of every earlier row it eliminates with;
+    // the columns added are all greater than k, so the walk visits them too
+    for (int i = 0; i < info.n; ++i) {
+      for (std::set<int>::iterator k = rows[i].begin(); *k < i; ++k)
+        rows[i].insert(rows[*k].upper_bound(*k), rows[*k].end());
+    }
+
+    lu_pattern p;
+    p.indptr.push_back(0);
+    p.diag.resize(info.n);
+    for (int i = 0; i < info.n; ++i) {
+      for (std::set<int>::iterator k = rows[i].begin(); k != rows[i].end(); ++k) {
+        if (*k == i)
+          p.diag[i] = (int) p.indices.size();
+        p.indices.push_back(*k);
+      }
+      p.indptr.push_back((int) p.indices.size());
+    }
+    p.a_pos.resize(info.nnz);
+    for (int k = 0; k < info.nnz; ++k) {
+      const int* row = &p.indices[0] + p.indptr[info.i[k]];
+      const int* end = &p.indices[0] + p.indptr[info.i[k] + 1];
+      p.a_pos[k] = (int) (std::lower_bound(row, end, info.j[k]) - &p.indices[0]);
+    }
+    return p;
+  }
+
+  const lu_pattern& cram_lu_pattern() {
+    static const lu_pattern p = build_lu_pattern();
+    return p;
+  }
+}  // namespace
+
+
+pyne::transmuters::CramSolver::CramSolver(const std::vector<double>& A,
+                                          int order) : order_(order) {
+  init();
+  factor(A);
+}
+
+pyne::transmuters::CramSolver::CramSolver(const double* A, int order)
+    : order_(order) {
+  init();
+  factor(A);
+}
+
+void pyne::transmuters::CramSolver::init() {
+  n_ = pyne_cram_transmute_info.n;
+  switch(order_) {
     case 14:
-      pyne_cram_expm_multiply14(A.data(), b.data(), x.data());
+      npoles_ = 7;
+      theta_ = cram14_theta;
+      alpha_ = cram14_alpha;
+      alpha0_ = cram14_alpha0;
       break;
     case 16:
-      pyne_cram_expm_multiply16(A.data(), b.data(), x.data());
-      break;
-    case 18:
-      pyne_cram_expm_multiply18(A.data(), b.data(), x.data());
+      npoles_ = 8;
+      theta_ = cram16_theta;
+      alpha_ = cram16_alpha;
+      alpha0_ = cram16_alpha0;
       break;
     default:
-      throw pyne::ValueError("Order selected not available for CRAM, please use"
-                             " order 6, 8, 10, 12, 14, 16, or 18.");
-      break;
+      // no pole tables: each composition goes through the generated solver
+      check_cram_order(order_);
+      npoles_ = 0;
+      A_.resize(pyne_cram_transmute_info.nnz);
+      return;
+  }
+  const size_t nlu = cram_lu_pattern().indices.size();
+  lu_re_.resize(npoles_ * nlu);
+  lu_im_.resize(npoles_ * nlu);
+  dinv_re_.resize((size_t) npoles_ * n_);
+  dinv_im_.resize((size_t) npoles_ * n_);
+  wr_.resize(n_);
+  wi_.resize(n_);
+}
+
+void pyne::transmuters::CramSolver::factor(const std::vector<double>& A) {
+  if ((int) A.size() != pyne_cram_transmute_info.nnz)
+    throw pyne::ValueError("The transmutation matrix must have one entry per"
+                           " nonzero of the CRAM sparsity pattern.");
+  factor(A.data());
+}
+
+void pyne::transmuters::CramSolver::factor(const double* A) {
+  if (npoles_ == 0) {
+    std::copy(A, A + pyne_cram_transmute_info.nnz, A_.begin());
+    return;
+  }
+  const lu_pattern& p = cram_lu_pattern();
+  const int nnz = pyne_cram_transmute_info.nnz;
+  const int nlu = (int) p.indices.size();
+  double* wr = wr_.data();  // dense copy of the row being eliminated
+  double* wi = wi_.data();
+  for (int j = 0; j < npoles_; ++j) {
+    double* re = &lu_re_[(size_t) j * nlu];
+    double* im = &lu_im_[(size_t) j * nlu];
+    double* dr = &dinv_re_[(size_t) j * n_];
+    double* di = &dinv_im_[(size_t) j * n_];
+    std::fill(re, re + nlu, 0.0);
+    std::fill(im, im + nlu, 0.0);
+    for (int k = 0; k < nnz; ++k)
+      re[p.a_pos[k]] = A[k];
+    for (int i = 0; i < n_; ++i) {
+      re[p.diag[i]] -= theta_[j][0];
+      im[p.diag[i]] -= theta_[j][1];
+    }
+
+    // row by row Doolittle elimination, keeping the inverse of each pivot
+    for (int i = 0; i < n_; ++i) {
+      for (int q = p.indptr[i]; q < p.indptr[i+1]; ++q) {
+        wr[p.indices[q]] = re[q];
+        wi[p.indices[q]] = im[q];
+      }
+      for (int q = p.indptr[i]; q < p.diag[i]; ++q) {
+        int k = p.indices[q];
+        double lr = wr[k] * dr[k] - wi[k] * di[k];
+        double li = wr[k] * di[k] + wi[k] * dr[k];
+        wr[k] = lr;
+        wi[k] = li;
+        for (int r = p.diag[k] + 1; r < p.indptr[k+1]; ++r) {
+          wr[p.indices[r]] -= lr * re[r] - li * im[r];
+          wi[p.indices[r]] -= lr * im[r] + li * re[r];
+        }
+      }
+      for (int q = p.indptr[i]; q < p.indptr[i+1]; ++q) {
+        re[q] = wr[p.indices[q]];
+        im[q] = wi[p.indices[q]];
+      }
+      std::complex<double> d = 1.0 / std::complex<double>(wr[i], wi[i]);
+      dr[i] = d.real();
+      di[i] = d.imag();
+    }
+  }
+}
+
+void pyne::transmuters::CramSolver::apply(const double* B, double* X,
+                                          int nrhs) const {
+  std::vector<double> work (2 * (size_t) n_ * nrhs);
+  apply_block(B, X, nrhs, nrhs, work.data());
+}
+
+void pyne::transmuters::CramSolver::apply_block(const double* B, double* X,
+                                                int ld, int nb,
+                                                double* work) const {
+  if (npoles_ == 0) {
+    double* b = work;
+    double* x = work + n_;
+    for (int r = 0; r < nb; ++r) {
+      for (int i = 0; i < n_; ++i)
+        b[i] = B[(size_t) i * ld + r];
+      if (order_ == CRAM_ADAPTIVE_ORDER)
+        cram_adaptive(A_.data(), x, b);
+      else
+        expm_multiply(order_, A_.data(), b, x);
+      for (int i = 0; i < n_; ++i)
+        X[(size_t) i * ld + r] = x[i];
+    }
+    return;
+  }
+  const lu_pattern& p = cram_lu_pattern();
+  const int nlu = (int) p.indices.size();
+  double* zr = work;
+  double* zi = work + (size_t) n_ * nb;
+
+  for (int i = 0; i < n_; ++i)
+    for (int r = 0; r < nb; ++r)
+      X[(size_t) i * ld + r] = alpha0_ * B[(size_t) i * ld + r];
+
+  for (int j = 0; j < npoles_; ++j) {
+    const double* lr = &lu_re_[(size_t) j * nlu];
+    const double* li = &lu_im_[(size_t) j * nlu];
+    const double* dr = &dinv_re_[(size_t) j * n_];
+    const double* di = &dinv_im_[(size_t) j * n_];
+
+    // forward substitution with the unit lower triangle
+    for (int i = 0; i < n_; ++i) {
+      double* yr = zr + (size_t) i * nb;
+      double* yi = zi + (size_t) i * nb;
+      for (int r = 0; r < nb; ++r) {
+        yr[r] = B[(size_t) i * ld + r];
+        yi[r] = 0.0;
+      }
+      for (int q = p.indptr[i]; q < p.diag[i]; ++q) {
+        const double* xr = zr + (size_t) p.indices[q] * nb;
+        const double* xi = zi + (size_t) p.indices[q] * nb;
+        const double a = lr[q], b = li[q];
+        for (int r = 0; r < nb; ++r) {
+          yr[r] -= a * xr[r] - b * xi[r];
+          yi[r] -= a * xi[r] + b * xr[r];
+        }
+      }
+    }
+    // backward substitution with the upper triangle
+    for (int i = n_ - 1; 0 <= i; --i) {
+      double* yr = zr + (size_t) i * nb;
+      double* yi = zi + (size_t) i * nb;
+      for (int q = p.diag[i] + 1; q < p.indptr[i+1]; ++q) {
+        const double* xr = zr + (size_t) p.indices[q] * nb;
+        const double* xi = zi + (size_t) p.indices[q] * nb;
+        const double a = lr[q], b = li[q];
+        for (int r = 0; r < nb; ++r) {
+          yr[r] -= a * xr[r] - b * xi[r];
+          yi[r] -= a * xi[r] + b * xr[r];
+        }
+      }
+      const double a = dr[i], b = di[i];
+      for (int r = 0; r < nb; ++r) {
+        double t = yr[r];
+        yr[r] = a * t - b * yi[r];
+        yi[r] = a * yi[r] + b * t;
+      }
+    }
+    // X += 2 Re(alpha_j z)
+    const double ar = 2.0 * alpha_[j][0], ai = 2.0 * alpha_[j][1];
+    for (int i = 0; i < n_; ++i)
+      for (int r = 0; r < nb; ++r)
+        X[(size_t) i * ld + r] += ar * zr[(size_t) i * nb + r] -
+                                  ai * zi[(size_t) i * nb + r];
   }
+}
+
+void pyne::transmuters::cram_batch(const std::vector<double>& A,
+                                   const double* B, double* X, int nrhs,
+                                   const int order) {
+  CramSolver solver (A, order);
+  solver.apply(B, X, nrhs);
+}
 
-  // convert back to map
-  map<int, double> n1;
-  for (i=0; i < pyne_cram_transmute_info.n; ++i) {
-    if (x[i] > 0.0) {
-      n1[(pyne_cram_transmute_info.nucids)[i]] = x[i];
+
+std::vector<std::vector<double> > pyne::transmuters::cram_times(
+    const std::vector<double>& A, const std::vector<double>& n0,
+    const std::vector<double>& times, const int order) {
+  const int n = pyne_cram_transmute_info.n;
+  const int nnz = pyne_cram_transmute_info.nnz;
+  if ((int) A.size() != nnz)
+    throw pyne::ValueError("The transmutation matrix must have one entry per"
+                           " nonzero of the CRAM sparsity pattern.");
+  if ((int) n0.size() != n)
+    throw pyne::ValueError("The initial composition must have one entry per"
+                           " nuclide of the CRAM transmutation matrix.");
+  for (size_t k = 0; k < times.size(); ++k)
+    if (!(0.0 <= times[k]))
+      throw pyne::ValueError("CRAM times must not be negative.");
+  check_cram_order(order);
+
+  std::vector<size_t> visit (times.size());
+  for (size_t k = 0; k < visit.size(); ++k)
+    visit[k] = k;
+  std::stable_sort(visit.begin(), visit.end(), [&](size_t a, size_t b) {
+    return times[a] < times[b];
+  });
+
+  // orders 14 and 16 keep their factorization between steps of equal length,
+  // the others go through the generated solvers every step
+  const bool factored = order == 14 || order == 16;
+  std::unique_ptr<CramSolver> solver;
+  std::vector<double> At (nnz);
+  std::vector<double> x (n0), b (n), work (2 * (size_t) n);
+  std::vector<std::vector<double> > rtn (times.size());
+  double t = 0.0;
+  double dt_last = -1.0;
+  for (size_t k = 0; k < visit.size(); ++k) {
+    double dt = times[visit[k]] - t;
+    if (0.0 < dt) {
+      if (dt != dt_last) {
+        for (int q = 0; q < nnz; ++q)
+          At[q] = A[q] * dt;
+        if (factored && solver)
+          solver->factor(At.data());
+        else if (factored)
+          solver.reset(new CramSolver(At, order));
+        dt_last = dt;
+      }
+      if (factored) {
+        std::copy(x.begin(), x.end(), b.begin());
+        solver->apply_block(b.data(), x.data(), 1, 1, work.data());
+      } else {
+        cram_inplace(At, x.data(), order, work.data());
+      }
+      t = times[visit[k]];
     }
+    rtn[visit[k]] = x;
+  }
+  return rtn;
+}
+
+
+/*** Parallel CRAM ***/
+
+namespace {
+  void check_compositions(const std::vector<std::vector<double> >& n0) {
+    for (size_t m = 0; m < n0.size(); ++m)
+      if ((int) n0[m].size() != pyne_cram_transmute_info.n)
+        throw pyne::ValueError("The initial compositions must have one entry"
+                               " per nuclide of the CRAM transmutation matrix.");
   }
-  return n1;
-}
\ No newline at end of file
+}  // namespace
+
+
+void pyne::transmuters::cram_many(
+    const std::vector<std::vector<double> >& A,
+    const std::vector<std::vector<double> >& n0,
+    std::vector<std::vector<double> >& n1, const int order, int nthreads) {
+  if (A.size() != n0.size())
+    throw pyne::ValueError("cram_many needs one transmutation matrix per"
+                           " initial composition.");
+  // checked here rather than by the first solver a worker builds
+  check_cram_order(order);
+  for (size_t m = 0; m < A.size(); ++m)
+    if ((int) A[m].size() != pyne_cram_transmute_info.nnz)
+      throw pyne::ValueError("The transmutation matrix must have one entry per"
+                             " nonzero of the CRAM sparsity pattern.");
+  check_compositions(n0);
+  n1.resize(n0.size());
+  for (size_t m = 0; m < n0.size(); ++m)
+    n1[m].resize(pyne_cram_transmute_info.n);
+
+  // each worker refactors its own solver in place for every material
+  nthreads = pyne::task_threads(nthreads, n0.size());
+  std::vector<std::unique_ptr<CramSolver> > solvers (nthreads);
+  std::vector<std::vector<double> > work (nthreads);
+  pyne::run_tasks(n0.size(), nthreads, [&](size_t m, int w) {
+    if (!solvers[w]) {
+      solvers[w].reset(new CramSolver(A[m], order));
+      work[w].resize(2 * (size_t) pyne_cram_transmute_info.n);
+    } else {
+      solvers[w]->factor(A[m]);
+    }
+    solvers[w]->apply_block(n0[m].data(), n1[m].data(), 1, 1, work[w].data());
+  });
+}
+
+void pyne::transmuters::cram_many(
+    const std::vector<double>& A, const std::vector<std::vector<double> >& n0,
+    std::vector<std::vector<double> >& n1, const int order, int nthreads) {
+  check_compositions(n0);
+  const int n = pyne_cram_transmute_info.n;
+  n1.resize(n0.size());
+  for (size_t m = 0; m < n0.size(); ++m)
+    n1[m].resize(n);
+  if (n0.empty())
+    return;
+
+  // materials go through the shared solver in blocks, gathered into
+  // nuclide-major order so that the solves vectorize across the block
+  const CramSolver solver (A, order);
+  const size_t nblocks = (n0.size() + CRAM_MANY_BLOCK - 1) / CRAM_MANY_BLOCK;
+  nthreads = pyne::task_threads(nthreads, nblocks);
+  const size_t blocklen = (size_t) n * CRAM_MANY_BLOCK;
+  std::vector<std::vector<double> > work (nthreads,
+                                          std::vector<double>(4 * blocklen));
+  pyne::run_tasks(nblocks, nthreads, [&](size_t b, int w) {
+    size_t m0 = b * CRAM_MANY_BLOCK;
+    int nb = (int) std::min((size_t) CRAM_MANY_BLOCK, n0.size() - m0);
+    double* B = work[w].data();
+    double* X = B + blocklen;
+    for (int r = 0; r < nb; ++r)
+      for (int i = 0; i < n; ++i)
+        B[(size_t) i * nb + r] = n0[m0 + r][i];
+    solver.apply_block(B, X, nb, nb, X + blocklen);
+    for (int r = 0; r < nb; ++r)
+      for (int i = 0; i < n; ++i)
+        n1[m0 + r][i] = X[(size_t) i * nb + r];
+  });
+}
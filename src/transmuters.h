@@ -4,6 +4,11 @@
 #include <map>
 #include <vector>
 
+#ifndef PYNE_IS_AMALGAMATED
+#include "nuclide_index.h"
+#include "rxname.h"
+#endif
+
 namespace pyne {
 namespace transmuters {
 
@@ -12,12 +17,227 @@ namespace transmuters {
 /// atom fraction composition map and returns the value.
 /// \param A The transmutation matrix [unitless]
 /// \param n0 The initial compositions [atom fraction]
-/// \param order The order of approximation, default 14.
+/// \param order The order of approximation, default 14, or
+///              CRAM_ADAPTIVE_ORDER.
 /// \return n1 The result of the transmutation [atom fraction]
 std::map<int, double> cram(std::vector<double>& A,
                            const std::map<int, double>& n0,
                            const int order=14);
 
+/// CRAM solver on dense compositions.
+/// \param A The transmutation matrix [unitless]
+/// \param n0 The initial compositions in cram_index() order [atom fraction]
+/// \param order The order of approximation, default 14, or
+///              CRAM_ADAPTIVE_ORDER.
+/// \return n1 The result of the transmutation in cram_index() order
+///         [atom fraction]
+std::vector<double> cram(std::vector<double>& A,
+                         const std::vector<double>& n0,
+                         const int order=14);
+
+/// In-place CRAM solver on a dense composition, which is replaced by its
+/// transmuted value.  Nothing is allocated when \a work is given.
+/// \param A The transmutation matrix [unitless]
+/// \param n The compositions in cram_index() order [atom fraction]
+/// \param order The order of approximation, default 14, or
+///              CRAM_ADAPTIVE_ORDER.
+/// \param work Scratch space for cram_index().size() doubles, or NULL.
+void cram_inplace(std::vector<double>& A, double* n, const int order=14,
+                  double* work=NULL);
+
+/// Order that makes cram() and cram_inplace() pick the order of each solve
+/// themselves.  A solve starts at cram_adaptive_order() of
+/// cram_adaptive_tol() and also solves at the order below it; their
+/// difference, scaled by the ratio of the two orders' errors, estimates the
+/// error of the higher order result.  While that estimate is above the
+/// tolerance the next order up is solved and checked against the last one.
+/// The result is that of the highest order solved, so at least order 8.
+#define CRAM_ADAPTIVE_ORDER 0
+
+/// Relative accuracy that CRAM_ADAPTIVE_ORDER aims for, default 1e-10.
+double cram_adaptive_tol();
+/// Sets the relative accuracy that CRAM_ADAPTIVE_ORDER aims for.  It may be
+/// changed while other threads are solving.
+void set_cram_adaptive_tol(double tol);
+
+/// Tolerance-to-order mapping that CRAM_ADAPTIVE_ORDER starts from: the
+/// lowest CRAM order whose uniform error on the negative real axis, about
+/// 9.28903^-k (Halphen's constant), is within \a tol.  That error is
+/// uniform over the whole axis, z = 0 included, so it does not shrink for
+/// short steps and the mapping depends on \a tol alone; the estimate of
+/// each adaptive solve then decides whether a higher order is needed.
+int cram_adaptive_order(double tol);
+
+/// Cost and use of one order by the CRAM_ADAPTIVE_ORDER solves.
+struct cram_order_stats {
+  int order;         ///< CRAM order
+  long calls;        ///< solves that ended at this order
+  long escalations;  ///< of those, solves that the error estimate stepped up
+  double seconds;    ///< wall time of those solves, all orders included [s]
+};
+
+/// The totals of the CRAM_ADAPTIVE_ORDER solves since the last reset, one
+/// entry per order from 6 to 18.
+std::vector<cram_order_stats> cram_adaptive_stats();
+/// Clears the totals of cram_adaptive_stats().
+void reset_cram_adaptive_stats();
+
+/// The nuclides of the CRAM transmutation matrix, in matrix order.
+const NuclideIndex& cram_index();
+
+/// \brief Assembles flat CRAM transmutation matrices from a multigroup flux.
+///
+/// A builder is set up once for a list of reaction channels, each taking a
+/// parent nuclide to a child, and looks up where every channel lands in the
+/// flat pyne_cram_transmute_info layout.  assemble() then writes
+///
+///   A = t (R - D)
+///
+/// where D is the decay matrix pyne_cram_transmute_info.decay_matrix and
+/// channel c removes the rate r_c = sum_g xs_cg phi_g from its parent's
+/// diagonal and adds it to the (child, parent) entry.  Channels whose child
+/// is not in the matrix are pure losses; channels whose child is the parent
+/// cancel out and are dropped.
+class TransmutationBuilder {
+ public:
+  /// \param parents The parent of each channel, in id form, which must be
+  ///                in cram_index().
+  /// \param children The child of each channel, in id form.
+  /// \param ngroups The number of energy groups.
+  TransmutationBuilder(const std::vector<int>& parents,
+                       const std::vector<int>& children, int ngroups);
+  /// Sets up the channels of rxname::child_triplets(), in its order.
+  TransmutationBuilder(const rxname::rx_triplets& channels, int ngroups);
+
+  int nchannels() const {return (int) diag_.size();};  ///< number of channels
+  int ngroups() const {return ngroups_;};              ///< number of groups
+
+  /// Writes the flat matrix for one flux spectrum to \a A.
+  /// \param flux The group fluxes, ngroups() values [n/cm^2/s]
+  /// \param xs The group cross sections, channel-major: group g of channel
+  ///           c is xs[c*ngroups() + g] [barns]
+  /// \param t The time step [s]
+  /// \param A pyne_cram_transmute_info.nnz entries to write [unitless]
+  void assemble(const double* flux, const double* xs, double t,
+                double* A) const;
+  /// Returns the flat matrix for one flux spectrum, as assemble().
+  std::vector<double> assemble(const std::vector<double>& flux,
+                               const std::vector<double>& xs,
+                               double t=1.0) const;
+
+ private:
+  int ngroups_;
+  std::vector<int> diag_;  // position of the parent's diagonal, or -1
+  std::vector<int> gain_;  // position of the (child, parent) entry, or -1
+};
+
+/// \brief The CRAM approximation of exp(A) for one transmutation matrix,
+/// factored once and applied to any number of compositions.
+///
+/// The constructor LU factors A - theta_j I for each pole theta_j of the
+/// rational approximation, on the sparsity pattern of the CRAM
+/// transmutation matrix plus its fill-in.  apply() then costs a forward and
+/// a backward substitution per pole, done for all right-hand sides at once
+/// with the right-hand side as the innermost, contiguous loop.
+///
+/// Compositions are stored nuclide-major: entry r of nuclide i of a block
+/// of nrhs compositions is at [i*nrhs + r], with nuclides in cram_index()
+/// order.  Orders 14 and 16 are factored.  The other orders of
+/// cram_inplace(), CRAM_ADAPTIVE_ORDER included, have no pole tables here
+/// and solve each composition in turn with the generated solvers, so they
+/// gain nothing from batching; other orders throw pyne::ValueError.
+class CramSolver {
+ public:
+  /// Factors the flat transmutation matrix \a A [unitless].
+  CramSolver(const std::vector<double>& A, int order=14);
+  CramSolver(const double* A, int order=14);
+
+  int order() const {return order_;};  ///< order of approximation
+  int size() const {return n_;};       ///< number of nuclides
+
+  /// Refactors the solver for a new matrix \a A, reusing its storage.
+  void factor(const std::vector<double>& A);
+  void factor(const double* A);
+
+  /// Sets X = exp(A) B for the \a nrhs compositions in \a B.
+  void apply(const double* B, double* X, int nrhs) const;
+
+  /// Applies exp(A) to the \a nb columns of B and X that start at the given
+  /// pointers, whose rows are \a ld apart, using 2*size()*nb doubles of
+  /// \a work.  Nothing is allocated.
+  void apply_block(const double* B, double* X, int ld, int nb,
+                   double* work) const;
+
+ private:
+  void init();
+
+  int order_;
+  int n_;
+  int npoles_;
+  const double (*theta_)[2];  // poles
+  const double (*alpha_)[2];  // residues of the poles
+  double alpha0_;
+  std::vector<double> lu_re_, lu_im_;      // factors, one block per pole
+  std::vector<double> dinv_re_, dinv_im_;  // inverse U diagonals per pole
+  std::vector<double> wr_, wi_;            // row scratch for factor()
+  std::vector<double> A_;  // the matrix, for orders without pole tables
+};
+
+/// Transmutes \a nrhs compositions with the same matrix.
+/// \param A The transmutation matrix [unitless]
+/// \param B The initial compositions, nuclide-major in cram_index() order:
+///          entry r of nuclide i is B[i*nrhs + r] [atom fraction]
+/// \param X The results, laid out as \a B [atom fraction]
+/// \param nrhs The number of compositions.
+/// \param order The order of approximation, default 14; see CramSolver.
+void cram_batch(const std::vector<double>& A, const double* B, double* X,
+                int nrhs, const int order=14);
+
+/// Transmutes one composition to each of several times with the matrix of
+/// a unit time step.  The times are visited in increasing order, each
+/// starting from the composition at the one before, so a step only costs
+/// the span since the previous time.  Steps of the same length reuse the
+/// factorization of the last one, and all buffers are allocated once.
+/// \param A The transmutation matrix for a unit time [unitless]
+/// \param n0 The initial composition in cram_index() order [atom fraction]
+/// \param times The times to evaluate at, in the units of \a A, which need
+///              not be sorted and may repeat.
+/// \param order The order of approximation, default 14, or
+///              CRAM_ADAPTIVE_ORDER to choose it for each step.
+/// \return The composition at each of \a times, in the order given
+///         [atom fraction]
+std::vector<std::vector<double> > cram_times(const std::vector<double>& A,
+                                             const std::vector<double>& n0,
+                                             const std::vector<double>& times,
+                                             const int order=14);
+
+/// Number of compositions that cram_many() solves together when they share
+/// a matrix.
+#define CRAM_MANY_BLOCK 16
+
+/// Transmutes many materials in parallel, each with its own matrix.
+/// Materials are handed out to the threads one at a time, and each thread
+/// refactors a single solver in place, so nothing is allocated per material.
+/// \param A The transmutation matrix of each material [unitless]
+/// \param n0 The initial composition of each material, in cram_index()
+///           order [atom fraction]
+/// \param n1 Set to the results, one per material [atom fraction]
+/// \param order The order of approximation, default 14.  Orders other than
+///              14 and 16 run without factoring, see CramSolver; an order
+///              that is not available throws before any work starts.
+/// \param nthreads The number of threads, or 0 for one per core.
+void cram_many(const std::vector<std::vector<double> >& A,
+               const std::vector<std::vector<double> >& n0,
+               std::vector<std::vector<double> >& n1,
+               const int order=14, int nthreads=0);
+
+/// Transmutes many materials in parallel with one shared matrix, factored
+/// once.  The materials are solved in blocks of CRAM_MANY_BLOCK.
+void cram_many(const std::vector<double>& A,
+               const std::vector<std::vector<double> >& n0,
+               std::vector<std::vector<double> >& n1,
+               const int order=14, int nthreads=0);
+
 } // namespace transmuters
 } // namespace pyne
 #endif // PYNE_DQKIQSJ4SNG7VAB5LX36BLIYMA
\ No newline at end of file
@@ -3,6 +3,14 @@
 extern "C" double endftod_(char *str, int len);
 #endif
 #include <iomanip>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 #ifndef PYNE_IS_AMALGAMATED
 #include "utils.h"
@@ -410,6 +418,129 @@ void pyne::warning(std::string s){
   }
 }
 
+// Threading Helpers
+
+int pyne::task_threads(int nthreads, size_t ntasks) {
+  if (nthreads <= 0)
+    nthreads = std::max(1u, std::thread::hardware_concurrency());
+  return (int) std::max((size_t) 1, std::min((size_t) nthreads, ntasks));
+}
+
+namespace {
+  // One run_tasks() call: its tasks and the helper threads working on them.
+  // taken and active are guarded by the pool mutex.
+  struct task_job {
+    const std::function<void(size_t, int)>* task;
+    size_t ntasks;
+    std::atomic<size_t> next;
+    int nslots;  // helpers the job can use, worker indices 1 to nslots
+    int taken;   // helpers that joined it so far
+    int active;  // helpers still running its tasks
+    std::mutex error_mutex;
+    std::exception_ptr error;
+  };
+
+  // Claims and runs tasks of job as worker w until none are left.
+  void run_job(task_job& job, int w) {
+    for (size_t t = job.next++; t < job.ntasks; t = job.next++) {
+      try {
+        (*job.task)(t, w);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(job.error_mutex);
+        if (!job.error)
+          job.error = std::current_exception();
+        job.next = job.ntasks;
+      }
+    }
+  }
+
+  int current_pid() {
+#ifndef _WIN32
+    return (int) getpid();
+#else
+    return 0;
+#endif
+  }
+
+  // Helper threads shared by every run_tasks() call.  They are started on
+  // first use, added to when a call asks for more, and then wait for jobs
+  // for the life of the process.
+  struct task_pool {
+    task_pool() : pid(current_pid()), nhelpers(0) {};
+    int pid;       // process the helpers were started in
+    int nhelpers;
+    std::mutex mutex;
+    std::condition_variable wake;  // a job was queued
+    std::condition_variable done;  // a helper left its job
+    std::deque<task_job*> jobs;    // jobs with helper slots still open
+  };
+
+  void helper_loop(task_pool* pool) {
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    for (;;) {
+      pool->wake.wait(lock, [pool]() {return !pool->jobs.empty();});
+      task_job* job = pool->jobs.front();
+      int w = ++job->taken;
+      ++job->active;
+      if (job->taken == job->nslots)
+        pool->jobs.pop_front();
+      lock.unlock();
+      run_job(*job, w);
+      lock.lock();
+      if (--job->active == 0)
+        pool->done.notify_all();
+    }
+  }
+
+  // The pool, with at least nhelpers helpers.  It is never destroyed, so
+  // that exit does not wait on idle helpers; a child process forked from a
+  // process with a pool, which has none of its threads, starts its own.
+  task_pool& get_task_pool(int nhelpers) {
+    static std::mutex pool_mutex;
+    static task_pool* pool = NULL;
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    if (pool == NULL || pool->pid != current_pid())
+      pool = new task_pool();
+    std::lock_guard<std::mutex> pool_lock(pool->mutex);
+    for (; pool->nhelpers < nhelpers; ++pool->nhelpers)
+      std::thread(helper_loop, pool).detach();
+    return *pool;
+  }
+}  // namespace
+
+void pyne::run_tasks(size_t ntasks, int nthreads,
+                     const std::function<void(size_t, int)>& task) {
+  nthreads = task_threads(nthreads, ntasks);
+  task_job job;
+  job.task = &task;
+  job.ntasks = ntasks;
+  job.next = 0;
+  job.nslots = nthreads - 1;
+  job.taken = 0;
+  job.active = 0;
+  if (nthreads == 1) {
+    run_job(job, 0);
+  } else {
+    task_pool& pool = get_task_pool(nthreads - 1);
+    {
+      std::lock_guard<std::mutex> lock(pool.mutex);
+      pool.jobs.push_back(&job);
+    }
+    pool.wake.notify_all();
+    run_job(job, 0);
+    // close the job to helpers that have not joined yet, then wait for the
+    // ones that did to finish their last task
+    std::unique_lock<std::mutex> lock(pool.mutex);
+    std::deque<task_job*>::iterator it = std::find(pool.jobs.begin(),
+                                                   pool.jobs.end(), &job);
+    if (it != pool.jobs.end())
+      pool.jobs.erase(it);
+    pool.done.wait(lock, [&job]() {return job.active == 0;});
+  }
+  if (job.error)
+    std::rethrow_exception(job.error);
+}
+
 
 
 
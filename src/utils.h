@@ -24,6 +24,7 @@
 #include <cstdlib>
 #include <vector>
 #include <algorithm>
+#include <functional>
 
 #if (__GNUC__ >= 4)
   #include <cmath>
@@ -156,6 +157,24 @@ namespace pyne {
   /// Prints a warning message.
   void warning(std::string s);
 
+  // Threading Helpers
+  /// Number of threads to run \a ntasks tasks on when \a nthreads are asked
+  /// for: every hardware thread if \a nthreads <= 0, and at least one but
+  /// never more than there are tasks.
+  int task_threads(int nthreads, size_t ntasks);
+
+  /// Runs task(t, w) for t in [0, ntasks) on task_threads(nthreads, ntasks)
+  /// threads: the calling one and helpers from a process-wide pool that is
+  /// started on first use and kept afterwards, so repeated calls do not
+  /// create threads.  w is the index of the worker running a task, unique
+  /// within the call.  Tasks are claimed one at a time from a shared
+  /// counter, so workers that finish early keep taking work, and the caller
+  /// runs every task itself if no helper is free.  Once a task throws no
+  /// new tasks are started, and the first exception is rethrown after all
+  /// workers are done.
+  void run_tasks(size_t ntasks, int nthreads,
+                 const std::function<void(size_t, int)>& task);
+
   /// Custom exception to be thrown in the event that a required file is not able to
   /// be found.
   class FileNotFound : public std::exception
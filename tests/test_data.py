@@ -1,10 +1,15 @@
 """PyNE nuclear data tests"""
 import os
+import sys
+import json
 import math
+import struct
+import subprocess
 import warnings
 
 import nose
-from nose.tools import assert_equal, assert_in, assert_true
+from nose.tools import assert_equal, assert_not_equal, assert_in, assert_true, \
+    assert_false, assert_raises
 import numpy as np
 import numpy.testing as npt
 
@@ -41,10 +46,12 @@ def test_natural_abund_excited_state():
     gnd = 902320000
     excited = gnd + 1
     data.natural_abund(gnd)
-    # excited state should not be in the map yet
+    # excited state should not be in the map
     assert_equal(data.natural_abund_map.get(excited), None)
     nabund = data.natural_abund(excited)
-    assert_equal(nabund, data.natural_abund_map.get(excited))
+    # the ground state guess is computed without modifying the map
+    assert_equal(nabund, data.natural_abund(gnd))
+    assert_equal(data.natural_abund_map.get(excited), None)
 
 
 def test_q_val():
@@ -66,6 +73,13 @@ def test_simple_xs():
     assert_equal(data.simple_xs(922350000, 'tot', 'fission_spectrum_ave'), 7.705)
 
 
+def test_simple_xs_array():
+    nucs = ['H1', 'U235', 'O16']
+    obs = data.simple_xs_array(nucs, 'gamma', 'thermal')
+    exp = [data.simple_xs(nuc, 'gamma', 'thermal') for nuc in nucs]
+    npt.assert_array_equal(obs, exp)
+
+
 def test_gamma_frac():
     assert_equal(data.gamma_frac('H1'), 0.0)
     assert_equal(data.gamma_frac(92235), 0.036)
@@ -122,6 +136,19 @@ def test_nds_fpyield():
     assert_equal(data.fpyield('Th-232', 'Eu-154', 3, True), 9.3e-08)
 
 
+def test_fpyield_matrix():
+    fpy = data.fpyield_matrix('NDS_14MEV')
+    i = list(fpy['parents']).index(nucname.id('Th-232'))
+    row = slice(fpy['indptr'][i], fpy['indptr'][i+1])
+    j = list(fpy['children'][row]).index(nucname.id('Eu-154'))
+    assert_equal(fpy['values'][row][j], 2.79e-07)
+    # the product index points back at the same entry
+    k = list(fpy['products']).index(nucname.id('Eu-154'))
+    col = slice(fpy['product_indptr'][k], fpy['product_indptr'][k+1])
+    p = list(fpy['product_parents'][col]).index(nucname.id('Th-232'))
+    assert_equal(fpy['values'][fpy['entry_of'][col][p]], 2.79e-07)
+
+
 def test_half_life():
     assert_equal(data.half_life('H1'), np.inf)
     assert_equal(data.half_life(922350001), 1560.0)
@@ -527,5 +554,97 @@ def test_special_children():
         assert_equal(set(data.decay_data_children(nucname.id_to_state_id(item))),
                      special_children[item])
 
+def test_write_data_snapshot():
+    fname = 'test_nuc_data.snapshot'
+    data.write_data_snapshot(fname)
+    with open(fname, 'rb') as f:
+        magic = f.read(8)
+    os.remove(fname)
+    assert_equal(magic, b'PYNESNP\x00')
+
+# Lookups run both against nuc_data.h5 in this process and against a loaded
+# snapshot in a fresh one, since a snapshot must be loaded before first use.
+SNAPSHOT_LOOKUPS = """
+import json, sys, warnings
+from pyne.utils import QAWarning
+warnings.simplefilter('ignore', QAWarning)
+from pyne import data
+if len(sys.argv) > 1:
+    data.load_data_snapshot(sys.argv[1])
+nucs = ['H1', 'O16', 'Co60', 'Cs137', 'U235', 'U238', 'Am242M', 'Pu239']
+out = {}
+for nuc in nucs:
+    out[nuc] = [data.atomic_mass(nuc), data.half_life(nuc),
+                data.decay_const(nuc), sorted(data.decay_children(nuc)),
+                data.gamma_energy(nuc), data.gamma_photon_intensity(nuc)]
+out['loaded'] = data.data_snapshot_loaded()
+print(json.dumps(out))
+"""
+
+def _snapshot_lookups(*args):
+    p = subprocess.Popen([sys.executable, '-c', SNAPSHOT_LOOKUPS] + list(args),
+                         stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    out, err = p.communicate()
+    return p.returncode, out.decode(), err.decode()
+
+def test_data_snapshot_lookups():
+    fname = 'test_nuc_data_lookups.snapshot'
+    data.write_data_snapshot(fname)
+    try:
+        rtn, out, err = _snapshot_lookups(fname)
+    finally:
+        os.remove(fname)
+    assert_equal(rtn, 0, err)
+    obs = json.loads(out)
+    rtn, out, err = _snapshot_lookups()
+    assert_equal(rtn, 0, err)
+    exp = json.loads(out)
+    assert_true(obs.pop('loaded'))
+    assert_false(exp.pop('loaded'))
+    assert_equal(set(obs), set(exp))
+    for nuc in exp:
+        npt.assert_equal(obs[nuc], exp[nuc], nuc)
+
+def test_data_snapshot_corrupt():
+    fname = 'test_nuc_data_corrupt.snapshot'
+    data.write_data_snapshot(fname)
+    try:
+        with open(fname, 'r+b') as f:
+            f.seek(-1, os.SEEK_END)
+            last = f.read(1)
+            f.seek(-1, os.SEEK_END)
+            f.write(b'\x00' if last != b'\x00' else b'\x01')
+        rtn, out, err = _snapshot_lookups(fname)
+    finally:
+        os.remove(fname)
+    assert_not_equal(rtn, 0)
+    assert_in('failed its checksum', err)
+
+def test_data_snapshot_stale():
+    fname = 'test_nuc_data_stale.snapshot'
+    data.write_data_snapshot(fname)
+    try:
+        # the source modification time lives at byte 48 of the header,
+        # outside of the checksummed payload
+        with open(fname, 'r+b') as f:
+            f.seek(48)
+            mtime, = struct.unpack('q', f.read(8))
+            f.seek(48)
+            f.write(struct.pack('q', mtime - 1))
+        rtn, out, err = _snapshot_lookups(fname)
+    finally:
+        os.remove(fname)
+    assert_not_equal(rtn, 0)
+    assert_in('was written from a different', err)
+
+def test_preload_data():
+    stats = data.preload_data(['atomic_mass', 'decay'])
+    assert_equal([s['table'] for s in stats], ['atomic_mass', 'decay'])
+    for s in stats:
+        assert_true(s['loaded'])
+        assert_true(s['bytes'] > 0)
+    assert_true(data.data_load_info('decay')['loaded'])
+    assert_raises(RuntimeError, data.preload_data, ['not_a_table'])
+
 if __name__ == "__main__":
     nose.runmodule()
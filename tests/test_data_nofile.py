@@ -43,10 +43,12 @@ def test_natural_abund_excited_state():
     gnd = 902320000
     excited = gnd + 42
     data.natural_abund(gnd)
-    # excited state should not be in the map yet
+    # excited state should not be in the map
     assert_true(excited not in data.natural_abund_map)
     nabund = data.natural_abund(excited)
-    assert_equal(nabund, data.natural_abund_map.get(excited))
+    # the ground state guess is computed without modifying the map
+    assert_equal(nabund, data.natural_abund(gnd))
+    assert_true(excited not in data.natural_abund_map)
     pyne_conf.NUC_DATA_PATH = orig
 
 
@@ -13,7 +13,7 @@ from pyne.utils import QAWarning
 warnings.simplefilter("ignore", QAWarning)
 from pyne import nuc_data
 from pyne.material import Material, from_atom_frac, from_hdf5, from_text, \
-    MapStrMaterial, MultiMaterial, MaterialLibrary
+    MapStrMaterial, MultiMaterial, MaterialLibrary, decay_many
 from pyne import jsoncpp
 from pyne import data
 from pyne import nucname
@@ -2019,6 +2019,62 @@ def test_decay_h3():
     assert_almost_equal(0.5, obs[nucname.id('H3')])
     assert_almost_equal(0.5, obs[nucname.id('He3')])
 
+def test_decay_times_h3():
+    mat = Material({'H3': 1.0})
+    hl = data.half_life('H3')
+    obs = mat.decay_times([2*hl, 0.0, hl])
+    assert_equal(3, len(obs))
+    for t, o in zip([2*hl, 0.0, hl], obs):
+        exp = mat.decay(t).to_atom_frac()
+        o = o.to_atom_frac()
+        for nuc in exp:
+            assert_almost_equal(exp[nuc], o[nuc])
+    assert_almost_equal(0.25, obs[0].to_atom_frac()[nucname.id('H3')])
+
+def test_dense_round_trip():
+    mat = Material({'H1': 0.1, 'O16': 0.6, 'U235': 0.05, 'U238': 0.25}, 42.0)
+    idx = nucname.NuclideIndex(['U238', 'H1', 'Pu239', 'O16', 'U235'])
+    x = mat.to_dense(idx)
+    assert_equal(len(x), 5)
+    assert_equal(x[2], 0.0)
+    for i, nuc in enumerate(idx.nucs):
+        assert_equal(x[i], mat.comp.get(nuc, 0.0))
+    obs = Material()
+    obs.from_dense(idx, x)
+    exp = Material(dict(mat.comp))
+    assert_equal(set(obs.comp.keys()), set(exp.comp.keys()))
+    for nuc in exp:
+        assert_almost_equal(exp[nuc], obs[nuc])
+
+    af = mat.to_atom_frac()
+    afx = mat.to_atom_frac_dense(idx)
+    for i, nuc in enumerate(idx.nucs):
+        assert_almost_equal(afx[i], af.get(nuc, 0.0))
+    obs = Material()
+    obs.from_atom_frac_dense(idx, afx)
+    exp = Material()
+    exp.from_atom_frac(dict(af))
+    assert_almost_equal(exp.atoms_per_molecule, obs.atoms_per_molecule)
+    assert_equal(set(obs.comp.keys()), set(exp.comp.keys()))
+    for nuc in exp:
+        assert_almost_equal(exp[nuc], obs[nuc])
+    assert_raises(RuntimeError, obs.from_dense, idx, x[:3])
+
+def test_decay_many():
+    mats = [Material({'H3': 1.0}), Material({'H3': 0.5, 'He4': 0.5}, 3.0)]
+    hl = data.half_life('H3')
+    obs = decay_many(mats, hl, nthreads=2)
+    assert_equal(2, len(obs))
+    for mat, o in zip(mats, obs):
+        exp = mat.decay(hl)
+        assert_almost_equal(exp.mass, o.mass)
+        for nuc in exp:
+            assert_almost_equal(exp[nuc], o[nuc])
+    obs = decay_many(mats, [0.0, hl])
+    assert_equal(2, len(obs))
+    assert_equal(2, len(obs[1]))
+    assert_almost_equal(0.5, obs[0][1].to_atom_frac()[nucname.id('H3')])
+
 def test_decay_u235_h3():
     mat = Material({'U235': 1.0, 'H3': 1.0})
     obs = mat.decay(365.25 * 24.0 * 3600.0)
@@ -2156,6 +2212,18 @@ def test_cram_h3():
     assert_almost_equal(0.5, obs[nucname.id('He3')])
 
 
+def test_cram_h3_steps():
+    mat = Material({'H3': 1.0}, mass=2.0)
+    A = -cram.DECAY_MATRIX * data.half_life('H3')
+    obs = mat.cram(A).cram(A)
+    assert_almost_equal(0.25, obs.to_atom_frac()[nucname.id('H3')])
+    # editing the composition between steps is seen by the next one
+    obs.comp[nucname.id('H3')] = 0.0
+    obs = obs.cram(A).to_atom_frac()
+    assert_almost_equal(0.0, obs.get(nucname.id('H3'), 0.0))
+    assert_almost_equal(1.0, obs[nucname.id('He3')])
+
+
 # Run as script
 #
 if __name__ == "__main__":
@@ -4,6 +4,8 @@ from unittest import TestCase
 import nose
 import warnings
 
+import numpy as np
+
 from nose.tools import assert_equal, assert_not_equal, assert_raises, raises, assert_in, \
     assert_true, assert_false
 
@@ -125,6 +127,44 @@ def test_id():
 
     assert_raises(RuntimeError, nucname.id, '0-H-1')
 
+def _id_or_error(f, nuc):
+    try:
+        return f(nuc)
+    except Exception as e:
+        return type(e)
+
+def check_id_matches_general(nucs):
+    for nuc in nucs:
+        assert_equal(_id_or_error(nucname.id, nuc),
+                     _id_or_error(nucname._id_general, nuc))
+
+def test_id_matches_general():
+    # the fast string parser must agree with the general one on every form,
+    # including the inputs it hands back to the general parser
+    symbols = sorted(nucname.name_zz.keys()) + ['Xx', 'Q']
+    for sym in symbols:
+        nucs = []
+        for s in (sym, sym.upper(), sym.lower()):
+            nucs += [s, s + '-', '-' + s]
+            for a in range(301):
+                for m in ('', 'm', 'M', 'm2', 'X'):
+                    nucs += [s + str(a) + m, s + '-' + str(a) + m,
+                             str(a) + s + m, str(a) + '-' + s + m]
+            nucs += [s + '00235', s + '123456', '1234567' + s]
+        yield check_id_matches_general, nucs
+    nucs = []
+    for z in range(1, 119):
+        for a in range(0, 300, 7):
+            nucs += ['{0}-{1}-{2}'.format(z, nucname.zz_name[z], a),
+                     '{0}-{1}-{2}m'.format(z, nucname.zz_name[z], a)]
+    yield check_id_matches_general, nucs
+    nucs = ['-', '--', '0', '1', '92', '92235', '95642', '922350', '922350001',
+            '9223500000', '12345678901234', 'a', '1a', 'u 235', 'U$235',
+            '1-2-3', 'U-2-35', 'U-23-5', 'm', 'M', '235m', 'UM', 'U1M2',
+            '-92235', '+92235', ' 92235', 'U235 ']
+    nucs += [str(i) for i in range(0, 2000000, 97)]
+    yield check_id_matches_general, nucs
+
 def test_name():
     assert_equal(nucname.name(942390), "Pu239")
     assert_equal(nucname.name(952421), "Am242M")
@@ -351,6 +391,7 @@ def test_fluka():
     assert_equal(nucname.fluka( 280000000), 'NICKEL')
     assert_equal(nucname.fluka(1140000000), 'UNUNQUAD')
     assert_not_equal(nucname.fluka(1140000000), 'UNUNQUA')
+    assert_equal(nucname.fluka(  30000000), 'LITHIUM')
 
 def test_fluka_to_id():
     assert_equal(nucname.fluka_to_id('BERYLLIU'),40000000)
@@ -574,12 +615,98 @@ def test_id_to_state_id():
     assert_equal(nucname.id_to_state_id(270590001), None)  # Co59M doesn't exist
 
 
+def test_state_id_arrays():
+    assert_equal(list(nucname.id_to_state_id_array([190380002, 270590001,
+                                                    922350000])),
+                 [190380015, -1, 922350000])
+    assert_equal(list(nucname.state_id_to_id_array([190380015, 922350000])),
+                 [190380002, 922350000])
+
+
 def test_ensdf_to_id():
     assert_equal(nucname.ensdf_to_id('16O'), 80160000)
     assert_equal(nucname.ensdf_to_id('28614'), 1142860000)
     assert_equal(nucname.ensdf_to_id('269Hs'), 1082690000)
 
 
+def test_bulk_conversions():
+    nucs = ['U235', 'U235', 'Am242M', 10010000, 'he4']
+    ids = nucname.id_array(nucs[:3] + ['H1', 'He4'])
+    assert_equal(ids.dtype, np.int32)
+    assert_equal(list(ids), [nucname.id(n) for n in nucs])
+    assert_equal(list(nucname.id_array(np.array(ids, dtype=np.int64))),
+                 list(ids))
+    for bulk, single in [(nucname.name_array, nucname.name),
+                         (nucname.zzaaam_array, nucname.zzaaam),
+                         (nucname.zzzaaa_array, nucname.zzzaaa),
+                         (nucname.mcnp_array, nucname.mcnp),
+                         (nucname.cinder_array, nucname.cinder),
+                         (nucname.serpent_array, nucname.serpent),
+                         (nucname.openmc_array, nucname.openmc)]:
+        assert_equal(list(bulk(ids)), [single(int(n)) for n in ids])
+    assert_equal(list(nucname.fluka_array([10010000])), ['HYDROG-1'])
+    assert_equal(len(nucname.name_array([])), 0)
+    assert_raises(RuntimeError, nucname.id_array, ['U235', 'Qq1'])
+
+
+def test_nuclide_index():
+    nucs = ['U235', 'H1', 'Am242M', 80160000]
+    idx = nucname.NuclideIndex(nucs)
+    ids = [nucname.id(n) for n in nucs]
+    assert_equal(len(idx), 4)
+    assert_equal(list(idx.nucs), ids)
+    for i, nuc in enumerate(ids):
+        assert_equal(idx.index(nuc), i)
+        assert_equal(idx.nuc(i), nuc)
+        assert_in(nuc, idx)
+    assert_equal(idx.index('U235'), 0)
+    assert_equal(idx.index('U238'), -1)
+    assert_equal(idx.index(952420000), -1)
+    assert_false('U238' in idx)
+    assert_raises(IndexError, idx.nuc, 4)
+    assert_equal(len(nucname.NuclideIndex()), 0)
+
+
+def test_nuclide_index_duplicates():
+    assert_raises(RuntimeError, nucname.NuclideIndex, ['U235', 'H1', 'U235'])
+    assert_raises(RuntimeError, nucname.NuclideIndex, [10010000, 'H1'])
+
+
+def test_nuclide_index_negative():
+    idx = nucname.NuclideIndex([10010000, -1, 20040000, -5])
+    assert_equal(len(idx), 4)
+    assert_equal(list(idx.nucs), [10010000, -1, 20040000, -5])
+    assert_equal(idx.index(20040000), 2)
+    assert_equal(idx.index(-1), -1)
+    assert_equal(idx.index(-5), -1)
+    assert_false(-1 in idx)
+    assert_equal(idx.to_map([1.0, 2.0, 3.0, 4.0]), {10010000: 1.0, 20040000: 3.0})
+    # negative entries never take part in a mapping
+    other = nucname.NuclideIndex([-1, 20040000])
+    assert_equal(list(idx.map_to(other)), [-1, -1, 1, -1])
+
+
+def test_nuclide_index_map_to():
+    a = nucname.NuclideIndex(['H1', 'He4', 'U235', 'U238'])
+    b = nucname.NuclideIndex(['U238', 'Pu239', 'H1'])
+    assert_equal(list(a.map_to(b)), [2, -1, -1, 0])
+    assert_equal(list(b.map_to(a)), [3, -1, 0])
+    assert_equal(list(a.map_to(a)), [0, 1, 2, 3])
+    assert_equal(list(a.map_to(nucname.NuclideIndex())), [-1, -1, -1, -1])
+
+
+def test_nuclide_index_dense():
+    idx = nucname.NuclideIndex(['H1', 'He4', 'U235'])
+    x = idx.to_dense({'U235': 0.5, 10010000: 0.25, 'Pu239': 1.0})
+    assert_equal(x.dtype, np.float64)
+    assert_equal(list(x), [0.25, 0.0, 0.5])
+    assert_equal(idx.to_map(x), {10010000: 0.25, 922350000: 0.5})
+    assert_equal(idx.to_map(x, keep_zeros=True),
+                 {10010000: 0.25, 20040000: 0.0, 922350000: 0.5})
+    assert_equal(idx.to_map([0.0, -1.0, 2.0]), {922350000: 2.0})
+    assert_raises(ValueError, idx.to_map, [1.0, 2.0])
+
+
 if __name__ == "__main__":
     nose.runmodule()
 
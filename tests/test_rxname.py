@@ -9,6 +9,7 @@ from nose.tools import assert_equal, assert_not_equal, assert_raises, raises, \
 
 from pyne.utils import QAWarning
 warnings.simplefilter("ignore", QAWarning)
+from pyne import nucname
 from pyne import rxname
 
 if sys.version_info[0] > 2:
@@ -252,6 +253,80 @@ def test_no_id_mt_clash():
     badids = [rxid for rxid in rxname.id_name if rxid < 1000]
     assert_equal(0, len(badids))
 
+# entries of the reaction maps before they were generated from tables
+BASELINE_ALTNAMES = [
+    ('*', 'excited'), ('14c', 'decay_14c'), ('2b+', 'decay_2bplus'),
+    ('2b-', 'decay_2bminus'), ('2ec', 'decay_2ec'), ('2n', 'z_2n'),
+    ('2p', 'z_2p'), ('3HE', 'He3'), ('3He', 'He3'), ('3h', 't'),
+    ('3he', 'He3'), ('HE-3', 'He3'), ('HE3', 'He3'), ('abs', 'absorption'),
+    ('alpha', 'a'), ('b+', 'bplus'), ('b+2p', 'bplus_2p'),
+    ('b+3p', 'bplus_3p'), ('b+a', 'bplus_a'), ('b+p', 'bplus_p'),
+    ('b-', 'bminus'), ('b-2n', 'bminus_2n'), ('b-3n', 'bminus_3n'),
+    ('b-4n', 'bminus_4n'), ('b-a', 'bminus_a'), ('b-n', 'bminus_n'),
+    ('b-p', 'bminus_p'), ('b-sf', 'bminus_sf'), ('deut', 'd'),
+    ('deuterium', 'd'), ('deuteron', 'd'), ('e', 'elastic'),
+    ('ec+b+', 'ec_bplus'), ('ec2p', 'ec_2p'), ('ec3p', 'ec_3p'),
+    ('elas', 'elastic'), ('fis', 'fission'), ('fiss', 'fission'), ('g', 'it'),
+    ('h', 'He3'), ('he-3', 'He3'), ('he3', 'He3'), ('i', 'n'), ('inel', 'n'),
+    ('inelastic', 'n'), ('proton', 'p'), ('s', 'scattering'),
+    ('scat', 'scattering'), ('tot', 'total'), ('trit', 't'), ('tritium', 't'),
+    ('triton', 't'),
+    ]
+
+BASELINE_MTS = [
+    (1, 'total'), (22, 'na'), (37, 'z_4n'), (57, 'n_7'), (70, 'n_20'),
+    (83, 'n_33'), (105, 't'), (201, 'n_total'), (214, 'kaon0_long'),
+    (310, 'erel_continuum'), (328, 'erel_np'), (345, 'erel_npa'),
+    (362, 'erel_n_12'), (375, 'erel_n_25'), (388, 'erel_n_38'),
+    (411, 'erel_2p'), (457, 'decay'), (522, 'absorption_photoelectric'),
+    (541, 'm4_photoelectric'), (554, 'o5_photoelectric'),
+    (567, 'p9_photoelectric'), (607, 'p_7'), (620, 'p_20'), (633, 'p_33'),
+    (646, 'p_46'), (659, 'd_9'), (672, 'd_22'), (685, 'd_35'), (698, 'd_48'),
+    (711, 't_11'), (724, 't_24'), (737, 't_37'), (750, 'He3_0'),
+    (763, 'He3_13'), (776, 'He3_26'), (789, 'He3_39'), (802, 'a_2'),
+    (815, 'a_15'), (828, 'a_28'), (841, 'a_41'),
+    ]
+
+BASELINE_NAMES = [
+    'He3', 'He3_21', 'He3_35', 'He3_5', 'a_15', 'a_29', 'a_42',
+    'absorption_photoelectric', 'bplus_a', 'd_17', 'd_30', 'd_44',
+    'decay_14c', 'erel_2n', 'erel_d', 'erel_n3a', 'erel_n_20', 'erel_n_34',
+    'erel_nd', 'excited', 'it', 'misc', 'nHe3', 'n_19', 'n_32', 'n_continuum',
+    'np_2', 'o5_photoelectric', 'p8_photoelectric', 'p_20', 'p_34', 'p_48',
+    'photon_incoherent', 'stopping_power', 't_2', 't_33', 't_47', 'z_2n_1',
+    'z_3np',
+    ]
+
+def test_lookup_tables_match_baseline():
+    assert_equal(574, len(rxname.names))
+    assert_equal(52, len(rxname.altnames))
+    assert_equal(517, len(rxname.mt_id))
+    for alt, n in BASELINE_ALTNAMES:
+        yield assert_equal, rxname.name(alt), n
+        yield assert_equal, rxname.id(alt), _hash(n)
+    for mt, n in BASELINE_MTS:
+        yield assert_equal, rxname.name(mt), n
+        yield assert_equal, rxname.mt(n), mt
+    for n in BASELINE_NAMES:
+        yield assert_equal, rxname.id(n), _hash(n)
+        yield assert_equal, rxname.name(long(_hash(n))), n
+
+def test_child_triplets():
+    nucs = [nucname.id(n) for n in ["U235", "U236", "U234", "Th232", "Pu239"]]
+    rxs = ["absorption", "z_2n", "a"]
+    t = rxname.child_triplets(nucs, rxs)
+    obs = set(zip(t['parents'], t['rxs'], t['children']))
+    exp = set()
+    for i, nuc in enumerate(nucs):
+        for rx in rxs:
+            child = rxname.child(nuc, rx)
+            if child in nucs:
+                exp.add((i, rxname.id(rx), nucs.index(child)))
+    assert_equal(obs, exp)
+    assert_in((0, rxname.id("a"), 3), obs)
+    assert_raises(RuntimeError, rxname.child_triplets, nucs, ["fission"])
+    assert_raises(RuntimeError, rxname.child_triplets, nucs, rxs, "x")
+
 
 if __name__ == "__main__":
     nose.runmodule()
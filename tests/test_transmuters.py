@@ -1,5 +1,7 @@
 """Transmuter tests"""
-from nose.tools import assert_equal, assert_almost_equal
+import numpy as np
+from nose.tools import assert_equal, assert_almost_equal, assert_raises, \
+    assert_true
 
 from pyne import data
 from pyne import cram
@@ -14,6 +16,146 @@ def test_transmuters_cram():
     assert_almost_equal(0.5, n1[nucname.id('H3')])
     assert_almost_equal(0.5, n1[nucname.id('He3')])
 
+def test_transmuters_cram_inplace():
+    idx = dict((nucname.id(nuc), i) for i, nuc in enumerate(cram.NUCS))
+    A = -cram.DECAY_MATRIX * data.half_life('H3')
+    n = np.zeros(cram.N)
+    n[idx[nucname.id('H3')]] = 1.0
+    transmuters.cram_inplace(A, n)
+    transmuters.cram_inplace(A, n, 16)
+    assert_almost_equal(0.25, n[idx[nucname.id('H3')]])
+    assert_almost_equal(0.75, n[idx[nucname.id('He3')]])
+    assert_raises(ValueError, transmuters.cram_inplace, A, n, 13)
+
+
+def test_transmuters_cram_adaptive():
+    assert_equal(6, transmuters.cram_adaptive_order(1e-5))
+    assert_equal(12, transmuters.cram_adaptive_order(1e-10))
+    assert_equal(18, transmuters.cram_adaptive_order(1e-20))
+    orders = [transmuters.cram_adaptive_order(tol)
+              for tol in (1e-4, 1e-8, 1e-12, 1e-16)]
+    assert_equal(sorted(orders), orders)
+    assert_equal(1e-10, transmuters.cram_adaptive_tol())
+    assert_raises(ValueError, transmuters.set_cram_adaptive_tol, 0.0)
+
+def test_transmuters_cram_adaptive_decay():
+    # the unscaled decay matrix does not need the highest order at the
+    # default tolerance
+    A = -cram.DECAY_MATRIX * data.half_life('H3')
+    order = transmuters.cram_adaptive_order()
+    assert_true(order < 18)
+    transmuters.reset_cram_adaptive_stats()
+    n1 = transmuters.cram(A, {'H3': 1.0}, order=transmuters.ADAPTIVE_ORDER)
+    assert_almost_equal(0.5, n1[nucname.id('H3')])
+    assert_almost_equal(0.5, n1[nucname.id('He3')])
+    stats = transmuters.cram_adaptive_stats()
+    assert_equal([6, 8, 10, 12, 14, 16, 18], [s['order'] for s in stats])
+    used = [s['order'] for s in stats if s['calls'] > 0]
+    assert_equal([order], used)
+    assert_equal(0, sum(s['escalations'] for s in stats))
+    exp = transmuters.cram(A, {'H3': 1.0}, order=order)
+    for nuc in exp:
+        assert_equal(exp[nuc], n1[nuc])
+    transmuters.reset_cram_adaptive_stats()
+    assert_equal(0, sum(s['calls'] for s in transmuters.cram_adaptive_stats()))
+
+def test_transmuters_cram_adaptive_tol():
+    A = -cram.DECAY_MATRIX * data.half_life('H3')
+    transmuters.set_cram_adaptive_tol(1e-4)
+    try:
+        transmuters.reset_cram_adaptive_stats()
+        n1 = transmuters.cram(A, {'H3': 1.0}, order=transmuters.ADAPTIVE_ORDER)
+        stats = transmuters.cram_adaptive_stats()
+    finally:
+        transmuters.set_cram_adaptive_tol(1e-10)
+    assert_almost_equal(0.5, n1[nucname.id('H3')], places=4)
+    # the lowest order maps to the pair 6 and 8, which returns order 8
+    assert_equal(6, transmuters.cram_adaptive_order(1e-4))
+    used = [s['order'] for s in stats if s['calls'] > 0]
+    assert_equal([8], used)
+
+def test_transmuters_cram_batch():
+    idx = dict((nucname.id(nuc), i) for i, nuc in enumerate(cram.NUCS))
+    h3, he3 = idx[nucname.id('H3')], idx[nucname.id('He3')]
+    A = -cram.DECAY_MATRIX * data.half_life('H3')
+    N0 = np.zeros((cram.N, 3))
+    N0[h3, 0] = 1.0
+    N0[h3, 1] = 2.0
+    N0[he3, 2] = 1.0
+    for order in (12, 14, 16, 18, transmuters.ADAPTIVE_ORDER):
+        N1 = transmuters.cram_batch(A, N0, order=order)
+        assert_almost_equal(0.5, N1[h3, 0])
+        assert_almost_equal(0.5, N1[he3, 0])
+        assert_almost_equal(1.0, N1[he3, 1])
+        assert_almost_equal(1.0, N1[he3, 2])
+        assert_almost_equal(0.0, N1[:, 2].sum() - 1.0)
+    # orders without pole tables match the single-composition solver
+    n = N0[:, 1].copy()
+    transmuters.cram_inplace(A, n, 12)
+    assert_equal(list(n), list(transmuters.cram_batch(A, N0, 12)[:, 1]))
+    assert_raises(ValueError, transmuters.cram_batch, A, N0, 13)
+    assert_raises(ValueError, transmuters.cram_batch, A, N0[:-1])
+
+
+def test_transmuters_cram_times():
+    idx = dict((nucname.id(nuc), i) for i, nuc in enumerate(cram.NUCS))
+    h3, he3 = idx[nucname.id('H3')], idx[nucname.id('He3')]
+    A = -cram.DECAY_MATRIX
+    n0 = np.zeros(cram.N)
+    n0[h3] = 1.0
+    hl = data.half_life('H3')
+    times = [2*hl, 0.0, hl, 3*hl, hl]
+    for order in (14, 16):
+        N = transmuters.cram_times(A, n0, times, order)
+        assert_equal((5, cram.N), N.shape)
+        for t, n in zip(times, N):
+            assert_almost_equal(0.5**(t / hl), n[h3])
+            assert_almost_equal(1.0 - 0.5**(t / hl), n[he3])
+    assert_raises(ValueError, transmuters.cram_times, A, n0, [-1.0])
+
+
+def test_transmuters_builder():
+    # with no flux the matrix is just decay
+    b = transmuters.TransmutationBuilder(['H3', 'H3'], ['U300', 'H3'], 2)
+    assert_equal(2, b.nchannels)
+    assert_equal(2, b.ngroups)
+    xs = np.array([[1.0, 2.0], [3.0, 4.0]])
+    A = b.assemble([0.0, 0.0], xs, t=10.0)
+    assert_almost_equal(0.0, np.abs(A + 10.0 * cram.DECAY_MATRIX).max())
+    # U300 is not in the matrix, so H3 -> U300 only removes H3
+    hl = data.half_life('H3')
+    A = b.assemble([1e24, 0.5e24], xs, t=hl)
+    idx = dict((nucname.id(nuc), i) for i, nuc in enumerate(cram.NUCS))
+    h3 = idx[nucname.id('H3')]
+    h3h3 = cram.IJ[h3, h3]
+    assert_almost_equal(-cram.DECAY_MATRIX[h3h3] - 2.0, A[h3h3] / hl)
+    assert_raises(ValueError, b.assemble, [1.0], xs)
+
+
+def test_transmuters_cram_many():
+    idx = dict((nucname.id(nuc), i) for i, nuc in enumerate(cram.NUCS))
+    h3, he3 = idx[nucname.id('H3')], idx[nucname.id('He3')]
+    A = -cram.DECAY_MATRIX * data.half_life('H3')
+    N0 = np.zeros((40, cram.N))
+    N0[:, h3] = np.arange(40)
+    # one shared matrix, with more materials than fit in a single block
+    N1 = transmuters.cram_many(A, N0, nthreads=3)
+    assert_equal(N0.shape, N1.shape)
+    assert_almost_equal(0.0, np.abs(N1[:, h3] - 0.5 * N0[:, h3]).max())
+    # a matrix per material, with each material decaying for twice as long
+    # as the one before
+    As = np.array([A * 2**m for m in range(4)])
+    N1 = transmuters.cram_many(As, N0[1:5], order=16, nthreads=2)
+    for m in range(4):
+        assert_almost_equal(0.5**(2**m) * N0[m+1, h3], N1[m, h3])
+    N1 = transmuters.cram_many(A, N0, nthreads=1)
+    assert_almost_equal(0.0, np.abs(transmuters.cram_batch(A, N0.T).T - N1).max())
+    assert_raises(ValueError, transmuters.cram_many, As, N0)
+    N1 = transmuters.cram_many(As, N0[1:5], order=10, nthreads=2)
+    for m in range(4):
+        assert_almost_equal(0.5**(2**m) * N0[m+1, h3], N1[m, h3])
+    assert_raises(ValueError, transmuters.cram_many, As, N0[1:5], 13, 2)
+
 
 # Run as script
 #